@@ -0,0 +1,99 @@
+#ifndef GHOST_WIDTH_VARIABLE_FILL_PATTERN_HPP
+#define GHOST_WIDTH_VARIABLE_FILL_PATTERN_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxContainer.h"
+#include "SAMRAI/hier/BoxGeometry.h"
+#include "SAMRAI/hier/BoxOverlap.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/PatchDataFactory.h"
+#include "SAMRAI/hier/Transformation.h"
+#include "SAMRAI/xfer/VariableFillPattern.h"
+
+#include "boost/shared_ptr.hpp"
+#include <string>
+
+using namespace SAMRAI;
+
+/*!
+ * @brief Class GhostWidthVariableFillPattern is a VariableFillPattern that restricts the filling
+ * of the ghost cells of a patch data to the cells within a given ghost cell width of the patch box.
+ *
+ * It is used by RungeKuttaLevelIntegrator to fill only the ghost cells read by the part of the
+ * right-hand side computed in the intermediate steps when the intermediate data has more ghost
+ * cells than that part needs.
+ */
+class GhostWidthVariableFillPattern:
+    public xfer::VariableFillPattern
+{
+    public:
+        /*!
+         * @brief Constructor.
+         *
+         * @param ghost_width Width of the ghost cells to fill.
+         */
+        explicit GhostWidthVariableFillPattern(
+            const hier::IntVector& ghost_width);
+        
+        /*!
+         * @brief Destructor.
+         */
+        ~GhostWidthVariableFillPattern();
+        
+        /*!
+         * @brief Calculate the overlap between the source and destination geometries, restricted
+         * to the cells within the ghost cell width of the destination patch box.
+         */
+        boost::shared_ptr<hier::BoxOverlap>
+        calculateOverlap(
+            const hier::BoxGeometry& dst_geometry,
+            const hier::BoxGeometry& src_geometry,
+            const hier::Box& dst_patch_box,
+            const hier::Box& src_mask,
+            const hier::Box& fill_box,
+            const bool overwrite_interior,
+            const hier::Transformation& transformation) const;
+        
+        /*!
+         * @brief Compute the overlap of the fill boxes and the data box, restricted to the cells
+         * within the ghost cell width of the patch box.
+         */
+        boost::shared_ptr<hier::BoxOverlap>
+        computeFillBoxesOverlap(
+            const hier::BoxContainer& fill_boxes,
+            const hier::BoxContainer& node_fill_boxes,
+            const hier::Box& patch_box,
+            const hier::Box& data_box,
+            const hier::PatchDataFactory& pdf) const;
+        
+        /*!
+         * @brief Return the ghost cell width to fill.
+         */
+        const hier::IntVector&
+        getStencilWidth();
+        
+        /*!
+         * @brief Return the name of the fill pattern.
+         */
+        const std::string&
+        getPatternName() const
+        {
+            return s_name_id;
+        }
+        
+    private:
+        /*
+         * Width of the ghost cells to fill.
+         */
+        const hier::IntVector d_ghost_width;
+        
+        /*
+         * Name of the fill pattern.
+         */
+        static const std::string s_name_id;
+        
+};
+
+#endif /* GHOST_WIDTH_VARIABLE_FILL_PATTERN_HPP */
@@ -17,6 +17,7 @@
 #include "HAMeRS_config.hpp"
 
 #include "algs/integrator/ExtendedTagAndInitialize.hpp"
+#include "algs/integrator/GhostWidthVariableFillPattern.hpp"
 #include "algs/patch_strategy/RungeKuttaPatchStrategy.hpp"
 
 #include "SAMRAI/algs/TimeRefinementLevelStrategy.h"
@@ -31,6 +32,7 @@
 #include "SAMRAI/xfer/CoarsenAlgorithm.h"
 #include "SAMRAI/xfer/RefineAlgorithm.h"
 #include "SAMRAI/xfer/RefineSchedule.h"
+#include "SAMRAI/xfer/VariableFillPattern.h"
 
 #define HLI_RECORD_STATS
 // #undef DGA_RECORD_STATS
@@ -1007,6 +1009,184 @@ class RungeKuttaLevelIntegrator:
             const hier::PatchLevel& patch_level,
             double current_time);
         
+        /*
+         * Get the stable time increment on a patch. When the diffusive part of the right-hand side
+         * is advanced with super-time-stepping or implicitly, only the convective part limits the
+         * time increment.
+         */
+        double
+        getStableDtOnPatch(
+            hier::Patch& patch,
+            const bool initial_time,
+            const double dt_time);
+        
+        /*
+         * Get the stable time increment of the diffusive part of the right-hand side on a level.
+         */
+        double
+        getLevelStableDiffusiveDt(
+            const boost::shared_ptr<hier::PatchLevel>& level,
+            const double dt_time);
+        
+        /*
+         * Get the number of stages of the second-order Runge-Kutta-Legendre super-time-stepping
+         * (RKL2) needed to advance the diffusive part of the right-hand side over the time increment
+         * dt with the stable time increment dt_diffusive.
+         */
+        int
+        getNumberOfSuperTimeSteppingStages(
+            const double dt,
+            const double dt_diffusive) const;
+        
+        /*
+         * Get the fill pattern restricting the ghosts of the intermediate data filled to the width
+         * read by a part of the right-hand side. A null pointer is returned when all the ghosts of the
+         * intermediate data are read.
+         */
+        boost::shared_ptr<xfer::VariableFillPattern>
+        getIntermediateVariableFillPattern(
+            const RHS_OPERATOR::TYPE& rhs_operator,
+            const hier::IntVector& ghosts_intermediate) const;
+        
+        /*
+         * Advance the scratch data on a level with the diffusive part of the right-hand side only,
+         * using the second-order Runge-Kutta-Legendre super-time-stepping (RKL2) with num_stages
+         * stages. The time integrals of the diffusive fluxes are accumulated in the scratch fluxes.
+         */
+        void
+        advanceLevelDiffusionWithSuperTimeStepping(
+            const boost::shared_ptr<hier::PatchLevel>& level,
+            const double current_time,
+            const double dt,
+            const int num_stages,
+            const bool regrid_advance);
+        
+        /*
+         * Advance the scratch data on a level with the diffusive part of the right-hand side only,
+         * using the two-stage, second-order and L-stable singly diagonally implicit Runge-Kutta
+         * scheme (SDIRK2). The implicit stages are solved with a Jacobian-free Newton-Krylov
+         * method. The time integrals of the diffusive fluxes are accumulated in the scratch fluxes.
+         */
+        void
+        advanceLevelDiffusionImplicitly(
+            const boost::shared_ptr<hier::PatchLevel>& level,
+            const double current_time,
+            const double dt,
+            const bool regrid_advance);
+        
+        /*
+         * Solve the implicit stage Y = R + a*dt*L(Y) of the diffusive part of the right-hand side
+         * with Newton iterations, where R is stored in the right-hand side work context. The state
+         * of the stage is stored in the intermediate context with index state_idx and dt*L(Y) is
+         * stored in the operator work context on return.
+         */
+        void
+        solveImplicitDiffusionStage(
+            const boost::shared_ptr<hier::PatchLevel>& level,
+            const double current_time,
+            const double dt,
+            const double a,
+            const int state_idx,
+            const std::vector<boost::shared_ptr<xfer::RefineSchedule> >& fill_schedules,
+            const bool regrid_advance);
+        
+        /*
+         * Solve the linear system of a Newton iteration of an implicit stage with the matrix-free
+         * BiCGSTAB method. The right-hand side is the residual work context and the solution is
+         * stored in the solution work context.
+         */
+        void
+        solveImplicitDiffusionLinearSystem(
+            const boost::shared_ptr<hier::PatchLevel>& level,
+            const double current_time,
+            const double dt,
+            const double a,
+            const int state_idx,
+            const double norm_state,
+            const std::vector<boost::shared_ptr<xfer::RefineSchedule> >& fill_schedules,
+            const bool regrid_advance);
+        
+        /*
+         * Compute dt*L(Y) of the diffusive part of the right-hand side into the scratch data, where
+         * Y is the scratch data. Y is copied into the intermediate context with index state_idx and
+         * its ghost cells are filled before the fluxes are computed.
+         */
+        void
+        computeImplicitDiffusionOperator(
+            const boost::shared_ptr<hier::PatchLevel>& level,
+            const double current_time,
+            const double dt,
+            const int state_idx,
+            const boost::shared_ptr<xfer::RefineSchedule>& fill_schedule,
+            const bool regrid_advance);
+        
+        /*
+         * Apply the Jacobian (I - a*dt*dL/dY) of an implicit stage to the data of src_context with
+         * a finite difference of the diffusive part of the right-hand side around the state in the
+         * intermediate context with index state_idx, and store the result in dst_context.
+         */
+        void
+        applyImplicitDiffusionJacobian(
+            const boost::shared_ptr<hier::PatchLevel>& level,
+            const double current_time,
+            const double dt,
+            const double a,
+            const int state_idx,
+            const double norm_state,
+            const std::vector<boost::shared_ptr<xfer::RefineSchedule> >& fill_schedules,
+            const boost::shared_ptr<hier::VariableContext>& src_context,
+            const boost::shared_ptr<hier::VariableContext>& dst_context,
+            const bool regrid_advance);
+        
+        /*
+         * Advance a single step on a patch with the patch strategy. If the fluxes and sources of the
+         * step are the first accumulated in the advance of the level, the accumulators are
+         * overwritten with the contribution of the first intermediate context instead of being
+         * zero-filled beforehand.
+         */
+        void
+        advanceSingleStepOnPatchAndAccumulateFluxes(
+            hier::Patch& patch,
+            const double time,
+            const double dt,
+            const std::vector<double>& alpha,
+            const std::vector<double>& beta,
+            const std::vector<double>& gamma,
+            const std::vector<boost::shared_ptr<hier::VariableContext> >& intermediate_context);
+        
+        /*
+         * Initialize the FLUX and SOURCE data of the scratch context on a patch to gamma times the
+         * data of a context. The data is set to zero if gamma is zero.
+         */
+        void
+        initializeFluxAndSourceAccumulatorsOnPatch(
+            hier::Patch& patch,
+            const double gamma,
+            const boost::shared_ptr<hier::VariableContext>& context);
+        
+        /*
+         * Compute dst = a*src_1 + b*src_2 on the interiors of the patches of a level for all
+         * TIME_DEP variables. src_2 is not used if b is zero.
+         */
+        void
+        computeLevelLinearSum(
+            const boost::shared_ptr<hier::PatchLevel>& level,
+            const boost::shared_ptr<hier::VariableContext>& dst_context,
+            const double a,
+            const boost::shared_ptr<hier::VariableContext>& src_context_1,
+            const double b,
+            const boost::shared_ptr<hier::VariableContext>& src_context_2);
+        
+        /*
+         * Compute the dot product of the data of two contexts on the interiors of the patches of a
+         * level for all TIME_DEP variables.
+         */
+        double
+        computeLevelDotProduct(
+            const boost::shared_ptr<hier::PatchLevel>& level,
+            const boost::shared_ptr<hier::VariableContext>& context_1,
+            const boost::shared_ptr<hier::VariableContext>& context_2);
+        
         /*
          * The patch strategy supplies the application-specific operations needed to treat data on
          * patches in the AMR hierarchy.
@@ -1056,6 +1236,31 @@ class RungeKuttaLevelIntegrator:
          */
         double d_dt;
         
+        /*
+         * Whether the diffusive part of the right-hand side is advanced with the second-order
+         * Runge-Kutta-Legendre super-time-stepping (RKL2), Strang-split with the Runge-Kutta steps of
+         * the convective part. If true, the time increment is limited by the convective part only.
+         */
+        bool d_use_super_time_stepping;
+        
+        /*
+         * Whether the diffusive part of the right-hand side is advanced implicitly, Strang-split
+         * with the Runge-Kutta steps of the convective part, and the parameters of the Newton and
+         * Krylov iterations. If true, the time increment is limited by the convective part only.
+         */
+        bool d_use_implicit_diffusion;
+        int d_implicit_diffusion_max_newton_iterations;
+        double d_implicit_diffusion_newton_tolerance;
+        int d_implicit_diffusion_max_krylov_iterations;
+        double d_implicit_diffusion_krylov_tolerance;
+        
+        /*
+         * Whether the scratch and intermediate data used in advancing a level is kept allocated
+         * between the advances of the level instead of being allocated and deallocated in every
+         * advance. The data is freed when the level is regridded.
+         */
+        bool d_keep_advance_data_allocated;
+        
         /*
          * Number of steps of the Runge-Kutta method, and matrices of alpha, beta, and gamma values
          * used in updating solution during multi-step process.
@@ -1065,6 +1270,12 @@ class RungeKuttaLevelIntegrator:
         std::vector<std::vector<double> > d_beta;
         std::vector<std::vector<double> > d_gamma;
         
+        /*
+         * Number of intermediate contexts, which is larger than the number of steps of the
+         * Runge-Kutta method when the super-time-stepping needs more.
+         */
+        int d_number_intermediate_contexts;
+        
         /*
          * Boolean flags for indicating whether face or side data types are used for fluxes (choice
          * is determined by numerical routines in Runge-Kutta patch model).
@@ -1073,6 +1284,13 @@ class RungeKuttaLevelIntegrator:
         bool d_flux_face_registered;
         bool d_flux_side_registered;
         
+        /*
+         * Whether the FLUX and SOURCE data of the scratch context, in which the fluxes and sources
+         * of the steps are accumulated, still has to be initialized in the current advance of the
+         * level.
+         */
+        bool d_initialize_flux_and_source_accumulators;
+        
         /*
          * The following communication algorithms and schedules are created and maintained to manage
          * inter-patch communication during AMR integration. The algorithms are created in the class
@@ -1112,7 +1330,17 @@ class RungeKuttaLevelIntegrator:
          */
         boost::shared_ptr<xfer::RefineAlgorithm> d_bdry_fill_advance_old;
         
+        /*
+         * The "intermediate" algorithms are used to fill ghosts of the intermediate data from the
+         * scratch data. The ghosts filled are restricted to the width read by the part of the
+         * right-hand side computed with the intermediate data: all parts, the convective part only
+         * (Runge-Kutta steps when the diffusive part is split) or the diffusive part only (super-
+         * time-stepping and implicit steps of the diffusive part). The convective and diffusive
+         * algorithms are only set up when the diffusive part is split.
+         */
         std::vector<boost::shared_ptr<xfer::RefineAlgorithm> > d_bdry_fill_intermediate;
+        std::vector<boost::shared_ptr<xfer::RefineAlgorithm> > d_bdry_fill_intermediate_convective;
+        std::vector<boost::shared_ptr<xfer::RefineAlgorithm> > d_bdry_fill_intermediate_diffusive;
         
         /*
          * Coarsen algorithms for conservative data synchronization (e.g., flux correction or
@@ -1219,6 +1447,23 @@ class RungeKuttaLevelIntegrator:
          */
         std::vector<hier::ComponentSelector> d_intermediate_source_var_data;
         
+        /*
+         * Work contexts and descriptor indices of TIME_DEP variables used by the Newton and Krylov
+         * iterations of the implicit diffusion.
+         */
+        enum IMPLICIT_DIFFUSION_WORK { WORK_RHS                = 0,
+                                       WORK_OPERATOR           = 1,
+                                       WORK_SOLUTION           = 2,
+                                       WORK_RESIDUAL           = 3,
+                                       WORK_SHADOW_RESIDUAL    = 4,
+                                       WORK_SEARCH_DIRECTION   = 5,
+                                       WORK_JACOBIAN_DIRECTION = 6,
+                                       WORK_JACOBIAN_RESIDUAL  = 7,
+                                       NUM_WORK_CONTEXTS       = 8};
+        
+        std::vector<boost::shared_ptr<hier::VariableContext> > d_implicit_diffusion_work;
+        hier::ComponentSelector d_implicit_diffusion_work_data;
+        
         /*
          * OLD descriptor indices for TIME_DEP variables. Note that these are used only when three
          * time levels of data are used.
@@ -29,6 +29,16 @@
 
 class RungeKuttaLevelIntegrator;
 
+/*
+ * Parts of the right-hand side computed by RungeKuttaPatchStrategy::computeFluxesAndSourcesOnPatch().
+ */
+namespace RHS_OPERATOR
+{
+    enum TYPE { ALL,
+                CONVECTIVE,
+                DIFFUSIVE };
+}
+
 /**
  * Class RungeKuttaPatchStrategy is an abstract base class defining the interface between an
  * RungeKuttaLevelIntegrator object and operations applied to a single patch in a structured AMR
@@ -126,6 +136,47 @@ class RungeKuttaPatchStrategy:
             const bool initial_time,
             const double dt_time) = 0;
         
+        /**
+         * Compute the stable time increments of the convective and the diffusive parts of the right-
+         * hand side separately for a patch. This routine is used instead of computeStableDtOnPatch()
+         * when the diffusive part is split from the convective part in the level integrator.
+         *
+         * Note that this function is not pure virtual. It is given a dummy implementation here so
+         * that users may ignore it when the splitting of the right-hand side is not used.
+         */
+        virtual void
+        computeStableDtsOnPatch(
+            hier::Patch& patch,
+            const bool initial_time,
+            const double dt_time,
+            double& stable_dt_convective,
+            double& stable_dt_diffusive);
+        
+        /**
+         * Set the part of the right-hand side computed by computeFluxesAndSourcesOnPatch(). The
+         * fluxes and sources of the other parts are set to zero. By default, all parts are computed.
+         *
+         * Note that this function is not pure virtual. It is given a dummy implementation here so
+         * that users may ignore it when the splitting of the right-hand side is not used.
+         */
+        virtual void
+        setRightHandSideOperator(
+            const RHS_OPERATOR::TYPE& rhs_operator);
+        
+        /**
+         * Get the number of ghost cells of the time-dependent variables read by the computation of
+         * a part of the right-hand side in computeFluxesAndSourcesOnPatch(). The level integrator
+         * only fills this width of the intermediate data in the steps computing this part. A
+         * negative width means that all the ghost cells of the intermediate data are filled.
+         *
+         * Note that this function is not pure virtual. It is given a dummy implementation here that
+         * returns a negative width so that users may ignore it.
+         */
+        virtual hier::IntVector
+        getRightHandSideOperatorNumberOfGhostCells(
+            const tbox::Dimension& dim,
+            const RHS_OPERATOR::TYPE& rhs_operator) const;
+        
         /**
          * Compute TIME INTEGRALS of fluxes to be used in finite difference for patch integration.
          * That is, it is assumed that this numerical routine will compute the fluxes corresponding
@@ -559,6 +610,21 @@ class RungeKuttaPatchStrategy:
             const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
             const double output_time);
         
+        /**
+         * Reset the cached patch-dependent data (e.g., the boundary fill plans) of the levels in
+         * the range of levels after the configuration of the hierarchy has changed. This function
+         * is called from the resetHierarchyConfiguration() function of the Runge-Kutta level
+         * integrator.
+         *
+         * Note that this function is not pure virtual. It is given a dummy implementation here so
+         * that users may ignore it when inheriting from this class.
+         */
+        virtual void
+        resetHierarchyConfiguration(
+            const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
+            const int coarsest_level,
+            const int finest_level);
+        
         
         /**
          * Return pointer to patch data context.
@@ -355,6 +355,16 @@ class Euler:
         
         //@}
         
+        /**
+         * Drop the cached data of the special boundary conditions of the patches on the levels in
+         * the range of levels after the configuration of the hierarchy has changed.
+         */
+        void
+        resetHierarchyConfiguration(
+            const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
+            const int coarsest_level,
+            const int finest_level);
+        
         /**
          * Write state of Euler object to the given database for restart.
          *
@@ -580,6 +590,7 @@ class Euler:
         static boost::shared_ptr<tbox::Timer> t_advance_step;
         static boost::shared_ptr<tbox::Timer> t_synchronize_fluxes;
         static boost::shared_ptr<tbox::Timer> t_setphysbcs;
+        static boost::shared_ptr<tbox::Timer> t_reset_hierarchy_config;
         static boost::shared_ptr<tbox::Timer> t_tagvalue;
         static boost::shared_ptr<tbox::Timer> t_taggradient;
         static boost::shared_ptr<tbox::Timer> t_tagmultiresolution;
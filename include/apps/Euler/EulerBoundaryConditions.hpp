@@ -9,6 +9,8 @@
 #include "util/basic_boundary_conditions/BoundaryUtilityStrategy.hpp"
 #include "util/basic_boundary_conditions/CartesianBoundaryDefines.hpp"
 
+#include "SAMRAI/hier/PatchHierarchy.h"
+
 #include "boost/shared_ptr.hpp"
 #include <map>
 #include <string>
@@ -83,6 +85,16 @@ class EulerBoundaryConditions:
             const hier::IntVector& ghost_width_to_fill,
             const boost::shared_ptr<hier::VariableContext>& data_context);
         
+        /*
+         * Drop the cached data of the special boundary conditions of the patches on the levels in
+         * the range of levels after the configuration of the hierarchy has changed.
+         */
+        void
+        resetSpecialBoundaryConditionsCache(
+            const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
+            const int coarsest_level,
+            const int finest_level);
+        
     private:
         std::vector<double>
         readPrimitiveDataEntry(
@@ -15,6 +15,7 @@
 #include "flow/refinement_taggers/GradientTagger.hpp"
 #include "flow/refinement_taggers/MultiresolutionTagger.hpp"
 #include "flow/refinement_taggers/ValueTagger.hpp"
+#include "util/patch_tiles/PatchTiles.hpp"
 
 #include "SAMRAI/appu/VisDerivedDataStrategy.h"
 // #include "SAMRAI/appu/VisItDataWriter.h"
@@ -121,6 +122,34 @@ class NavierStokes:
             const bool initial_time,
             const double dt_time);
         
+        /**
+         * Compute the stable time increments of the convective and the diffusive parts of the right-
+         * hand side separately for patch using a CFL condition.
+         */
+        void
+        computeStableDtsOnPatch(
+            hier::Patch& patch,
+            const bool initial_time,
+            const double dt_time,
+            double& stable_dt_convective,
+            double& stable_dt_diffusive);
+        
+        /**
+         * Set the part of the right-hand side computed by computeFluxesAndSourcesOnPatch().
+         */
+        void
+        setRightHandSideOperator(
+            const RHS_OPERATOR::TYPE& rhs_operator);
+        
+        /**
+         * Get the number of ghost cells of the conservative variables read by the computation of a
+         * part of the right-hand side in computeFluxesAndSourcesOnPatch().
+         */
+        hier::IntVector
+        getRightHandSideOperatorNumberOfGhostCells(
+            const tbox::Dimension& dim,
+            const RHS_OPERATOR::TYPE& rhs_operator) const;
+        
         /**
          * Compute time integral of convective fluxes to be used in finite difference for patch Runge-
          * Kutta integration.
@@ -358,6 +387,16 @@ class NavierStokes:
         
         //@}
         
+        /**
+         * Rebuild the boundary fill plans of the patches on the levels in the range of levels after
+         * the configuration of the hierarchy has changed.
+         */
+        void
+        resetHierarchyConfiguration(
+            const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
+            const int coarsest_level,
+            const int finest_level);
+        
         /**
          * Write state of NavierStokes object to the given database for restart.
          *
@@ -454,6 +493,43 @@ class NavierStokes:
         
         void getFromRestart();
         
+        /*
+         * Compute the fluxes and sources of the convective and the diffusive parts of the
+         * right-hand side on a patch, or on a tile of a patch, in one pass.
+         */
+        void
+        computeFluxesAndSourcesOnSinglePatch(
+            hier::Patch& patch,
+            const double time,
+            const double dt,
+            const int RK_step_number,
+            const boost::shared_ptr<hier::VariableContext>& data_context);
+        
+        /*
+         * Compute the fluxes and sources of the convective and the diffusive parts of the
+         * right-hand side on a patch tile by tile. The conservative variables are copied into each
+         * tile and the fluxes and sources computed on the tile are copied back to the patch. The
+         * data of the tiles are allocated once per tile shape and reused.
+         */
+        void
+        computeFluxesAndSourcesOnTiles(
+            hier::Patch& patch,
+            const hier::IntVector& tile_size,
+            const double time,
+            const double dt,
+            const int RK_step_number,
+            const boost::shared_ptr<hier::VariableContext>& data_context);
+        
+        /*
+         * Compute the spectral radii of the convective and the diffusive parts of the right-hand side
+         * on a patch, which are the inverses of their stable time increments.
+         */
+        void
+        computeStableSpectralRadiiOnPatch(
+            hier::Patch& patch,
+            double& spectral_radius_convective,
+            double& spectral_radius_diffusive);
+        
         /*
          * The object name is used for error/warning reporting.
          */
@@ -529,6 +605,12 @@ class NavierStokes:
         boost::shared_ptr<ConvectiveFluxReconstructor> d_convective_flux_reconstructor;
         boost::shared_ptr<tbox::Database> d_convective_flux_reconstructor_db;
         
+        /*
+         * Tiles on which the right-hand side is computed if the convective flux reconstructor
+         * processes the patches tile by tile. Their data are reused for all tiles of the same shape.
+         */
+        PatchTiles d_patch_tiles;
+        
         /*
          * boost::shared_ptr to the DiffusiveFluxReconstructor and its database.
          */
@@ -559,6 +641,11 @@ class NavierStokes:
         boost::shared_ptr<tbox::Database> d_Navier_Stokes_boundary_conditions_db;
         bool d_Navier_Stokes_boundary_conditions_db_is_from_restart;
         
+        /*
+         * Part of the right-hand side computed by computeFluxesAndSourcesOnPatch().
+         */
+        RHS_OPERATOR::TYPE d_rhs_operator;
+        
         /*
          * boost::shared_ptr to ValueTagger and its database.
          */
@@ -632,6 +719,7 @@ class NavierStokes:
         static boost::shared_ptr<tbox::Timer> t_advance_step;
         static boost::shared_ptr<tbox::Timer> t_synchronize_fluxes;
         static boost::shared_ptr<tbox::Timer> t_setphysbcs;
+        static boost::shared_ptr<tbox::Timer> t_reset_hierarchy_config;
         static boost::shared_ptr<tbox::Timer> t_tagvalue;
         static boost::shared_ptr<tbox::Timer> t_taggradient;
         static boost::shared_ptr<tbox::Timer> t_tagmultiresolution;
@@ -6,9 +6,13 @@
 #include "flow/flow_models/FlowModels.hpp"
 #include "apps/Navier-Stokes/NavierStokesSpecialBoundaryConditions.hpp"
 #include "util/basic_boundary_conditions/BasicBoundaryConditions.hpp"
+#include "util/basic_boundary_conditions/BoundaryFillPlan.hpp"
 #include "util/basic_boundary_conditions/BoundaryUtilityStrategy.hpp"
 #include "util/basic_boundary_conditions/CartesianBoundaryDefines.hpp"
 
+#include "SAMRAI/hier/BoxId.h"
+#include "SAMRAI/hier/PatchHierarchy.h"
+
 #include "boost/shared_ptr.hpp"
 #include <map>
 #include <string>
@@ -83,6 +87,17 @@ class NavierStokesBoundaryConditions:
             const hier::IntVector& ghost_width_to_fill,
             const boost::shared_ptr<hier::VariableContext>& data_context);
         
+        /*
+         * Rebuild the boundary fill plans of the patches touching the physical boundaries on the
+         * levels in the range of levels after the configuration of the hierarchy has changed. The
+         * cached data of the special boundary conditions of these levels is dropped as well.
+         */
+        void
+        resetBoundaryFillPlans(
+            const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
+            const int coarsest_level,
+            const int finest_level);
+        
     private:
         std::vector<double>
         readPrimitiveDataEntry(
@@ -96,6 +111,14 @@ class NavierStokesBoundaryConditions:
         void
         setDefaultBoundaryConditions();
         
+        /*
+         * Get the cached boundary fill plan of a patch. A null pointer is returned if no plan is
+         * cached for the patch or if the cached plan is stale.
+         */
+        boost::shared_ptr<BoundaryFillPlan>
+        getBoundaryFillPlan(
+            const hier::Patch& patch) const;
+        
         /*
          * The object name is used for error/warning reporting.
          */
@@ -153,6 +176,15 @@ class NavierStokesBoundaryConditions:
         std::vector<int> d_edge_bdry_face; // Used in 3D only.
         std::vector<int> d_node_bdry_face; // Used in 3D only.
         
+        /*
+         * Boundary condition cases of each conservative variable, i.e. the scalar or vector
+         * boundary condition cases depending on the type of the variable. These are passed to the
+         * boundary routines that fill all the conservative variables in one pass.
+         */
+        std::vector<std::vector<int> > d_conservative_var_bdry_node_conds; // Used in 2D and 3D only.
+        std::vector<std::vector<int> > d_conservative_var_bdry_edge_conds; // Used in 2D and 3D only.
+        std::vector<std::vector<int> > d_conservative_var_bdry_face_conds; // Used in 3D only.
+        
         /*
          * Vectors of node (1D), edge (2D) or face (3D) boundary values for DIRICHLET case.
          */
@@ -165,6 +197,12 @@ class NavierStokesBoundaryConditions:
          */
         boost::shared_ptr<NavierStokesSpecialBoundaryConditions> d_Navier_Stokes_special_boundary_conditions;
         
+        /*
+         * Boundary fill plans of the patches touching the physical boundaries for each level,
+         * indexed by the box IDs of the patches.
+         */
+        std::vector<std::map<hier::BoxId, boost::shared_ptr<BoundaryFillPlan> > > d_bdry_fill_plans;
+        
 };
 
 #endif /* NAVIER_STOKES_BOUNDARY_CONDITIONS_HPP */
@@ -4,6 +4,7 @@
 #include "HAMeRS_config.hpp"
 
 #include "flow/flow_models/FlowModels.hpp"
+#include "util/basic_boundary_conditions/SpecialBoundaryConditionsCache.hpp"
 
 #include "SAMRAI/geom/CartesianGridGeometry.h"
 #include "SAMRAI/geom/CartesianPatchGeometry.h"
@@ -47,6 +48,18 @@ class NavierStokesSpecialBoundaryConditions
             const double fill_time,
             const hier::IntVector& ghost_width_to_fill);
         
+        /*
+         * Drop the cached time-independent data of the special boundary conditions of the patches
+         * on the levels in the range of levels after the configuration of the hierarchy has changed.
+         */
+        void
+        resetCache(
+            const int coarsest_level,
+            const int finest_level)
+        {
+            d_cache.resetLevels(coarsest_level, finest_level);
+        }
+        
     private:
         /*
          * The object name is used for error/warning reporting.
@@ -78,6 +91,12 @@ class NavierStokesSpecialBoundaryConditions
          */
         const boost::shared_ptr<FlowModel> d_flow_model;
         
+        /*
+         * Cache of the index masks and time-independent coefficients of the special boundary
+         * conditions of the patches.
+         */
+        SpecialBoundaryConditionsCache d_cache;
+        
 };
 
 #endif /* NAVIER_STOKES_SPECIAL_BOUNDARY_CONDITIONS_HPP */
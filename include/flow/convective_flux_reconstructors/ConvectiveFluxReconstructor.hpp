@@ -6,6 +6,7 @@
 #include "flow/flow_models/FlowModels.hpp"
 
 #include "SAMRAI/geom/CartesianGridGeometry.h"
+#include "SAMRAI/hier/Box.h"
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/Patch.h"
 #include "SAMRAI/pdat/CellVariable.h"
@@ -64,6 +65,18 @@ class ConvectiveFluxReconstructor
         putToRestart(
             const boost::shared_ptr<tbox::Database>& restart_db) const = 0;
         
+        /*
+         * Register the variables that the convective flux reconstruction class keeps in the patches
+         * with the integrator so that their data are allocated and deallocated together with the
+         * other data of the levels.
+         */
+        virtual void
+        registerConvectiveFluxReconstructorVariables(
+            RungeKuttaLevelIntegrator* integrator)
+        {
+            NULL_USE(integrator);
+        }
+        
         /*
          * Compute the convective flux and source due to splitting of convective term on a patch.
          */
@@ -76,6 +89,82 @@ class ConvectiveFluxReconstructor
             const double time,
             const double dt,
             const int RK_step_number) = 0;
+        
+        /*
+         * Register the derived cell variables required by the convective flux and source in the
+         * patch registered in the flow model. This allows a caller to register the patch once for
+         * several operators and to compute the shared derived cell data only once.
+         */
+        virtual void
+        registerDerivedVariablesForConvectiveFluxAndSource(
+            const hier::Patch& patch) = 0;
+        
+        /*
+         * Get the number of cells of each tile if the patches are processed tile by tile. Zero is
+         * returned if the patches are processed at once. A caller that registers the patch in the
+         * flow model itself runs the reconstruction on the tiles itself.
+         */
+        virtual hier::IntVector
+        getTileSize() const
+        {
+            return hier::IntVector::getZero(d_dim);
+        }
+        
+        /*
+         * Get the indices of the patch data kept in a patch by the reconstructor between the
+         * Runge-Kutta stages (e.g. a frozen shock sensor), which are also needed on the tiles of the
+         * patch.
+         */
+        virtual std::vector<int>
+        getTileDataIndices() const
+        {
+            return std::vector<int>();
+        }
+        
+        /*
+         * Copy the data kept in a patch by the reconstructor between the Runge-Kutta stages into a
+         * tile of the patch for the given tile box before the convective flux and source are
+         * computed on the tile.
+         */
+        virtual void
+        copyPatchDataToTile(
+            hier::Patch& tile,
+            const hier::Patch& patch,
+            const hier::Box& tile_box,
+            const int RK_step_number)
+        {
+            NULL_USE(tile);
+            NULL_USE(patch);
+            NULL_USE(tile_box);
+            NULL_USE(RK_step_number);
+        }
+        
+        /*
+         * Copy the data kept in a patch by the reconstructor between the Runge-Kutta stages from a
+         * tile of the patch for the given tile box back into the patch after the convective flux and
+         * source are computed on the tile.
+         */
+        virtual void
+        copyTileDataToPatch(
+            hier::Patch& patch,
+            const hier::Patch& tile,
+            const hier::Box& tile_box,
+            const int RK_step_number)
+        {
+            NULL_USE(patch);
+            NULL_USE(tile);
+            NULL_USE(tile_box);
+            NULL_USE(RK_step_number);
+        }
+        
+        /*
+         * Print the statistics of the convective flux reconstruction gathered since the last call.
+         */
+        virtual void
+        printStatistics(std::ostream& os)
+        {
+            NULL_USE(os);
+        }
     
     protected:
         /*
@@ -38,7 +38,8 @@ class ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL: public ConvectiveFluxReconstr
         performWENOInterpolation(
             std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_minus,
             std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_plus,
-            const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables);
+            const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables,
+            const std::vector<std::vector<int> >& WENO_row_flags);
         
         /*
          * Constant used by the scheme.
@@ -4,6 +4,7 @@
 #include "flow/convective_flux_reconstructors/ConvectiveFluxReconstructor.hpp"
 #include "util/derivatives/DerivativeFirstOrder.hpp"
 #include "util/Directions.hpp"
+#include "util/patch_tiles/PatchTiles.hpp"
 
 #include "boost/multi_array.hpp"
 
@@ -34,6 +35,13 @@ class ConvectiveFluxReconstructorWCNS56: public ConvectiveFluxReconstructor
         putToRestart(
             const boost::shared_ptr<tbox::Database>& restart_db) const = 0;
         
+        /*
+         * Register the frozen shock sensor with the integrator as temporary data.
+         */
+        void
+        registerConvectiveFluxReconstructorVariables(
+            RungeKuttaLevelIntegrator* integrator);
+        
         /*
          * Compute the convective flux and source due to splitting of convective term on a patch.
          */
@@ -47,15 +55,145 @@ class ConvectiveFluxReconstructorWCNS56: public ConvectiveFluxReconstructor
             const double dt,
             const int RK_step_number);
         
+        /*
+         * Register the derived cell variables required by the convective flux and source in the
+         * patch registered in the flow model.
+         */
+        void
+        registerDerivedVariablesForConvectiveFluxAndSource(
+            const hier::Patch& patch);
+        
+        /*
+         * Get the number of cells of each tile if the patches are processed tile by tile.
+         */
+        hier::IntVector
+        getTileSize() const;
+        
+        /*
+         * Get the index of the patch data of the frozen shock sensor, which is also needed on the
+         * tiles of the patches.
+         */
+        std::vector<int>
+        getTileDataIndices() const;
+        
+        /*
+         * Copy the frozen shock sensor of a patch into a tile of the patch at the Runge-Kutta stages
+         * after the first one.
+         */
+        void
+        copyPatchDataToTile(
+            hier::Patch& tile,
+            const hier::Patch& patch,
+            const hier::Box& tile_box,
+            const int RK_step_number);
+        
+        /*
+         * Copy the frozen shock sensor computed on a tile of a patch back into the patch at the first
+         * Runge-Kutta stage.
+         */
+        void
+        copyTileDataToPatch(
+            hier::Patch& patch,
+            const hier::Patch& tile,
+            const hier::Box& tile_box,
+            const int RK_step_number);
+        
+        /*
+         * Print the fraction of faces flagged by the shock sensor for the hybrid central/WCNS
+         * interpolation since the last call and reset the counters.
+         */
+        void
+        printStatistics(std::ostream& os);
+        
     protected:
         /*
-         * Perform WENO interpolation.
+         * Compute the convective flux and source due to splitting of convective term on the whole
+         * patch in one pass.
+         */
+        void
+        computeConvectiveFluxAndSourceOnSinglePatch(
+            hier::Patch& patch,
+            const boost::shared_ptr<pdat::SideVariable<double> >& variable_convective_flux,
+            const boost::shared_ptr<pdat::CellVariable<double> >& variable_source,
+            const boost::shared_ptr<hier::VariableContext>& data_context,
+            const double time,
+            const double dt,
+            const int RK_step_number);
+        
+        /*
+         * Compute the convective flux and source due to splitting of convective term on a patch
+         * tile by tile. The whole reconstruction pipeline is executed on each tile so that the
+         * intermediate data of the tile stays in cache between the stages. The data of the tiles are
+         * allocated once per tile shape and reused.
+         */
+        void
+        computeConvectiveFluxAndSourceOnTiles(
+            hier::Patch& patch,
+            const boost::shared_ptr<pdat::SideVariable<double> >& variable_convective_flux,
+            const boost::shared_ptr<pdat::CellVariable<double> >& variable_source,
+            const boost::shared_ptr<hier::VariableContext>& data_context,
+            const double time,
+            const double dt,
+            const int RK_step_number);
+        
+        /*
+         * Count the faces flagged by the shock sensor for the hybrid central/WCNS interpolation and
+         * flag the rows of faces that contain any flagged face for the WENO interpolation. Return
+         * whether any face used by the flux reconstruction on the patch is flagged.
+         */
+        bool
+        countFacesFlaggedByShockSensor(
+            std::vector<std::vector<int> >& WENO_row_flags,
+            const boost::shared_ptr<pdat::SideData<double> >& shock_sensor,
+            const hier::IntVector& interior_dims);
+        
+        /*
+         * Zero the faces in the rows of faces skipped by the WENO interpolation, which are the rows
+         * whose flags in WENO_row_flags are zero.
+         */
+        void
+        zeroRowsSkippedByWENOInterpolation(
+            std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables,
+            const std::vector<std::vector<int> >& WENO_row_flags,
+            const hier::IntVector& interior_dims);
+        
+        /*
+         * Perform linear sixth order interpolation of the primitive variables on the faces that
+         * are not flagged by the shock sensor.
+         */
+        void
+        performLinearInterpolationOnSmoothFaces(
+            std::vector<boost::shared_ptr<pdat::SideData<double> > >& primitive_variables_minus,
+            std::vector<boost::shared_ptr<pdat::SideData<double> > >& primitive_variables_plus,
+            const std::vector<boost::shared_ptr<pdat::CellData<double> > >& primitive_variables,
+            const boost::shared_ptr<pdat::SideData<double> >& shock_sensor,
+            const hier::IntVector& interior_dims);
+        
+        /*
+         * Compute global side data of the primitive variables in the stencils of the sides for
+         * component-wise WENO interpolation. The value at a side is that of the cell at idx_offset
+         * from the cell on the right of the side.
+         */
+        void
+        computeGlobalSideDataPrimitiveVariablesInStencil(
+            std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_side,
+            const std::vector<boost::shared_ptr<pdat::CellData<double> > >& primitive_variables,
+            const hier::IntVector& interior_dims,
+            const int idx_offset);
+        
+        /*
+         * Perform WENO interpolation. The WENO interpolation in each direction is only performed on
+         * the rows of faces (the faces traversed by the innermost loop) whose flags in WENO_row_flags
+         * are non-zero. The rows in a direction are numbered by the two outer loop indices of the
+         * faces in that direction, the index in the y-direction (j) running fastest. All rows are
+         * interpolated if WENO_row_flags is empty.
          */
         virtual void
         performWENOInterpolation(
             std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_minus,
             std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_plus,
-            const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables) = 0;
+            const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables,
+            const std::vector<std::vector<int> >& WENO_row_flags) = 0;
         
         /*
          * Forms of equations.
@@ -68,6 +206,49 @@ class ConvectiveFluxReconstructorWCNS56: public ConvectiveFluxReconstructor
          */
         boost::shared_ptr<FlowModelRiemannSolver> d_riemann_solver;
         
+        /*
+         * Whether the patch is processed tile by tile and the number of cells of each tile.
+         */
+        bool d_use_tiling;
+        hier::IntVector d_tile_size;
+        
+        /*
+         * Tiles whose data are reused for all the tiles of the same shape.
+         */
+        PatchTiles d_patch_tiles;
+        
+        /*
+         * Whether the hybrid central/WCNS interpolation is used and the threshold of the shock
+         * sensor above which a face is interpolated with the characteristic WCNS interpolation.
+         * Only the WENO interpolation is restricted to the rows of faces that contain a flagged face.
+         * The projection variables and the transformations between the primitive and the
+         * characteristic variables are still computed on all the faces of the patch.
+         */
+        bool d_use_hybrid_central_WCNS;
+        double d_hybrid_shock_sensor_threshold;
+        
+        /*
+         * Numbers of flagged faces and all faces counted for the hybrid central/WCNS interpolation.
+         */
+        long d_num_faces_flagged;
+        long d_num_faces;
+        
+        /*
+         * Whether the shock sensor is only computed at the first Runge-Kutta stage of a time step and
+         * the variable and patch data index that keep it for the later stages. The patch data index
+         * is the one of the scratch context of the integrator and is negative until the variable is
+         * registered with the integrator.
+         */
+        bool d_freeze_shock_sensor;
+        boost::shared_ptr<pdat::SideVariable<double> > d_shock_sensor_variable;
+        int d_shock_sensor_data_id;
+        
+        /*
+         * Coarsest level on which the WCNS interpolation is performed on the primitive variables
+         * component by component. A negative value disables the component-wise interpolation.
+         */
+        int d_component_wise_interpolation_start_level;
+        
 };
 
 #endif /* CONVECTIVE_FLUX_RECONSTRUCTOR_56_HLLC_HLL_HPP */
@@ -38,7 +38,8 @@ class ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL: public ConvectiveFluxReco
         performWENOInterpolation(
             std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_minus,
             std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_plus,
-            const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables);
+            const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables,
+            const std::vector<std::vector<int> >& WENO_row_flags);
         
         /*
          * Constants used by the scheme.
@@ -49,6 +49,14 @@ class ConvectiveFluxReconstructorWCNS6_Test: public ConvectiveFluxReconstructor
             const double dt,
             const int RK_step_number);
         
+        /*
+         * Register the derived cell variables required by the convective flux and source in the
+         * patch registered in the flow model.
+         */
+        void
+        registerDerivedVariablesForConvectiveFluxAndSource(
+            const hier::Patch& patch);
+        
     private:
         /*
          * Perform WENO interpolation.
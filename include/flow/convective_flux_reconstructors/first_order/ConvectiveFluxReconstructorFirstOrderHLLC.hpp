@@ -42,6 +42,13 @@ class ConvectiveFluxReconstructorFirstOrderHLLC: public ConvectiveFluxReconstruc
             const double dt,
             const int RK_step_number);
         
+        /*
+         * Register the derived cell variables required by the convective flux and source in the
+         * patch registered in the flow model.
+         */
+        void registerDerivedVariablesForConvectiveFluxAndSource(
+            const hier::Patch& patch);
+        
     private:
         std::vector<EQN_FORM::TYPE> d_eqn_form;
         bool d_has_advective_eqn_form;
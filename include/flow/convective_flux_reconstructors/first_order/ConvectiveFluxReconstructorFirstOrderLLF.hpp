@@ -41,6 +41,13 @@ class ConvectiveFluxReconstructorFirstOrderLLF: public ConvectiveFluxReconstruct
             const double time,
             const double dt,
             const int RK_step_number);
+        
+        /*
+         * Register the derived cell variables required by the convective flux and source in the
+         * patch registered in the flow model.
+         */
+        void registerDerivedVariablesForConvectiveFluxAndSource(
+            const hier::Patch& patch);
     
 };
 
@@ -75,6 +75,15 @@ class DiffusiveFluxReconstructor
             const double time,
             const double dt,
             const int RK_step_number) = 0;
+        
+        /*
+         * Register the derived cell variables required by the diffusive flux in the patch registered
+         * in the flow model. This allows a caller to register the patch once for several operators
+         * and to compute the shared derived cell data only once.
+         */
+        virtual void
+        registerDerivedVariablesForDiffusiveFlux(
+            const hier::Patch& patch) = 0;
     
     protected:
         /*
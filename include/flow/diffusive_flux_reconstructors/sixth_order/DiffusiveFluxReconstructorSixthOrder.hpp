@@ -41,36 +41,27 @@ class DiffusiveFluxReconstructorSixthOrder: public DiffusiveFluxReconstructor
             const double dt,
             const int RK_step_number);
         
-    private:
         /*
-         * Compute the first derivatives in the x-direction.
+         * Register the derived cell variables required by the diffusive flux in the patch registered
+         * in the flow model.
          */
-        void computeFirstDerivativesInX(
-            hier::Patch& patch,
-            std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& derivative_x,
-            std::map<double*, boost::shared_ptr<pdat::CellData<double> > >& derivative_x_computed,
-            const std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& data_x,
-            const std::vector<std::vector<int> >& data_component_idx_x);
-        
-        /*
-         * Compute the first derivatives in the y-direction.
-         */
-        void computeFirstDerivativesInY(
-            hier::Patch& patch,
-            std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& derivative_y,
-            std::map<double*, boost::shared_ptr<pdat::CellData<double> > >& derivative_y_computed,
-            const std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& data_y,
-            const std::vector<std::vector<int> >& data_component_idx_y);
+        void registerDerivedVariablesForDiffusiveFlux(
+            const hier::Patch& patch);
         
+    private:
         /*
-         * Compute the first derivatives in the z-direction.
+         * Add the products of the diffusivities and the first derivatives in a direction to the
+         * diffusive flux in a direction at the nodes.
          */
-        void computeFirstDerivativesInZ(
+        void addDiffusiveFluxAtNodes(
             hier::Patch& patch,
-            std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& derivative_z,
-            std::map<double*, boost::shared_ptr<pdat::CellData<double> > >& derivative_z_computed,
-            const std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& data_z,
-            const std::vector<std::vector<int> >& data_component_idx_z);
+            std::vector<double*>& F_node,
+            const DIRECTION::TYPE& flux_direction,
+            const DIRECTION::TYPE& derivative_direction,
+            const std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& data,
+            const std::vector<std::vector<int> >& data_component_idx,
+            const std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& diffusivities_data,
+            const std::vector<std::vector<int> >& diffusivities_component_idx);
         
 };
 
@@ -9,6 +9,7 @@
 #include "flow/flow_models/FlowModelRiemannSolver.hpp"
 #include "flow/flow_models/FlowModelStatisticsUtilities.hpp"
 #include "util/Directions.hpp"
+#include "util/memory_usage/MemoryUsage.hpp"
 #include "util/mixing_rules/equations_of_state/EquationOfStateMixingRulesManager.hpp"
 
 #include "SAMRAI/appu/VisDerivedDataStrategy.h"
@@ -110,6 +111,14 @@ class FlowModel:
             return d_eqn_form;
         }
         
+        /*
+         * Check whether a patch is registered.
+         */
+        bool hasRegisteredPatch() const
+        {
+            return (d_patch != nullptr);
+        }
+        
         /*
          * Get the number of ghost cells of conservative variables.
          */
@@ -3,6 +3,7 @@
 
 #include "HAMeRS_config.hpp"
 
+#include "util/basic_boundary_conditions/BoundaryFillPlan.hpp"
 #include "util/mixing_rules/equations_of_state/EquationOfStateMixingRulesManager.hpp"
 
 #include "SAMRAI/pdat/CellData.h"
@@ -106,7 +107,8 @@ class FlowModelBoundaryUtilities
             std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<std::vector<double> >& bdry_node_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(1))) = 0;
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(1)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>()) = 0;
         
         /*
          * Virtual function to fill 2d edge boundary values for a patch.
@@ -119,7 +121,8 @@ class FlowModelBoundaryUtilities
             std::vector<int>& bdry_edge_locs,
             const std::vector<int>& bdry_edge_conds,
             const std::vector<std::vector<double> >& bdry_edge_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2))) = 0;
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>()) = 0;
         
         /*
          * Virtual function to fill 2d node boundary values for a patch.
@@ -132,7 +135,8 @@ class FlowModelBoundaryUtilities
             std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<std::vector<double> >& bdry_edge_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2))) = 0;
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>()) = 0;
         
         /*
          * Virtual function to fill 3d face boundary values for a patch.
@@ -145,7 +149,8 @@ class FlowModelBoundaryUtilities
             std::vector<int>& bdry_face_locs,
             const std::vector<int>& bdry_face_conds,
             const std::vector<std::vector<double> >& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3))) = 0;
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>()) = 0;
         
         /*
          * Virtual function to fill 3d edge boundary values for a patch.
@@ -158,7 +163,8 @@ class FlowModelBoundaryUtilities
             std::vector<int>& bdry_edge_locs,
             const std::vector<int>& bdry_edge_conds,
             const std::vector<std::vector<double> >& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3))) = 0;
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>()) = 0;
         
         /*
          * Virtual function to fill 3d node boundary values for a patch.
@@ -171,7 +177,8 @@ class FlowModelBoundaryUtilities
             std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<std::vector<double> >& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3))) = 0;
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>()) = 0;
         
 protected:
         /*
@@ -74,7 +74,8 @@ class FlowModelBoundaryUtilitiesFiveEqnAllaire: public FlowModelBoundaryUtilitie
             std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<std::vector<double> >& bdry_node_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(1)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(1)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*
          * Function to fill 2d edge boundary values for a patch.
@@ -87,7 +88,8 @@ class FlowModelBoundaryUtilitiesFiveEqnAllaire: public FlowModelBoundaryUtilitie
             std::vector<int>& bdry_edge_locs,
             const std::vector<int>& bdry_edge_conds,
             const std::vector<std::vector<double> >& bdry_edge_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*
          * Function to fill 2d node boundary values for a patch.
@@ -100,7 +102,8 @@ class FlowModelBoundaryUtilitiesFiveEqnAllaire: public FlowModelBoundaryUtilitie
             std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<std::vector<double> >& bdry_edge_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*
          * Function to fill 3d face boundary values for a patch.
@@ -113,7 +116,8 @@ class FlowModelBoundaryUtilitiesFiveEqnAllaire: public FlowModelBoundaryUtilitie
             std::vector<int>& bdry_face_locs,
             const std::vector<int>& bdry_face_conds,
             const std::vector<std::vector<double> >& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*
          * Function to fill 3d edge boundary values for a patch.
@@ -126,7 +130,8 @@ class FlowModelBoundaryUtilitiesFiveEqnAllaire: public FlowModelBoundaryUtilitie
             std::vector<int>& bdry_edge_locs,
             const std::vector<int>& bdry_edge_conds,
             const std::vector<std::vector<double> >& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*
          * Function to fill 3d node boundary values for a patch.
@@ -139,7 +144,8 @@ class FlowModelBoundaryUtilitiesFiveEqnAllaire: public FlowModelBoundaryUtilitie
             std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<std::vector<double> >& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
     private:
         void
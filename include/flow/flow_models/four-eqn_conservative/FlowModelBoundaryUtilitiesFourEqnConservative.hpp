@@ -67,7 +67,8 @@ class FlowModelBoundaryUtilitiesFourEqnConservative: public FlowModelBoundaryUti
             std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<std::vector<double> >& bdry_node_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(1)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(1)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*
          * Function to fill 2d edge boundary values for a patch.
@@ -80,7 +81,8 @@ class FlowModelBoundaryUtilitiesFourEqnConservative: public FlowModelBoundaryUti
             std::vector<int>& bdry_edge_locs,
             const std::vector<int>& bdry_edge_conds,
             const std::vector<std::vector<double> >& bdry_edge_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*
          * Function to fill 2d node boundary values for a patch.
@@ -93,7 +95,8 @@ class FlowModelBoundaryUtilitiesFourEqnConservative: public FlowModelBoundaryUti
             std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<std::vector<double> >& bdry_edge_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*
          * Function to fill 3d face boundary values for a patch.
@@ -106,7 +109,8 @@ class FlowModelBoundaryUtilitiesFourEqnConservative: public FlowModelBoundaryUti
             std::vector<int>& bdry_face_locs,
             const std::vector<int>& bdry_face_conds,
             const std::vector<std::vector<double> >& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*
          * Function to fill 3d edge boundary values for a patch.
@@ -119,7 +123,8 @@ class FlowModelBoundaryUtilitiesFourEqnConservative: public FlowModelBoundaryUti
             std::vector<int>& bdry_edge_locs,
             const std::vector<int>& bdry_edge_conds,
             const std::vector<std::vector<double> >& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*
          * Function to fill 3d node boundary values for a patch.
@@ -132,7 +137,8 @@ class FlowModelBoundaryUtilitiesFourEqnConservative: public FlowModelBoundaryUti
             std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<std::vector<double> >& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
     private:
         void
@@ -76,6 +76,15 @@ class NonconservativeDiffusiveFluxDivergenceOperator
             const double time,
             const double dt,
             const int RK_step_number) = 0;
+        
+        /*
+         * Register the derived cell variables required by the non-conservative diffusive flux
+         * divergence in the patch registered in the flow model. This allows a caller to register the
+         * patch once for several operators and to compute the shared derived cell data only once.
+         */
+        virtual void
+        registerDerivedVariablesForDiffusiveFluxDivergence(
+            const hier::Patch& patch) = 0;
     
     protected:
         /*
@@ -41,7 +41,49 @@ class NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder: public Nonconser
             const double dt,
             const int RK_step_number);
         
+        /*
+         * Register the derived cell variables required by the non-conservative diffusive flux
+         * divergence in the patch registered in the flow model.
+         */
+        void registerDerivedVariablesForDiffusiveFluxDivergence(
+            const hier::Patch& patch);
+        
     private:
+        /*
+         * Plan of the first and second derivatives computed on a patch. The buffers of the derivatives
+         * are keyed by the pointer to the differentiated data so that every derivative is computed only
+         * once on the patch, whichever diffusive flux needs it. A mixed derivative is always taken in
+         * the later direction of the first derivative in the earlier direction and stored only once for
+         * the cross terms of both diffusive fluxes. All buffers are freed together by clear().
+         */
+        struct DerivativePlan
+        {
+            std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_x_computed;
+            std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_y_computed;
+            std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_z_computed;
+            
+            std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_xx_computed;
+            std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_xy_computed;
+            std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_xz_computed;
+            std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_yy_computed;
+            std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_yz_computed;
+            std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_zz_computed;
+            
+            void clear()
+            {
+                derivative_x_computed.clear();
+                derivative_y_computed.clear();
+                derivative_z_computed.clear();
+                
+                derivative_xx_computed.clear();
+                derivative_xy_computed.clear();
+                derivative_xz_computed.clear();
+                derivative_yy_computed.clear();
+                derivative_yz_computed.clear();
+                derivative_zz_computed.clear();
+            }
+        };
+        
         /*
          * Add derivatives to divergence.
          */
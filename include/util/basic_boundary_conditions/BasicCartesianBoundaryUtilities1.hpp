@@ -3,6 +3,7 @@
 
 #include "HAMeRS_config.hpp"
 
+#include "util/basic_boundary_conditions/BoundaryFillPlan.hpp"
 #include "util/basic_boundary_conditions/BoundaryUtilityStrategy.hpp"
 
 #include "SAMRAI/pdat/CellData.h"
@@ -136,6 +137,8 @@ struct BasicCartesianBoundaryUtilities1
          * @param bdry_node_conds     tbox::Array of boundary condition types for
          *                            patch nodes.
          * @param ghost_width_to_fill Width of ghost region to fill.
+         * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+         *                            it is not given.
          *
          * @pre !var_name.empty()
          * @pre var_data
@@ -154,7 +157,8 @@ struct BasicCartesianBoundaryUtilities1
             const std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<double>& bdry_node_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(1)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(1)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
     private:
         static void
@@ -15,6 +15,7 @@
 
 #include "HAMeRS_config.hpp"
 
+#include "util/basic_boundary_conditions/BoundaryFillPlan.hpp"
 #include "util/basic_boundary_conditions/BoundaryUtilityStrategy.hpp"
 
 #include "SAMRAI/pdat/CellData.h"
@@ -181,6 +182,8 @@ struct BasicCartesianBoundaryUtilities2
          * @param bdry_edge_values    tbox::Array of boundary values for patch
          *                            edges.
          * @param ghost_width_to_fill Width of ghost region to fill.
+         * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+         *                            it is not given.
          *
          * @pre !var_name.empty());
          * @pre var_data
@@ -199,7 +202,44 @@ struct BasicCartesianBoundaryUtilities2
             const std::vector<int>& bdry_edge_locs,
             const std::vector<int>& bdry_edge_conds,
             const std::vector<double>& bdry_edge_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
+        
+        /*!
+         * Function to fill 2d edge boundary values of several variables for a patch. The
+         * edge boundary boxes are traversed once and all the variables are filled for each
+         * of them.
+         *
+         * @param var_names           Vector of string names of variables (for error reporting).
+         * @param var_data            Vector of cell-centered patch data objects to fill.
+         * @param patch               hier::Patch on which data objects live.
+         * @param bdry_edge_locs      tbox::Array of locations of edges for applying
+         *                            boundary conditions.
+         * @param bdry_edge_conds     Vector of arrays of boundary condition types for
+         *                            patch edges, one for each variable.
+         * @param bdry_edge_values    Vector of arrays of boundary values for patch
+         *                            edges, one for each variable.
+         * @param ghost_width_to_fill Width of ghost region to fill.
+         * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+         *                            it is not given.
+         *
+         * @pre var_names.size() == var_data.size()
+         * @pre bdry_edge_conds.size() == var_data.size()
+         * @pre bdry_edge_values.size() == var_data.size()
+         * @pre bdry_edge_conds[vi].size() == NUM_2D_EDGES
+         * @pre bdry_edge_values[vi].size() == NUM_2D_EDGES * (var_data[vi]->getDepth())
+         * @pre ghost_fill_width.getDim() == tbox::Dimension(2)
+         */
+        static void
+        fillEdgeBoundaryData(
+            const std::vector<std::string>& var_names,
+            const std::vector<boost::shared_ptr<pdat::CellData<double> > >& var_data,
+            const hier::Patch& patch,
+            const std::vector<int>& bdry_edge_locs,
+            const std::vector<std::vector<int> >& bdry_edge_conds,
+            const std::vector<std::vector<double> >& bdry_edge_values,
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*!
          * Function to fill 2d node boundary values for a patch.
@@ -218,6 +258,8 @@ struct BasicCartesianBoundaryUtilities2
          * @param bdry_edge_values    tbox::Array of boundary values for patch
          *                            edges.
          * @param ghost_width_to_fill Width of ghost region to fill.
+         * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+         *                            it is not given.
          *
          * @pre !var_name.empty()
          * @pre var_data
@@ -236,7 +278,44 @@ struct BasicCartesianBoundaryUtilities2
             const std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<double>& bdry_edge_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
+        
+        /*!
+         * Function to fill 2d node boundary values of several variables for a patch. The
+         * node boundary boxes are traversed once and all the variables are filled for each
+         * of them.
+         *
+         * @param var_names           Vector of string names of variables (for error reporting).
+         * @param var_data            Vector of cell-centered patch data objects to fill.
+         * @param patch               hier::Patch on which data objects live.
+         * @param bdry_node_locs      tbox::Array of locations of nodes for applying
+         *                            boundary conditions.
+         * @param bdry_node_conds     Vector of arrays of boundary condition types for
+         *                            patch nodes, one for each variable.
+         * @param bdry_edge_values    Vector of arrays of boundary values for patch
+         *                            edges, one for each variable.
+         * @param ghost_width_to_fill Width of ghost region to fill.
+         * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+         *                            it is not given.
+         *
+         * @pre var_names.size() == var_data.size()
+         * @pre bdry_node_conds.size() == var_data.size()
+         * @pre bdry_edge_values.size() == var_data.size()
+         * @pre bdry_node_conds[vi].size() == NUM_2D_NODES
+         * @pre bdry_edge_values[vi].size() == NUM_2D_EDGES * (var_data[vi]->getDepth())
+         * @pre ghost_fill_width.getDim() == tbox::Dimension(2)
+         */
+        static void
+        fillNodeBoundaryData(
+            const std::vector<std::string>& var_names,
+            const std::vector<boost::shared_ptr<pdat::CellData<double> > >& var_data,
+            const hier::Patch& patch,
+            const std::vector<int>& bdry_node_locs,
+            const std::vector<std::vector<int> >& bdry_node_conds,
+            const std::vector<std::vector<double> >& bdry_edge_values,
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(2)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*!
          * Function that returns the integer edge boundary location
@@ -284,6 +363,27 @@ struct BasicCartesianBoundaryUtilities2
             std::vector<int>& node_conds,
             const hier::IntVector& periodic);
         
+        /*
+         * Function that returns the edge boundary condition type of a node boundary condition
+         * type, or -1 if the type is unknown.
+         */
+        static int
+        getEdgeBoundaryConditionType(
+            const int bdry_cond);
+        
+        /*
+         * Function to fill the cells of a fill box with the FLOW, REFLECT, SYMMETRY or DIRICHLET
+         * boundary condition of an edge. The cells are filled by contiguous rows.
+         */
+        static void
+        fillBoxWithEdgeBoundaryCondition(
+            const boost::shared_ptr<pdat::CellData<double> >& var_data,
+            const hier::Box& fill_box,
+            const hier::Box& interior_box,
+            const int edge_loc,
+            const int bdry_edge_cond,
+            const std::vector<double>& bdry_edge_values);
+        
 };
 
 #endif /* BASIC_CARTESIAN_BOUNDARY_UTILITIES2_HPP */
@@ -14,6 +14,7 @@
 
 #include "HAMeRS_config.hpp"
 
+#include "util/basic_boundary_conditions/BoundaryFillPlan.hpp"
 #include "util/basic_boundary_conditions/BoundaryUtilityStrategy.hpp"
 
 #include "SAMRAI/pdat/CellData.h"
@@ -195,6 +196,8 @@ struct BasicCartesianBoundaryUtilities3
         * @param bdry_face_values    tbox::Array of boundary values for patch
         *                            faces.
         * @param ghost_width_to_fill Width of ghost region to fill.
+        * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+        *                            it is not given.
         *
         * @pre !var_name.empty()
         * @pre var_data
@@ -213,7 +216,44 @@ struct BasicCartesianBoundaryUtilities3
             const std::vector<int>& bdry_face_locs,
             const std::vector<int>& bdry_face_conds,
             const std::vector<double>& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
+        
+        /*!
+        * Function to fill 3d face boundary values of several variables for a patch. The
+        * face boundary boxes are traversed once and all the variables are filled for each
+        * of them.
+        *
+        * @param var_names           Vector of string names of variables (for error reporting).
+        * @param var_data            Vector of cell-centered patch data objects to fill.
+        * @param patch               hier::Patch on which data objects live.
+        * @param bdry_face_locs      tbox::Array of locations of faces for applying
+        *                            boundary conditions.
+        * @param bdry_face_conds     Vector of arrays of boundary condition types for
+        *                            patch faces, one for each variable.
+        * @param bdry_face_values    Vector of arrays of boundary values for patch
+        *                            faces, one for each variable.
+        * @param ghost_width_to_fill Width of ghost region to fill.
+        * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+        *                            it is not given.
+        *
+        * @pre var_names.size() == var_data.size()
+        * @pre bdry_face_conds.size() == var_data.size()
+        * @pre bdry_face_values.size() == var_data.size()
+        * @pre bdry_face_conds[vi].size() == NUM_3D_FACES
+        * @pre bdry_face_values[vi].size() == NUM_3D_FACES * (var_data[vi]->getDepth())
+        * @pre ghost_fill_width.getDim() == tbox::Dimension(3)
+        */
+        static void
+        fillFaceBoundaryData(
+            const std::vector<std::string>& var_names,
+            const std::vector<boost::shared_ptr<pdat::CellData<double> > >& var_data,
+            const hier::Patch& patch,
+            const std::vector<int>& bdry_face_locs,
+            const std::vector<std::vector<int> >& bdry_face_conds,
+            const std::vector<std::vector<double> >& bdry_face_values,
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*!
         * Function to fill 3d edge boundary values for a patch.
@@ -232,6 +272,8 @@ struct BasicCartesianBoundaryUtilities3
         * @param bdry_face_values    tbox::Array of boundary values for patch
         *                            faces.
         * @param ghost_width_to_fill Width of ghost region to fill.
+        * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+        *                            it is not given.
         *
         * @pre !var_name.empty()
         * @pre var_data
@@ -250,7 +292,44 @@ struct BasicCartesianBoundaryUtilities3
             const std::vector<int>& bdry_edge_locs,
             const std::vector<int>& bdry_edge_conds,
             const std::vector<double>& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
+        
+        /*!
+        * Function to fill 3d edge boundary values of several variables for a patch. The
+        * edge boundary boxes are traversed once and all the variables are filled for each
+        * of them.
+        *
+        * @param var_names           Vector of string names of variables (for error reporting).
+        * @param var_data            Vector of cell-centered patch data objects to fill.
+        * @param patch               hier::Patch on which data objects live.
+        * @param bdry_edge_locs      tbox::Array of locations of edges for applying
+        *                            boundary conditions.
+        * @param bdry_edge_conds     Vector of arrays of boundary condition types for
+        *                            patch edges, one for each variable.
+        * @param bdry_face_values    Vector of arrays of boundary values for patch
+        *                            faces, one for each variable.
+        * @param ghost_width_to_fill Width of ghost region to fill.
+        * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+        *                            it is not given.
+        *
+        * @pre var_names.size() == var_data.size()
+        * @pre bdry_edge_conds.size() == var_data.size()
+        * @pre bdry_face_values.size() == var_data.size()
+        * @pre bdry_edge_conds[vi].size() == NUM_3D_EDGES
+        * @pre bdry_face_values[vi].size() == NUM_3D_FACES * (var_data[vi]->getDepth())
+        * @pre ghost_fill_width.getDim() == tbox::Dimension(3)
+        */
+        static void
+        fillEdgeBoundaryData(
+            const std::vector<std::string>& var_names,
+            const std::vector<boost::shared_ptr<pdat::CellData<double> > >& var_data,
+            const hier::Patch& patch,
+            const std::vector<int>& bdry_edge_locs,
+            const std::vector<std::vector<int> >& bdry_edge_conds,
+            const std::vector<std::vector<double> >& bdry_face_values,
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*!
         * Function to fill 3d node boundary values for a patch.
@@ -269,6 +348,8 @@ struct BasicCartesianBoundaryUtilities3
         * @param bdry_face_values    tbox::Array of boundary values for patch
         *                            faces.
         * @param ghost_width_to_fill Width of ghost region to fill.
+        * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+        *                            it is not given.
         *
         * @pre !var_name.empty()
         * @pre var_data
@@ -287,7 +368,44 @@ struct BasicCartesianBoundaryUtilities3
             const std::vector<int>& bdry_node_locs,
             const std::vector<int>& bdry_node_conds,
             const std::vector<double>& bdry_face_values,
-            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)));
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
+        
+        /*!
+        * Function to fill 3d node boundary values of several variables for a patch. The
+        * node boundary boxes are traversed once and all the variables are filled for each
+        * of them.
+        *
+        * @param var_names           Vector of string names of variables (for error reporting).
+        * @param var_data            Vector of cell-centered patch data objects to fill.
+        * @param patch               hier::Patch on which data objects live.
+        * @param bdry_node_locs      tbox::Array of locations of nodes for applying
+        *                            boundary conditions.
+        * @param bdry_node_conds     Vector of arrays of boundary condition types for
+        *                            patch nodes, one for each variable.
+        * @param bdry_face_values    Vector of arrays of boundary values for patch
+        *                            faces, one for each variable.
+        * @param ghost_width_to_fill Width of ghost region to fill.
+        * @param bdry_fill_plan      Boundary fill plan of the patch. It is built on the fly if
+        *                            it is not given.
+        *
+        * @pre var_names.size() == var_data.size()
+        * @pre bdry_node_conds.size() == var_data.size()
+        * @pre bdry_face_values.size() == var_data.size()
+        * @pre bdry_node_conds[vi].size() == NUM_3D_NODES
+        * @pre bdry_face_values[vi].size() == NUM_3D_FACES * (var_data[vi]->getDepth())
+        * @pre ghost_fill_width.getDim() == tbox::Dimension(3)
+        */
+        static void
+        fillNodeBoundaryData(
+            const std::vector<std::string>& var_names,
+            const std::vector<boost::shared_ptr<pdat::CellData<double> > >& var_data,
+            const hier::Patch& patch,
+            const std::vector<int>& bdry_node_locs,
+            const std::vector<std::vector<int> >& bdry_node_conds,
+            const std::vector<std::vector<double> >& bdry_face_values,
+            const hier::IntVector& ghost_width_to_fill = -hier::IntVector::getOne(tbox::Dimension(3)),
+            const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan = boost::shared_ptr<BoundaryFillPlan>());
         
         /*!
         * Function that returns the integer face boundary location
@@ -386,6 +504,27 @@ struct BasicCartesianBoundaryUtilities3
             std::vector<int>& node_conds,
             const hier::IntVector& periodic);
         
+        /*
+         * Function that returns the face boundary condition type of an edge or node boundary
+         * condition type, or -1 if the type is unknown.
+         */
+        static int
+        getFaceBoundaryConditionType(
+            const int bdry_cond);
+        
+        /*
+         * Function to fill the cells of a fill box with the FLOW, REFLECT, SYMMETRY or DIRICHLET
+         * boundary condition of a face. The cells are filled by contiguous rows.
+         */
+        static void
+        fillBoxWithFaceBoundaryCondition(
+            const boost::shared_ptr<pdat::CellData<double> >& var_data,
+            const hier::Box& fill_box,
+            const hier::Box& interior_box,
+            const int face_loc,
+            const int bdry_face_cond,
+            const std::vector<double>& bdry_face_values);
+        
 };
 
 #endif /* CARTESIAN_BOUNDARY_UTILITIES3_HPP */
@@ -0,0 +1,91 @@
+#ifndef BOUNDARY_FILL_PLAN_HPP
+#define BOUNDARY_FILL_PLAN_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include "SAMRAI/geom/CartesianPatchGeometry.h"
+#include "SAMRAI/hier/BoundaryBox.h"
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/Patch.h"
+
+#include "boost/shared_ptr.hpp"
+#include <vector>
+
+using namespace SAMRAI;
+
+/*
+ * Plan of the filling of the ghost cells at the physical boundaries of a patch. The plan holds the
+ * boundary boxes of the patch for each codimension and the fill boxes of the boundary boxes for
+ * each ghost cell width that has been filled. Since it only depends on the patch geometry, the plan
+ * can be built once after each regrid and replayed for all variables and all ghost cell fills
+ * without repeating the box calculus.
+ */
+class BoundaryFillPlan
+{
+    public:
+        BoundaryFillPlan(
+            const hier::Patch& patch);
+        
+        /*
+         * Whether the plan was built for a patch with the same box and the same refinement ratio
+         * as the given patch.
+         */
+        bool
+        isValidFor(
+            const hier::Patch& patch) const;
+        
+        /*
+         * Get the boundary boxes of the patch of a codimension.
+         */
+        const std::vector<hier::BoundaryBox>&
+        getBoundaryBoxes(
+            const int codim) const
+        {
+            TBOX_ASSERT(codim >= 1 && codim <= d_dim.getValue());
+            
+            return d_bdry_boxes[codim - 1];
+        }
+        
+        /*
+         * Get the fill boxes of the boundary boxes of a codimension for a ghost cell width to fill.
+         * The fill boxes are computed from the patch geometry the first time a ghost cell width is
+         * requested and cached afterwards.
+         */
+        const std::vector<hier::Box>&
+        getFillBoxes(
+            const int codim,
+            const hier::IntVector& ghost_width_to_fill);
+        
+    private:
+        /*
+         * Problem dimension.
+         */
+        const tbox::Dimension d_dim;
+        
+        /*
+         * Box and refinement ratio of the patch.
+         */
+        const hier::Box d_patch_box;
+        const hier::IntVector d_ratio_to_level_zero;
+        
+        /*
+         * Geometry of the patch.
+         */
+        const boost::shared_ptr<geom::CartesianPatchGeometry> d_patch_geom;
+        
+        /*
+         * Boundary boxes of the patch for each codimension.
+         */
+        std::vector<std::vector<hier::BoundaryBox> > d_bdry_boxes;
+        
+        /*
+         * Ghost cell widths that have been filled and the fill boxes of the boundary boxes for
+         * each of them and for each codimension.
+         */
+        std::vector<hier::IntVector> d_ghost_widths_to_fill;
+        std::vector<std::vector<std::vector<hier::Box> > > d_fill_boxes;
+        
+};
+
+#endif /* BOUNDARY_FILL_PLAN_HPP */
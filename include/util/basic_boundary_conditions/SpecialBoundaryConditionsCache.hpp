@@ -0,0 +1,115 @@
+#ifndef SPECIAL_BOUNDARY_CONDITIONS_CACHE_HPP
+#define SPECIAL_BOUNDARY_CONDITIONS_CACHE_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxId.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/Patch.h"
+
+#include "boost/shared_ptr.hpp"
+#include <map>
+#include <vector>
+
+using namespace SAMRAI;
+
+/*
+ * Data of the special boundary conditions of a patch that does not depend on time. The index masks
+ * hold the indices of the ghost cells selected by the geometric tests of the special boundary
+ * conditions (e.g. on which side of a wall or of the initial shock position a ghost cell lies) and
+ * the coefficients hold any time-independent values of these cells (e.g. their coordinates). The
+ * meaning of each mask and of each set of coefficients is up to the special boundary conditions.
+ */
+class SpecialBoundaryConditionsPatchData
+{
+    public:
+        SpecialBoundaryConditionsPatchData(
+            const hier::Patch& patch,
+            const hier::IntVector& ghost_width_to_fill,
+            const hier::IntVector& num_ghosts);
+        
+        /*
+         * Whether the data was set up for a patch with the same box and the same refinement ratio
+         * as the given patch and for the same ghost cell widths.
+         */
+        bool
+        isValidFor(
+            const hier::Patch& patch,
+            const hier::IntVector& ghost_width_to_fill,
+            const hier::IntVector& num_ghosts) const;
+        
+        /*
+         * Index masks of the ghost cells.
+         */
+        std::vector<std::vector<int> > d_cell_indices;
+        
+        /*
+         * Time-independent coefficients of the ghost cells.
+         */
+        std::vector<std::vector<double> > d_coefficients;
+        
+    private:
+        /*
+         * Box and refinement ratio of the patch.
+         */
+        const hier::Box d_patch_box;
+        const hier::IntVector d_ratio_to_level_zero;
+        
+        /*
+         * Width of ghost region to fill and number of ghost cells of the data.
+         */
+        const hier::IntVector d_ghost_width_to_fill;
+        const hier::IntVector d_num_ghosts;
+        
+};
+
+/*
+ * Cache of the time-independent data of the special boundary conditions of the patches for each
+ * level, indexed by the box IDs of the patches. The data is set up the first time the ghost cells
+ * of a patch are filled and only the time-dependent part of the special boundary conditions is
+ * evaluated in the later fills.
+ */
+class SpecialBoundaryConditionsCache
+{
+    public:
+        SpecialBoundaryConditionsCache() {}
+        
+        /*
+         * Get the cached data of a patch. A null pointer is returned if no data is cached for the
+         * patch or if the cached data is stale.
+         */
+        boost::shared_ptr<SpecialBoundaryConditionsPatchData>
+        getPatchData(
+            const hier::Patch& patch,
+            const hier::IntVector& ghost_width_to_fill,
+            const hier::IntVector& num_ghosts) const;
+        
+        /*
+         * Create empty data for a patch, replacing any data cached for the patch. The data of
+         * patches that do not belong to a level of the hierarchy is not cached.
+         */
+        boost::shared_ptr<SpecialBoundaryConditionsPatchData>
+        createPatchData(
+            const hier::Patch& patch,
+            const hier::IntVector& ghost_width_to_fill,
+            const hier::IntVector& num_ghosts);
+        
+        /*
+         * Drop the cached data of the patches on the levels in the range of levels.
+         */
+        void
+        resetLevels(
+            const int coarsest_level,
+            const int finest_level);
+        
+    private:
+        /*
+         * Cached data of the patches for each level.
+         */
+        std::vector<std::map<hier::BoxId, boost::shared_ptr<SpecialBoundaryConditionsPatchData> > >
+            d_patch_data;
+        
+};
+
+#endif /* SPECIAL_BOUNDARY_CONDITIONS_CACHE_HPP */
@@ -0,0 +1,92 @@
+#ifndef MEMORY_USAGE_HPP
+#define MEMORY_USAGE_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include "SAMRAI/hier/PatchHierarchy.h"
+#include "SAMRAI/pdat/CellData.h"
+#include "SAMRAI/pdat/SideData.h"
+
+#include "boost/shared_ptr.hpp"
+#include <map>
+#include <ostream>
+#include <string>
+
+using namespace SAMRAI;
+
+/*
+ * Class MemoryUsage reports the memory footprint of a run. The current and peak resident memory
+ * of the process on each rank are read from the operating system. The patch data allocated on the
+ * patch hierarchy is accounted exactly and grouped by variable context (e.g. the current, new,
+ * scratch and intermediate Runge-Kutta data). The temporary patch data that the components (e.g.
+ * the flow model and the flux reconstructors) allocate and free within a step is not visible on
+ * the hierarchy, so the components record the size of the data themselves and the peak size per
+ * component is reported.
+ */
+class MemoryUsage
+{
+    public:
+        /*
+         * Record the size of the temporary data of a component. Only the peak size of the
+         * temporary data of each component is kept.
+         */
+        static void
+        recordTemporaryData(
+            const std::string& component_name,
+            const size_t num_bytes);
+        
+        /*
+         * Get the size of the array of the cell data including the ghost cells. Zero is returned
+         * for a null pointer.
+         */
+        static size_t
+        getPatchDataSize(
+            const boost::shared_ptr<pdat::CellData<double> >& data);
+        
+        /*
+         * Get the size of the arrays of the side data including the ghost cells. Zero is returned
+         * for a null pointer.
+         */
+        static size_t
+        getPatchDataSize(
+            const boost::shared_ptr<pdat::SideData<double> >& data);
+        
+        /*
+         * Get the current resident memory of the process in bytes. Zero is returned if it is not
+         * available.
+         */
+        static size_t
+        getCurrentProcessMemory();
+        
+        /*
+         * Get the peak resident memory of the process in bytes. Zero is returned if it is not
+         * available.
+         */
+        static size_t
+        getPeakProcessMemory();
+        
+        /*
+         * Print the current and peak memory of the process on each rank, the memory of the patch
+         * data on the patch hierarchy on this rank grouped by variable context and the peak
+         * memory of the temporary data of the components on this rank.
+         */
+        static void
+        printMemoryUsage(
+            std::ostream& os,
+            const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy);
+        
+    private:
+        /*
+         * Read the value of a field of /proc/self/status in bytes.
+         */
+        static size_t
+        readProcessStatusField(const std::string& field_name);
+        
+        /*
+         * Peak size of the temporary data of each component.
+         */
+        static std::map<std::string, size_t> s_temporary_data_peak;
+        
+};
+
+#endif /* MEMORY_USAGE_HPP */
@@ -0,0 +1,213 @@
+#ifndef TEMPERATURE_TABLE_HPP
+#define TEMPERATURE_TABLE_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include "SAMRAI/pdat/CellData.h"
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/Dimension.h"
+
+#include "boost/make_shared.hpp"
+#include "boost/shared_ptr.hpp"
+#include <cmath>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace SAMRAI;
+
+/*
+ * Settings of the temperature tables of the transport coefficients, read from the database of a
+ * mixing rules object. The tables are only built when "use_temperature_tables" is TRUE.
+ */
+class TemperatureTableSettings
+{
+    public:
+        TemperatureTableSettings(
+            const std::string& object_name,
+            const boost::shared_ptr<tbox::Database>& mixing_rules_db);
+        
+        /*
+         * Print all characteristics of the temperature table settings.
+         */
+        void
+        printClassData(std::ostream& os) const;
+        
+        /*
+         * Put the characteristics of the temperature table settings into the restart database.
+         */
+        void
+        putToRestart(
+            const boost::shared_ptr<tbox::Database>& restart_db) const;
+        
+        /*
+         * Whether the transport coefficients are computed from the temperature tables.
+         */
+        bool d_use_temperature_tables;
+        
+        /*
+         * Range of temperature covered by the tables.
+         */
+        double d_temperature_table_T_min;
+        double d_temperature_table_T_max;
+        
+        /*
+         * Initial and maximum numbers of nodes of the tables.
+         */
+        int d_temperature_table_num_points;
+        int d_temperature_table_max_num_points;
+        
+        /*
+         * Whether the nodes are uniformly spaced in log(T) instead of T.
+         */
+        bool d_temperature_table_use_log_spacing;
+        
+        /*
+         * Upper bound of the relative error of the interpolation.
+         */
+        double d_temperature_table_tolerance;
+        
+    private:
+        /*
+         * Name of the object owning the settings.
+         */
+        const std::string d_object_name;
+        
+};
+
+/*
+ * Table of a function of temperature interpolated with four-point cubic Lagrange polynomials. The
+ * number of nodes is doubled at setup until the relative error of the interpolation between the
+ * nodes is below the tolerance. The function itself is evaluated outside the range of the table.
+ */
+class TemperatureTable
+{
+    public:
+        TemperatureTable(
+            const std::string& object_name,
+            const tbox::Dimension& dim,
+            const TemperatureTableSettings& settings,
+            const std::function<double(const double)>& function);
+        
+        /*
+         * Get the value of the function at a temperature.
+         */
+        double
+        getValue(const double temperature) const
+        {
+            if (temperature < d_T_min || temperature > d_T_max)
+            {
+                return d_function(temperature);
+            }
+            
+            const double x = d_use_log_spacing ? log(temperature) : temperature;
+            
+            return interpolate(x);
+        }
+        
+        /*
+         * Compute the cell data of the function at a depth from the cell data of temperature.
+         */
+        void
+        computeCellData(
+            boost::shared_ptr<pdat::CellData<double> >& data_function,
+            const boost::shared_ptr<pdat::CellData<double> >& data_temperature,
+            const hier::Box& domain,
+            const int depth_function = 0) const;
+        
+        /*
+         * Get the number of nodes of the table.
+         */
+        int
+        getNumberOfPoints() const
+        {
+            return d_num_points;
+        }
+        
+        /*
+         * Get the maximum relative error of the interpolation measured at setup.
+         */
+        double
+        getMaximumRelativeError() const
+        {
+            return d_max_relative_error;
+        }
+        
+    private:
+        /*
+         * Sample the function on the nodes of the table.
+         */
+        void
+        sampleFunction();
+        
+        /*
+         * Compute the maximum relative error of the interpolation between the nodes.
+         */
+        double
+        computeMaximumRelativeError() const;
+        
+        /*
+         * Interpolate the table at a coordinate inside the range of the table.
+         */
+        double
+        interpolate(const double x) const
+        {
+            double s = (x - d_x_min)*d_inv_dx;
+            s = fmin(fmax(s, double(0)), double(d_num_points - 1));
+            
+            int i = static_cast<int>(s);
+            i = i < 1 ? 1 : (i > d_num_points - 3 ? d_num_points - 3 : i);
+            
+            const double t = s - double(i);
+            
+            const double w_m1 = -t*(t - double(1))*(t - double(2))/double(6);
+            const double w_0  = (t + double(1))*(t - double(1))*(t - double(2))/double(2);
+            const double w_p1 = -(t + double(1))*t*(t - double(2))/double(2);
+            const double w_p2 = (t + double(1))*t*(t - double(1))/double(6);
+            
+            return w_m1*d_values[i - 1] + w_0*d_values[i] + w_p1*d_values[i + 1] + w_p2*d_values[i + 2];
+        }
+        
+        /*
+         * The object name is used for error/warning reporting.
+         */
+        const std::string d_object_name;
+        
+        /*
+         * Problem dimension.
+         */
+        const tbox::Dimension d_dim;
+        
+        /*
+         * The tabulated function.
+         */
+        std::function<double(const double)> d_function;
+        
+        /*
+         * Range of temperature and of the coordinate of the nodes.
+         */
+        double d_T_min;
+        double d_T_max;
+        double d_x_min;
+        double d_x_max;
+        
+        /*
+         * Whether the nodes are uniformly spaced in log(T) instead of T.
+         */
+        bool d_use_log_spacing;
+        
+        /*
+         * Number of nodes, inverse of the spacing between the nodes and values at the nodes.
+         */
+        int d_num_points;
+        double d_inv_dx;
+        std::vector<double> d_values;
+        
+        /*
+         * Maximum relative error of the interpolation measured at setup.
+         */
+        double d_max_relative_error;
+        
+};
+
+#endif /* TEMPERATURE_TABLE_HPP */
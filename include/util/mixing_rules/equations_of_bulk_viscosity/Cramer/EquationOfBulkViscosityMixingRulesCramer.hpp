@@ -3,6 +3,7 @@
 
 #include "util/mixing_rules/equations_of_bulk_viscosity/EquationOfBulkViscosityMixingRules.hpp"
 #include "util/mixing_rules/equations_of_bulk_viscosity/Cramer/EquationOfBulkViscosityCramer.hpp"
+#include "util/mixing_rules/TemperatureTable.hpp"
 
 class EquationOfBulkViscosityMixingRulesCramer: public EquationOfBulkViscosityMixingRules
 {
@@ -101,6 +102,30 @@ class EquationOfBulkViscosityMixingRulesCramer: public EquationOfBulkViscosityMi
             const int species_index = 0) const;
         
     private:
+        /*
+         * Compute the bulk viscosity of a species from its table or from the equation of
+         * bulk viscosity.
+         */
+        double
+        getBulkViscosityOfSpecies(
+            const double* const pressure,
+            const double* const temperature,
+            const std::vector<const double*>& species_molecular_properties,
+            const int species_index) const;
+        
+        /*
+         * Compute the bulk viscosity of a species from its table or from the equation of
+         * bulk viscosity.
+         */
+        void
+        computeBulkViscosityOfSpecies(
+            boost::shared_ptr<pdat::CellData<double> >& data_bulk_viscosity_species,
+            const boost::shared_ptr<pdat::CellData<double> >& data_pressure,
+            const boost::shared_ptr<pdat::CellData<double> >& data_temperature,
+            const std::vector<const double*>& species_molecular_properties,
+            const int species_index,
+            const hier::Box& domain) const;
+        
         /*
          * Ratio of specific heats of different species.
          */
@@ -130,6 +155,13 @@ class EquationOfBulkViscosityMixingRulesCramer: public EquationOfBulkViscosityMi
          */
         boost::shared_ptr<EquationOfBulkViscosity> d_equation_of_bulk_viscosity;
         
+        /*
+         * Settings of the temperature tables and the tables of the bulk viscosity of different
+         * species.
+         */
+        TemperatureTableSettings d_temperature_table_settings;
+        std::vector<boost::shared_ptr<TemperatureTable> > d_species_bulk_viscosity_tables;
+        
 };
 
 #endif /* EQUATION_OF_BULK_VISCOSITY_MIXING_RULES_CRAMER_HPP */
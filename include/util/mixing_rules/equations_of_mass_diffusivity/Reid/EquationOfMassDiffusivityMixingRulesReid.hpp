@@ -2,6 +2,7 @@
 #define EQUATION_OF_MASS_DIFFUSIVITY_MIXING_RULES_REID_HPP
 
 #include "util/mixing_rules/equations_of_mass_diffusivity/EquationOfMassDiffusivityMixingRules.hpp"
+#include "util/mixing_rules/TemperatureTable.hpp"
 
 class EquationOfMassDiffusivityMixingRulesReid: public EquationOfMassDiffusivityMixingRules
 {
@@ -70,14 +71,14 @@ class EquationOfMassDiffusivityMixingRulesReid: public EquationOfMassDiffusivity
         
     private:
         /*
-         * Compute the mass diffusivity of a binary mixture.
+         * Compute the mass diffusivity of a binary mixture of two species.
          */
         double
         getMassDiffusivity(
             const double* const pressure,
             const double* const temperature,
-            const std::vector<const double*>& molecular_properties_1,
-            const std::vector<const double*>& molecular_properties_2) const;
+            const int species_index_1,
+            const int species_index_2) const;
         
         /*
          * Lennard-Jones energy parameter of different species.
@@ -94,6 +95,20 @@ class EquationOfMassDiffusivityMixingRulesReid: public EquationOfMassDiffusivity
          */
         std::vector<double> d_species_M;
         
+        /*
+         * Index of each pair of species in the packed tables, stored for both orders of the species,
+         * and the packed table of the constants of the binary mass diffusivity of each pair of species.
+         */
+        std::vector<int> d_species_pair_indices;
+        std::vector<double> d_species_pair_constants;
+        
+        /*
+         * Settings of the temperature tables and the tables of the product of pressure and binary
+         * mass diffusivity of different pairs of species.
+         */
+        TemperatureTableSettings d_temperature_table_settings;
+        std::vector<boost::shared_ptr<TemperatureTable> > d_binary_mass_diffusivity_tables;
+        
 };
 
 #endif /* EQUATION_OF_MASS_DIFFUSIVITY_MIXING_RULES_REID_HPP */
@@ -4,6 +4,7 @@
 #include "util/mixing_rules/equations_of_shear_viscosity/EquationOfShearViscosityMixingRules.hpp"
 
 #include "util/mixing_rules/equations_of_shear_viscosity/Chapman-Enskog/EquationOfShearViscosityChapmanEnskog.hpp"
+#include "util/mixing_rules/TemperatureTable.hpp"
 
 class EquationOfShearViscosityMixingRulesChapmanEnskog: public EquationOfShearViscosityMixingRules
 {
@@ -102,6 +103,30 @@ class EquationOfShearViscosityMixingRulesChapmanEnskog: public EquationOfShearVi
             const int species_index = 0) const;
         
     private:
+        /*
+         * Compute the shear viscosity of a species from its table or from the equation of shear
+         * viscosity.
+         */
+        double
+        getShearViscosityOfSpecies(
+            const double* const pressure,
+            const double* const temperature,
+            const std::vector<const double*>& species_molecular_properties,
+            const int species_index) const;
+        
+        /*
+         * Compute the shear viscosity of a species from its table or from the equation of shear
+         * viscosity.
+         */
+        void
+        computeShearViscosityOfSpecies(
+            boost::shared_ptr<pdat::CellData<double> >& data_shear_viscosity_species,
+            const boost::shared_ptr<pdat::CellData<double> >& data_pressure,
+            const boost::shared_ptr<pdat::CellData<double> >& data_temperature,
+            const std::vector<const double*>& species_molecular_properties,
+            const int species_index,
+            const hier::Box& domain) const;
+        
         /*
          * Lennard-Jones energy parameter of different species.
          */
@@ -122,6 +147,13 @@ class EquationOfShearViscosityMixingRulesChapmanEnskog: public EquationOfShearVi
          */
         boost::shared_ptr<EquationOfShearViscosity> d_equation_of_shear_viscosity;
         
+        /*
+         * Settings of the temperature tables and the tables of the shear viscosity of different
+         * species.
+         */
+        TemperatureTableSettings d_temperature_table_settings;
+        std::vector<boost::shared_ptr<TemperatureTable> > d_species_shear_viscosity_tables;
+        
 };
     
 
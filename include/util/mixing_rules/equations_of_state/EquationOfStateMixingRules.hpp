@@ -50,6 +50,26 @@ class EquationOfStateMixingRules
         putToRestart(
             const boost::shared_ptr<tbox::Database>& restart_db) const = 0;
         
+        /*
+         * Start caching the thermodynamic properties of the mixture computed from the given cell
+         * data of species fractions. The cached properties are reused by all the functions taking
+         * the same cell data of species fractions until the caching is stopped. The cell data must
+         * not be modified while it is cached.
+         */
+        virtual void
+        startCachingMixtureThermodynamicProperties(
+            const boost::shared_ptr<pdat::CellData<double> >& data_species_fractions) const
+        {
+            NULL_USE(data_species_fractions);
+        }
+        
+        /*
+         * Stop caching the thermodynamic properties of the mixture.
+         */
+        virtual void
+        stopCachingMixtureThermodynamicProperties() const
+        {}
+        
         /*
          * Compute the pressure of the mixture with isothermal and isobaric equilibria assumptions.
          */
@@ -878,6 +898,56 @@ class EquationOfStateMixingRules
             int side_normal,
             const hier::Box& domain) const = 0;
         
+        /*
+         * Compute the pressure of the mixture with isothermal and isobaric equilibria assumptions
+         * for a batch of values stored in contiguous arrays. The mass fractions of all species are
+         * stored species by species, i.e. the mass fraction of species si of value n is at
+         * mass_fractions[si*num_values + n].
+         */
+        virtual void
+        computePressure(
+            double* const pressure,
+            const double* const density,
+            const double* const internal_energy,
+            const double* const mass_fractions,
+            const int num_values) const = 0;
+        
+        /*
+         * Compute the temperature of the mixture with isothermal and isobaric equilibria
+         * assumptions for a batch of values stored in contiguous arrays.
+         */
+        virtual void
+        computeTemperature(
+            double* const temperature,
+            const double* const density,
+            const double* const pressure,
+            const double* const mass_fractions,
+            const int num_values) const = 0;
+        
+        /*
+         * Compute the specific internal energy of the mixture from temperature with isothermal
+         * and isobaric equilibria assumptions for a batch of values stored in contiguous arrays.
+         */
+        virtual void
+        computeInternalEnergyFromTemperature(
+            double* const internal_energy,
+            const double* const density,
+            const double* const temperature,
+            const double* const mass_fractions,
+            const int num_values) const = 0;
+        
+        /*
+         * Compute the density of mixture with isothermal and isobaric equilibria assumptions for a
+         * batch of values stored in contiguous arrays.
+         */
+        virtual void
+        computeMixtureDensity(
+            double* const mixture_density,
+            const double* const pressure,
+            const double* const temperature,
+            const double* const mass_fractions,
+            const int num_values) const = 0;
+        
         /*
          * Get the number of thermodynamic properties of a species.
          */
@@ -3,6 +3,7 @@
 
 #include "util/mixing_rules/equations_of_state/ideal_gas/EquationOfStateIdealGas.hpp"
 #include "util/mixing_rules/equations_of_state/ideal_gas/EquationOfStateMixingRulesIdealGas.hpp"
+#include "util/mixing_rules/equations_of_state/ideal_gas/EquationOfStateIdealGasPolicy.hpp"
 
 #include <map>
 #include <string>
@@ -0,0 +1,57 @@
+#ifndef EQUATION_OF_STATE_IDEAL_GAS_POLICY_HPP
+#define EQUATION_OF_STATE_IDEAL_GAS_POLICY_HPP
+
+#include <cmath>
+
+/*
+ * Compile-time policy of the ideal gas equation of state. The functions are static and inlined
+ * into the kernels of the flow models that are instantiated with the policy. The thermodynamic
+ * properties are the ones of EquationOfStateIdealGas, i.e. gamma, R, c_p and c_v.
+ */
+struct EquationOfStateIdealGasPolicy
+{
+    /*
+     * Compute the pressure.
+     */
+    static inline __attribute__((always_inline)) double
+    getPressure(
+        const double density,
+        const double internal_energy,
+        const double* const thermo_properties)
+    {
+        const double& gamma = thermo_properties[0];
+        
+        return (gamma - double(1))*density*internal_energy;
+    }
+    
+    /*
+     * Compute the sound speed.
+     */
+    static inline __attribute__((always_inline)) double
+    getSoundSpeed(
+        const double density,
+        const double pressure,
+        const double* const thermo_properties)
+    {
+        const double& gamma = thermo_properties[0];
+        
+        return sqrt(gamma*pressure/density);
+    }
+    
+    /*
+     * Compute the temperature.
+     */
+    static inline __attribute__((always_inline)) double
+    getTemperature(
+        const double density,
+        const double pressure,
+        const double* const thermo_properties)
+    {
+        const double& gamma = thermo_properties[0];
+        const double& c_v = thermo_properties[3];
+        
+        return pressure/((gamma - double(1))*c_v*density);
+    }
+};
+
+#endif /* EQUATION_OF_STATE_IDEAL_GAS_POLICY_HPP */
@@ -31,6 +31,20 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
         putToRestart(
             const boost::shared_ptr<tbox::Database>& restart_db) const;
         
+        /*
+         * Start caching the thermodynamic properties of the mixture computed from the given cell
+         * data of species fractions.
+         */
+        void
+        startCachingMixtureThermodynamicProperties(
+            const boost::shared_ptr<pdat::CellData<double> >& data_species_fractions) const;
+        
+        /*
+         * Stop caching the thermodynamic properties of the mixture.
+         */
+        void
+        stopCachingMixtureThermodynamicProperties() const;
+        
         /*
          * Return the boost::shared_ptr to the equation of state.
          */
@@ -411,6 +425,54 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
             int side_normal,
             const hier::Box& domain) const;
         
+        /*
+         * Compute the pressure of the mixture with isothermal and isobaric equilibria assumptions
+         * for a batch of values stored in contiguous arrays.
+         */
+        void
+        computePressure(
+            double* const pressure,
+            const double* const density,
+            const double* const internal_energy,
+            const double* const mass_fractions,
+            const int num_values) const;
+        
+        /*
+         * Compute the temperature of the mixture with isothermal and isobaric equilibria
+         * assumptions for a batch of values stored in contiguous arrays.
+         */
+        void
+        computeTemperature(
+            double* const temperature,
+            const double* const density,
+            const double* const pressure,
+            const double* const mass_fractions,
+            const int num_values) const;
+        
+        /*
+         * Compute the specific internal energy of the mixture from temperature with isothermal
+         * and isobaric equilibria assumptions for a batch of values stored in contiguous arrays.
+         */
+        void
+        computeInternalEnergyFromTemperature(
+            double* const internal_energy,
+            const double* const density,
+            const double* const temperature,
+            const double* const mass_fractions,
+            const int num_values) const;
+        
+        /*
+         * Compute the density of mixture with isothermal and isobaric equilibria assumptions for a
+         * batch of values stored in contiguous arrays.
+         */
+        void
+        computeMixtureDensity(
+            double* const mixture_density,
+            const double* const pressure,
+            const double* const temperature,
+            const double* const mass_fractions,
+            const int num_values) const;
+        
         /*
          * Get the number of thermodynamic properties of a species.
          */
@@ -436,6 +498,16 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
         int
         getNumberOfMixtureThermodynamicProperties() const;
         
+        /*
+         * Get the cell data of the thermodynamic properties of the mixture.
+         */
+        boost::shared_ptr<pdat::CellData<double> >
+        getCellDataMixtureThermodynamicProperties(
+            const boost::shared_ptr<pdat::CellData<double> >& data_species_fraction,
+            const hier::Box& interior_box,
+            const hier::IntVector& num_ghosts_min,
+            const hier::Box& domain) const;
+        
         /*
          * Get the thermodynamic properties of the mixture.
          */
@@ -463,6 +535,17 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
             int side_normal,
             const hier::Box& domain) const;
         
+        /*
+         * Compute the isobaric and isochoric specific heat capacities of the mixture with mass
+         * fractions for a batch of values stored in contiguous arrays.
+         */
+        void
+        computeMixtureSpecificHeatCapacities(
+            double* const c_p,
+            double* const c_v,
+            const double* const mass_fractions,
+            const int num_values) const;
+        
         /*
          * Compute the thermodynamic properties of the mixture with mass fractions.
          */
@@ -664,6 +747,13 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
          */
         boost::shared_ptr<EquationOfState> d_equation_of_state;
         
+        /*
+         * Cell data of species fractions whose mixture thermodynamic properties are cached and the
+         * cached cell data of the mixture thermodynamic properties.
+         */
+        mutable boost::shared_ptr<pdat::CellData<double> > d_data_species_fractions_cached;
+        mutable boost::shared_ptr<pdat::CellData<double> > d_data_mixture_thermo_properties_cached;
+        
 };
 
 #endif /* EQUATION_OF_STATE_MIXING_RULES_IDEAL_GAS_HPP */
@@ -5,6 +5,7 @@
 
 #include "util/mixing_rules/equations_of_thermal_conductivity/Prandtl/EquationOfThermalConductivityPrandtl.hpp"
 #include "util/mixing_rules/equations_of_shear_viscosity/EquationOfShearViscosityMixingRulesManager.hpp"
+#include "util/mixing_rules/TemperatureTable.hpp"
 
 class EquationOfThermalConductivityMixingRulesPrandtl: public EquationOfThermalConductivityMixingRules
 {
@@ -83,6 +84,30 @@ class EquationOfThermalConductivityMixingRulesPrandtl: public EquationOfThermalC
             const int species_index = 0) const;
         
     private:
+        /*
+         * Compute the thermal conductivity of a species from its table or from the equation of
+         * thermal conductivity.
+         */
+        double
+        getThermalConductivityOfSpecies(
+            const double* const pressure,
+            const double* const temperature,
+            const std::vector<const double*>& species_molecular_properties,
+            const int species_index) const;
+        
+        /*
+         * Compute the thermal conductivity of a species from its table or from the equation of
+         * thermal conductivity.
+         */
+        void
+        computeThermalConductivityOfSpecies(
+            boost::shared_ptr<pdat::CellData<double> >& data_thermal_conductivity_species,
+            const boost::shared_ptr<pdat::CellData<double> >& data_pressure,
+            const boost::shared_ptr<pdat::CellData<double> >& data_temperature,
+            const std::vector<const double*>& species_molecular_properties,
+            const int species_index,
+            const hier::Box& domain) const;
+        
         /*
          * Specific heats at constant pressure of different species.
          */
@@ -118,6 +143,14 @@ class EquationOfThermalConductivityMixingRulesPrandtl: public EquationOfThermalC
          */
         boost::shared_ptr<EquationOfThermalConductivity> d_equation_of_thermal_conductivity;
         
+        /*
+         * Settings of the temperature tables and the tables of the thermal conductivity of different
+         * species. The settings are printed and put into the restart database by the shear viscosity
+         * mixing rules object reading the same database.
+         */
+        TemperatureTableSettings d_temperature_table_settings;
+        std::vector<boost::shared_ptr<TemperatureTable> > d_species_thermal_conductivity_tables;
+        
 };
     
 
@@ -0,0 +1,149 @@
+#ifndef PATCH_TILES_HPP
+#define PATCH_TILES_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/Patch.h"
+#include "SAMRAI/hier/PatchData.h"
+#include "SAMRAI/hier/Transformation.h"
+#include "SAMRAI/hier/Variable.h"
+
+#include "boost/shared_ptr.hpp"
+#include <vector>
+
+using namespace SAMRAI;
+
+/*
+ * Class PatchTiles splits a patch into tiles so that an operator can be run on one tile of cells
+ * at a time and its intermediate data stays in cache. A tile is a hier::Patch with the shape of a
+ * tile box of the patch. Its patch data are allocated with the same factories as the data of the
+ * patch, so the data of the tile have the same ghost cell widths as the data of the patch.
+ *
+ * The tiles are cached by their numbers of cells. The data of a tile are allocated once per tile
+ * shape, variable and ghost cell width and are reused for all the tile boxes of that shape on all
+ * patches and at all Runge-Kutta stages. So that one tile serves the tile boxes at different places
+ * of the patches, the box of a tile starts at the zero index and the data are copied between the
+ * patch and the tile with the shift from the tile box to the box of the tile. The tile shares the
+ * geometry of the patch, of which only the grid spacing is meaningful on the tile.
+ */
+class PatchTiles
+{
+    public:
+        PatchTiles() {}
+        
+        /*
+         * Get the number of tiles of a patch box. The last tile in each direction is truncated by
+         * the patch box.
+         */
+        static int
+        getNumberOfTiles(
+            const hier::Box& patch_box,
+            const hier::IntVector& tile_size);
+        
+        /*
+         * Get the box of the tile with the given index. The tiles are numbered with the index in the
+         * x-direction running fastest.
+         */
+        static hier::Box
+        getTileBox(
+            const hier::Box& patch_box,
+            const hier::IntVector& tile_size,
+            const int tile_index);
+        
+        /*
+         * Check whether processing a patch box tile by tile is expected to pay off for an operator
+         * that reads the given number of ghost cells around each tile. The ghost cells of every tile
+         * are copied into the tile and the derived data are recomputed on them, so the work on a
+         * tile grows with the volume of its ghost box. The tiles are only used if the patch box is
+         * larger than one tile and the ratio of the number of ghost cells to the number of interior
+         * cells of a full tile is at most s_max_halo_to_tile_volume_ratio.
+         */
+        static bool
+        isTilingBeneficial(
+            const hier::Box& patch_box,
+            const hier::IntVector& tile_size,
+            const hier::IntVector& num_ghosts);
+        
+        /*
+         * Largest ratio of the number of ghost cells to the number of interior cells of a tile for
+         * which the patches are processed tile by tile. It is one, so the ghost cells of a tile are
+         * at most as many as its interior cells. For example, with four ghost cells in three
+         * dimensions, tiles of 32^3 cells (ratio 0.95) are used while tiles of 16^3 cells (ratio
+         * 2.4) fall back to processing the whole patch at once.
+         */
+        static const double s_max_halo_to_tile_volume_ratio;
+        
+        /*
+         * Get the cached tile for a tile box of a patch with the patch data of the given indices
+         * allocated. The data of the given indices should belong to different variables. The data
+         * are only allocated the first time a tile of the same shape is used with a variable of the
+         * same ghost cell width and are otherwise bound to the data allocated before.
+         */
+        hier::Patch&
+        getTile(
+            const hier::Patch& patch,
+            const hier::Box& tile_box,
+            const std::vector<int>& data_ids);
+        
+        /*
+         * Copy the data of the patch into the data of the tile for a tile box of the patch, including
+         * the ghost cells of the tile data.
+         */
+        static void
+        copyPatchDataToTile(
+            hier::Patch& tile,
+            const hier::Patch& patch,
+            const hier::Box& tile_box,
+            const std::vector<int>& data_ids);
+        
+        /*
+         * Copy the data of the tile covered by the tile box back into the patch (e.g. the cells of the
+         * tile for cell data and the faces of the tile for side data). The data on the faces shared
+         * by neighboring tiles are expected to be identical in both tiles.
+         */
+        static void
+        copyTileDataToPatch(
+            hier::Patch& patch,
+            const hier::Patch& tile,
+            const hier::Box& tile_box,
+            const std::vector<int>& data_ids);
+        
+        /*
+         * Get the transformation from the index space of the patch to the index space of the tile
+         * for a tile box of the patch.
+         */
+        static hier::Transformation
+        getPatchToTileTransformation(
+            const hier::Patch& tile,
+            const hier::Box& tile_box);
+        
+        /*
+         * Get the transformation from the index space of the tile to the index space of the patch
+         * for a tile box of the patch.
+         */
+        static hier::Transformation
+        getTileToPatchTransformation(
+            const hier::Patch& tile,
+            const hier::Box& tile_box);
+        
+        /*
+         * Release the cached tiles and their data.
+         */
+        void
+        clearTiles();
+        
+    private:
+        /*
+         * Cached tiles and, for each tile, the data allocated on it together with the variables and
+         * the ghost cell widths of the data.
+         */
+        std::vector<boost::shared_ptr<hier::Patch> > d_tiles;
+        std::vector<std::vector<boost::shared_ptr<hier::Variable> > > d_tile_data_variables;
+        std::vector<std::vector<hier::IntVector> > d_tile_data_ghost_widths;
+        std::vector<std::vector<boost::shared_ptr<hier::PatchData> > > d_tile_data;
+        
+};
+
+#endif /* PATCH_TILES_HPP */
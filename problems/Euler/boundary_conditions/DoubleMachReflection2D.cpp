@@ -100,83 +100,144 @@ EulerSpecialBoundaryConditions::setSpecialBoundaryConditions(
             double(1)/double(2)*rho_post_shock*(u_post_shock*u_post_shock + v_post_shock*v_post_shock);
         
         /*
-         * Update the bottom boundary conditions.
+         * Get the cached index masks of the ghost cells and coordinates of the ghost cells at the
+         * top boundary. They are set up the first time the ghost cells of the patch are filled:
+         * d_cell_indices[0] ... ghost cells at the bottom boundary behind the initial shock,
+         * d_cell_indices[1] ... ghost cells at the bottom boundary along the wall,
+         * d_cell_indices[2] ... mirror cells of the ghost cells along the wall,
+         * d_cell_indices[3] ... ghost cells at the top boundary,
+         * d_coefficients[0] ... x-coordinates of the ghost cells at the top boundary.
          */
         
-        if (patch_geom->getTouchesRegularBoundary(1, 0))
+        boost::shared_ptr<SpecialBoundaryConditionsPatchData> patch_data =
+            d_cache.getPatchData(patch, ghost_width_to_fill, num_ghosts);
+        
+        if (!patch_data)
         {
-            for (int i = 0; i < interior_dims[0]; i++)
+            patch_data = d_cache.createPatchData(patch, ghost_width_to_fill, num_ghosts);
+            
+            patch_data->d_cell_indices.resize(4);
+            patch_data->d_coefficients.resize(1);
+            
+            std::vector<int>& idx_bottom_post_shock = patch_data->d_cell_indices[0];
+            std::vector<int>& idx_bottom_wall = patch_data->d_cell_indices[1];
+            std::vector<int>& idx_bottom_wall_mirror = patch_data->d_cell_indices[2];
+            std::vector<int>& idx_top = patch_data->d_cell_indices[3];
+            std::vector<double>& x_top = patch_data->d_coefficients[0];
+            
+            if (patch_geom->getTouchesRegularBoundary(1, 0))
             {
                 for (int j = -ghost_width_to_fill[1];
                      j < 0;
                      j++)
                 {
-                    const int idx_cell = (i + num_ghosts[0]) +
-                        (j + num_ghosts[1])*ghostcell_dims[0];
-                    
-                    // Compute the coordinates.
-                    double x[2];
-                    x[0] = patch_xlo[0] + (i + double(1)/double(2))*dx[0];
-                    x[1] = patch_xlo[1] + (j + double(1)/double(2))*dx[1];
-                    
-                    if (x[0] < x_0)
+                    for (int i = 0; i < interior_dims[0]; i++)
                     {
-                        rho[idx_cell] = rho_post_shock;
-                        rho_u[idx_cell] = rho_u_post_shock;
-                        rho_v[idx_cell] = rho_v_post_shock;
-                        E[idx_cell] = E_post_shock;
+                        const int idx_cell = (i + num_ghosts[0]) +
+                            (j + num_ghosts[1])*ghostcell_dims[0];
+                        
+                        // Compute the x-coordinate.
+                        const double x = patch_xlo[0] + (i + double(1)/double(2))*dx[0];
+                        
+                        if (x < x_0)
+                        {
+                            idx_bottom_post_shock.push_back(idx_cell);
+                        }
+                        else
+                        {
+                            const int idx_mirror_cell = (i + num_ghosts[0]) +
+                                (-j + num_ghosts[1] - 1)*ghostcell_dims[0];
+                            
+                            idx_bottom_wall.push_back(idx_cell);
+                            idx_bottom_wall_mirror.push_back(idx_mirror_cell);
+                        }
                     }
-                    else
+                }
+            }
+            
+            if (patch_geom->getTouchesRegularBoundary(1, 1))
+            {
+                for (int j = interior_dims[1];
+                     j < interior_dims[1] + ghost_width_to_fill[1];
+                     j++)
+                {
+                    for (int i = 0; i < interior_dims[0]; i++)
                     {
-                        const int idx_mirror_cell = (i + num_ghosts[0]) +
-                            (-j + num_ghosts[1] - 1)*ghostcell_dims[0];
+                        const int idx_cell = (i + num_ghosts[0]) +
+                            (j + num_ghosts[1])*ghostcell_dims[0];
                         
-                        rho[idx_cell] = rho[idx_mirror_cell];
-                        rho_u[idx_cell] = rho_u[idx_mirror_cell];
-                        rho_v[idx_cell] = -rho_v[idx_mirror_cell];
-                        E[idx_cell] = E[idx_mirror_cell];
+                        idx_top.push_back(idx_cell);
+                        x_top.push_back(patch_xlo[0] + (i + double(1)/double(2))*dx[0]);
                     }
                 }
             }
         }
         
         /*
-         * Update the top boundary conditions.
+         * Update the bottom boundary conditions.
          */
         
-        if (patch_geom->getTouchesRegularBoundary(1, 1))
         {
+            const std::vector<int>& idx_bottom_post_shock = patch_data->d_cell_indices[0];
+            const std::vector<int>& idx_bottom_wall = patch_data->d_cell_indices[1];
+            const std::vector<int>& idx_bottom_wall_mirror = patch_data->d_cell_indices[2];
+            
+            const int num_post_shock_cells = static_cast<int>(idx_bottom_post_shock.size());
+            const int num_wall_cells = static_cast<int>(idx_bottom_wall.size());
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int n = 0; n < num_post_shock_cells; n++)
+            {
+                const int idx_cell = idx_bottom_post_shock[n];
+                
+                rho[idx_cell] = rho_post_shock;
+                rho_u[idx_cell] = rho_u_post_shock;
+                rho_v[idx_cell] = rho_v_post_shock;
+                E[idx_cell] = E_post_shock;
+            }
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int n = 0; n < num_wall_cells; n++)
+            {
+                const int idx_cell = idx_bottom_wall[n];
+                const int idx_mirror_cell = idx_bottom_wall_mirror[n];
+                
+                rho[idx_cell] = rho[idx_mirror_cell];
+                rho_u[idx_cell] = rho_u[idx_mirror_cell];
+                rho_v[idx_cell] = -rho_v[idx_mirror_cell];
+                E[idx_cell] = E[idx_mirror_cell];
+            }
+        }
+        
+        /*
+         * Update the top boundary conditions. Only the shock position depends on time.
+         */
+        
+        {
+            const std::vector<int>& idx_top = patch_data->d_cell_indices[3];
+            const std::vector<double>& x_top = patch_data->d_coefficients[0];
+            
+            const int num_top_cells = static_cast<int>(idx_top.size());
+            
             const double x_s = x_0 + (double(1) + double(20)*fill_time)/sqrt(double(3));
             
-            for (int i = 0; i < interior_dims[0]; i++)
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int n = 0; n < num_top_cells; n++)
             {
-                for (int j = interior_dims[1];
-                     j < interior_dims[1] + ghost_width_to_fill[1];
-                     j++)
-                {
-                    const int idx_cell = (i + num_ghosts[0]) +
-                        (j + num_ghosts[1])*ghostcell_dims[0];
-                    
-                    // Compute the coordinates.
-                    double x[2];
-                    x[0] = patch_xlo[0] + (i + double(1)/double(2))*dx[0];
-                    x[1] = patch_xlo[1] + (j + double(1)/double(2))*dx[1];
-                    
-                    if (x[0] >= x_s)
-                    {
-                        rho[idx_cell] = rho_pre_shock;
-                        rho_u[idx_cell] = rho_u_pre_shock;
-                        rho_v[idx_cell] = rho_v_pre_shock;
-                        E[idx_cell] = E_pre_shock;
-                    }
-                    else
-                    {
-                        rho[idx_cell] = rho_post_shock;
-                        rho_u[idx_cell] = rho_u_post_shock;
-                        rho_v[idx_cell] = rho_v_post_shock;
-                        E[idx_cell] = E_post_shock;
-                    }
-                }
+                const int idx_cell = idx_top[n];
+                
+                const bool is_pre_shock = (x_top[n] >= x_s);
+                
+                rho[idx_cell] = is_pre_shock ? rho_pre_shock : rho_post_shock;
+                rho_u[idx_cell] = is_pre_shock ? rho_u_pre_shock : rho_u_post_shock;
+                rho_v[idx_cell] = is_pre_shock ? rho_v_pre_shock : rho_v_post_shock;
+                E[idx_cell] = is_pre_shock ? E_pre_shock : E_post_shock;
             }
         }
     }
@@ -0,0 +1,81 @@
+#include "algs/integrator/GhostWidthVariableFillPattern.hpp"
+
+const std::string GhostWidthVariableFillPattern::s_name_id = "GHOST_WIDTH_FILL_PATTERN";
+
+GhostWidthVariableFillPattern::GhostWidthVariableFillPattern(
+    const hier::IntVector& ghost_width):
+        d_ghost_width(ghost_width)
+{
+    TBOX_ASSERT(ghost_width >= hier::IntVector::getZero(ghost_width.getDim()));
+}
+
+
+GhostWidthVariableFillPattern::~GhostWidthVariableFillPattern()
+{
+}
+
+
+/*
+ * Calculate the overlap between the source and destination geometries, restricted to the cells
+ * within the ghost cell width of the destination patch box.
+ */
+boost::shared_ptr<hier::BoxOverlap>
+GhostWidthVariableFillPattern::calculateOverlap(
+    const hier::BoxGeometry& dst_geometry,
+    const hier::BoxGeometry& src_geometry,
+    const hier::Box& dst_patch_box,
+    const hier::Box& src_mask,
+    const hier::Box& fill_box,
+    const bool overwrite_interior,
+    const hier::Transformation& transformation) const
+{
+    TBOX_ASSERT_OBJDIM_EQUALITY2(dst_patch_box, d_ghost_width);
+    
+    hier::Box ghost_width_box(dst_patch_box);
+    ghost_width_box.grow(d_ghost_width);
+    
+    return dst_geometry.calculateOverlap(
+        src_geometry,
+        src_mask,
+        fill_box*ghost_width_box,
+        overwrite_interior,
+        transformation);
+}
+
+
+/*
+ * Compute the overlap of the fill boxes and the data box, restricted to the cells within the
+ * ghost cell width of the patch box.
+ */
+boost::shared_ptr<hier::BoxOverlap>
+GhostWidthVariableFillPattern::computeFillBoxesOverlap(
+    const hier::BoxContainer& fill_boxes,
+    const hier::BoxContainer& node_fill_boxes,
+    const hier::Box& patch_box,
+    const hier::Box& data_box,
+    const hier::PatchDataFactory& pdf) const
+{
+    NULL_USE(node_fill_boxes);
+    
+    TBOX_ASSERT_OBJDIM_EQUALITY2(patch_box, d_ghost_width);
+    
+    hier::Box ghost_width_box(patch_box);
+    ghost_width_box.grow(d_ghost_width);
+    
+    hier::BoxContainer overlap_boxes(fill_boxes);
+    overlap_boxes.intersectBoxes(data_box*ghost_width_box);
+    
+    hier::Transformation transformation(hier::IntVector::getZero(patch_box.getDim()));
+    
+    return pdf.getBoxGeometry(patch_box)->setUpOverlap(overlap_boxes, transformation);
+}
+
+
+/*
+ * Return the ghost cell width to fill.
+ */
+const hier::IntVector&
+GhostWidthVariableFillPattern::getStencilWidth()
+{
+    return d_ghost_width;
+}
@@ -13,6 +13,10 @@
 
 #include "algs/integrator/RungeKuttaLevelIntegrator.hpp"
 
+#include "SAMRAI/math/PatchCellDataOpsReal.h"
+#include "SAMRAI/math/PatchFaceDataOpsReal.h"
+#include "SAMRAI/math/PatchSideDataOpsReal.h"
+#include "SAMRAI/pdat/ArrayData.h"
 #include "SAMRAI/pdat/CellData.h"
 #include "SAMRAI/pdat/FaceData.h"
 #include "SAMRAI/pdat/FaceDataFactory.h"
@@ -38,152 +42,29 @@
 #include "SAMRAI/tbox/Utilities.h"
 #include "SAMRAI/tbox/MathUtilities.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <fstream>
 #include <string>
 
 /*
- **************************************************************************************************
- *
- * External declarations for FORTRAN 77 routines used in flux synchronization process between
- * hierarchy levels.
- *
- **************************************************************************************************
+ * Whether the fluxes and sources of a step are accumulated, i.e. whether any of their weights is
+ * nonzero.
  */
-extern "C"
+static bool
+isAccumulatingFluxesAndSources(
+    const std::vector<double>& gamma)
 {
+    for (int n = 0; n < static_cast<int>(gamma.size()); n++)
+    {
+        if (gamma[n] != 0.0)
+        {
+            return true;
+        }
+    }
     
-#ifdef __INTEL_COMPILER
-#pragma warning (disable:1419)
-#endif
-    
-    // in upfluxsum1d.m4:
-    void SAMRAI_F77_FUNC(upfluxsum1d, UPFLUXSUM1D) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *,
-        double *);
-    // in upfluxsum2d.m4:
-    void SAMRAI_F77_FUNC(upfluxsumface2d0, UPFLUXSUMFACE2D0) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *, double *);
-    void SAMRAI_F77_FUNC(upfluxsumface2d1, UPFLUXSUMFACE2D1) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *,
-        double *);
-    void SAMRAI_F77_FUNC(upfluxsumside2d0, UPFLUXSUMSIDE2D0) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *,
-        double *);
-    void SAMRAI_F77_FUNC(upfluxsumside2d1, UPFLUXSUMSIDE2D1) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *,
-        double *);
-    // in upfluxsum3d.m4:
-    void SAMRAI_F77_FUNC(upfluxsumface3d0, UPFLUXSUMFACE3D0) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *,
-        double *);
-    void SAMRAI_F77_FUNC(upfluxsumface3d1, UPFLUXSUMFACE3D1) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *,
-        double *);
-    void SAMRAI_F77_FUNC(upfluxsumface3d2, UPFLUXSUMFACE3D2) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *,
-        double *);
-    void SAMRAI_F77_FUNC(upfluxsumside3d0, UPFLUXSUMSIDE3D0) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *,
-        double *);
-    void SAMRAI_F77_FUNC(upfluxsumside3d1, UPFLUXSUMSIDE3D1) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *,
-        double *);
-    void SAMRAI_F77_FUNC(upfluxsumside3d2, UPFLUXSUMSIDE3D2) (
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const int&,
-        const double *,
-        double *);
+    return false;
 }
 
 
@@ -268,9 +149,17 @@ RungeKuttaLevelIntegrator::RungeKuttaLevelIntegrator(
     d_lag_dt_computation(true),
     d_use_ghosts_for_dt(false),
     d_dt(tbox::MathUtilities<double>::getSignalingNaN()),
+    d_use_super_time_stepping(false),
+    d_use_implicit_diffusion(false),
+    d_implicit_diffusion_max_newton_iterations(10),
+    d_implicit_diffusion_newton_tolerance(1.0e-8),
+    d_implicit_diffusion_max_krylov_iterations(50),
+    d_implicit_diffusion_krylov_tolerance(1.0e-4),
+    d_keep_advance_data_allocated(true),
     d_flux_is_face(true),
     d_flux_face_registered(false),
     d_flux_side_registered(false),
+    d_initialize_flux_and_source_accumulators(false),
     d_number_time_data_levels(2),
     d_scratch(hier::VariableDatabase::getDatabase()->getContext("SCRATCH")),
     d_current(hier::VariableDatabase::getDatabase()->getContext("CURRENT")),
@@ -295,16 +184,40 @@ RungeKuttaLevelIntegrator::RungeKuttaLevelIntegrator(
     }
     getFromInput(input_db, from_restart);
     
-    d_intermediate.resize(d_number_steps);
-    d_intermediate_time_dep_data.resize(d_number_steps);
-    d_intermediate_flux_var_data.resize(d_number_steps);
-    d_intermediate_source_var_data.resize(d_number_steps);
-    for (int sn = 0; sn < d_number_steps; sn++)
+    /*
+     * The super-time-stepping and the implicit advance of the diffusive part of the right-hand side
+     * need at least three and four intermediate contexts respectively.
+     */
+    d_number_intermediate_contexts = d_number_steps;
+    if (d_use_super_time_stepping)
+    {
+        d_number_intermediate_contexts = std::max(d_number_steps, 3);
+    }
+    else if (d_use_implicit_diffusion)
+    {
+        d_number_intermediate_contexts = std::max(d_number_steps, 4);
+    }
+    
+    d_intermediate.resize(d_number_intermediate_contexts);
+    d_intermediate_time_dep_data.resize(d_number_intermediate_contexts);
+    d_intermediate_flux_var_data.resize(d_number_intermediate_contexts);
+    d_intermediate_source_var_data.resize(d_number_intermediate_contexts);
+    for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
     {
         std::string context_string = "INTERMEDIATE_" + tbox::Utilities::intToString(sn);
         d_intermediate[sn] = hier::VariableDatabase::getDatabase()->getContext(context_string);
     }
     
+    if (d_use_implicit_diffusion)
+    {
+        d_implicit_diffusion_work.resize(NUM_WORK_CONTEXTS);
+        for (int wi = 0; wi < NUM_WORK_CONTEXTS; wi++)
+        {
+            std::string context_string = "IMPLICIT_DIFFUSION_WORK_" + tbox::Utilities::intToString(wi);
+            d_implicit_diffusion_work[wi] = hier::VariableDatabase::getDatabase()->getContext(context_string);
+        }
+    }
+    
     /*
      * If d_use_cfl is false, d_use_time_refinement is turned off automatically.
      */
@@ -535,6 +448,15 @@ RungeKuttaLevelIntegrator::resetHierarchyConfiguration(
             t_new_advance_bdry_fill_create->stop();
         }
     }
+    
+    /*
+     * Let the patch strategy reset its cached patch-dependent data of the levels.
+     */
+    
+    d_patch_strategy->resetHierarchyConfiguration(
+        hierarchy,
+        coarsest_level,
+        finest_hiera_level);
 }
 
 
@@ -1180,6 +1102,9 @@ RungeKuttaLevelIntegrator::getLevelDt(
     
     double global_dt = 0.0;
     
+    // Whether the scratch data is kept allocated for the next computations on the level.
+    const bool keep_advance_data_allocated = d_keep_advance_data_allocated && level->inHierarchy();
+    
     t_get_level_dt->start();
     
     if (d_use_cfl)
@@ -1203,11 +1128,10 @@ RungeKuttaLevelIntegrator::getLevelDt(
                 patch->allocatePatchData(d_temp_var_scratch_data, dt_time);
                 
                 double patch_dt;
-                patch_dt = d_patch_strategy->
-                    computeStableDtOnPatch(
-                        *patch,
-                        initial_time,
-                        dt_time);
+                patch_dt = getStableDtOnPatch(
+                    *patch,
+                    initial_time,
+                    dt_time);
                 
                 dt = tbox::MathUtilities<double>::Min(dt, patch_dt);
                 //tbox::plog.precision(12);
@@ -1218,7 +1142,10 @@ RungeKuttaLevelIntegrator::getLevelDt(
                 //           << " dt " << dt
                 //           << std::endl;
                 
-                patch->deallocatePatchData(d_temp_var_scratch_data);
+                if (!keep_advance_data_allocated)
+                {
+                    patch->deallocatePatchData(d_temp_var_scratch_data);
+                }
             }
          
             d_patch_strategy->clearDataContext();
@@ -1244,11 +1171,10 @@ RungeKuttaLevelIntegrator::getLevelDt(
                 patch->allocatePatchData(d_temp_var_scratch_data, dt_time);
                 
                 double patch_dt;
-                patch_dt = d_patch_strategy->
-                    computeStableDtOnPatch(
-                        *patch,
-                        initial_time,
-                        dt_time);
+                patch_dt = getStableDtOnPatch(
+                    *patch,
+                    initial_time,
+                    dt_time);
                 
                 dt = tbox::MathUtilities<double>::Min(dt, patch_dt);
                 //tbox::plog.precision(12);
@@ -1259,7 +1185,10 @@ RungeKuttaLevelIntegrator::getLevelDt(
                 //           << " dt " << dt
                 //           << std::endl;
                 
-                patch->deallocatePatchData(d_temp_var_scratch_data);
+                if (!keep_advance_data_allocated)
+                {
+                    patch->deallocatePatchData(d_temp_var_scratch_data);
+                }
             }
             
             d_patch_strategy->clearDataContext();
@@ -1272,7 +1201,10 @@ RungeKuttaLevelIntegrator::getLevelDt(
          
             copyTimeDependentData(level, d_scratch, d_current);
          
-            level->deallocatePatchData(d_saved_var_scratch_data);
+            if (!keep_advance_data_allocated)
+            {
+                level->deallocatePatchData(d_saved_var_scratch_data);
+            }
         }
         
         t_get_level_dt_sync->start();
@@ -1440,6 +1372,15 @@ RungeKuttaLevelIntegrator::advanceLevel(
     const int level_number = level->getLevelNumber();
     const double dt = new_time - current_time;
     
+    /*
+     * The scratch and intermediate data of the advance is kept allocated on levels in the hierarchy
+     * so that the next advances of the level reuse it without allocating it again. The data lives as
+     * long as the level, i.e. until the level is regridded. The data of temporary levels is always
+     * deallocated.
+     */
+    
+    const bool keep_advance_data_allocated = d_keep_advance_data_allocated && level->inHierarchy();
+    
     /*
      * (1) Allocate data needed for advancing level.
      * (2) Generate temporary communication schedule to fill ghost cells, if needed.
@@ -1450,13 +1391,18 @@ RungeKuttaLevelIntegrator::advanceLevel(
     level->allocatePatchData(d_new_time_dep_data, new_time);
     level->allocatePatchData(d_saved_var_scratch_data, current_time);
     
-    for (int sn = 0; sn < d_number_steps; sn++)
+    for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
     {
         level->allocatePatchData(d_intermediate_time_dep_data[sn], current_time);
         level->allocatePatchData(d_intermediate_flux_var_data[sn], current_time);
         level->allocatePatchData(d_intermediate_source_var_data[sn], current_time);
     }
     
+    if (d_use_implicit_diffusion)
+    {
+        level->allocatePatchData(d_implicit_diffusion_work_data, current_time);
+    }
+    
     boost::shared_ptr<xfer::RefineSchedule> fill_schedule;
     
     if (!level->inHierarchy())
@@ -1551,14 +1497,14 @@ RungeKuttaLevelIntegrator::advanceLevel(
     
     /*
      * (5) Call user-routine to pre-process state data, if needed.
-     * (6) Initialize all fluxes with zero values
      * (6) Advance solution on all level patches (scratch storage).
      *     In looping over Runge-Kutta sub-steps,
      *     (6a) Copy data from scatch data to the intermediate data.
      *          Dirchlet boundary conditions are applied at the coarse-fine boundaries of patches.
      *     (6b) Compute intermediate fluxes of current step.
      *     (6c) Advance one Runge-Kutta sub-step and accumulate the intermediate flux to the total
-     *          flux during this whole Runge-Kutta step. Time-independent intermediate data of next
+     *          flux during this whole Runge-Kutta step. The first accumulation overwrites the total
+     *          flux, which is therefore not initialized with zero values. Time-independent intermediate data of next
      *          Runge-Kutta step is stored in scratch context.
      * (7) Copy new solution to from scratch to new storage.
      * (8) Call user-routine to post-process state data, if needed.
@@ -1584,13 +1530,18 @@ RungeKuttaLevelIntegrator::advanceLevel(
         
         patch->allocatePatchData(d_temp_var_scratch_data, current_time);
         
-        // Fill all fluxes with zero values.
+        /*
+         * The fluxes and sources are not zero-filled here since the first step that accumulates
+         * them overwrites them. They are filled with signaling NaNs in debug mode to catch reads
+         * before they are written.
+         */
         
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
         std::list<boost::shared_ptr<hier::Variable> >::iterator flux_var =
             d_flux_variables.begin();
         
         while (flux_var != d_flux_variables.end())
-        {            
+        {
             if (d_flux_is_face)
             {
                 boost::shared_ptr<pdat::FaceData<double> > flux_data(
@@ -1598,7 +1549,7 @@ RungeKuttaLevelIntegrator::advanceLevel(
                         patch->getPatchData(*flux_var, d_scratch)));
                 
                 TBOX_ASSERT(flux_data);
-                flux_data->fillAll(0.0);
+                flux_data->fillAll(tbox::MathUtilities<double>::getSignalingNaN());
             }
             else
             {
@@ -1607,14 +1558,12 @@ RungeKuttaLevelIntegrator::advanceLevel(
                         patch->getPatchData(*flux_var, d_scratch)));
                 
                 TBOX_ASSERT(flux_data);
-                flux_data->fillAll(0.0);
+                flux_data->fillAll(tbox::MathUtilities<double>::getSignalingNaN());
             }
             
             flux_var++;
         }
         
-        // Fill all sources with zero values.
-        
         std::list<boost::shared_ptr<hier::Variable> >::iterator source_var =
             d_source_variables.begin();
         
@@ -1624,10 +1573,54 @@ RungeKuttaLevelIntegrator::advanceLevel(
                 BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
                     patch->getPatchData(*source_var, d_scratch)));
             
-            source_data->fillAll(0.0);
+            TBOX_ASSERT(source_data);
+            source_data->fillAll(tbox::MathUtilities<double>::getSignalingNaN());
             
             source_var++;
         }
+#endif
+    }
+    
+    d_initialize_flux_and_source_accumulators = true;
+    
+    /*
+     * If the diffusive part of the right-hand side is advanced with super-time-stepping or
+     * implicitly, it is advanced over half of the time increment before and after the Runge-Kutta
+     * steps of the convective part (Strang splitting). The number of stages of the super-time-
+     * stepping is chosen from the ratio of the half time increment to the stable time increment of
+     * the diffusive part so that the level is advanced with the time increment limited by the
+     * convective part only.
+     */
+    
+    const bool split_diffusion = d_use_super_time_stepping || d_use_implicit_diffusion;
+    
+    int num_super_time_stepping_stages = 0;
+    
+    if (d_use_super_time_stepping)
+    {
+        const double dt_diffusive = getLevelStableDiffusiveDt(level, current_time);
+        
+        num_super_time_stepping_stages = getNumberOfSuperTimeSteppingStages(0.5*dt, dt_diffusive);
+        
+        advanceLevelDiffusionWithSuperTimeStepping(
+            level,
+            current_time,
+            0.5*dt,
+            num_super_time_stepping_stages,
+            regrid_advance);
+    }
+    else if (d_use_implicit_diffusion)
+    {
+        advanceLevelDiffusionImplicitly(
+            level,
+            current_time,
+            0.5*dt,
+            regrid_advance);
+    }
+    
+    if (split_diffusion)
+    {
+        d_patch_strategy->setRightHandSideOperator(RHS_OPERATOR::CONVECTIVE);
     }
     
     const tbox::SAMRAI_MPI& mpi(hierarchy->getMPI());
@@ -1639,15 +1632,19 @@ RungeKuttaLevelIntegrator::advanceLevel(
         copyTimeDependentData(level, d_scratch, d_intermediate[sn]);
         
         /*
-         * Fill the ghost cell data for current intemediate data factory.
+         * Fill the ghost cell data for current intemediate data factory. The ghost cell data of the
+         * first step is also refilled when the scratch data has been advanced by the diffusive part.
          */
         
         boost::shared_ptr<xfer::RefineSchedule> fill_schedule_intermediate;
         
-        if (sn > 0)
+        if (sn > 0 || split_diffusion)
         {
+            const boost::shared_ptr<xfer::RefineAlgorithm>& bdry_fill_intermediate =
+                split_diffusion ? d_bdry_fill_intermediate_convective[sn] : d_bdry_fill_intermediate[sn];
+            
             fill_schedule_intermediate = 
-                d_bdry_fill_intermediate[sn]->createSchedule(
+                bdry_fill_intermediate->createSchedule(
                     level,
                     d_patch_strategy);
             
@@ -1691,7 +1688,7 @@ RungeKuttaLevelIntegrator::advanceLevel(
                 d_intermediate[sn]);
             
             // Advance a Runge-Kutta sub-step.
-            d_patch_strategy->advanceSingleStepOnPatch(
+            advanceSingleStepOnPatchAndAccumulateFluxes(
                 *patch,
                 current_time,
                 dt,
@@ -1703,18 +1700,55 @@ RungeKuttaLevelIntegrator::advanceLevel(
             t_patch_num_kernel->stop();
         }
         
+        if (isAccumulatingFluxesAndSources(d_gamma[sn]))
+        {
+            d_initialize_flux_and_source_accumulators = false;
+        }
+        
         fill_schedule_intermediate.reset();
     }
     
+    if (d_use_super_time_stepping)
+    {
+        advanceLevelDiffusionWithSuperTimeStepping(
+            level,
+            current_time + 0.5*dt,
+            0.5*dt,
+            num_super_time_stepping_stages,
+            regrid_advance);
+    }
+    else if (d_use_implicit_diffusion)
+    {
+        advanceLevelDiffusionImplicitly(
+            level,
+            current_time + 0.5*dt,
+            0.5*dt,
+            regrid_advance);
+    }
+    
     for (hier::PatchLevel::iterator ip(level->begin());
          ip != level->end();
          ip++)
     {
         const boost::shared_ptr<hier::Patch>& patch = *ip;
         
-        patch->deallocatePatchData(d_temp_var_scratch_data);
+        // Set the fluxes and sources to zero if none of the steps accumulates them.
+        if (d_initialize_flux_and_source_accumulators)
+        {
+            initializeFluxAndSourceAccumulatorsOnPatch(
+                *patch,
+                0.0,
+                d_scratch);
+        }
+        
+        if (!keep_advance_data_allocated)
+        {
+            patch->deallocatePatchData(d_temp_var_scratch_data);
+        }
     }
     
+    d_initialize_flux_and_source_accumulators = false;
+    
     d_patch_strategy->clearDataContext();
     
     level->setTime(new_time, d_saved_var_scratch_data);
@@ -1796,73 +1830,1239 @@ RungeKuttaLevelIntegrator::advanceLevel(
                 
                 // "false" argument indicates "initial_time" is false.
                 t_patch_num_kernel->start();
-                double patch_dt = d_patch_strategy->computeStableDtOnPatch(
+                double patch_dt = getStableDtOnPatch(
                     *patch,
                     false,
                     new_time);
                 t_patch_num_kernel->stop();
                 
-                dt_next = tbox::MathUtilities<double>::Min(dt_next, patch_dt);
+                dt_next = tbox::MathUtilities<double>::Min(dt_next, patch_dt);
+                
+                if (!keep_advance_data_allocated)
+                {
+                    patch->deallocatePatchData(d_temp_var_scratch_data);
+                }
+            }
+            d_patch_strategy->clearDataContext();
+        }
+        else
+        {
+            dt_next = d_dt;
+        }
+      
+    } // !regrid_advance
+    
+    if (!keep_advance_data_allocated)
+    {
+        level->deallocatePatchData(d_saved_var_scratch_data);
+        
+        for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
+        {
+            level->deallocatePatchData(d_intermediate_time_dep_data[sn]);
+            level->deallocatePatchData(d_intermediate_flux_var_data[sn]);
+            level->deallocatePatchData(d_intermediate_source_var_data[sn]);
+        }
+        
+        if (d_use_implicit_diffusion)
+        {
+            level->deallocatePatchData(d_implicit_diffusion_work_data);
+        }
+    }
+    
+    postprocessFluxAndSourceData(
+        level,
+        regrid_advance,
+        first_step,
+        last_step);
+    
+    t_advance_level->stop();
+    
+    t_advance_level_sync->start();
+    
+    if (d_distinguish_mpi_reduction_costs)
+    {
+        hierarchy->getMPI().Barrier();
+        t_advance_level_sync->stop();
+        t_advance_mpi_reductions->start();
+    }
+    
+    double next_dt = dt_next;
+    
+    if (mpi.getSize() > 1)
+    {
+        mpi.AllReduce(&next_dt, 1, MPI_MIN);
+    }
+    
+    if (d_use_cfl)
+    {
+        next_dt *= d_cfl;
+    }
+    
+    if (d_distinguish_mpi_reduction_costs)
+    {
+        t_advance_mpi_reductions->stop();
+    }
+    else
+    {
+        t_advance_level_sync->stop();
+    }
+    
+    return next_dt;
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Get the stable time increment on a patch. When the diffusive part of the right-hand side is
+ * advanced with super-time-stepping or implicitly, only the stable time increment of the
+ * convective part is used.
+ *
+ **************************************************************************************************
+ */
+double
+RungeKuttaLevelIntegrator::getStableDtOnPatch(
+    hier::Patch& patch,
+    const bool initial_time,
+    const double dt_time)
+{
+    if (d_use_super_time_stepping || d_use_implicit_diffusion)
+    {
+        double stable_dt_convective = 0.0;
+        double stable_dt_diffusive = 0.0;
+        
+        d_patch_strategy->computeStableDtsOnPatch(
+            patch,
+            initial_time,
+            dt_time,
+            stable_dt_convective,
+            stable_dt_diffusive);
+        
+        return stable_dt_convective;
+    }
+    
+    return d_patch_strategy->computeStableDtOnPatch(
+        patch,
+        initial_time,
+        dt_time);
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Get the stable time increment of the diffusive part of the right-hand side on a level from the
+ * scratch data. The ghost cells of the scratch data are assumed to be filled and the temporary
+ * scratch data is assumed to be allocated.
+ *
+ **************************************************************************************************
+ */
+double
+RungeKuttaLevelIntegrator::getLevelStableDiffusiveDt(
+    const boost::shared_ptr<hier::PatchLevel>& level,
+    const double dt_time)
+{
+    TBOX_ASSERT(level);
+    
+    const tbox::SAMRAI_MPI& mpi(level->getBoxLevel()->getMPI());
+    
+    double dt_diffusive = tbox::MathUtilities<double>::getMax();
+    
+    d_patch_strategy->setDataContext(d_scratch);
+    
+    for (hier::PatchLevel::iterator ip(level->begin());
+         ip != level->end();
+         ip++)
+    {
+        const boost::shared_ptr<hier::Patch>& patch = *ip;
+        
+        double patch_dt_convective = 0.0;
+        double patch_dt_diffusive = 0.0;
+        
+        t_patch_num_kernel->start();
+        d_patch_strategy->computeStableDtsOnPatch(
+            *patch,
+            false,
+            dt_time,
+            patch_dt_convective,
+            patch_dt_diffusive);
+        t_patch_num_kernel->stop();
+        
+        dt_diffusive = tbox::MathUtilities<double>::Min(dt_diffusive, patch_dt_diffusive);
+    }
+    
+    d_patch_strategy->clearDataContext();
+    
+    if (mpi.getSize() > 1)
+    {
+        mpi.AllReduce(&dt_diffusive, 1, MPI_MIN);
+    }
+    
+    return dt_diffusive*d_cfl;
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Get the number of stages of the RKL2 super-time-stepping. The RKL2 scheme with s stages is stable
+ * for time increments up to (s^2 + s - 2)/4 times the stable time increment of the forward Euler
+ * scheme.
+ *
+ **************************************************************************************************
+ */
+int
+RungeKuttaLevelIntegrator::getNumberOfSuperTimeSteppingStages(
+    const double dt,
+    const double dt_diffusive) const
+{
+    TBOX_ASSERT(dt_diffusive > 0.0);
+    
+    const double dt_ratio = dt/dt_diffusive;
+    
+    const int num_stages = static_cast<int>(ceil(0.5*(sqrt(9.0 + 16.0*dt_ratio) - 1.0)));
+    
+    return std::max(num_stages, 2);
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Get the fill pattern restricting the ghosts of the intermediate data filled to the width read by
+ * a part of the right-hand side. A null pointer, i.e. the default fill of all ghosts, is returned
+ * when the patch strategy does not provide the width or when the width is not smaller than the
+ * number of ghosts of the intermediate data.
+ *
+ **************************************************************************************************
+ */
+boost::shared_ptr<xfer::VariableFillPattern>
+RungeKuttaLevelIntegrator::getIntermediateVariableFillPattern(
+    const RHS_OPERATOR::TYPE& rhs_operator,
+    const hier::IntVector& ghosts_intermediate) const
+{
+    const tbox::Dimension& dim = ghosts_intermediate.getDim();
+    
+    const hier::IntVector num_ghosts_rhs =
+        d_patch_strategy->getRightHandSideOperatorNumberOfGhostCells(dim, rhs_operator);
+    
+    if (!(num_ghosts_rhs >= hier::IntVector::getZero(dim)) || num_ghosts_rhs >= ghosts_intermediate)
+    {
+        return boost::shared_ptr<xfer::VariableFillPattern>();
+    }
+    
+    return boost::shared_ptr<xfer::VariableFillPattern>(
+        new GhostWidthVariableFillPattern(hier::IntVector::min(num_ghosts_rhs, ghosts_intermediate)));
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Advance the scratch data on a level with the diffusive part of the right-hand side only, using
+ * the RKL2 super-time-stepping of Meyer, Balsara and Aslam (2014). Each stage is written as an
+ * update of the Runge-Kutta patch strategy with the contexts of the initial state and of the
+ * states of the previous two stages:
+ *
+ *     Y_j = mu_j*Y_{j-1} + nu_j*Y_{j-2} + (1 - mu_j - nu_j)*Y_0 + mu_tilde_j*dt*L(Y_{j-1})
+ *           + gamma_tilde_j*dt*L(Y_0).
+ *
+ * The weights of the fluxes of the stages are accumulated with the same recursion so that the time
+ * integrals of the fluxes used in the flux synchronization are consistent with the update.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::advanceLevelDiffusionWithSuperTimeStepping(
+    const boost::shared_ptr<hier::PatchLevel>& level,
+    const double current_time,
+    const double dt,
+    const int num_stages,
+    const bool regrid_advance)
+{
+    TBOX_ASSERT(level);
+    TBOX_ASSERT(num_stages >= 2);
+    TBOX_ASSERT(d_number_intermediate_contexts >= 3);
+    
+    /*
+     * Compute the coefficients of the stages.
+     */
+    
+    const double s = double(num_stages);
+    const double w_1 = 4.0/(s*s + s - 2.0);
+    
+    std::vector<double> b(num_stages + 1);
+    b[0] = 1.0/3.0;
+    b[1] = 1.0/3.0;
+    for (int j = 2; j <= num_stages; j++)
+    {
+        const double jj = double(j);
+        b[j] = (jj*jj + jj - 2.0)/(2.0*jj*(jj + 1.0));
+    }
+    
+    std::vector<double> mu(num_stages + 1, 0.0);
+    std::vector<double> nu(num_stages + 1, 0.0);
+    std::vector<double> mu_tilde(num_stages + 1, 0.0);
+    std::vector<double> gamma_tilde(num_stages + 1, 0.0);
+    
+    mu_tilde[1] = b[1]*w_1;
+    for (int j = 2; j <= num_stages; j++)
+    {
+        const double jj = double(j);
+        mu[j] = (2.0*jj - 1.0)/jj*b[j]/b[j - 1];
+        nu[j] = -(jj - 1.0)/jj*b[j]/b[j - 2];
+        mu_tilde[j] = mu[j]*w_1;
+        gamma_tilde[j] = -(1.0 - b[j - 1])*mu_tilde[j];
+    }
+    
+    /*
+     * Compute the weights of the fluxes of the initial state and of the stages in the state of the
+     * last stage with the same recursion as the stages. The fluxes of the state of each stage are
+     * accumulated with these weights when they are computed.
+     */
+    
+    std::vector<double> flux_weights_m2(num_stages, 0.0);
+    std::vector<double> flux_weights_m1(num_stages, 0.0);
+    flux_weights_m1[0] = mu_tilde[1];
+    
+    for (int j = 2; j <= num_stages; j++)
+    {
+        std::vector<double> flux_weights(num_stages, 0.0);
+        for (int k = 0; k < num_stages; k++)
+        {
+            flux_weights[k] = mu[j]*flux_weights_m1[k] + nu[j]*flux_weights_m2[k];
+        }
+        flux_weights[j - 1] += mu_tilde[j];
+        flux_weights[0] += gamma_tilde[j];
+        
+        flux_weights_m2 = flux_weights_m1;
+        flux_weights_m1 = flux_weights;
+    }
+    
+    const std::vector<double>& flux_weights = flux_weights_m1;
+    
+    /*
+     * Advance the stages. The initial state is stored in the first intermediate context and the
+     * states of the previous two stages are stored in the second and third intermediate contexts
+     * alternately.
+     */
+    
+    d_patch_strategy->setRightHandSideOperator(RHS_OPERATOR::DIFFUSIVE);
+    
+    for (int j = 1; j <= num_stages; j++)
+    {
+        const int ctx_idx_m1 = (j - 1 == 0) ? 0 : 1 + (j - 1)%2;
+        const int ctx_idx_m2 = (j - 2 <= 0) ? 0 : 1 + (j - 2)%2;
+        
+        d_patch_strategy->setDataContext(d_intermediate[ctx_idx_m1]);
+        
+        // Copy scratch data to intermediate data of the previous stage.
+        copyTimeDependentData(level, d_scratch, d_intermediate[ctx_idx_m1]);
+        
+        boost::shared_ptr<xfer::RefineSchedule> fill_schedule_intermediate(
+            d_bdry_fill_intermediate_diffusive[ctx_idx_m1]->createSchedule(
+                level,
+                d_patch_strategy));
+        
+        if (regrid_advance)
+        {
+            t_error_bdry_fill_comm->start();
+        }
+        else
+        {
+            t_advance_bdry_fill_comm->start();
+        }
+        
+        fill_schedule_intermediate->fillData(current_time);
+        
+        if (regrid_advance)
+        {
+            t_error_bdry_fill_comm->stop();
+        }
+        else
+        {
+            t_advance_bdry_fill_comm->stop();
+        }
+        
+        d_patch_strategy->setDataContext(d_scratch);
+        
+        std::vector<boost::shared_ptr<hier::VariableContext> > contexts;
+        std::vector<double> alpha;
+        std::vector<double> beta;
+        std::vector<double> gamma;
+        
+        if (j == 1)
+        {
+            contexts.push_back(d_intermediate[0]);
+            alpha.push_back(1.0);
+            beta.push_back(mu_tilde[1]);
+            gamma.push_back(flux_weights[0]);
+        }
+        else
+        {
+            contexts.push_back(d_intermediate[0]);
+            contexts.push_back(d_intermediate[ctx_idx_m2]);
+            contexts.push_back(d_intermediate[ctx_idx_m1]);
+            
+            alpha.push_back(1.0 - mu[j] - nu[j]);
+            alpha.push_back(nu[j]);
+            alpha.push_back(mu[j]);
+            
+            beta.push_back(gamma_tilde[j]);
+            beta.push_back(0.0);
+            beta.push_back(mu_tilde[j]);
+            
+            gamma.push_back(0.0);
+            gamma.push_back(0.0);
+            gamma.push_back(flux_weights[j - 1]);
+        }
+        
+        for (hier::PatchLevel::iterator ip(level->begin());
+             ip != level->end();
+             ip++)
+        {
+            const boost::shared_ptr<hier::Patch>& patch = *ip;
+            
+            t_patch_num_kernel->start();
+            
+            // Compute the diffusive flux of the state of the previous stage.
+            d_patch_strategy->computeFluxesAndSourcesOnPatch(
+                *patch,
+                current_time,
+                dt,
+                j - 1,
+                d_intermediate[ctx_idx_m1]);
+            
+            // Advance a stage.
+            advanceSingleStepOnPatchAndAccumulateFluxes(
+                *patch,
+                current_time,
+                dt,
+                alpha,
+                beta,
+                gamma,
+                contexts);
+            
+            t_patch_num_kernel->stop();
+        }
+        
+        if (isAccumulatingFluxesAndSources(gamma))
+        {
+            d_initialize_flux_and_source_accumulators = false;
+        }
+        
+        fill_schedule_intermediate.reset();
+    }
+    
+    d_patch_strategy->setRightHandSideOperator(RHS_OPERATOR::ALL);
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Advance the scratch data on a level with the diffusive part of the right-hand side only, using
+ * the two-stage, second-order and L-stable SDIRK2 scheme with g = 1 - 1/sqrt(2):
+ *
+ *     Y_1 = Y_0 + g*dt*L(Y_1),
+ *     Y_2 = Y_0 + (1 - g)*dt*L(Y_1) + g*dt*L(Y_2).
+ *
+ * The initial state and the states of the two stages are stored in the first three intermediate
+ * contexts and the fourth intermediate context is used for the perturbed states of the Jacobian-
+ * vector products. The final state is assembled from the fluxes of the two stages so that the
+ * update stays conservative and the accumulated time integrals of the fluxes are consistent with it
+ * even if the Newton iterations are not fully converged.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::advanceLevelDiffusionImplicitly(
+    const boost::shared_ptr<hier::PatchLevel>& level,
+    const double current_time,
+    const double dt,
+    const bool regrid_advance)
+{
+    TBOX_ASSERT(level);
+    TBOX_ASSERT(d_number_intermediate_contexts >= 4);
+    TBOX_ASSERT(static_cast<int>(d_implicit_diffusion_work.size()) == NUM_WORK_CONTEXTS);
+    
+    const double g = 1.0 - 1.0/sqrt(2.0);
+    
+    d_patch_strategy->setRightHandSideOperator(RHS_OPERATOR::DIFFUSIVE);
+    
+    /*
+     * Create the schedules to fill the ghost cells of the states of the stages and of the
+     * perturbed states.
+     */
+    
+    std::vector<boost::shared_ptr<xfer::RefineSchedule> > fill_schedules(4);
+    for (int ci = 1; ci < 4; ci++)
+    {
+        fill_schedules[ci] =
+            d_bdry_fill_intermediate_diffusive[ci]->createSchedule(
+                level,
+                d_patch_strategy);
+    }
+    
+    // Store the initial state.
+    copyTimeDependentData(level, d_scratch, d_intermediate[0]);
+    
+    /*
+     * Solve the first stage with R = Y_0.
+     */
+    
+    computeLevelLinearSum(
+        level,
+        d_implicit_diffusion_work[WORK_RHS],
+        1.0,
+        d_intermediate[0],
+        0.0,
+        d_intermediate[0]);
+    
+    solveImplicitDiffusionStage(
+        level,
+        current_time,
+        dt,
+        g,
+        1,
+        fill_schedules,
+        regrid_advance);
+    
+    /*
+     * Solve the second stage with R = Y_0 + (1 - g)*dt*L(Y_1).
+     */
+    
+    computeLevelLinearSum(
+        level,
+        d_implicit_diffusion_work[WORK_RHS],
+        1.0,
+        d_intermediate[0],
+        1.0 - g,
+        d_implicit_diffusion_work[WORK_OPERATOR]);
+    
+    solveImplicitDiffusionStage(
+        level,
+        current_time,
+        dt,
+        g,
+        2,
+        fill_schedules,
+        regrid_advance);
+    
+    /*
+     * Assemble the final state from the fluxes of the two stages and accumulate the fluxes.
+     */
+    
+    std::vector<boost::shared_ptr<hier::VariableContext> > contexts(3);
+    contexts[0] = d_intermediate[0];
+    contexts[1] = d_intermediate[1];
+    contexts[2] = d_intermediate[2];
+    
+    std::vector<double> alpha(3);
+    alpha[0] = 1.0;
+    alpha[1] = 0.0;
+    alpha[2] = 0.0;
+    
+    std::vector<double> beta(3);
+    beta[0] = 0.0;
+    beta[1] = 1.0 - g;
+    beta[2] = g;
+    
+    d_patch_strategy->setDataContext(d_scratch);
+    
+    for (hier::PatchLevel::iterator ip(level->begin());
+         ip != level->end();
+         ip++)
+    {
+        const boost::shared_ptr<hier::Patch>& patch = *ip;
+        
+        t_patch_num_kernel->start();
+        
+        advanceSingleStepOnPatchAndAccumulateFluxes(
+            *patch,
+            current_time,
+            dt,
+            alpha,
+            beta,
+            beta,
+            contexts);
+        
+        t_patch_num_kernel->stop();
+    }
+    
+    if (isAccumulatingFluxesAndSources(beta))
+    {
+        d_initialize_flux_and_source_accumulators = false;
+    }
+    
+    for (int ci = 1; ci < 4; ci++)
+    {
+        fill_schedules[ci].reset();
+    }
+    
+    d_patch_strategy->setRightHandSideOperator(RHS_OPERATOR::ALL);
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Solve an implicit stage with Newton iterations. The Newton iterations stop when the norm of the
+ * residual G(Y) = Y - R - a*dt*L(Y) is reduced by the Newton tolerance or when the maximum number of
+ * iterations is reached. The operator dt*L(Y) of the final state is always evaluated so that the
+ * fluxes stored in the intermediate context of the stage correspond to the final state.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::solveImplicitDiffusionStage(
+    const boost::shared_ptr<hier::PatchLevel>& level,
+    const double current_time,
+    const double dt,
+    const double a,
+    const int state_idx,
+    const std::vector<boost::shared_ptr<xfer::RefineSchedule> >& fill_schedules,
+    const bool regrid_advance)
+{
+    const boost::shared_ptr<hier::VariableContext>& state_context = d_intermediate[state_idx];
+    
+    const boost::shared_ptr<hier::VariableContext>& rhs_context =
+        d_implicit_diffusion_work[WORK_RHS];
+    
+    const boost::shared_ptr<hier::VariableContext>& operator_context =
+        d_implicit_diffusion_work[WORK_OPERATOR];
+    
+    const boost::shared_ptr<hier::VariableContext>& residual_context =
+        d_implicit_diffusion_work[WORK_RESIDUAL];
+    
+    const boost::shared_ptr<hier::VariableContext>& solution_context =
+        d_implicit_diffusion_work[WORK_SOLUTION];
+    
+    // Use R as the initial guess of the state.
+    computeLevelLinearSum(level, d_scratch, 1.0, rhs_context, 0.0, rhs_context);
+    
+    double norm_residual_initial = 0.0;
+    
+    for (int it = 0; ; it++)
+    {
+        /*
+         * Compute dt*L(Y) and the negative residual -G(Y) = R + a*dt*L(Y) - Y.
+         */
+        
+        computeImplicitDiffusionOperator(
+            level,
+            current_time,
+            dt,
+            state_idx,
+            fill_schedules[state_idx],
+            regrid_advance);
+        
+        computeLevelLinearSum(level, operator_context, 1.0, d_scratch, 0.0, d_scratch);
+        
+        computeLevelLinearSum(level, residual_context, 1.0, rhs_context, a, operator_context);
+        computeLevelLinearSum(level, residual_context, 1.0, residual_context, -1.0, state_context);
+        
+        const double norm_residual =
+            sqrt(computeLevelDotProduct(level, residual_context, residual_context));
+        
+        if (it == 0)
+        {
+            norm_residual_initial = norm_residual;
+        }
+        
+        if (norm_residual <= d_implicit_diffusion_newton_tolerance*norm_residual_initial)
+        {
+            break;
+        }
+        
+        if (it == d_implicit_diffusion_max_newton_iterations)
+        {
+            TBOX_WARNING(d_object_name
+                << ": RungeKuttaLevelIntegrator::solveImplicitDiffusionStage()\n"
+                << "Newton iterations of the implicit diffusion are not converged on level "
+                << level->getLevelNumber()
+                << ". Relative norm of residual = "
+                << norm_residual/norm_residual_initial
+                << std::endl);
+            
+            break;
+        }
+        
+        /*
+         * Solve (I - a*dt*dL/dY)*dY = -G(Y) and update the state.
+         */
+        
+        const double norm_state = sqrt(computeLevelDotProduct(level, state_context, state_context));
+        
+        solveImplicitDiffusionLinearSystem(
+            level,
+            current_time,
+            dt,
+            a,
+            state_idx,
+            norm_state,
+            fill_schedules,
+            regrid_advance);
+        
+        computeLevelLinearSum(level, d_scratch, 1.0, state_context, 1.0, solution_context);
+    }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Solve the linear system of a Newton iteration with the matrix-free BiCGSTAB method starting from
+ * a zero initial guess. The intermediate residual s of the BiCGSTAB method is stored in place of
+ * the residual.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::solveImplicitDiffusionLinearSystem(
+    const boost::shared_ptr<hier::PatchLevel>& level,
+    const double current_time,
+    const double dt,
+    const double a,
+    const int state_idx,
+    const double norm_state,
+    const std::vector<boost::shared_ptr<xfer::RefineSchedule> >& fill_schedules,
+    const bool regrid_advance)
+{
+    const boost::shared_ptr<hier::VariableContext>& x = d_implicit_diffusion_work[WORK_SOLUTION];
+    const boost::shared_ptr<hier::VariableContext>& r = d_implicit_diffusion_work[WORK_RESIDUAL];
+    const boost::shared_ptr<hier::VariableContext>& r_hat = d_implicit_diffusion_work[WORK_SHADOW_RESIDUAL];
+    const boost::shared_ptr<hier::VariableContext>& p = d_implicit_diffusion_work[WORK_SEARCH_DIRECTION];
+    const boost::shared_ptr<hier::VariableContext>& v = d_implicit_diffusion_work[WORK_JACOBIAN_DIRECTION];
+    const boost::shared_ptr<hier::VariableContext>& t = d_implicit_diffusion_work[WORK_JACOBIAN_RESIDUAL];
+    
+    const double norm_b = sqrt(computeLevelDotProduct(level, r, r));
+    
+    // Start from x = 0.
+    computeLevelLinearSum(level, x, 0.0, r, 0.0, r);
+    
+    if (norm_b == 0.0)
+    {
+        return;
+    }
+    
+    computeLevelLinearSum(level, r_hat, 1.0, r, 0.0, r);
+    
+    double rho_old = 1.0;
+    double alpha = 1.0;
+    double omega = 1.0;
+    
+    for (int k = 0; k < d_implicit_diffusion_max_krylov_iterations; k++)
+    {
+        const double rho = computeLevelDotProduct(level, r_hat, r);
+        
+        if (rho == 0.0)
+        {
+            break;
+        }
+        
+        if (k == 0)
+        {
+            computeLevelLinearSum(level, p, 1.0, r, 0.0, r);
+        }
+        else
+        {
+            const double beta = (rho/rho_old)*(alpha/omega);
+            
+            computeLevelLinearSum(level, p, 1.0, p, -omega, v);
+            computeLevelLinearSum(level, p, 1.0, r, beta, p);
+        }
+        
+        applyImplicitDiffusionJacobian(
+            level,
+            current_time,
+            dt,
+            a,
+            state_idx,
+            norm_state,
+            fill_schedules,
+            p,
+            v,
+            regrid_advance);
+        
+        const double r_hat_dot_v = computeLevelDotProduct(level, r_hat, v);
+        
+        if (r_hat_dot_v == 0.0)
+        {
+            break;
+        }
+        
+        alpha = rho/r_hat_dot_v;
+        
+        // s = r - alpha*v is stored in r.
+        computeLevelLinearSum(level, r, 1.0, r, -alpha, v);
+        computeLevelLinearSum(level, x, 1.0, x, alpha, p);
+        
+        const double norm_s = sqrt(computeLevelDotProduct(level, r, r));
+        
+        if (norm_s <= d_implicit_diffusion_krylov_tolerance*norm_b)
+        {
+            break;
+        }
+        
+        applyImplicitDiffusionJacobian(
+            level,
+            current_time,
+            dt,
+            a,
+            state_idx,
+            norm_state,
+            fill_schedules,
+            r,
+            t,
+            regrid_advance);
+        
+        const double t_dot_t = computeLevelDotProduct(level, t, t);
+        
+        if (t_dot_t == 0.0)
+        {
+            break;
+        }
+        
+        omega = computeLevelDotProduct(level, t, r)/t_dot_t;
+        
+        computeLevelLinearSum(level, x, 1.0, x, omega, r);
+        computeLevelLinearSum(level, r, 1.0, r, -omega, t);
+        
+        const double norm_r = sqrt(computeLevelDotProduct(level, r, r));
+        
+        if (norm_r <= d_implicit_diffusion_krylov_tolerance*norm_b || omega == 0.0)
+        {
+            break;
+        }
+        
+        rho_old = rho;
+    }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Compute dt*L(Y) of the diffusive part of the right-hand side into the scratch data, where Y is
+ * the scratch data. The diffusive fluxes are computed from the intermediate context with index
+ * state_idx and the patch strategy assembles -div(F) + S into the scratch data.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::computeImplicitDiffusionOperator(
+    const boost::shared_ptr<hier::PatchLevel>& level,
+    const double current_time,
+    const double dt,
+    const int state_idx,
+    const boost::shared_ptr<xfer::RefineSchedule>& fill_schedule,
+    const bool regrid_advance)
+{
+    d_patch_strategy->setDataContext(d_intermediate[state_idx]);
+    
+    copyTimeDependentData(level, d_scratch, d_intermediate[state_idx]);
+    
+    if (regrid_advance)
+    {
+        t_error_bdry_fill_comm->start();
+    }
+    else
+    {
+        t_advance_bdry_fill_comm->start();
+    }
+    
+    fill_schedule->fillData(current_time);
+    
+    if (regrid_advance)
+    {
+        t_error_bdry_fill_comm->stop();
+    }
+    else
+    {
+        t_advance_bdry_fill_comm->stop();
+    }
+    
+    d_patch_strategy->setDataContext(d_scratch);
+    
+    const std::vector<boost::shared_ptr<hier::VariableContext> > contexts(1, d_intermediate[state_idx]);
+    const std::vector<double> alpha(1, 0.0);
+    const std::vector<double> beta(1, 1.0);
+    const std::vector<double> gamma(1, 0.0);
+    
+    for (hier::PatchLevel::iterator ip(level->begin());
+         ip != level->end();
+         ip++)
+    {
+        const boost::shared_ptr<hier::Patch>& patch = *ip;
+        
+        t_patch_num_kernel->start();
+        
+        d_patch_strategy->computeFluxesAndSourcesOnPatch(
+            *patch,
+            current_time,
+            dt,
+            0,
+            d_intermediate[state_idx]);
+        
+        d_patch_strategy->advanceSingleStepOnPatch(
+            *patch,
+            current_time,
+            dt,
+            alpha,
+            beta,
+            gamma,
+            contexts);
+        
+        t_patch_num_kernel->stop();
+    }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Apply the Jacobian of an implicit stage with the finite difference
+ *
+ *     J*v = v - a*(dt*L(Y + eps*v) - dt*L(Y))/eps,
+ *
+ * where eps = sqrt(machine epsilon)*(1 + |Y|)/|v| and dt*L(Y) is stored in the operator work
+ * context. The perturbed state is stored in the fourth intermediate context.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::applyImplicitDiffusionJacobian(
+    const boost::shared_ptr<hier::PatchLevel>& level,
+    const double current_time,
+    const double dt,
+    const double a,
+    const int state_idx,
+    const double norm_state,
+    const std::vector<boost::shared_ptr<xfer::RefineSchedule> >& fill_schedules,
+    const boost::shared_ptr<hier::VariableContext>& src_context,
+    const boost::shared_ptr<hier::VariableContext>& dst_context,
+    const bool regrid_advance)
+{
+    TBOX_ASSERT(src_context != dst_context);
+    
+    const double norm_src = sqrt(computeLevelDotProduct(level, src_context, src_context));
+    
+    if (norm_src == 0.0)
+    {
+        computeLevelLinearSum(level, dst_context, 0.0, src_context, 0.0, src_context);
+        
+        return;
+    }
+    
+    const double eps = sqrt(tbox::MathUtilities<double>::getEpsilon())*(1.0 + norm_state)/norm_src;
+    
+    computeLevelLinearSum(level, d_scratch, 1.0, d_intermediate[state_idx], eps, src_context);
+    
+    computeImplicitDiffusionOperator(
+        level,
+        current_time,
+        dt,
+        3,
+        fill_schedules[3],
+        regrid_advance);
+    
+    computeLevelLinearSum(level, dst_context, 1.0, src_context, -a/eps, d_scratch);
+    computeLevelLinearSum(
+        level,
+        dst_context,
+        1.0,
+        dst_context,
+        a/eps,
+        d_implicit_diffusion_work[WORK_OPERATOR]);
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Advance a single step on a patch with the patch strategy. If the fluxes and sources of the step
+ * are the first accumulated in the advance of the level, the FLUX and SOURCE data of the scratch
+ * context is overwritten with the contribution of the first intermediate context and the patch
+ * strategy only accumulates the contributions of the other intermediate contexts. This saves
+ * zero-filling the data before the steps and reading it back in the first accumulation.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::advanceSingleStepOnPatchAndAccumulateFluxes(
+    hier::Patch& patch,
+    const double time,
+    const double dt,
+    const std::vector<double>& alpha,
+    const std::vector<double>& beta,
+    const std::vector<double>& gamma,
+    const std::vector<boost::shared_ptr<hier::VariableContext> >& intermediate_context)
+{
+    TBOX_ASSERT(!gamma.empty());
+    TBOX_ASSERT(gamma.size() <= intermediate_context.size());
+    
+    if (d_initialize_flux_and_source_accumulators && isAccumulatingFluxesAndSources(gamma))
+    {
+        initializeFluxAndSourceAccumulatorsOnPatch(
+            patch,
+            gamma[0],
+            intermediate_context[0]);
+        
+        std::vector<double> gamma_remaining(gamma);
+        gamma_remaining[0] = 0.0;
+        
+        d_patch_strategy->advanceSingleStepOnPatch(
+            patch,
+            time,
+            dt,
+            alpha,
+            beta,
+            gamma_remaining,
+            intermediate_context);
+    }
+    else
+    {
+        d_patch_strategy->advanceSingleStepOnPatch(
+            patch,
+            time,
+            dt,
+            alpha,
+            beta,
+            gamma,
+            intermediate_context);
+    }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Initialize the FLUX and SOURCE data of the scratch context on a patch to gamma times the data of
+ * a context, including the ghost cells. The data is set to zero if gamma is zero so that the data
+ * of the context is not read.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::initializeFluxAndSourceAccumulatorsOnPatch(
+    hier::Patch& patch,
+    const double gamma,
+    const boost::shared_ptr<hier::VariableContext>& context)
+{
+    math::PatchFaceDataOpsReal<double> patch_face_data_ops;
+    math::PatchSideDataOpsReal<double> patch_side_data_ops;
+    math::PatchCellDataOpsReal<double> patch_cell_data_ops;
+    
+    std::list<boost::shared_ptr<hier::Variable> >::iterator flux_var =
+        d_flux_variables.begin();
+    
+    while (flux_var != d_flux_variables.end())
+    {
+        if (d_flux_is_face)
+        {
+            boost::shared_ptr<pdat::FaceData<double> > flux_data(
+                BOOST_CAST<pdat::FaceData<double>, hier::PatchData>(
+                    patch.getPatchData(*flux_var, d_scratch)));
+            
+            TBOX_ASSERT(flux_data);
+            
+            if (gamma == 0.0)
+            {
+                patch_face_data_ops.setToScalar(flux_data, 0.0, flux_data->getGhostBox());
+            }
+            else
+            {
+                boost::shared_ptr<pdat::FaceData<double> > flux_data_src(
+                    BOOST_CAST<pdat::FaceData<double>, hier::PatchData>(
+                        patch.getPatchData(*flux_var, context)));
+                
+                TBOX_ASSERT(flux_data_src);
+                TBOX_ASSERT(flux_data_src->getGhostBox().contains(flux_data->getGhostBox()));
                 
-                patch->deallocatePatchData(d_temp_var_scratch_data);
+                patch_face_data_ops.scale(flux_data, gamma, flux_data_src, flux_data->getGhostBox());
             }
-            d_patch_strategy->clearDataContext();
         }
         else
         {
-            dt_next = d_dt;
+            boost::shared_ptr<pdat::SideData<double> > flux_data(
+                BOOST_CAST<pdat::SideData<double>, hier::PatchData>(
+                    patch.getPatchData(*flux_var, d_scratch)));
+            
+            TBOX_ASSERT(flux_data);
+            
+            if (gamma == 0.0)
+            {
+                patch_side_data_ops.setToScalar(flux_data, 0.0, flux_data->getGhostBox());
+            }
+            else
+            {
+                boost::shared_ptr<pdat::SideData<double> > flux_data_src(
+                    BOOST_CAST<pdat::SideData<double>, hier::PatchData>(
+                        patch.getPatchData(*flux_var, context)));
+                
+                TBOX_ASSERT(flux_data_src);
+                TBOX_ASSERT(flux_data_src->getGhostBox().contains(flux_data->getGhostBox()));
+                
+                patch_side_data_ops.scale(flux_data, gamma, flux_data_src, flux_data->getGhostBox());
+            }
         }
-      
-    } // !regrid_advance
+        
+        flux_var++;
+    }
     
-    level->deallocatePatchData(d_saved_var_scratch_data);
+    std::list<boost::shared_ptr<hier::Variable> >::iterator source_var =
+        d_source_variables.begin();
     
-    for (int sn = 0; sn < d_number_steps; sn++)
+    while (source_var != d_source_variables.end())
     {
-      level->deallocatePatchData(d_intermediate_time_dep_data[sn]);
-      level->deallocatePatchData(d_intermediate_flux_var_data[sn]);
-      level->deallocatePatchData(d_intermediate_source_var_data[sn]);
+        boost::shared_ptr<pdat::CellData<double> > source_data(
+            BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+                patch.getPatchData(*source_var, d_scratch)));
+        
+        TBOX_ASSERT(source_data);
+        
+        if (gamma == 0.0)
+        {
+            patch_cell_data_ops.setToScalar(source_data, 0.0, source_data->getGhostBox());
+        }
+        else
+        {
+            boost::shared_ptr<pdat::CellData<double> > source_data_src(
+                BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+                    patch.getPatchData(*source_var, context)));
+            
+            TBOX_ASSERT(source_data_src);
+            TBOX_ASSERT(source_data_src->getGhostBox().contains(source_data->getGhostBox()));
+            
+            patch_cell_data_ops.scale(source_data, gamma, source_data_src, source_data->getGhostBox());
+        }
+        
+        source_var++;
     }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Compute dst = a*src_1 + b*src_2 on the interiors of the patches of a level for all TIME_DEP
+ * variables.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::computeLevelLinearSum(
+    const boost::shared_ptr<hier::PatchLevel>& level,
+    const boost::shared_ptr<hier::VariableContext>& dst_context,
+    const double a,
+    const boost::shared_ptr<hier::VariableContext>& src_context_1,
+    const double b,
+    const boost::shared_ptr<hier::VariableContext>& src_context_2)
+{
+    math::PatchCellDataOpsReal<double> patch_cell_data_ops;
     
-    postprocessFluxAndSourceData(
-        level,
-        regrid_advance,
-        first_step,
-        last_step);
-    
-    t_advance_level->stop();
-    
-    t_advance_level_sync->start();
-    
-    if (d_distinguish_mpi_reduction_costs)
+    for (hier::PatchLevel::iterator ip(level->begin());
+         ip != level->end();
+         ip++)
     {
-        hierarchy->getMPI().Barrier();
-        t_advance_level_sync->stop();
-        t_advance_mpi_reductions->start();
+        const boost::shared_ptr<hier::Patch>& patch = *ip;
+        
+        const hier::Box& interior_box = patch->getBox();
+        
+        std::list<boost::shared_ptr<hier::Variable> >::iterator time_dep_var =
+            d_time_dep_variables.begin();
+        
+        while (time_dep_var != d_time_dep_variables.end())
+        {
+            boost::shared_ptr<pdat::CellData<double> > dst_data(
+                BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+                    patch->getPatchData(*time_dep_var, dst_context)));
+            
+            boost::shared_ptr<pdat::CellData<double> > src_data_1(
+                BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+                    patch->getPatchData(*time_dep_var, src_context_1)));
+            
+            TBOX_ASSERT(dst_data);
+            TBOX_ASSERT(src_data_1);
+            
+            if (b == 0.0)
+            {
+                patch_cell_data_ops.scale(dst_data, a, src_data_1, interior_box);
+            }
+            else
+            {
+                boost::shared_ptr<pdat::CellData<double> > src_data_2(
+                    BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+                        patch->getPatchData(*time_dep_var, src_context_2)));
+                
+                TBOX_ASSERT(src_data_2);
+                
+                patch_cell_data_ops.linearSum(dst_data, a, src_data_1, b, src_data_2, interior_box);
+            }
+            
+            time_dep_var++;
+        }
     }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Compute the dot product of the data of two contexts on the interiors of the patches of a level
+ * for all TIME_DEP variables.
+ *
+ **************************************************************************************************
+ */
+double
+RungeKuttaLevelIntegrator::computeLevelDotProduct(
+    const boost::shared_ptr<hier::PatchLevel>& level,
+    const boost::shared_ptr<hier::VariableContext>& context_1,
+    const boost::shared_ptr<hier::VariableContext>& context_2)
+{
+    math::PatchCellDataOpsReal<double> patch_cell_data_ops;
     
-    double next_dt = dt_next;
+    double dot_product = 0.0;
     
-    if (mpi.getSize() > 1)
+    for (hier::PatchLevel::iterator ip(level->begin());
+         ip != level->end();
+         ip++)
     {
-        mpi.AllReduce(&next_dt, 1, MPI_MIN);
+        const boost::shared_ptr<hier::Patch>& patch = *ip;
+        
+        const hier::Box& interior_box = patch->getBox();
+        
+        std::list<boost::shared_ptr<hier::Variable> >::iterator time_dep_var =
+            d_time_dep_variables.begin();
+        
+        while (time_dep_var != d_time_dep_variables.end())
+        {
+            boost::shared_ptr<pdat::CellData<double> > data_1(
+                BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+                    patch->getPatchData(*time_dep_var, context_1)));
+            
+            boost::shared_ptr<pdat::CellData<double> > data_2(
+                BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+                    patch->getPatchData(*time_dep_var, context_2)));
+            
+            TBOX_ASSERT(data_1);
+            TBOX_ASSERT(data_2);
+            
+            dot_product += patch_cell_data_ops.dot(data_1, data_2, interior_box);
+            
+            time_dep_var++;
+        }
     }
     
-    if (d_use_cfl)
-    {
-        next_dt *= d_cfl;
-    }
+    const tbox::SAMRAI_MPI& mpi(level->getBoxLevel()->getMPI());
     
-    if (d_distinguish_mpi_reduction_costs)
-    {
-        t_advance_mpi_reductions->stop();
-    }
-    else
+    if (mpi.getSize() > 1)
     {
-        t_advance_level_sync->stop();
+        mpi.AllReduce(&dot_product, 1, MPI_SUM);
     }
     
-    return next_dt;
+    return dot_product;
 }
 
 
@@ -2348,12 +3548,23 @@ RungeKuttaLevelIntegrator::registerVariable(
         d_bdry_fill_advance_new.reset(new xfer::RefineAlgorithm());
         d_bdry_fill_advance_old.reset(new xfer::RefineAlgorithm());
         
-        d_bdry_fill_intermediate.resize(d_number_steps);
-        for (int sn = 0; sn < d_number_steps; sn++)
+        d_bdry_fill_intermediate.resize(d_number_intermediate_contexts);
+        for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
         {
             d_bdry_fill_intermediate[sn].reset(new xfer::RefineAlgorithm());
         }
         
+        if (d_use_super_time_stepping || d_use_implicit_diffusion)
+        {
+            d_bdry_fill_intermediate_convective.resize(d_number_intermediate_contexts);
+            d_bdry_fill_intermediate_diffusive.resize(d_number_intermediate_contexts);
+            for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
+            {
+                d_bdry_fill_intermediate_convective[sn].reset(new xfer::RefineAlgorithm());
+                d_bdry_fill_intermediate_diffusive[sn].reset(new xfer::RefineAlgorithm());
+            }
+        }
+        
         d_fill_new_level.reset(new xfer::RefineAlgorithm());
         d_coarsen_fluxsum.reset(new xfer::CoarsenAlgorithm(dim));
         d_coarsen_sync_data.reset(new xfer::CoarsenAlgorithm(dim));
@@ -2388,8 +3599,8 @@ RungeKuttaLevelIntegrator::registerVariable(
                 d_scratch,
                 ghosts);
             
-            std::vector<int> intermediate_id(d_number_steps);
-            for (int sn = 0; sn < d_number_steps; sn++)
+            std::vector<int> intermediate_id(d_number_intermediate_contexts);
+            for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
             {
                 intermediate_id[sn] = variable_db->registerVariableAndContext(
                     var,
@@ -2403,11 +3614,21 @@ RungeKuttaLevelIntegrator::registerVariable(
             
             d_new_time_dep_data.setFlag(new_id);
             
-            for (int sn = 0; sn < d_number_steps; sn++)
+            for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
             {
                 d_intermediate_time_dep_data[sn].setFlag(intermediate_id[sn]);
             }
             
+            for (int wi = 0; wi < static_cast<int>(d_implicit_diffusion_work.size()); wi++)
+            {
+                int work_id = variable_db->registerVariableAndContext(
+                    var,
+                    d_implicit_diffusion_work[wi],
+                    zero_ghosts);
+                
+                d_implicit_diffusion_work_data.setFlag(work_id);
+            }
+            
             /*
              * Register variable and context needed for restart.
              */
@@ -2437,15 +3658,46 @@ RungeKuttaLevelIntegrator::registerVariable(
             
             /*
              * Set boundary fill schedules for data used in the intermediate steps of the Runge-Kutta
-             * integration.
+             * integration. Only the ghosts read by the part of the right-hand side computed with the
+             * intermediate data are filled.
              */
-            for (int sn = 0; sn < d_number_steps; sn++)
+            const boost::shared_ptr<xfer::VariableFillPattern> fill_pattern_intermediate(
+                getIntermediateVariableFillPattern(RHS_OPERATOR::ALL, ghosts_intermediate));
+            
+            for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
             {
                 d_bdry_fill_intermediate[sn]->registerRefine(
                     intermediate_id[sn],
                     scr_id,
                     intermediate_id[sn],
-                    refine_op);
+                    refine_op,
+                    fill_pattern_intermediate);
+            }
+            
+            if (d_use_super_time_stepping || d_use_implicit_diffusion)
+            {
+                const boost::shared_ptr<xfer::VariableFillPattern> fill_pattern_intermediate_convective(
+                    getIntermediateVariableFillPattern(RHS_OPERATOR::CONVECTIVE, ghosts_intermediate));
+                
+                const boost::shared_ptr<xfer::VariableFillPattern> fill_pattern_intermediate_diffusive(
+                    getIntermediateVariableFillPattern(RHS_OPERATOR::DIFFUSIVE, ghosts_intermediate));
+                
+                for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
+                {
+                    d_bdry_fill_intermediate_convective[sn]->registerRefine(
+                        intermediate_id[sn],
+                        scr_id,
+                        intermediate_id[sn],
+                        refine_op,
+                        fill_pattern_intermediate_convective);
+                    
+                    d_bdry_fill_intermediate_diffusive[sn]->registerRefine(
+                        intermediate_id[sn],
+                        scr_id,
+                        intermediate_id[sn],
+                        refine_op,
+                        fill_pattern_intermediate_diffusive);
+                }
             }
             
             /*
@@ -2643,8 +3895,8 @@ RungeKuttaLevelIntegrator::registerVariable(
             
             d_flux_var_data.setFlag(scr_id);
             
-            std::vector<int> intermediate_id(d_number_steps);
-            for (int sn = 0; sn < d_number_steps; sn++)
+            std::vector<int> intermediate_id(d_number_intermediate_contexts);
+            for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
             {
                 intermediate_id[sn] = variable_db->registerVariableAndContext(
                     var,
@@ -2652,7 +3904,7 @@ RungeKuttaLevelIntegrator::registerVariable(
                     ghosts_intermediate);
             }
             
-            for (int sn = 0; sn < d_number_steps; sn++)
+            for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
             {
                 d_intermediate_flux_var_data[sn].setFlag(intermediate_id[sn]);
             }
@@ -2716,8 +3968,8 @@ RungeKuttaLevelIntegrator::registerVariable(
             
             d_source_var_data.setFlag(scr_id);
             
-            std::vector<int> intermediate_id(d_number_steps);
-            for (int sn = 0; sn < d_number_steps; sn++)
+            std::vector<int> intermediate_id(d_number_intermediate_contexts);
+            for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
             {
                 intermediate_id[sn] = variable_db->registerVariableAndContext(
                     var,
@@ -2725,7 +3977,7 @@ RungeKuttaLevelIntegrator::registerVariable(
                     ghosts_intermediate);
             }
             
-            for (int sn = 0; sn < d_number_steps; sn++)
+            for (int sn = 0; sn < d_number_intermediate_contexts; sn++)
             {
                 d_intermediate_source_var_data[sn].setFlag(intermediate_id[sn]);
             }
@@ -2862,6 +4114,104 @@ RungeKuttaLevelIntegrator::preprocessFluxAndSourceData(
 }
 
 
+/*
+ * Add the fluxes on the lower and upper faces (or sides) of a patch in all directions to the flux
+ * integrals for all the components of a flux variable in one call. The flux integrals of each face
+ * (or side) of the patch are stored in a slab of the index space of the fluxes in the same
+ * direction, with a single index in the direction normal to the faces (or sides). The normal
+ * direction comes first in the index space of face data and is in place in that of side data.
+ */
+template<class TFluxData, class TFluxSumData, bool normal_direction_is_first>
+static void
+addFluxesToFluxIntegrals(
+    const TFluxData& flux_data,
+    TFluxSumData& fluxsum_data)
+{
+    const tbox::Dimension& dim = flux_data.getDim();
+    
+    const int depth = flux_data.getDepth();
+    
+    for (int di = 0; di < dim.getValue(); di++)
+    {
+        const pdat::ArrayData<double>& flux_array = flux_data.getArrayData(di);
+        const hier::Box& flux_box = flux_array.getBox();
+        
+        /*
+         * Get the strides of the flux data and the tangential directions in the index space of the
+         * flux data.
+         */
+        
+        hier::IntVector flux_strides(dim);
+        flux_strides[0] = 1;
+        for (int dj = 1; dj < dim.getValue(); dj++)
+        {
+            flux_strides[dj] = flux_strides[dj - 1]*flux_box.numberCells(dj - 1);
+        }
+        
+        const int dir_normal = normal_direction_is_first ? 0 : di;
+        
+        int dir_inner = -1;
+        int dir_outer = -1;
+        for (int dj = 0; dj < dim.getValue(); dj++)
+        {
+            if (dj != dir_normal)
+            {
+                if (dir_inner < 0)
+                {
+                    dir_inner = dj;
+                }
+                else
+                {
+                    dir_outer = dj;
+                }
+            }
+        }
+        
+        for (int side = 0; side < 2; side++)
+        {
+            pdat::ArrayData<double>& fluxsum_array = fluxsum_data.getArrayData(di, side);
+            const hier::Box& fluxsum_box = fluxsum_array.getBox();
+            
+            TBOX_ASSERT(flux_box.contains(fluxsum_box));
+            TBOX_ASSERT(fluxsum_box.numberCells(dir_normal) == 1);
+            
+            const int num_inner = (dir_inner >= 0) ? fluxsum_box.numberCells(dir_inner) : 1;
+            const int num_outer = (dir_outer >= 0) ? fluxsum_box.numberCells(dir_outer) : 1;
+            
+            const int flux_stride_inner = (dir_inner >= 0) ? flux_strides[dir_inner] : 0;
+            const int flux_stride_outer = (dir_outer >= 0) ? flux_strides[dir_outer] : 0;
+            
+            // Compute the linear index of the flux at the lower corner of the flux integrals.
+            int idx_flux_lo = 0;
+            for (int dj = 0; dj < dim.getValue(); dj++)
+            {
+                idx_flux_lo += (fluxsum_box.lower(dj) - flux_box.lower(dj))*flux_strides[dj];
+            }
+            
+            for (int ei = 0; ei < depth; ei++)
+            {
+                const double* const F = flux_array.getPointer(ei) + idx_flux_lo;
+                double* const F_sum = fluxsum_array.getPointer(ei);
+                
+                for (int j = 0; j < num_outer; j++)
+                {
+                    const double* const F_row = F + j*flux_stride_outer;
+                    double* const F_sum_row = F_sum + j*num_inner;
+                    
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < num_inner; i++)
+                    {
+                        F_sum_row[i] += F_row[i*flux_stride_inner];
+                    }
+                }
+            }
+        }
+    }
+}
+
+
 /*
  **************************************************************************************************
  *
@@ -2916,9 +4266,6 @@ RungeKuttaLevelIntegrator::postprocessFluxAndSourceData(
             std::list<boost::shared_ptr<hier::Variable> >::iterator fluxsum_var =
                 d_fluxsum_variables.begin();
             
-            const hier::Index& ilo = patch->getBox().lower();
-            const hier::Index& ihi = patch->getBox().upper();
-            
             while (flux_var != d_flux_variables.end())
             {
                 boost::shared_ptr<hier::PatchData> flux_data(
@@ -2926,188 +4273,39 @@ RungeKuttaLevelIntegrator::postprocessFluxAndSourceData(
                 boost::shared_ptr<hier::PatchData> fsum_data(
                    patch->getPatchData(*fluxsum_var, d_scratch));
                 
-                boost::shared_ptr<pdat::FaceData<double> > fflux_data;
-                boost::shared_ptr<pdat::OuterfaceData<double> > ffsum_data;
-                
-                boost::shared_ptr<pdat::SideData<double> > sflux_data;
-                boost::shared_ptr<pdat::OutersideData<double> > sfsum_data;
-                
-                int ddepth;
-                hier::IntVector flux_num_ghosts(level->getDim());
-                
                 if (d_flux_is_face)
                 {
-                    fflux_data =
+                    boost::shared_ptr<pdat::FaceData<double> > fflux_data(
                         BOOST_CAST<pdat::FaceData<double>, hier::PatchData>(
-                            flux_data);
-                    ffsum_data =
+                            flux_data));
+                    boost::shared_ptr<pdat::OuterfaceData<double> > ffsum_data(
                         BOOST_CAST<pdat::OuterfaceData<double>, hier::PatchData>(
-                            fsum_data);
+                            fsum_data));
                     
                     TBOX_ASSERT(fflux_data && ffsum_data);
                     TBOX_ASSERT(fflux_data->getDepth() == ffsum_data->getDepth());
-                    ddepth = fflux_data->getDepth();
-                    flux_num_ghosts = fflux_data->getGhostCellWidth();
+                    
+                    addFluxesToFluxIntegrals<pdat::FaceData<double>, pdat::OuterfaceData<double>, true>(
+                        *fflux_data,
+                        *ffsum_data);
                 }
                 else
                 {
-                    sflux_data =
+                    boost::shared_ptr<pdat::SideData<double> > sflux_data(
                         BOOST_CAST<pdat::SideData<double>, hier::PatchData>(
-                            flux_data);
-                    sfsum_data =
+                            flux_data));
+                    boost::shared_ptr<pdat::OutersideData<double> > sfsum_data(
                         BOOST_CAST<pdat::OutersideData<double>, hier::PatchData>(
-                            fsum_data);
+                            fsum_data));
                     
                     TBOX_ASSERT(sflux_data && sfsum_data);
                     TBOX_ASSERT(sflux_data->getDepth() == sfsum_data->getDepth());
-                    ddepth = sflux_data->getDepth();
-                    flux_num_ghosts = sflux_data->getGhostCellWidth();
+                    
+                    addFluxesToFluxIntegrals<pdat::SideData<double>, pdat::OutersideData<double>, false>(
+                        *sflux_data,
+                        *sfsum_data);
                 }
                 
-                for (int d = 0; d < ddepth; d++)
-                {
-                    // Loop over lower and upper parts of outer face/side arrays.
-                    for (int ifs = 0; ifs < 2; ifs++)
-                    {
-                        if (level->getDim() == tbox::Dimension(1))
-                        {
-                            SAMRAI_F77_FUNC(upfluxsum1d, UPFLUXSUM1D) (
-                                ilo(0),
-                                ihi(0),
-                                flux_num_ghosts(0),
-                                ifs,
-                                fflux_data->getPointer(0, d),
-                                ffsum_data->getPointer(0, ifs, d));
-                        }
-                        else
-                        {
-                            if (d_flux_is_face)
-                            {
-                                if (level->getDim() == tbox::Dimension(2))
-                                {
-                                    SAMRAI_F77_FUNC(upfluxsumface2d0, UPFLUXSUMFACE2D0) (
-                                        ilo(0),
-                                        ilo(1),
-                                        ihi(0),
-                                        ihi(1),
-                                        flux_num_ghosts(0),
-                                        flux_num_ghosts(1),
-                                        ifs,
-                                        fflux_data->getPointer(0, d),
-                                        ffsum_data->getPointer(0, ifs, d));
-                                    SAMRAI_F77_FUNC(upfluxsumface2d1, UPFLUXSUMFACE2D1) (
-                                        ilo(0),
-                                        ilo(1),
-                                        ihi(0),
-                                        ihi(1),
-                                        flux_num_ghosts(0),
-                                        flux_num_ghosts(1),
-                                        ifs,
-                                        fflux_data->getPointer(1, d),
-                                        ffsum_data->getPointer(1, ifs, d));
-                                }
-                                if (level->getDim() == tbox::Dimension(3))
-                                {
-                                    SAMRAI_F77_FUNC(upfluxsumface3d0, UPFLUXSUMFACE3D0) (
-                                        ilo(0),
-                                        ilo(1),
-                                        ilo(2),
-                                        ihi(0),
-                                        ihi(1),
-                                        ihi(2),
-                                        flux_num_ghosts(0),
-                                        flux_num_ghosts(1),
-                                        flux_num_ghosts(2),
-                                        ifs,
-                                        fflux_data->getPointer(0, d),
-                                        ffsum_data->getPointer(0, ifs, d));
-                                    SAMRAI_F77_FUNC(upfluxsumface3d1, UPFLUXSUMFACE3D1) (
-                                        ilo(0),
-                                        ilo(1),
-                                        ilo(2),
-                                        ihi(0),
-                                        ihi(1),
-                                        ihi(2),
-                                        flux_num_ghosts(0),
-                                        flux_num_ghosts(1),
-                                        flux_num_ghosts(2),
-                                        ifs,
-                                        fflux_data->getPointer(1, d),
-                                        ffsum_data->getPointer(1, ifs, d));
-                                    SAMRAI_F77_FUNC(upfluxsumface3d2, UPFLUXSUMFACE3D2) (
-                                        ilo(0),
-                                        ilo(1),
-                                        ilo(2),
-                                        ihi(0),
-                                        ihi(1),
-                                        ihi(2),
-                                        flux_num_ghosts(0),
-                                        flux_num_ghosts(1),
-                                        flux_num_ghosts(2),
-                                        ifs,
-                                        fflux_data->getPointer(2, d),
-                                        ffsum_data->getPointer(2, ifs, d));
-                                }
-                            }
-                            else
-                            {
-                                if (level->getDim() == tbox::Dimension(2))
-                                {
-                                    SAMRAI_F77_FUNC(upfluxsumside2d0, UPFLUXSUMSIDE2D0) (
-                                        ilo(0),
-                                        ilo(1), ihi(0), ihi(1),
-                                        flux_num_ghosts(0),
-                                        flux_num_ghosts(1),
-                                        ifs,
-                                        sflux_data->getPointer(0, d),
-                                        sfsum_data->getPointer(0, ifs, d));
-                                    SAMRAI_F77_FUNC(upfluxsumside2d1, UPFLUXSUMSIDE2D1) (
-                                        ilo(0),
-                                        ilo(1), ihi(0), ihi(1),
-                                        flux_num_ghosts(0),
-                                        flux_num_ghosts(1),
-                                        ifs,
-                                        sflux_data->getPointer(1, d),
-                                        sfsum_data->getPointer(1, ifs, d));
-                                }
-                                if (level->getDim() == tbox::Dimension(3))
-                                {
-                                    SAMRAI_F77_FUNC(upfluxsumside3d0, UPFLUXSUMSIDE3D0) (
-                                        ilo(0),
-                                        ilo(1), ilo(2),
-                                        ihi(0), ihi(1), ihi(2),
-                                        flux_num_ghosts(0),
-                                        flux_num_ghosts(1),
-                                        flux_num_ghosts(2),
-                                        ifs,
-                                        sflux_data->getPointer(0, d),
-                                        sfsum_data->getPointer(0, ifs, d));
-                                    SAMRAI_F77_FUNC(upfluxsumside3d1, UPFLUXSUMSIDE3D1) (
-                                        ilo(0),
-                                        ilo(1), ilo(2),
-                                        ihi(0), ihi(1), ihi(2),
-                                        flux_num_ghosts(0),
-                                        flux_num_ghosts(1),
-                                        flux_num_ghosts(2),
-                                        ifs,
-                                        sflux_data->getPointer(1, d),
-                                        sfsum_data->getPointer(1, ifs, d));
-                                    SAMRAI_F77_FUNC(upfluxsumside3d2, UPFLUXSUMSIDE3D2) (
-                                        ilo(0),
-                                        ilo(1), ilo(2),
-                                        ihi(0), ihi(1), ihi(2),
-                                        flux_num_ghosts(0),
-                                        flux_num_ghosts(1),
-                                        flux_num_ghosts(2),
-                                        ifs,
-                                        sflux_data->getPointer(2, d),
-                                        sfsum_data->getPointer(2, ifs, d));
-                                }
-                            }  // if face operations vs. side operations
-                        }
-                    }  // loop over lower and upper sides/faces
-                }  // loop over depth
-                
                 flux_var++;
                 fluxsum_var++;
             }  // loop over flux variables
@@ -3327,12 +4525,29 @@ RungeKuttaLevelIntegrator::printClassData(
         os << "d_lag_dt_computation = " << d_lag_dt_computation << "\n"
            << "d_use_ghosts_for_dt = "
            << d_use_ghosts_for_dt << std::endl;
+        os << "d_use_super_time_stepping = " << d_use_super_time_stepping << std::endl;
     }
     else
     {
         os << "d_dt = " << d_dt << std::endl;
     }
     
+    os << "d_use_implicit_diffusion = " << d_use_implicit_diffusion << std::endl;
+    
+    if (d_use_implicit_diffusion)
+    {
+        os << "d_implicit_diffusion_max_newton_iterations = "
+           << d_implicit_diffusion_max_newton_iterations << "\n"
+           << "d_implicit_diffusion_newton_tolerance = "
+           << d_implicit_diffusion_newton_tolerance << "\n"
+           << "d_implicit_diffusion_max_krylov_iterations = "
+           << d_implicit_diffusion_max_krylov_iterations << "\n"
+           << "d_implicit_diffusion_krylov_tolerance = "
+           << d_implicit_diffusion_krylov_tolerance << std::endl;
+    }
+    
+    os << "d_keep_advance_data_allocated = " << d_keep_advance_data_allocated << std::endl;
+    
     os << "d_patch_strategy = "
        << (RungeKuttaPatchStrategy *)d_patch_strategy << std::endl;
     
@@ -3422,6 +4637,17 @@ RungeKuttaLevelIntegrator::putToRestart(
     restart_db->putBool("lag_dt_computation", d_lag_dt_computation);
     restart_db->putBool("use_ghosts_to_compute_dt", d_use_ghosts_for_dt);
     restart_db->putDouble("dt", d_dt);
+    restart_db->putBool("use_super_time_stepping", d_use_super_time_stepping);
+    restart_db->putBool("use_implicit_diffusion", d_use_implicit_diffusion);
+    restart_db->putInteger("implicit_diffusion_max_newton_iterations",
+        d_implicit_diffusion_max_newton_iterations);
+    restart_db->putDouble("implicit_diffusion_newton_tolerance",
+        d_implicit_diffusion_newton_tolerance);
+    restart_db->putInteger("implicit_diffusion_max_krylov_iterations",
+        d_implicit_diffusion_max_krylov_iterations);
+    restart_db->putDouble("implicit_diffusion_krylov_tolerance",
+        d_implicit_diffusion_krylov_tolerance);
+    restart_db->putBool("keep_advance_data_allocated", d_keep_advance_data_allocated);
     restart_db->putBool("DEV_distinguish_mpi_reduction_costs",
         d_distinguish_mpi_reduction_costs);
     
@@ -3557,6 +4783,31 @@ RungeKuttaLevelIntegrator::getFromInput(
             d_dt = input_db->getDouble("dt");
         }
         
+        d_use_super_time_stepping = input_db->getBoolWithDefault("use_super_time_stepping", false);
+        
+        d_use_implicit_diffusion = input_db->getBoolWithDefault("use_implicit_diffusion", false);
+        
+        if (d_use_implicit_diffusion)
+        {
+            d_implicit_diffusion_max_newton_iterations =
+                input_db->getIntegerWithDefault("implicit_diffusion_max_newton_iterations",
+                    d_implicit_diffusion_max_newton_iterations);
+            
+            d_implicit_diffusion_newton_tolerance =
+                input_db->getDoubleWithDefault("implicit_diffusion_newton_tolerance",
+                    d_implicit_diffusion_newton_tolerance);
+            
+            d_implicit_diffusion_max_krylov_iterations =
+                input_db->getIntegerWithDefault("implicit_diffusion_max_krylov_iterations",
+                    d_implicit_diffusion_max_krylov_iterations);
+            
+            d_implicit_diffusion_krylov_tolerance =
+                input_db->getDoubleWithDefault("implicit_diffusion_krylov_tolerance",
+                    d_implicit_diffusion_krylov_tolerance);
+        }
+        
+        d_keep_advance_data_allocated = input_db->getBoolWithDefault("keep_advance_data_allocated", true);
+        
         d_distinguish_mpi_reduction_costs = input_db->getBoolWithDefault("DEV_distinguish_mpi_reduction_costs", false);
         
         if (input_db->keyExists("RungeKuttaWeights"))
@@ -3721,11 +4972,62 @@ RungeKuttaLevelIntegrator::getFromInput(
                 d_dt = input_db->getDouble("dt");
             }
             
+            d_use_super_time_stepping =
+                input_db->getBoolWithDefault("use_super_time_stepping",
+                    d_use_super_time_stepping);
+            
+            d_use_implicit_diffusion =
+                input_db->getBoolWithDefault("use_implicit_diffusion",
+                    d_use_implicit_diffusion);
+            
+            d_implicit_diffusion_max_newton_iterations =
+                input_db->getIntegerWithDefault("implicit_diffusion_max_newton_iterations",
+                    d_implicit_diffusion_max_newton_iterations);
+            
+            d_implicit_diffusion_newton_tolerance =
+                input_db->getDoubleWithDefault("implicit_diffusion_newton_tolerance",
+                    d_implicit_diffusion_newton_tolerance);
+            
+            d_implicit_diffusion_max_krylov_iterations =
+                input_db->getIntegerWithDefault("implicit_diffusion_max_krylov_iterations",
+                    d_implicit_diffusion_max_krylov_iterations);
+            
+            d_implicit_diffusion_krylov_tolerance =
+                input_db->getDoubleWithDefault("implicit_diffusion_krylov_tolerance",
+                    d_implicit_diffusion_krylov_tolerance);
+            
+            d_keep_advance_data_allocated =
+                input_db->getBoolWithDefault("keep_advance_data_allocated",
+                    d_keep_advance_data_allocated);
+            
             d_distinguish_mpi_reduction_costs =
                 input_db->getBoolWithDefault("DEV_distinguish_mpi_reduction_costs",
                     d_distinguish_mpi_reduction_costs);
         }
     }
+    
+    if (d_use_super_time_stepping && !d_use_cfl)
+    {
+        TBOX_ERROR(": RungeKuttaLevelIntegrator::getFromInput()\n"
+                   << "'use_super_time_stepping' requires 'use_cfl' to be TRUE."
+                   << std::endl);
+    }
+    
+    if (d_use_super_time_stepping && d_use_implicit_diffusion)
+    {
+        TBOX_ERROR(": RungeKuttaLevelIntegrator::getFromInput()\n"
+                   << "'use_super_time_stepping' and 'use_implicit_diffusion' cannot be both TRUE."
+                   << std::endl);
+    }
+    
+    if (d_use_implicit_diffusion &&
+        (d_implicit_diffusion_max_newton_iterations < 1 ||
+         d_implicit_diffusion_max_krylov_iterations < 1))
+    {
+        TBOX_ERROR(": RungeKuttaLevelIntegrator::getFromInput()\n"
+                   << "Numbers of Newton and Krylov iterations of the implicit diffusion must be positive."
+                   << std::endl);
+    }
 }
 
 
@@ -3770,6 +5072,21 @@ RungeKuttaLevelIntegrator::getFromRestart()
     d_lag_dt_computation = db->getBool("lag_dt_computation");
     d_use_ghosts_for_dt = db->getBool("use_ghosts_to_compute_dt");
     d_dt = db->getDouble("dt");
+    d_use_super_time_stepping = db->getBoolWithDefault("use_super_time_stepping", false);
+    d_use_implicit_diffusion = db->getBoolWithDefault("use_implicit_diffusion", false);
+    d_implicit_diffusion_max_newton_iterations =
+        db->getIntegerWithDefault("implicit_diffusion_max_newton_iterations",
+            d_implicit_diffusion_max_newton_iterations);
+    d_implicit_diffusion_newton_tolerance =
+        db->getDoubleWithDefault("implicit_diffusion_newton_tolerance",
+            d_implicit_diffusion_newton_tolerance);
+    d_implicit_diffusion_max_krylov_iterations =
+        db->getIntegerWithDefault("implicit_diffusion_max_krylov_iterations",
+            d_implicit_diffusion_max_krylov_iterations);
+    d_implicit_diffusion_krylov_tolerance =
+        db->getDoubleWithDefault("implicit_diffusion_krylov_tolerance",
+            d_implicit_diffusion_krylov_tolerance);
+    d_keep_advance_data_allocated = db->getBoolWithDefault("keep_advance_data_allocated", true);
     d_distinguish_mpi_reduction_costs = db->getBool("DEV_distinguish_mpi_reduction_costs");
     
     boost::shared_ptr<tbox::Database> RK_db(db->getDatabase("RungeKuttaWeights"));
@@ -361,6 +361,18 @@ RungeKuttaPatchStrategy::outputDataStatistics(
 }
 
 
+void
+RungeKuttaPatchStrategy::resetHierarchyConfiguration(
+   const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
+   const int coarsest_level,
+   const int finest_level)
+{
+   NULL_USE(patch_hierarchy);
+   NULL_USE(coarsest_level);
+   NULL_USE(finest_level);
+}
+
+
 void
 RungeKuttaPatchStrategy::setupLoadBalancer(
    RungeKuttaLevelIntegrator* integrator,
@@ -371,6 +383,48 @@ RungeKuttaPatchStrategy::setupLoadBalancer(
 }
 
 
+void
+RungeKuttaPatchStrategy::computeStableDtsOnPatch(
+   hier::Patch& patch,
+   const bool initial_time,
+   const double dt_time,
+   double& stable_dt_convective,
+   double& stable_dt_diffusive)
+{
+   NULL_USE(patch);
+   NULL_USE(initial_time);
+   NULL_USE(dt_time);
+   NULL_USE(stable_dt_convective);
+   NULL_USE(stable_dt_diffusive);
+   TBOX_ERROR("RungeKuttaPatchStrategy::computeStableDtsOnPatch()"
+      << "\nNo derived class supplies a concrete implementation for "
+      << "\nthis method." << std::endl);
+}
+
+
+void
+RungeKuttaPatchStrategy::setRightHandSideOperator(
+   const RHS_OPERATOR::TYPE& rhs_operator)
+{
+   if (rhs_operator != RHS_OPERATOR::ALL)
+   {
+      TBOX_ERROR("RungeKuttaPatchStrategy::setRightHandSideOperator()"
+         << "\nNo derived class supplies a concrete implementation for "
+         << "\nthis method." << std::endl);
+   }
+}
+
+
+hier::IntVector
+RungeKuttaPatchStrategy::getRightHandSideOperatorNumberOfGhostCells(
+   const tbox::Dimension& dim,
+   const RHS_OPERATOR::TYPE& rhs_operator) const
+{
+   NULL_USE(rhs_operator);
+   return -hier::IntVector::getOne(dim);
+}
+
+
 void
 RungeKuttaPatchStrategy::preprocessAdvanceLevelState(
    const boost::shared_ptr<hier::PatchLevel>& level,
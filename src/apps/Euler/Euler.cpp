@@ -47,6 +47,7 @@ boost::shared_ptr<tbox::Timer> Euler::t_compute_fluxes_sources;
 boost::shared_ptr<tbox::Timer> Euler::t_advance_step;
 boost::shared_ptr<tbox::Timer> Euler::t_synchronize_fluxes;
 boost::shared_ptr<tbox::Timer> Euler::t_setphysbcs;
+boost::shared_ptr<tbox::Timer> Euler::t_reset_hierarchy_config;
 boost::shared_ptr<tbox::Timer> Euler::t_tagvalue;
 boost::shared_ptr<tbox::Timer> Euler::t_taggradient;
 boost::shared_ptr<tbox::Timer> Euler::t_tagmultiresolution;
@@ -85,6 +86,8 @@ Euler::Euler(
             getTimer("Euler::synchronizeHyperbolicFluxes()");
         t_setphysbcs = tbox::TimerManager::getManager()->
             getTimer("Euler::setPhysicalBoundaryConditions()");
+        t_reset_hierarchy_config = tbox::TimerManager::getManager()->
+            getTimer("Euler::resetHierarchyConfiguration()");
         t_tagvalue = tbox::TimerManager::getManager()->
             getTimer("Euler::tagValueDetectorCells()");
         t_taggradient = tbox::TimerManager::getManager()->
@@ -271,6 +274,7 @@ Euler::~Euler()
     t_advance_step.reset();
     t_synchronize_fluxes.reset();
     t_setphysbcs.reset();
+    t_reset_hierarchy_config.reset();
     t_tagvalue.reset();
     t_taggradient.reset();
     t_tagmultiresolution.reset();
@@ -346,6 +350,12 @@ Euler::registerModelVariables(
         "NO_COARSEN",
         "NO_REFINE");
     
+    /*
+     * Register the variables kept in the patches by the convective flux reconstructor.
+     */
+    
+    d_convective_flux_reconstructor->registerConvectiveFluxReconstructorVariables(integrator);
+    
     /*
      * Register the temporary variables used in refinement taggers.
      */
@@ -2114,6 +2124,27 @@ Euler::setPhysicalBoundaryConditions(
 }
 
 
+/*
+ * Drop the cached data of the special boundary conditions of the patches on the levels in the range
+ * of levels after the configuration of the hierarchy has changed.
+ */
+void
+Euler::resetHierarchyConfiguration(
+    const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
+    const int coarsest_level,
+    const int finest_level)
+{
+    t_reset_hierarchy_config->start();
+    
+    d_Euler_boundary_conditions->resetSpecialBoundaryConditionsCache(
+        patch_hierarchy,
+        coarsest_level,
+        finest_level);
+    
+    t_reset_hierarchy_config->stop();
+}
+
+
 void
 Euler::putToRestart(
     const boost::shared_ptr<tbox::Database>& restart_db) const
@@ -2540,6 +2571,8 @@ Euler::printDataStatistics(
             os << "Max/min " << variable_names[vi] << ": " << var_max_global << "/" << var_min_global << std::endl;
         }
     }
+    
+    d_convective_flux_reconstructor->printStatistics(os);
 }
 
 
@@ -919,6 +919,27 @@ EulerBoundaryConditions::setPhysicalBoundaryConditions(
 }
 
 
+/*
+ * Drop the cached data of the special boundary conditions of the patches on the levels in the range
+ * of levels after the configuration of the hierarchy has changed.
+ */
+void
+EulerBoundaryConditions::resetSpecialBoundaryConditionsCache(
+    const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
+    const int coarsest_level,
+    const int finest_level)
+{
+    TBOX_ASSERT(patch_hierarchy);
+    TBOX_ASSERT((coarsest_level >= 0) &&
+                (coarsest_level <= finest_level) &&
+                (finest_level <= patch_hierarchy->getFinestLevelNumber()));
+    
+    NULL_USE(patch_hierarchy);
+    
+    d_Euler_special_boundary_conditions->resetCache(coarsest_level, finest_level);
+}
+
+
 std::vector<double>
 EulerBoundaryConditions::readPrimitiveDataEntry(
     boost::shared_ptr<tbox::Database> db,
@@ -45,6 +45,7 @@ boost::shared_ptr<tbox::Timer> NavierStokes::t_compute_fluxes_sources;
 boost::shared_ptr<tbox::Timer> NavierStokes::t_advance_step;
 boost::shared_ptr<tbox::Timer> NavierStokes::t_synchronize_fluxes;
 boost::shared_ptr<tbox::Timer> NavierStokes::t_setphysbcs;
+boost::shared_ptr<tbox::Timer> NavierStokes::t_reset_hierarchy_config;
 boost::shared_ptr<tbox::Timer> NavierStokes::t_tagvalue;
 boost::shared_ptr<tbox::Timer> NavierStokes::t_taggradient;
 boost::shared_ptr<tbox::Timer> NavierStokes::t_tagmultiresolution;
@@ -62,7 +63,8 @@ NavierStokes::NavierStokes(
         d_stat_dump_filename(stat_dump_filename),
         d_use_nonuniform_workload(false),
         d_use_conservative_form_diffusive_flux(true),
-        d_Navier_Stokes_boundary_conditions_db_is_from_restart(false)
+        d_Navier_Stokes_boundary_conditions_db_is_from_restart(false),
+        d_rhs_operator(RHS_OPERATOR::ALL)
 {
     TBOX_ASSERT(!object_name.empty());
     TBOX_ASSERT(input_db);
@@ -84,6 +86,8 @@ NavierStokes::NavierStokes(
             getTimer("NavierStokes::synchronizeHyperbolicFluxes()");
         t_setphysbcs = tbox::TimerManager::getManager()->
             getTimer("NavierStokes::setPhysicalBoundaryConditions()");
+        t_reset_hierarchy_config = tbox::TimerManager::getManager()->
+            getTimer("NavierStokes::resetHierarchyConfiguration()");
         t_tagvalue = tbox::TimerManager::getManager()->
             getTimer("NavierStokes::tagValueDetectorCells()");
         t_taggradient = tbox::TimerManager::getManager()->
@@ -328,6 +332,7 @@ NavierStokes::~NavierStokes()
     t_advance_step.reset();
     t_synchronize_fluxes.reset();
     t_setphysbcs.reset();
+    t_reset_hierarchy_config.reset();
     t_tagvalue.reset();
     t_taggradient.reset();
     t_tagmultiresolution.reset();
@@ -344,25 +349,8 @@ NavierStokes::registerModelVariables(
      * Determine the number of ghost cells needed.
      */
     
-    hier::IntVector num_ghosts_intermediate = hier::IntVector::getZero(d_dim);
-    
-    num_ghosts_intermediate = hier::IntVector::max(
-        num_ghosts_intermediate,
-        d_convective_flux_reconstructor->getConvectiveFluxNumberOfGhostCells());
-    
-    if (d_use_conservative_form_diffusive_flux)
-    {
-        num_ghosts_intermediate = hier::IntVector::max(
-            num_ghosts_intermediate,
-            d_diffusive_flux_reconstructor->getDiffusiveFluxNumberOfGhostCells());
-    }
-    else
-    {
-        num_ghosts_intermediate = hier::IntVector::max(
-            num_ghosts_intermediate,
-            d_nonconservative_diffusive_flux_divergence_operator->
-                getNonconservativeDiffusiveFluxDivergenceOperatorNumberOfGhostCells());
-    }
+    hier::IntVector num_ghosts_intermediate =
+        getRightHandSideOperatorNumberOfGhostCells(d_dim, RHS_OPERATOR::ALL);
     
     hier::IntVector num_ghosts = num_ghosts_intermediate;
     
@@ -440,6 +428,12 @@ NavierStokes::registerModelVariables(
         "NO_COARSEN",
         "NO_REFINE");
     
+    /*
+     * Register the variables kept in the patches by the convective flux reconstructor.
+     */
+    
+    d_convective_flux_reconstructor->registerConvectiveFluxReconstructorVariables(integrator);
+    
     /*
      * Register the temporary variables used in refinement taggers.
      */
@@ -604,8 +598,105 @@ NavierStokes::computeStableDtOnPatch(
 {
     t_compute_dt->start();
     
-    double stable_dt;
+    double stable_spectral_radius_convective = 0.0;
+    double stable_spectral_radius_diffusive = 0.0;
+    
+    computeStableSpectralRadiiOnPatch(
+        patch,
+        stable_spectral_radius_convective,
+        stable_spectral_radius_diffusive);
+    
+    const double stable_dt = 1.0/fmax(stable_spectral_radius_convective, stable_spectral_radius_diffusive);
+    
+    t_compute_dt->stop();
+    
+    return stable_dt;
+}
+
+
+void
+NavierStokes::computeStableDtsOnPatch(
+    hier::Patch& patch,
+    const bool initial_time,
+    const double dt_time,
+    double& stable_dt_convective,
+    double& stable_dt_diffusive)
+{
+    t_compute_dt->start();
+    
+    double stable_spectral_radius_convective = 0.0;
+    double stable_spectral_radius_diffusive = 0.0;
+    
+    computeStableSpectralRadiiOnPatch(
+        patch,
+        stable_spectral_radius_convective,
+        stable_spectral_radius_diffusive);
+    
+    stable_dt_convective = 1.0/stable_spectral_radius_convective;
+    stable_dt_diffusive = 1.0/stable_spectral_radius_diffusive;
     
+    t_compute_dt->stop();
+}
+
+
+void
+NavierStokes::setRightHandSideOperator(
+    const RHS_OPERATOR::TYPE& rhs_operator)
+{
+    d_rhs_operator = rhs_operator;
+}
+
+
+/*
+ * Get the number of ghost cells of the conservative variables read by the computation of a part of
+ * the right-hand side. The convective part reads the stencil of the convective flux reconstructor
+ * and the diffusive part reads the stencil of the diffusive flux reconstructor or of the
+ * non-conservative diffusive flux divergence operator.
+ */
+hier::IntVector
+NavierStokes::getRightHandSideOperatorNumberOfGhostCells(
+    const tbox::Dimension& dim,
+    const RHS_OPERATOR::TYPE& rhs_operator) const
+{
+    TBOX_ASSERT(dim == d_dim);
+    NULL_USE(dim);
+    
+    hier::IntVector num_ghosts = hier::IntVector::getZero(d_dim);
+    
+    if (rhs_operator != RHS_OPERATOR::DIFFUSIVE)
+    {
+        num_ghosts = hier::IntVector::max(
+            num_ghosts,
+            d_convective_flux_reconstructor->getConvectiveFluxNumberOfGhostCells());
+    }
+    
+    if (rhs_operator != RHS_OPERATOR::CONVECTIVE)
+    {
+        if (d_use_conservative_form_diffusive_flux)
+        {
+            num_ghosts = hier::IntVector::max(
+                num_ghosts,
+                d_diffusive_flux_reconstructor->getDiffusiveFluxNumberOfGhostCells());
+        }
+        else
+        {
+            num_ghosts = hier::IntVector::max(
+                num_ghosts,
+                d_nonconservative_diffusive_flux_divergence_operator->
+                    getNonconservativeDiffusiveFluxDivergenceOperatorNumberOfGhostCells());
+        }
+    }
+    
+    return num_ghosts;
+}
+
+
+void
+NavierStokes::computeStableSpectralRadiiOnPatch(
+    hier::Patch& patch,
+    double& spectral_radius_convective,
+    double& spectral_radius_diffusive)
+{
     const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
         BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
             patch.getPatchGeometry()));
@@ -620,7 +711,8 @@ NavierStokes::computeStableDtOnPatch(
     const hier::Box interior_box = patch.getBox();
     const hier::IntVector interior_dims = interior_box.numberCells();
     
-    double stable_spectral_radius = 0.0;
+    double stable_spectral_radius_convective = 0.0;
+    double stable_spectral_radius_diffusive = 0.0;
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -676,7 +768,7 @@ NavierStokes::computeStableDtOnPatch(
         double* max_D = max_diffusivity->getPointer(0);
         
 #ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd reduction(max:stable_spectral_radius)
+        #pragma omp simd reduction(max:stable_spectral_radius_convective)
 #endif
         for (int i = -num_ghosts_0;
              i < interior_dim_0 + num_ghosts_0;
@@ -687,11 +779,11 @@ NavierStokes::computeStableDtOnPatch(
             
             const double spectral_radius_acoustic = max_lambda_x[idx]/dx_0;
             
-            stable_spectral_radius = fmax(stable_spectral_radius, spectral_radius_acoustic);
+            stable_spectral_radius_convective = fmax(stable_spectral_radius_convective, spectral_radius_acoustic);
         }
         
 #ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd reduction(max:stable_spectral_radius)
+        #pragma omp simd reduction(max:stable_spectral_radius_diffusive)
 #endif
         for (int i = -num_ghosts_0;
              i < interior_dim_0 + num_ghosts_0;
@@ -702,7 +794,7 @@ NavierStokes::computeStableDtOnPatch(
             
             const double spectral_radius_diffusive = 2.0*max_D[idx]/(dx_0*dx_0);
             
-            stable_spectral_radius = fmax(stable_spectral_radius, spectral_radius_diffusive);
+            stable_spectral_radius_diffusive = fmax(stable_spectral_radius_diffusive, spectral_radius_diffusive);
         }
         
         /*
@@ -787,7 +879,7 @@ NavierStokes::computeStableDtOnPatch(
              j++)
         {
 #ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd reduction(max:stable_spectral_radius)
+            #pragma omp simd reduction(max:stable_spectral_radius_convective)
 #endif
             for (int i = -num_ghosts_0;
                  i < interior_dim_0 + num_ghosts_0;
@@ -800,7 +892,7 @@ NavierStokes::computeStableDtOnPatch(
                 const double spectral_radius_acoustic = max_lambda_x[idx]/dx_0 +
                     max_lambda_y[idx]/dx_1;
                 
-                stable_spectral_radius = fmax(stable_spectral_radius, spectral_radius_acoustic);
+                stable_spectral_radius_convective = fmax(stable_spectral_radius_convective, spectral_radius_acoustic);
             }
         }
         
@@ -809,7 +901,7 @@ NavierStokes::computeStableDtOnPatch(
              j++)
         {
 #ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd reduction(max:stable_spectral_radius)
+            #pragma omp simd reduction(max:stable_spectral_radius_diffusive)
 #endif
             for (int i = -num_ghosts_0;
                  i < interior_dim_0 + num_ghosts_0;
@@ -823,7 +915,7 @@ NavierStokes::computeStableDtOnPatch(
                     max_D[idx]/(dx_0*dx_0),
                     max_D[idx]/(dx_1*dx_1));
                 
-                stable_spectral_radius = fmax(stable_spectral_radius, spectral_radius_diffusive);
+                stable_spectral_radius_diffusive = fmax(stable_spectral_radius_diffusive, spectral_radius_diffusive);
             }
         }
         
@@ -926,7 +1018,7 @@ NavierStokes::computeStableDtOnPatch(
                  j++)
             {
 #ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd reduction(max:stable_spectral_radius)
+                #pragma omp simd reduction(max:stable_spectral_radius_convective)
 #endif
                 for (int i = -num_ghosts_0;
                      i < interior_dim_0 + num_ghosts_0;
@@ -942,7 +1034,7 @@ NavierStokes::computeStableDtOnPatch(
                         max_lambda_y[idx]/dx_1 +
                         max_lambda_z[idx]/dx_2;
                     
-                    stable_spectral_radius = fmax(stable_spectral_radius, spectral_radius_acoustic);
+                    stable_spectral_radius_convective = fmax(stable_spectral_radius_convective, spectral_radius_acoustic);
                 }
             }
         }
@@ -956,7 +1048,7 @@ NavierStokes::computeStableDtOnPatch(
                  j++)
             {
 #ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd reduction(max:stable_spectral_radius)
+                #pragma omp simd reduction(max:stable_spectral_radius_diffusive)
 #endif
                 for (int i = -num_ghosts_0;
                      i < interior_dim_0 + num_ghosts_0;
@@ -973,7 +1065,7 @@ NavierStokes::computeStableDtOnPatch(
                         fmax(max_D[idx]/(dx_1*dx_1),
                             max_D[idx]/(dx_2*dx_2)));
                     
-                    stable_spectral_radius = fmax(stable_spectral_radius, spectral_radius_diffusive);
+                    stable_spectral_radius_diffusive = fmax(stable_spectral_radius_diffusive, spectral_radius_diffusive);
                 }
             }
         }
@@ -985,11 +1077,8 @@ NavierStokes::computeStableDtOnPatch(
         d_flow_model->unregisterPatch();
     }
     
-    stable_dt = 1.0/stable_spectral_radius;
-    
-    t_compute_dt->stop();
-    
-    return stable_dt;
+    spectral_radius_convective = stable_spectral_radius_convective;
+    spectral_radius_diffusive = stable_spectral_radius_diffusive;
 }
 
 
@@ -1003,32 +1092,155 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
 {
     t_compute_fluxes_sources->start();
     
+    boost::shared_ptr<hier::VariableContext> patch_data_context = data_context;
+    
+    if (!patch_data_context)
+    {
+        patch_data_context = getDataContext();
+    }
+    
     /*
      * Set zero for the source.
      */
     
-    if (data_context)
+    boost::shared_ptr<pdat::CellData<double> > data_source(
+        BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+            patch.getPatchData(d_variable_source, patch_data_context)));
+    
+    data_source->fillAll(0.0);
+    
+    /*
+     * Set zero for the fluxes of the parts of the right-hand side that are not computed.
+     */
+    
+    const bool compute_convective_part = (d_rhs_operator != RHS_OPERATOR::DIFFUSIVE);
+    const bool compute_diffusive_part = (d_rhs_operator != RHS_OPERATOR::CONVECTIVE);
+    
+    if (!compute_convective_part)
     {
-        boost::shared_ptr<pdat::CellData<double> > data_source(
-            BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
-                patch.getPatchData(d_variable_source, data_context)));
+        boost::shared_ptr<pdat::SideData<double> > data_convective_flux(
+            BOOST_CAST<pdat::SideData<double>, hier::PatchData>(
+                patch.getPatchData(d_variable_convective_flux, patch_data_context)));
         
-        data_source->fillAll(0.0);
+        data_convective_flux->fillAll(0.0);
     }
-    else
+    
+    if (!compute_diffusive_part)
     {
-        boost::shared_ptr<pdat::CellData<double> > data_source(
-            BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
-                patch.getPatchData(d_variable_source, getDataContext())));
+        if (d_use_conservative_form_diffusive_flux)
+        {
+            boost::shared_ptr<pdat::SideData<double> > data_diffusive_flux(
+                BOOST_CAST<pdat::SideData<double>, hier::PatchData>(
+                    patch.getPatchData(d_variable_diffusive_flux, patch_data_context)));
+            
+            data_diffusive_flux->fillAll(0.0);
+        }
+        else
+        {
+            boost::shared_ptr<pdat::CellData<double> > data_diffusive_flux_divergence(
+                BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+                    patch.getPatchData(d_variable_diffusive_flux_divergence, patch_data_context)));
+            
+            data_diffusive_flux_divergence->fillAll(0.0);
+        }
+    }
+    
+    /*
+     * Compute the right-hand side tile by tile if the convective flux reconstructor processes the
+     * patches tile by tile. The convective and diffusive operators are run together on each tile so
+     * that the derived cell data shared by them are computed only once for the tile. The whole patch
+     * is processed at once when the ghost cells copied into the tiles outweigh their interior cells
+     * (see PatchTiles::isTilingBeneficial()).
+     */
+    
+    const hier::IntVector tile_size = d_convective_flux_reconstructor->getTileSize();
+    
+    bool use_tiles = false;
+    
+    if (tile_size > hier::IntVector::getZero(d_dim))
+    {
+        const hier::IntVector num_ghosts_conservative_var = patch.getPatchData(
+            d_flow_model->getConservativeVariables()[0],
+            patch_data_context)->getGhostCellWidth();
         
-        data_source->fillAll(0.0);
+        use_tiles = PatchTiles::isTilingBeneficial(
+            patch.getBox(),
+            tile_size,
+            num_ghosts_conservative_var);
+    }
+    
+    if (use_tiles)
+    {
+        computeFluxesAndSourcesOnTiles(
+            patch,
+            tile_size,
+            time,
+            dt,
+            RK_step_number,
+            patch_data_context);
+    }
+    else
+    {
+        computeFluxesAndSourcesOnSinglePatch(
+            patch,
+            time,
+            dt,
+            RK_step_number,
+            patch_data_context);
     }
     
+    t_compute_fluxes_sources->stop();
+}
+
+
+/*
+ * Compute the fluxes and sources of the parts of the right-hand side that are computed on the
+ * whole patch, or on a tile of a patch, in one pass.
+ */
+void
+NavierStokes::computeFluxesAndSourcesOnSinglePatch(
+    hier::Patch& patch,
+    const double time,
+    const double dt,
+    const int RK_step_number,
+    const boost::shared_ptr<hier::VariableContext>& data_context)
+{
+    const bool compute_convective_part = (d_rhs_operator != RHS_OPERATOR::DIFFUSIVE);
+    const bool compute_diffusive_part = (d_rhs_operator != RHS_OPERATOR::CONVECTIVE);
+    
+    /*
+     * Register the patch in the flow model together with the derived cell variables of both the
+     * convective and the diffusive operators, so that the derived cell data shared by them (e.g.
+     * density, velocity and pressure) are computed only once for the patch.
+     */
+    
+    d_flow_model->registerPatchWithDataContext(patch, data_context);
+    
+    if (compute_convective_part)
+    {
+        d_convective_flux_reconstructor->registerDerivedVariablesForConvectiveFluxAndSource(patch);
+    }
+    
+    if (compute_diffusive_part)
+    {
+        if (d_use_conservative_form_diffusive_flux)
+        {
+            d_diffusive_flux_reconstructor->registerDerivedVariablesForDiffusiveFlux(patch);
+        }
+        else
+        {
+            d_nonconservative_diffusive_flux_divergence_operator->
+                registerDerivedVariablesForDiffusiveFluxDivergence(patch);
+        }
+    }
+    
+    d_flow_model->computeGlobalDerivedCellData();
+    
     /*
      * Compute the convective flux, source due to splitting of convective term and diffusive flux.
      */
     
-    if (data_context)
+    if (compute_convective_part)
     {
         d_convective_flux_reconstructor->computeConvectiveFluxAndSourceOnPatch(
             patch,
@@ -1038,7 +1250,10 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
             time,
             dt,
             RK_step_number);
-        
+    }
+    
+    if (compute_diffusive_part)
+    {
         if (d_use_conservative_form_diffusive_flux)
         {
             d_diffusive_flux_reconstructor->computeDiffusiveFluxOnPatch(
@@ -1061,41 +1276,147 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
                     RK_step_number);
         }
     }
-    else
+    
+    /*
+     * Unregister the patch and data of all registered derived cell variables in the flow model.
+     */
+    
+    d_flow_model->unregisterPatch();
+}
+
+
+/*
+ * Compute the fluxes and sources of the parts of the right-hand side on a patch tile by tile.
+ */
+void
+NavierStokes::computeFluxesAndSourcesOnTiles(
+    hier::Patch& patch,
+    const hier::IntVector& tile_size,
+    const double time,
+    const double dt,
+    const int RK_step_number,
+    const boost::shared_ptr<hier::VariableContext>& data_context)
+{
+    hier::VariableDatabase* variable_db = hier::VariableDatabase::getDatabase();
+    
+    const bool compute_convective_part = (d_rhs_operator != RHS_OPERATOR::DIFFUSIVE);
+    const bool compute_diffusive_part = (d_rhs_operator != RHS_OPERATOR::CONVECTIVE);
+    
+    /*
+     * Get the indices of the patch data copied into each tile and of the patch data computed on
+     * each tile. The conservative variables with their ghost cells and the source are copied into
+     * the tile and the source and the fluxes computed on the tile are copied back to the patch.
+     */
+    
+    std::vector<boost::shared_ptr<pdat::CellVariable<double> > > conservative_variables =
+        d_flow_model->getConservativeVariables();
+    
+    const int source_id = variable_db->mapVariableAndContextToIndex(
+        d_variable_source,
+        data_context);
+    
+    std::vector<int> tile_input_ids;
+    tile_input_ids.reserve(static_cast<int>(conservative_variables.size()) + 1);
+    
+    for (int vi = 0; vi < static_cast<int>(conservative_variables.size()); vi++)
     {
-        d_convective_flux_reconstructor->computeConvectiveFluxAndSourceOnPatch(
-            patch,
+        tile_input_ids.push_back(variable_db->mapVariableAndContextToIndex(
+            conservative_variables[vi],
+            data_context));
+    }
+    
+    tile_input_ids.push_back(source_id);
+    
+    std::vector<int> tile_output_ids;
+    tile_output_ids.push_back(source_id);
+    
+    if (compute_convective_part)
+    {
+        tile_output_ids.push_back(variable_db->mapVariableAndContextToIndex(
             d_variable_convective_flux,
-            d_variable_source,
-            getDataContext(),
-            time,
-            dt,
-            RK_step_number);
-        
+            data_context));
+    }
+    
+    if (compute_diffusive_part)
+    {
         if (d_use_conservative_form_diffusive_flux)
         {
-            d_diffusive_flux_reconstructor->computeDiffusiveFluxOnPatch(
-                patch,
+            tile_output_ids.push_back(variable_db->mapVariableAndContextToIndex(
                 d_variable_diffusive_flux,
-                getDataContext(),
-                time,
-                dt,
-                RK_step_number);
+                data_context));
         }
         else
         {
-            d_nonconservative_diffusive_flux_divergence_operator->
-                computeNonconservativeDiffusiveFluxDivergenceOnPatch(
-                    patch,
-                    d_variable_diffusive_flux_divergence,
-                    getDataContext(),
-                    time,
-                    dt,
-                    RK_step_number);
+            tile_output_ids.push_back(variable_db->mapVariableAndContextToIndex(
+                d_variable_diffusive_flux_divergence,
+                data_context));
         }
     }
     
-    t_compute_fluxes_sources->stop();
+    /*
+     * The data of the tiles are cached by tile shape in d_patch_tiles, so they are allocated once and
+     * reused for all tiles, patches and Runge-Kutta stages.
+     */
+    
+    std::vector<int> tile_data_ids(tile_input_ids);
+    tile_data_ids.insert(tile_data_ids.end(), tile_output_ids.begin() + 1, tile_output_ids.end());
+    
+    if (compute_convective_part)
+    {
+        const std::vector<int> reconstructor_tile_data_ids =
+            d_convective_flux_reconstructor->getTileDataIndices();
+        
+        tile_data_ids.insert(
+            tile_data_ids.end(),
+            reconstructor_tile_data_ids.begin(),
+            reconstructor_tile_data_ids.end());
+    }
+    
+    const int num_tiles = PatchTiles::getNumberOfTiles(patch.getBox(), tile_size);
+    
+    for (int ti = 0; ti < num_tiles; ti++)
+    {
+        /*
+         * Get the cached tile with the shape of the tile box.
+         */
+        
+        const hier::Box tile_box(PatchTiles::getTileBox(patch.getBox(), tile_size, ti));
+        
+        hier::Patch& tile = d_patch_tiles.getTile(patch, tile_box, tile_data_ids);
+        
+        PatchTiles::copyPatchDataToTile(tile, patch, tile_box, tile_input_ids);
+        
+        if (compute_convective_part)
+        {
+            d_convective_flux_reconstructor->copyPatchDataToTile(
+                tile,
+                patch,
+                tile_box,
+                RK_step_number);
+        }
+        
+        /*
+         * Compute the fluxes and sources on the tile and copy them back to the patch.
+         */
+        
+        computeFluxesAndSourcesOnSinglePatch(
+            tile,
+            time,
+            dt,
+            RK_step_number,
+            data_context);
+        
+        PatchTiles::copyTileDataToPatch(patch, tile, tile_box, tile_output_ids);
+        
+        if (compute_convective_part)
+        {
+            d_convective_flux_reconstructor->copyTileDataToPatch(
+                patch,
+                tile,
+                tile_box,
+                RK_step_number);
+        }
+    }
 }
 
 
@@ -3043,6 +3364,27 @@ NavierStokes::setPhysicalBoundaryConditions(
 }
 
 
+/*
+ * Rebuild the boundary fill plans of the patches on the levels in the range of levels after the
+ * configuration of the hierarchy has changed.
+ */
+void
+NavierStokes::resetHierarchyConfiguration(
+    const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
+    const int coarsest_level,
+    const int finest_level)
+{
+    t_reset_hierarchy_config->start();
+    
+    d_Navier_Stokes_boundary_conditions->resetBoundaryFillPlans(
+        patch_hierarchy,
+        coarsest_level,
+        finest_level);
+    
+    t_reset_hierarchy_config->stop();
+}
+
+
 void
 NavierStokes::putToRestart(
     const boost::shared_ptr<tbox::Database>& restart_db) const
@@ -3321,6 +3663,8 @@ NavierStokes::printDataStatistics(
             os << "Max/min " << variable_names[vi] << ": " << var_max_global << "/" << var_min_global << std::endl;
         }
     }
+    
+    d_convective_flux_reconstructor->printStatistics(os);
 }
 
 
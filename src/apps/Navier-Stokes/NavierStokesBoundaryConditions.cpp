@@ -313,6 +313,56 @@ NavierStokesBoundaryConditions::NavierStokesBoundaryConditions(
         }
     }
     
+    /*
+     * Set the boundary condition cases of each conservative variable from its type.
+     */
+    
+    if (d_dim != tbox::Dimension(1))
+    {
+        std::vector<std::string> conservative_var_types =
+            d_flow_model->getVariableTypesOfConservativeVariables();
+        
+        const int num_conservative_vars = static_cast<int>(conservative_var_types.size());
+        
+        d_conservative_var_bdry_node_conds.resize(num_conservative_vars);
+        d_conservative_var_bdry_edge_conds.resize(num_conservative_vars);
+        if (d_dim == tbox::Dimension(3))
+        {
+            d_conservative_var_bdry_face_conds.resize(num_conservative_vars);
+        }
+        
+        for (int vi = 0; vi < num_conservative_vars; vi++)
+        {
+            if (conservative_var_types[vi] == "SCALAR")
+            {
+                d_conservative_var_bdry_node_conds[vi] = d_scalar_bdry_node_conds;
+                d_conservative_var_bdry_edge_conds[vi] = d_scalar_bdry_edge_conds;
+                if (d_dim == tbox::Dimension(3))
+                {
+                    d_conservative_var_bdry_face_conds[vi] = d_scalar_bdry_face_conds;
+                }
+            }
+            else if (conservative_var_types[vi] == "VECTOR")
+            {
+                d_conservative_var_bdry_node_conds[vi] = d_vector_bdry_node_conds;
+                d_conservative_var_bdry_edge_conds[vi] = d_vector_bdry_edge_conds;
+                if (d_dim == tbox::Dimension(3))
+                {
+                    d_conservative_var_bdry_face_conds[vi] = d_vector_bdry_face_conds;
+                }
+            }
+            else
+            {
+                TBOX_ERROR(d_object_name
+                    << ": "
+                    << "Unknown type '"
+                    << conservative_var_types[vi]
+                    << "' of conservative variable."
+                    << std::endl);
+            }
+        }
+    }
+    
     d_Navier_Stokes_special_boundary_conditions.reset(new NavierStokesSpecialBoundaryConditions(
         "d_Navier_Stokes_special_boundary_conditions",
         d_project_name,
@@ -725,6 +775,13 @@ NavierStokesBoundaryConditions::setPhysicalBoundaryConditions(
     const boost::shared_ptr<FlowModelBoundaryUtilities> flow_model_boundary_utilities =
         d_flow_model->getFlowModelBoundaryUtilities();
     
+    /*
+     * Get the cached boundary fill plan of the patch. The boundary utilities build a plan on the
+     * fly if there is no valid cached plan.
+     */
+    
+    const boost::shared_ptr<BoundaryFillPlan> bdry_fill_plan = getBoundaryFillPlan(patch);
+    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -745,7 +802,8 @@ NavierStokesBoundaryConditions::setPhysicalBoundaryConditions(
                 node_locs,
                 d_vector_bdry_node_conds,
                 d_bdry_node_conservative_var,
-                ghost_width_to_fill);
+                ghost_width_to_fill,
+                bdry_fill_plan);
         
         for (int vi = 0; vi < static_cast<int>(conservative_var.size()); vi++)
         {
@@ -758,7 +816,8 @@ NavierStokesBoundaryConditions::setPhysicalBoundaryConditions(
                     node_locs,
                     d_scalar_bdry_node_conds,
                     d_bdry_node_conservative_var[vi],
-                    ghost_width_to_fill);
+                    ghost_width_to_fill,
+                    bdry_fill_plan);
             }
             else if (conservative_var_types[vi] == "VECTOR")
             {
@@ -769,7 +828,8 @@ NavierStokesBoundaryConditions::setPhysicalBoundaryConditions(
                     node_locs,
                     d_vector_bdry_node_conds,
                     d_bdry_node_conservative_var[vi],
-                    ghost_width_to_fill);
+                    ghost_width_to_fill,
+                    bdry_fill_plan);
             }
         }
     }
@@ -793,33 +853,18 @@ NavierStokesBoundaryConditions::setPhysicalBoundaryConditions(
                 edge_locs,
                 d_vector_bdry_edge_conds,
                 d_bdry_edge_conservative_var,
-                ghost_width_to_fill);
+                ghost_width_to_fill,
+                bdry_fill_plan);
         
-        for (int vi = 0; vi < static_cast<int>(conservative_var.size()); vi++)
-        {
-            if (conservative_var_types[vi] == "SCALAR")
-            {
-                BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
-                    conservative_var_names[vi],
-                    conservative_var_data[vi],
-                    patch,
-                    edge_locs,
-                    d_scalar_bdry_edge_conds,
-                    d_bdry_edge_conservative_var[vi],
-                    ghost_width_to_fill);
-            }
-            else if (conservative_var_types[vi] == "VECTOR")
-            {
-                BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
-                    conservative_var_names[vi],
-                    conservative_var_data[vi],
-                    patch,
-                    edge_locs,
-                    d_vector_bdry_edge_conds,
-                    d_bdry_edge_conservative_var[vi],
-                    ghost_width_to_fill);
-            }
-        }
+        BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
+            conservative_var_names,
+            conservative_var_data,
+            patch,
+            edge_locs,
+            d_conservative_var_bdry_edge_conds,
+            d_bdry_edge_conservative_var,
+            ghost_width_to_fill,
+            bdry_fill_plan);
         
         /*
          *  Set boundary conditions for cells corresponding to patch nodes.
@@ -839,33 +884,18 @@ NavierStokesBoundaryConditions::setPhysicalBoundaryConditions(
                 node_locs,
                 d_vector_bdry_node_conds,
                 d_bdry_edge_conservative_var,
-                ghost_width_to_fill);
+                ghost_width_to_fill,
+                bdry_fill_plan);
         
-        for (int vi = 0; vi < static_cast<int>(conservative_var.size()); vi++)
-        {
-            if (conservative_var_types[vi] == "SCALAR")
-            {
-                BasicCartesianBoundaryUtilities2::fillNodeBoundaryData(
-                    conservative_var_names[vi],
-                    conservative_var_data[vi],
-                    patch,
-                    node_locs,
-                    d_scalar_bdry_node_conds,
-                    d_bdry_edge_conservative_var[vi],
-                    ghost_width_to_fill);
-            }
-            else if (conservative_var_types[vi] == "VECTOR")
-            {
-                BasicCartesianBoundaryUtilities2::fillNodeBoundaryData(
-                    conservative_var_names[vi],
-                    conservative_var_data[vi],
-                    patch,
-                    node_locs,
-                    d_vector_bdry_node_conds,
-                    d_bdry_edge_conservative_var[vi],
-                    ghost_width_to_fill);
-            }
-        }
+        BasicCartesianBoundaryUtilities2::fillNodeBoundaryData(
+            conservative_var_names,
+            conservative_var_data,
+            patch,
+            node_locs,
+            d_conservative_var_bdry_node_conds,
+            d_bdry_edge_conservative_var,
+            ghost_width_to_fill,
+            bdry_fill_plan);
     }
     else if (d_dim == tbox::Dimension(3))
     {
@@ -887,33 +917,18 @@ NavierStokesBoundaryConditions::setPhysicalBoundaryConditions(
                 face_locs,
                 d_vector_bdry_face_conds,
                 d_bdry_face_conservative_var,
-                ghost_width_to_fill);
+                ghost_width_to_fill,
+                bdry_fill_plan);
         
-        for (int vi = 0; vi < static_cast<int>(conservative_var.size()); vi++)
-        {
-            if (conservative_var_types[vi] == "SCALAR")
-            {
-                BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
-                    conservative_var_names[vi],
-                    conservative_var_data[vi],
-                    patch,
-                    face_locs,
-                    d_scalar_bdry_face_conds,
-                    d_bdry_face_conservative_var[vi],
-                    ghost_width_to_fill);
-            }
-            else if (conservative_var_types[vi] == "VECTOR")
-            {
-                BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
-                    conservative_var_names[vi],
-                    conservative_var_data[vi],
-                    patch,
-                    face_locs,
-                    d_vector_bdry_face_conds,
-                    d_bdry_face_conservative_var[vi],
-                    ghost_width_to_fill);
-            }
-        }
+        BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
+            conservative_var_names,
+            conservative_var_data,
+            patch,
+            face_locs,
+            d_conservative_var_bdry_face_conds,
+            d_bdry_face_conservative_var,
+            ghost_width_to_fill,
+            bdry_fill_plan);
         
         /*
          * Set boundary conditions for cells corresponding to patch edges.
@@ -933,33 +948,18 @@ NavierStokesBoundaryConditions::setPhysicalBoundaryConditions(
                 edge_locs,
                 d_vector_bdry_edge_conds,
                 d_bdry_face_conservative_var,
-                ghost_width_to_fill);
+                ghost_width_to_fill,
+                bdry_fill_plan);
         
-        for (int vi = 0; vi < static_cast<int>(conservative_var.size()); vi++)
-        {
-            if (conservative_var_types[vi] == "SCALAR")
-            {
-                BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData(
-                    conservative_var_names[vi],
-                    conservative_var_data[vi],
-                    patch,
-                    edge_locs,
-                    d_scalar_bdry_edge_conds,
-                    d_bdry_face_conservative_var[vi],
-                    ghost_width_to_fill);
-            }
-            else if (conservative_var_types[vi] == "VECTOR")
-            {
-                BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData(
-                    conservative_var_names[vi],
-                    conservative_var_data[vi],
-                    patch,
-                    edge_locs,
-                    d_vector_bdry_edge_conds,
-                    d_bdry_face_conservative_var[vi],
-                    ghost_width_to_fill);
-            }
-        }
+        BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData(
+            conservative_var_names,
+            conservative_var_data,
+            patch,
+            edge_locs,
+            d_conservative_var_bdry_edge_conds,
+            d_bdry_face_conservative_var,
+            ghost_width_to_fill,
+            bdry_fill_plan);
         
         /*
          *  Set boundary conditions for cells corresponding to patch nodes.
@@ -979,33 +979,18 @@ NavierStokesBoundaryConditions::setPhysicalBoundaryConditions(
                 node_locs,
                 d_vector_bdry_node_conds,
                 d_bdry_face_conservative_var,
-                ghost_width_to_fill);
+                ghost_width_to_fill,
+                bdry_fill_plan);
         
-        for (int vi = 0; vi < static_cast<int>(conservative_var.size()); vi++)
-        {
-            if (conservative_var_types[vi] == "SCALAR")
-            {
-                BasicCartesianBoundaryUtilities3::fillNodeBoundaryData(
-                    conservative_var_names[vi],
-                    conservative_var_data[vi],
-                    patch,
-                    node_locs,
-                    d_scalar_bdry_node_conds,
-                    d_bdry_face_conservative_var[vi],
-                    ghost_width_to_fill);
-            }
-            else if (conservative_var_types[vi] == "VECTOR")
-            {
-                BasicCartesianBoundaryUtilities3::fillNodeBoundaryData(
-                    conservative_var_names[vi],
-                    conservative_var_data[vi],
-                    patch,
-                    node_locs,
-                    d_vector_bdry_node_conds,
-                    d_bdry_face_conservative_var[vi],
-                    ghost_width_to_fill);
-            }
-        }
+        BasicCartesianBoundaryUtilities3::fillNodeBoundaryData(
+            conservative_var_names,
+            conservative_var_data,
+            patch,
+            node_locs,
+            d_conservative_var_bdry_node_conds,
+            d_bdry_face_conservative_var,
+            ghost_width_to_fill,
+            bdry_fill_plan);
     }
 
     d_Navier_Stokes_special_boundary_conditions->setSpecialBoundaryConditions(
@@ -1018,6 +1003,52 @@ NavierStokesBoundaryConditions::setPhysicalBoundaryConditions(
 }
 
 
+/*
+ * Rebuild the boundary fill plans of the patches touching the physical boundaries on the levels in
+ * the range of levels after the configuration of the hierarchy has changed. The cached data of the
+ * special boundary conditions of these levels is dropped as well.
+ */
+void
+NavierStokesBoundaryConditions::resetBoundaryFillPlans(
+    const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy,
+    const int coarsest_level,
+    const int finest_level)
+{
+    TBOX_ASSERT(patch_hierarchy);
+    TBOX_ASSERT((coarsest_level >= 0) &&
+                (coarsest_level <= finest_level) &&
+                (finest_level <= patch_hierarchy->getFinestLevelNumber()));
+    
+    d_bdry_fill_plans.resize(patch_hierarchy->getNumberOfLevels());
+    
+    for (int ln = coarsest_level; ln <= finest_level; ln++)
+    {
+        boost::shared_ptr<hier::PatchLevel> level(patch_hierarchy->getPatchLevel(ln));
+        
+        std::map<hier::BoxId, boost::shared_ptr<BoundaryFillPlan> >& level_bdry_fill_plans =
+            d_bdry_fill_plans[ln];
+        
+        level_bdry_fill_plans.clear();
+        
+        for (hier::PatchLevel::iterator ip(level->begin());
+             ip != level->end();
+             ip++)
+        {
+            const boost::shared_ptr<hier::Patch>& patch = *ip;
+            
+            if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+            {
+                level_bdry_fill_plans.insert(std::make_pair(
+                    patch->getBox().getBoxId(),
+                    boost::shared_ptr<BoundaryFillPlan>(new BoundaryFillPlan(*patch))));
+            }
+        }
+    }
+    
+    d_Navier_Stokes_special_boundary_conditions->resetCache(coarsest_level, finest_level);
+}
+
+
 std::vector<double>
 NavierStokesBoundaryConditions::readPrimitiveDataEntry(
     boost::shared_ptr<tbox::Database> db,
@@ -1168,3 +1199,28 @@ NavierStokesBoundaryConditions::setDefaultBoundaryConditions()
         }
     }
 }
+
+
+/*
+ * Get the cached boundary fill plan of a patch. A null pointer is returned if no plan is cached for
+ * the patch or if the cached plan is stale.
+ */
+boost::shared_ptr<BoundaryFillPlan>
+NavierStokesBoundaryConditions::getBoundaryFillPlan(
+    const hier::Patch& patch) const
+{
+    const int level_number = patch.getPatchLevelNumber();
+    
+    if (level_number >= 0 && level_number < static_cast<int>(d_bdry_fill_plans.size()))
+    {
+        std::map<hier::BoxId, boost::shared_ptr<BoundaryFillPlan> >::const_iterator it =
+            d_bdry_fill_plans[level_number].find(patch.getBox().getBoxId());
+        
+        if (it != d_bdry_fill_plans[level_number].end() && it->second->isValidFor(patch))
+        {
+            return it->second;
+        }
+    }
+    
+    return boost::shared_ptr<BoundaryFillPlan>();
+}
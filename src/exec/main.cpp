@@ -5,6 +5,7 @@
 #include "apps/Euler/Euler.hpp"
 #include "apps/Navier-Stokes/NavierStokes.hpp"
 #include "extn/visit_data_writer/ExtendedVisItDataWriter.hpp"
+#include "util/memory_usage/MemoryUsage.hpp"
 
 // Headers for basic SAMRAI objects
 
@@ -397,6 +398,12 @@ int main(int argc, char *argv[])
         restart_interval = main_db->getInteger("restart_interval");
     }
     
+    int memory_report_interval = 0;
+    if (main_db->keyExists("memory_report_interval"))
+    {
+        memory_report_interval = main_db->getInteger("memory_report_interval");
+    }
+    
     const std::string restart_write_dirname =
         main_db->getStringWithDefault("restart_write_dirname",
                                       base_name + ".restart");
@@ -1032,6 +1039,14 @@ int main(int argc, char *argv[])
             tbox::pout << "Files for restart are written." << std::endl;
         }
         
+        /*
+         * At specified intervals, print the memory usage.
+         */
+        if ((memory_report_interval > 0) && ((iteration_num % memory_report_interval) == 0))
+        {
+            MemoryUsage::printMemoryUsage(tbox::plog, patch_hierarchy);
+        }
+        
         tbox::pout << "--------------------------------------------------------------------------------";
         tbox::pout << std::endl;
     }
@@ -1113,6 +1128,11 @@ int main(int argc, char *argv[])
      */
     tbox::TimerManager::getManager()->print(tbox::plog);
     
+    /*
+     * Output memory usage.
+     */
+    MemoryUsage::printMemoryUsage(tbox::plog, patch_hierarchy);
+    
     /*
      * At conclusion of simulation, deallocate objects.
      */
@@ -6,6 +6,7 @@
  *
  ************************************************************************/
 #include "extn/visit_data_writer/ExtendedVisItDataWriter.hpp"
+#include "util/memory_usage/MemoryUsage.hpp"
 
 #ifdef HAVE_HDF5
 
@@ -1959,6 +1960,10 @@ ExtendedVisItDataWriter::packRegularAndDerivedData(
             double* dbuffer = new double[buf_size]; // used to pack var
             float* fbuffer = new float[buf_size]; // copy to float for writing
             
+            MemoryUsage::recordTemporaryData(
+                "VisIt data writer buffers",
+                static_cast<size_t>(buf_size)*(sizeof(double) + sizeof(float)));
+            
             // Check for mixed/clean state variables
             if (!(ipi->d_is_material_state_variable))
             {
@@ -2351,6 +2356,10 @@ ExtendedVisItDataWriter::packMaterialsData(
                 ibuffer = new int[buf_size];
             }
             
+            MemoryUsage::recordTemporaryData(
+                "VisIt data writer buffers",
+                static_cast<size_t>(buf_size)*(ibuffer ? sizeof(int) : sizeof(double) + sizeof(float)));
+            
             for (int depth_id = 0; depth_id < ipi->d_depth; ++depth_id)
             {
                 /*
@@ -2693,6 +2702,10 @@ ExtendedVisItDataWriter::packSpeciesData(
             double* dbuffer = new double[buf_size]; // used to pack var
             float* fbuffer = new float[buf_size]; // copy to float for writing
             
+            MemoryUsage::recordTemporaryData(
+                "VisIt data writer buffers",
+                static_cast<size_t>(buf_size)*(sizeof(double) + sizeof(float)));
+            
             for (int depth_id = 0; depth_id < ipi->d_depth; ++depth_id)
             {
                 // pack the buffer with species data
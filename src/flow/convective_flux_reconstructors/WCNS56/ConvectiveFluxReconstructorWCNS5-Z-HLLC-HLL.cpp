@@ -215,6 +215,24 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::printClassData(
     os << "d_constant_p = "
        << d_constant_p
        << std::endl;
+    os << "d_use_tiling = "
+       << d_use_tiling
+       << std::endl;
+    os << "d_tile_size = "
+       << d_tile_size
+       << std::endl;
+    os << "d_use_hybrid_central_WCNS = "
+       << d_use_hybrid_central_WCNS
+       << std::endl;
+    os << "d_hybrid_shock_sensor_threshold = "
+       << d_hybrid_shock_sensor_threshold
+       << std::endl;
+    os << "d_freeze_shock_sensor = "
+       << d_freeze_shock_sensor
+       << std::endl;
+    os << "d_component_wise_interpolation_start_level = "
+       << d_component_wise_interpolation_start_level
+       << std::endl;
 }
 
 
@@ -227,6 +245,23 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::putToRestart(
    const boost::shared_ptr<tbox::Database>& restart_db) const
 {
     restart_db->putInteger("d_constant_p", d_constant_p);
+    
+    if (d_use_tiling)
+    {
+        std::vector<int> tile_size(d_dim.getValue());
+        for (int di = 0; di < d_dim.getValue(); di++)
+        {
+            tile_size[di] = d_tile_size[di];
+        }
+        
+        restart_db->putIntegerVector("d_tile_size", tile_size);
+    }
+    
+    restart_db->putBool("d_use_hybrid_central_WCNS", d_use_hybrid_central_WCNS);
+    restart_db->putDouble("d_hybrid_shock_sensor_threshold", d_hybrid_shock_sensor_threshold);
+    restart_db->putBool("d_freeze_shock_sensor", d_freeze_shock_sensor);
+    restart_db->putInteger("d_component_wise_interpolation_start_level",
+        d_component_wise_interpolation_start_level);
 }
 
 
@@ -237,7 +272,8 @@ void
 ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
     std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_minus,
     std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_plus,
-    const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables)
+    const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables,
+    const std::vector<std::vector<int> >& WENO_row_flags)
 {
 #ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
     TBOX_ASSERT(static_cast<int>(variables_minus.size()) == d_num_eqn);
@@ -372,6 +408,11 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
             
             for (int j = 0; j < interior_dim_1; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[0][j] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -404,6 +445,11 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
             
             for (int j = 0; j < interior_dim_1; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[0][j] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -440,6 +486,11 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
             
             for (int j = -1; j < interior_dim_1 + 2; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[1][j + 1] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -472,6 +523,11 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
             
             for (int j = -1; j < interior_dim_1 + 2; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[1][j + 1] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -521,6 +577,11 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[0][j + k*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -558,6 +619,11 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[0][j + k*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -599,6 +665,11 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = -1; j < interior_dim_1 + 2; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[1][(j + 1) + k*(interior_dim_1 + 3)] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -636,6 +707,11 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = -1; j < interior_dim_1 + 2; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[1][(j + 1) + k*(interior_dim_1 + 3)] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -677,6 +753,11 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[2][j + (k + 1)*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -714,6 +795,11 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[2][j + (k + 1)*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
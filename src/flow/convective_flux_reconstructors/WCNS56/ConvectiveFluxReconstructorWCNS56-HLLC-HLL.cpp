@@ -1,7 +1,53 @@
 #include "flow/convective_flux_reconstructors/WCNS56/ConvectiveFluxReconstructorWCNS56-HLLC-HLL.hpp"
 
+#include "SAMRAI/hier/VariableDatabase.h"
+#include "SAMRAI/pdat/SideGeometry.h"
+#include "SAMRAI/pdat/SideOverlap.h"
+#include "SAMRAI/tbox/MathUtilities.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+
+#include <algorithm>
+
 #define EPSILON HAMERS_EPSILON
 
+
+/*
+ * Perform local linear sixth order interpolation at the mid-point between the cell with index
+ * idx_cell_R and its neighbor on the left, given the stride between the cells in the direction
+ * of interpolation.
+ */
+static inline __attribute__((always_inline)) double performLocalLinearInterpolation(
+    const double* const V,
+    const int idx_cell_R,
+    const int stride)
+{
+    return double(1)/double(256)*(
+        double(3)*(V[idx_cell_R - 3*stride] + V[idx_cell_R + 2*stride]) -
+        double(25)*(V[idx_cell_R - 2*stride] + V[idx_cell_R + stride]) +
+        double(150)*(V[idx_cell_R - stride] + V[idx_cell_R]));
+}
+
+
+/*
+ * Get the box of the faces normal to the given direction on which the shock sensor is computed for
+ * a box of cells. These are the faces of the box of cells and one more face on each side of it in
+ * the given direction.
+ */
+static hier::Box getShockSensorSideBox(
+    const hier::Box& box,
+    const int direction)
+{
+    hier::Box side_box(pdat::SideGeometry::toSideBox(
+        box,
+        static_cast<tbox::Dimension::dir_t>(direction)));
+    
+    side_box.growLower(static_cast<tbox::Dimension::dir_t>(direction), 1);
+    side_box.growUpper(static_cast<tbox::Dimension::dir_t>(direction), 1);
+    
+    return side_box;
+}
+
+
 ConvectiveFluxReconstructorWCNS56::ConvectiveFluxReconstructorWCNS56(
     const std::string& object_name,
     const tbox::Dimension& dim,
@@ -15,7 +61,16 @@ ConvectiveFluxReconstructorWCNS56::ConvectiveFluxReconstructorWCNS56(
             grid_geometry,
             num_eqn,
             flow_model,
-            convective_flux_reconstructor_db)
+            convective_flux_reconstructor_db),
+        d_use_tiling(false),
+        d_tile_size(hier::IntVector::getZero(d_dim)),
+        d_use_hybrid_central_WCNS(false),
+        d_hybrid_shock_sensor_threshold(double(0)),
+        d_num_faces_flagged(0),
+        d_num_faces(0),
+        d_freeze_shock_sensor(false),
+        d_shock_sensor_data_id(-1),
+        d_component_wise_interpolation_start_level(-1)
 {
     d_num_conv_ghosts = hier::IntVector::getOne(d_dim)*4;
     d_eqn_form = d_flow_model->getEquationsForm();
@@ -28,6 +83,161 @@ ConvectiveFluxReconstructorWCNS56::ConvectiveFluxReconstructorWCNS56(
             d_has_advective_eqn_form = true;
         }
     }
+    
+    /*
+     * Get the size of the tiles if the patches are processed tile by tile.
+     */
+    
+    std::vector<int> tile_size;
+    
+    if (convective_flux_reconstructor_db->keyExists("tile_size"))
+    {
+        tile_size = convective_flux_reconstructor_db->getIntegerVector("tile_size");
+    }
+    else if (convective_flux_reconstructor_db->keyExists("d_tile_size"))
+    {
+        tile_size = convective_flux_reconstructor_db->getIntegerVector("d_tile_size");
+    }
+    
+    if (!tile_size.empty())
+    {
+        if (static_cast<int>(tile_size.size()) != d_dim.getValue())
+        {
+            TBOX_ERROR(d_object_name
+                << ": "
+                << "The number of entries of 'tile_size' is not equal to the problem dimension."
+                << std::endl);
+        }
+        
+        for (int di = 0; di < d_dim.getValue(); di++)
+        {
+            if (tile_size[di] <= 0)
+            {
+                TBOX_ERROR(d_object_name
+                    << ": "
+                    << "Non-positive tile size is specified."
+                    << std::endl);
+            }
+            
+            d_tile_size[di] = tile_size[di];
+        }
+        
+        d_use_tiling = true;
+    }
+    
+    /*
+     * Get the settings of the hybrid central/WCNS interpolation.
+     */
+    
+    d_use_hybrid_central_WCNS = convective_flux_reconstructor_db->
+        getBoolWithDefault("use_hybrid_central_WCNS", false);
+    d_use_hybrid_central_WCNS = convective_flux_reconstructor_db->
+        getBoolWithDefault("d_use_hybrid_central_WCNS", d_use_hybrid_central_WCNS);
+    
+    if (d_use_hybrid_central_WCNS)
+    {
+        if (convective_flux_reconstructor_db->keyExists("hybrid_shock_sensor_threshold"))
+        {
+            d_hybrid_shock_sensor_threshold = convective_flux_reconstructor_db->
+                getDouble("hybrid_shock_sensor_threshold");
+        }
+        else if (convective_flux_reconstructor_db->keyExists("d_hybrid_shock_sensor_threshold"))
+        {
+            d_hybrid_shock_sensor_threshold = convective_flux_reconstructor_db->
+                getDouble("d_hybrid_shock_sensor_threshold");
+        }
+        else
+        {
+            TBOX_ERROR(d_object_name
+                << ": "
+                << "Key data 'hybrid_shock_sensor_threshold' not found in input/restart database."
+                << std::endl);
+        }
+        
+        /*
+         * The shock sensor lies between -1 and 1 and is positive on any face with compression, so a
+         * threshold well above zero (e.g. 0.65) is needed for the linear interpolation to be used on
+         * the faces in the smooth compressive regions.
+         */
+        
+        if (d_hybrid_shock_sensor_threshold < double(0) || d_hybrid_shock_sensor_threshold >= double(1))
+        {
+            TBOX_ERROR(d_object_name
+                << ": "
+                << "'hybrid_shock_sensor_threshold' should be in [0, 1)."
+                << std::endl);
+        }
+    }
+    
+    if (d_use_hybrid_central_WCNS && d_dim == tbox::Dimension(1))
+    {
+        TBOX_ERROR(d_object_name
+            << ": "
+            << "The hybrid central/WCNS interpolation is not available in one dimension since the"
+            << " shock sensor is not computed."
+            << std::endl);
+    }
+    
+    /*
+     * Get whether the shock sensor is frozen within the time step. The shock sensor is then kept in
+     * a patch variable from the first Runge-Kutta stage to the later stages. The variable is
+     * registered with the integrator in registerConvectiveFluxReconstructorVariables().
+     */
+    
+    d_freeze_shock_sensor = convective_flux_reconstructor_db->
+        getBoolWithDefault("freeze_shock_sensor", false);
+    d_freeze_shock_sensor = convective_flux_reconstructor_db->
+        getBoolWithDefault("d_freeze_shock_sensor", d_freeze_shock_sensor);
+    
+    if (d_freeze_shock_sensor && d_dim > tbox::Dimension(1))
+    {
+        d_shock_sensor_variable.reset(new pdat::SideVariable<double>(
+            d_dim,
+            "shock_sensor",
+            1));
+    }
+    
+    /*
+     * Get the coarsest level on which the WCNS interpolation is performed on the primitive variables
+     * component by component instead of on the characteristic variables. A negative value means
+     * that the characteristic variables are used on all levels.
+     */
+    
+    d_component_wise_interpolation_start_level = convective_flux_reconstructor_db->
+        getIntegerWithDefault("component_wise_interpolation_start_level", -1);
+    d_component_wise_interpolation_start_level = convective_flux_reconstructor_db->
+        getIntegerWithDefault("d_component_wise_interpolation_start_level",
+            d_component_wise_interpolation_start_level);
+}
+
+
+/*
+ * Register the frozen shock sensor with the integrator as temporary data. The data are allocated on
+ * the levels with the other scratch data of the integrator before the Runge-Kutta stages of a time
+ * step. They are not written to the restart files since the shock sensor is recomputed at the first
+ * Runge-Kutta stage of every time step.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::registerConvectiveFluxReconstructorVariables(
+    RungeKuttaLevelIntegrator* integrator)
+{
+    if (d_shock_sensor_variable)
+    {
+        integrator->registerVariable(
+            d_shock_sensor_variable,
+            hier::IntVector::getOne(d_dim),
+            hier::IntVector::getOne(d_dim),
+            RungeKuttaLevelIntegrator::TEMPORARY,
+            d_grid_geometry,
+            "NO_COARSEN",
+            "NO_REFINE");
+        
+        hier::VariableDatabase* variable_db = hier::VariableDatabase::getDatabase();
+        
+        d_shock_sensor_data_id = variable_db->mapVariableAndContextToIndex(
+            d_shock_sensor_variable,
+            integrator->getScratchContext());
+    }
 }
 
 
@@ -44,325 +254,881 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
     const double dt,
     const int RK_step_number)
 {
-    NULL_USE(time);
-    NULL_USE(RK_step_number);
+    /*
+     * The tiles are not used when the patch is already registered in the flow model by the caller,
+     * since the derived cell data shared with the other operators cover the whole patch. Such a
+     * caller runs the reconstruction on the tiles itself (see getTileSize()). The tiles are also not
+     * used when their ghost cells outweigh their interior cells (see PatchTiles).
+     */
     
-    d_flow_model->setupRiemannSolver();
-    d_riemann_solver = d_flow_model->getFlowModelRiemannSolver();
+    if (d_use_tiling && !d_flow_model->hasRegisteredPatch() &&
+        PatchTiles::isTilingBeneficial(patch.getBox(), d_tile_size, d_num_conv_ghosts))
+    {
+        computeConvectiveFluxAndSourceOnTiles(
+            patch,
+            variable_convective_flux,
+            variable_source,
+            data_context,
+            time,
+            dt,
+            RK_step_number);
+    }
+    else
+    {
+        computeConvectiveFluxAndSourceOnSinglePatch(
+            patch,
+            variable_convective_flux,
+            variable_source,
+            data_context,
+            time,
+            dt,
+            RK_step_number);
+    }
+}
+
+
+/*
+ * Print the fraction of faces flagged by the shock sensor for the hybrid central/WCNS
+ * interpolation since the last call and reset the counters.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::printStatistics(std::ostream& os)
+{
+    if (d_use_hybrid_central_WCNS)
+    {
+        const tbox::SAMRAI_MPI& mpi(tbox::SAMRAI_MPI::getSAMRAIWorld());
+        
+        long num_faces_flagged_global = 0;
+        long num_faces_global = 0;
+        
+        mpi.Allreduce(
+            &d_num_faces_flagged,
+            &num_faces_flagged_global,
+            1,
+            MPI_LONG,
+            MPI_SUM);
+        
+        mpi.Allreduce(
+            &d_num_faces,
+            &num_faces_global,
+            1,
+            MPI_LONG,
+            MPI_SUM);
+        
+        if (num_faces_global > 0)
+        {
+            os << "Fraction of faces flagged by shock sensor: "
+               << double(num_faces_flagged_global)/double(num_faces_global)
+               << std::endl;
+        }
+        
+        d_num_faces_flagged = 0;
+        d_num_faces = 0;
+    }
+}
+
+
+/*
+ * Compute the convective flux and source due to splitting of convective term on a patch
+ * tile by tile.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnTiles(
+    hier::Patch& patch,
+    const boost::shared_ptr<pdat::SideVariable<double> >& variable_convective_flux,
+    const boost::shared_ptr<pdat::CellVariable<double> >& variable_source,
+    const boost::shared_ptr<hier::VariableContext>& data_context,
+    const double time,
+    const double dt,
+    const int RK_step_number)
+{
+    hier::VariableDatabase* variable_db = hier::VariableDatabase::getDatabase();
     
-    // Get the dimensions of box that covers the interior of patch.
-    hier::Box interior_box = patch.getBox();
-    const hier::IntVector interior_dims = interior_box.numberCells();
+    // Get the box that covers the interior of patch.
+    const hier::Box& interior_box = patch.getBox();
     
-    // Get the dimensions of box that covers interior of patch plus
-    // convective ghost cells.
-    hier::Box conv_ghost_box = interior_box;
-    conv_ghost_box.grow(d_num_conv_ghosts);
-    const hier::IntVector conv_ghostcell_dims = conv_ghost_box.numberCells();
+    /*
+     * Get the indices of the patch data that are read or written by the reconstruction.
+     */
     
-    // Get the grid spacing.
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
+    std::vector<boost::shared_ptr<pdat::CellVariable<double> > > conservative_variables =
+        d_flow_model->getConservativeVariables();
     
-    const double* const dx = patch_geom->getDx();
+    std::vector<int> conservative_var_ids;
+    conservative_var_ids.reserve(static_cast<int>(conservative_variables.size()));
     
-    // Get the side data of convective flux.
-    boost::shared_ptr<pdat::SideData<double> > convective_flux(
-        BOOST_CAST<pdat::SideData<double>, hier::PatchData>(
-            patch.getPatchData(variable_convective_flux, data_context)));
+    for (int vi = 0; vi < static_cast<int>(conservative_variables.size()); vi++)
+    {
+        conservative_var_ids.push_back(variable_db->mapVariableAndContextToIndex(
+            conservative_variables[vi],
+            data_context));
+    }
     
-    // Get the cell data of source.
-    boost::shared_ptr<pdat::CellData<double> > source(
-        BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
-            patch.getPatchData(variable_source, data_context)));
+    const int convective_flux_id = variable_db->mapVariableAndContextToIndex(
+        variable_convective_flux,
+        data_context);
     
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-    TBOX_ASSERT(convective_flux);
-    TBOX_ASSERT(convective_flux->getGhostCellWidth() == hier::IntVector::getZero(d_dim));
+    const int source_id = variable_db->mapVariableAndContextToIndex(
+        variable_source,
+        data_context);
     
-    TBOX_ASSERT(source);
-    TBOX_ASSERT(source->getGhostCellWidth() == hier::IntVector::getZero(d_dim));
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(patch.getPatchData(convective_flux_id));
+    TBOX_ASSERT(patch.getPatchData(source_id));
 #endif
     
-    // Allocate temporary patch data.
-    boost::shared_ptr<pdat::SideData<double> > velocity_midpoint;
-    
-    if (d_has_advective_eqn_form)
-    {
-        velocity_midpoint.reset(new pdat::SideData<double>(
-            interior_box, d_dim.getValue(), hier::IntVector::getOne(d_dim)));
-    }
-    
-    boost::shared_ptr<pdat::SideData<double> > convective_flux_midpoint(
-        new pdat::SideData<double>(interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
+    /*
+     * The conservative variables with their ghost cells and the source are copied into the data of
+     * each tile and the convective flux and source of the tile are copied back to the patch.
+     */
     
-    boost::shared_ptr<pdat::SideData<double> > convective_flux_midpoint_HLLC(
-        new pdat::SideData<double>(interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
+    std::vector<int> tile_input_ids(conservative_var_ids);
+    tile_input_ids.push_back(source_id);
     
-    boost::shared_ptr<pdat::SideData<double> > convective_flux_midpoint_HLLC_HLL;
+    std::vector<int> tile_output_ids;
+    tile_output_ids.push_back(convective_flux_id);
+    tile_output_ids.push_back(source_id);
     
-    if (d_dim > tbox::Dimension(1))
-    {
-        convective_flux_midpoint_HLLC_HLL.reset(new pdat::SideData<double>(
-            interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
-    }
+    std::vector<int> tile_data_ids(tile_input_ids);
+    tile_data_ids.push_back(convective_flux_id);
     
-    boost::shared_ptr<pdat::CellData<double> > velocity_derivatives;
-    boost::shared_ptr<pdat::CellData<double> > dilatation;
-    boost::shared_ptr<pdat::CellData<double> > vorticity_magnitude;
-    boost::shared_ptr<pdat::SideData<double> > shock_sensor;;
+    const std::vector<int> reconstructor_tile_data_ids = getTileDataIndices();
+    tile_data_ids.insert(
+        tile_data_ids.end(),
+        reconstructor_tile_data_ids.begin(),
+        reconstructor_tile_data_ids.end());
     
-    if (d_dim > tbox::Dimension(1))
-    {
-        velocity_derivatives.reset(new pdat::CellData<double>(
-            interior_box, d_dim.getValue()*d_dim.getValue(), hier::IntVector::getOne(d_dim)*2));
-        
-        dilatation.reset(new pdat::CellData<double>(
-            interior_box, 1, hier::IntVector::getOne(d_dim)*2));
-        
-        vorticity_magnitude.reset(new pdat::CellData<double>(
-            interior_box, 1, hier::IntVector::getOne(d_dim)*2));
-        
-        shock_sensor.reset(new pdat::SideData<double>(
-            interior_box, 1, hier::IntVector::getOne(d_dim)));
-    }
+    const int num_tiles = PatchTiles::getNumberOfTiles(interior_box, d_tile_size);
     
-    if (d_dim == tbox::Dimension(1))
+    for (int ti = 0; ti < num_tiles; ti++)
     {
         /*
-         * Get the dimension.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        
-        /*
-         * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
+         * Get the cached tile with the shape of the tile box.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
+        const hier::Box tile_box(PatchTiles::getTileBox(interior_box, d_tile_size, ti));
         
-        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
-        
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
-        
-        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
+        hier::Patch& tile = d_patch_tiles.getTile(patch, tile_box, tile_data_ids);
         
-        d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
-            d_num_conv_ghosts,
-            AVERAGING::SIMPLE);
+        PatchTiles::copyPatchDataToTile(tile, patch, tile_box, tile_input_ids);
         
-        d_flow_model->computeGlobalDerivedCellData();
+        copyPatchDataToTile(tile, patch, tile_box, RK_step_number);
         
         /*
-         * Get the pointers to the velocity and convective flux cell data inside the flow model.
-         * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
+         * Run the whole reconstruction pipeline on the tile.
          */
         
-        boost::shared_ptr<pdat::CellData<double> > velocity =
-            d_flow_model->getGlobalCellData("VELOCITY");
-        
-        std::vector<boost::shared_ptr<pdat::CellData<double> > > convective_flux_node(1);
-        convective_flux_node[0] = d_flow_model->getGlobalCellData("CONVECTIVE_FLUX_X");
-        
-        hier::IntVector num_subghosts_velocity = velocity->getGhostCellWidth();
-        hier::IntVector num_subghosts_convective_flux_x = convective_flux_node[0]->getGhostCellWidth();
+        computeConvectiveFluxAndSourceOnSinglePatch(
+            tile,
+            variable_convective_flux,
+            variable_source,
+            data_context,
+            time,
+            dt,
+            RK_step_number);
         
-        const int num_subghosts_0_velocity = num_subghosts_velocity[0];
-        const int num_subghosts_0_convective_flux_x = num_subghosts_convective_flux_x[0];
+        PatchTiles::copyTileDataToPatch(patch, tile, tile_box, tile_output_ids);
         
-        double* u = velocity->getPointer(0);
+        copyTileDataToPatch(patch, tile, tile_box, RK_step_number);
+    }
+    
+#ifdef HAMERS_DEBUG_CHECK_TILES
+    /*
+     * Check that the convective flux and the frozen shock sensor assembled from the tiles are the
+     * same as the ones computed on the whole patch at once.
+     */
+    
+    {
+        const long num_faces_flagged = d_num_faces_flagged;
+        const long num_faces = d_num_faces;
         
-        std::vector<double*> F_node_x;
-        F_node_x.reserve(d_num_eqn);
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            F_node_x.push_back(convective_flux_node[0]->getPointer(ei));
-        }
+        hier::Patch whole_patch(interior_box, variable_db->getPatchDescriptor());
+        whole_patch.setPatchGeometry(patch.getPatchGeometry());
+        whole_patch.setPatchLevelNumber(patch.getPatchLevelNumber());
         
-        std::vector<double*> F_midpoint_x;
-        F_midpoint_x.reserve(d_num_eqn);
-        for (int ei = 0; ei < d_num_eqn; ei++)
+        for (int vi = 0; vi < static_cast<int>(conservative_var_ids.size()); vi++)
         {
-            F_midpoint_x.push_back(convective_flux_midpoint->getPointer(0, ei));
+            whole_patch.allocatePatchData(conservative_var_ids[vi]);
         }
         
-        /*
-         * Get the pointers to the conservative variables and primitive variables.
-         * The numbers of ghost cells are also determined.
-         */
-        
-        std::vector<boost::shared_ptr<pdat::CellData<double> > > conservative_variables =
-            d_flow_model->getGlobalCellDataConservativeVariables();
+        whole_patch.allocatePatchData(convective_flux_id);
+        whole_patch.allocatePatchData(source_id);
         
-        std::vector<boost::shared_ptr<pdat::CellData<double> > > primitive_variables =
-            d_flow_model->getGlobalCellDataPrimitiveVariables();
+        PatchTiles::copyPatchDataToTile(whole_patch, patch, interior_box, conservative_var_ids);
         
-        std::vector<hier::IntVector> num_subghosts_conservative_var;
-        num_subghosts_conservative_var.reserve(d_num_eqn);
+        BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+            whole_patch.getPatchData(source_id))->fillAll(double(0));
         
-        std::vector<hier::IntVector> num_subghosts_primitive_var;
-        num_subghosts_primitive_var.reserve(d_num_eqn);
+        if (d_shock_sensor_data_id >= 0)
+        {
+            whole_patch.allocatePatchData(d_shock_sensor_data_id);
+            
+            if (RK_step_number > 0)
+            {
+                PatchTiles::copyPatchDataToTile(
+                    whole_patch,
+                    patch,
+                    interior_box,
+                    std::vector<int>(1, d_shock_sensor_data_id));
+            }
+        }
         
-        std::vector<double*> Q;
-        Q.reserve(d_num_eqn);
+        computeConvectiveFluxAndSourceOnSinglePatch(
+            whole_patch,
+            variable_convective_flux,
+            variable_source,
+            data_context,
+            time,
+            dt,
+            RK_step_number);
         
-        std::vector<double*> V;
-        V.reserve(d_num_eqn);
+        std::vector<int> check_data_ids(1, convective_flux_id);
         
-        int count_eqn = 0;
+        if (d_shock_sensor_data_id >= 0 && RK_step_number == 0)
+        {
+            check_data_ids.push_back(d_shock_sensor_data_id);
+        }
         
-        for (int vi = 0; vi < static_cast<int>(conservative_variables.size()); vi++)
+        for (int i = 0; i < static_cast<int>(check_data_ids.size()); i++)
         {
-            int depth = conservative_variables[vi]->getDepth();
+            boost::shared_ptr<pdat::SideData<double> > data_tiles(
+                BOOST_CAST<pdat::SideData<double>, hier::PatchData>(
+                    patch.getPatchData(check_data_ids[i])));
             
-            for (int di = 0; di < depth; di++)
+            boost::shared_ptr<pdat::SideData<double> > data_whole_patch(
+                BOOST_CAST<pdat::SideData<double>, hier::PatchData>(
+                    whole_patch.getPatchData(check_data_ids[i])));
+            
+            for (int di = 0; di < d_dim.getValue(); di++)
             {
-                // If the last element of the conservative variable vector is not in the system of equations,
-                // ignore it.
-                if (count_eqn >= d_num_eqn)
-                    break;
+                const hier::Box side_box(check_data_ids[i] == d_shock_sensor_data_id ?
+                    getShockSensorSideBox(interior_box, di) :
+                    pdat::SideGeometry::toSideBox(
+                        interior_box,
+                        static_cast<tbox::Dimension::dir_t>(di)));
                 
-                Q.push_back(conservative_variables[vi]->getPointer(di));
-                num_subghosts_conservative_var.push_back(conservative_variables[vi]->getGhostCellWidth());
+                const pdat::ArrayData<double>& a_tiles = data_tiles->getArrayData(di);
+                const pdat::ArrayData<double>& a_whole_patch = data_whole_patch->getArrayData(di);
                 
-                count_eqn++;
+                for (int depth = 0; depth < static_cast<int>(a_tiles.getDepth()); depth++)
+                {
+                    hier::Box::iterator biend(side_box.end());
+                    for (hier::Box::iterator bi(side_box.begin()); bi != biend; bi++)
+                    {
+                        if (!tbox::MathUtilities<double>::equalEps(
+                                a_tiles(*bi, depth),
+                                a_whole_patch(*bi, depth)))
+                        {
+                            TBOX_ERROR(d_object_name
+                                << ": "
+                                << "The data computed tile by tile differs from the data computed"
+                                << " on the whole patch at "
+                                << *bi
+                                << " in direction "
+                                << di
+                                << "."
+                                << std::endl);
+                        }
+                    }
+                }
             }
         }
         
-        count_eqn = 0;
-        
-        for (int vi = 0; vi < static_cast<int>(primitive_variables.size()); vi++)
+        d_num_faces_flagged = num_faces_flagged;
+        d_num_faces = num_faces;
+    }
+#endif
+}
+
+
+/*
+ * Get the number of cells of each tile if the patches are processed tile by tile.
+ */
+hier::IntVector
+ConvectiveFluxReconstructorWCNS56::getTileSize() const
+{
+    if (d_use_tiling)
+    {
+        return d_tile_size;
+    }
+    
+    return hier::IntVector::getZero(d_dim);
+}
+
+
+/*
+ * Get the index of the patch data of the frozen shock sensor, which is also needed on the tiles of
+ * the patches.
+ */
+std::vector<int>
+ConvectiveFluxReconstructorWCNS56::getTileDataIndices() const
+{
+    std::vector<int> data_ids;
+    
+    if (d_shock_sensor_data_id >= 0)
+    {
+        data_ids.push_back(d_shock_sensor_data_id);
+    }
+    
+    return data_ids;
+}
+
+
+/*
+ * Copy the frozen shock sensor of a patch into a tile of the patch at the Runge-Kutta stages after
+ * the first one.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::copyPatchDataToTile(
+    hier::Patch& tile,
+    const hier::Patch& patch,
+    const hier::Box& tile_box,
+    const int RK_step_number)
+{
+    if (d_shock_sensor_data_id >= 0 && RK_step_number > 0 && patch.checkAllocated(d_shock_sensor_data_id))
+    {
+        PatchTiles::copyPatchDataToTile(
+            tile,
+            patch,
+            tile_box,
+            std::vector<int>(1, d_shock_sensor_data_id));
+    }
+}
+
+
+/*
+ * Copy the frozen shock sensor computed on a tile of a patch back into the patch at the first
+ * Runge-Kutta stage. Only the faces on which the shock sensor is computed on the tile are copied,
+ * since the other faces in the ghost box of the tile data are not set and would overwrite the faces
+ * of the neighboring tiles.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::copyTileDataToPatch(
+    hier::Patch& patch,
+    const hier::Patch& tile,
+    const hier::Box& tile_box,
+    const int RK_step_number)
+{
+    if (d_shock_sensor_data_id >= 0 && RK_step_number == 0)
+    {
+        TBOX_ASSERT(patch.checkAllocated(d_shock_sensor_data_id));
+        
+        std::vector<hier::BoxContainer> shock_sensor_side_boxes(d_dim.getValue());
+        for (int di = 0; di < d_dim.getValue(); di++)
         {
-            int depth = primitive_variables[vi]->getDepth();
-            
-            for (int di = 0; di < depth; di++)
-            {
-                // If the last element of the primitive variable vector is not in the system of equations,
-                // ignore it.
-                if (count_eqn >= d_num_eqn)
-                    break;
-                
-                V.push_back(primitive_variables[vi]->getPointer(di));
-                num_subghosts_primitive_var.push_back(primitive_variables[vi]->getGhostCellWidth());
-                
-                count_eqn++;
-            }
+            shock_sensor_side_boxes[di].pushBack(getShockSensorSideBox(tile_box, di));
         }
         
-        /*
-         * Declare temporary data containers for WENO interpolation.
-         */
+        const pdat::SideOverlap shock_sensor_overlap(
+            shock_sensor_side_boxes,
+            PatchTiles::getTileToPatchTransformation(tile, tile_box));
         
-        std::vector<boost::shared_ptr<pdat::SideData<double> > > projection_variables;
+        patch.getPatchData(d_shock_sensor_data_id)->copy(
+            *tile.getPatchData(d_shock_sensor_data_id),
+            shock_sensor_overlap);
         
-        std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > > characteristic_variables;
+        patch.getPatchData(d_shock_sensor_data_id)->setTime(
+            tile.getPatchData(d_shock_sensor_data_id)->getTime());
+    }
+}
+
+
+/*
+ * Register the derived cell variables required by the convective flux and source in the flow model.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::registerDerivedVariablesForConvectiveFluxAndSource(
+    const hier::Patch& patch)
+{
+    /*
+     * Determine whether the WCNS interpolation is performed on the characteristic variables or on
+     * the primitive variables component by component on the level of the patch.
+     */
+    
+    const bool use_characteristic_interpolation = (d_component_wise_interpolation_start_level < 0) ||
+        (patch.getPatchLevelNumber() < d_component_wise_interpolation_start_level);
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
         
-        std::vector<boost::shared_ptr<pdat::SideData<double> > > characteristic_variables_minus;
-        std::vector<boost::shared_ptr<pdat::SideData<double> > > characteristic_variables_plus;
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
         
-        std::vector<boost::shared_ptr<pdat::SideData<double> > > primitive_variables_minus;
-        std::vector<boost::shared_ptr<pdat::SideData<double> > > primitive_variables_plus;
+        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
         
-        boost::shared_ptr<pdat::SideData<int> > bounded_flag_minus;
-        boost::shared_ptr<pdat::SideData<int> > bounded_flag_plus;
+        if (use_characteristic_interpolation)
+        {
+            d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
+                d_num_conv_ghosts,
+                AVERAGING::SIMPLE);
+        }
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
         
-        /*
-         * Initialize temporary data containers for WENO interpolation.
-         */
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
         
-        int num_projection_var = d_flow_model->getNumberOfProjectionVariablesForPrimitiveVariables();
-        projection_variables.reserve(num_projection_var);
+        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
         
-        for (int vi = 0; vi < num_projection_var; vi++)
+        if (use_characteristic_interpolation)
         {
-            projection_variables.push_back(boost::make_shared<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
+            d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
+                d_num_conv_ghosts,
+                AVERAGING::SIMPLE);
         }
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
         
-        characteristic_variables.resize(6);
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Z", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
         
-        for (int m = 0; m < 6; m++)
+        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
+        
+        if (use_characteristic_interpolation)
         {
-            characteristic_variables[m].reserve(d_num_eqn);
-            for (int ei = 0; ei < d_num_eqn; ei++)
+            d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
+                d_num_conv_ghosts,
+                AVERAGING::SIMPLE);
+        }
+    }
+}
+
+
+/*
+ * Compute the convective flux and source due to splitting of convective term on the whole
+ * patch in one pass.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnSinglePatch(
+    hier::Patch& patch,
+    const boost::shared_ptr<pdat::SideVariable<double> >& variable_convective_flux,
+    const boost::shared_ptr<pdat::CellVariable<double> >& variable_source,
+    const boost::shared_ptr<hier::VariableContext>& data_context,
+    const double time,
+    const double dt,
+    const int RK_step_number)
+{
+    d_flow_model->setupRiemannSolver();
+    d_riemann_solver = d_flow_model->getFlowModelRiemannSolver();
+    
+    // Get the dimensions of box that covers the interior of patch.
+    hier::Box interior_box = patch.getBox();
+    const hier::IntVector interior_dims = interior_box.numberCells();
+    
+    // Get the dimensions of box that covers interior of patch plus
+    // convective ghost cells.
+    hier::Box conv_ghost_box = interior_box;
+    conv_ghost_box.grow(d_num_conv_ghosts);
+    const hier::IntVector conv_ghostcell_dims = conv_ghost_box.numberCells();
+    
+    // Get the grid spacing.
+    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
+        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
+            patch.getPatchGeometry()));
+    
+    const double* const dx = patch_geom->getDx();
+    
+    /*
+     * Determine whether the WCNS interpolation is performed on the characteristic variables or on
+     * the primitive variables component by component on the level of the patch.
+     */
+    
+    const bool use_characteristic_interpolation = (d_component_wise_interpolation_start_level < 0) ||
+        (patch.getPatchLevelNumber() < d_component_wise_interpolation_start_level);
+    
+    // Get the side data of convective flux.
+    boost::shared_ptr<pdat::SideData<double> > convective_flux(
+        BOOST_CAST<pdat::SideData<double>, hier::PatchData>(
+            patch.getPatchData(variable_convective_flux, data_context)));
+    
+    // Get the cell data of source.
+    boost::shared_ptr<pdat::CellData<double> > source(
+        BOOST_CAST<pdat::CellData<double>, hier::PatchData>(
+            patch.getPatchData(variable_source, data_context)));
+    
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(convective_flux);
+    TBOX_ASSERT(convective_flux->getGhostCellWidth() == hier::IntVector::getZero(d_dim));
+    
+    TBOX_ASSERT(source);
+    TBOX_ASSERT(source->getGhostCellWidth() == hier::IntVector::getZero(d_dim));
+#endif
+    
+    // Allocate temporary patch data.
+    boost::shared_ptr<pdat::SideData<double> > velocity_midpoint;
+    
+    if (d_has_advective_eqn_form)
+    {
+        velocity_midpoint.reset(new pdat::SideData<double>(
+            interior_box, d_dim.getValue(), hier::IntVector::getOne(d_dim)));
+    }
+    
+    boost::shared_ptr<pdat::SideData<double> > convective_flux_midpoint(
+        new pdat::SideData<double>(interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
+    
+    boost::shared_ptr<pdat::SideData<double> > convective_flux_midpoint_HLLC(
+        new pdat::SideData<double>(interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
+    
+    boost::shared_ptr<pdat::SideData<double> > convective_flux_midpoint_HLLC_HLL;
+    
+    if (d_dim > tbox::Dimension(1))
+    {
+        convective_flux_midpoint_HLLC_HLL.reset(new pdat::SideData<double>(
+            interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
+    }
+    
+    boost::shared_ptr<pdat::CellData<double> > velocity_derivatives;
+    boost::shared_ptr<pdat::CellData<double> > dilatation;
+    boost::shared_ptr<pdat::CellData<double> > vorticity_magnitude;
+    boost::shared_ptr<pdat::SideData<double> > shock_sensor;
+    
+    /*
+     * If the shock sensor is frozen within the time step, it is stored in the patch at the first
+     * Runge-Kutta stage and stamped with the time of the time step. It is only reused at the later
+     * stages if its time stamp shows that it was computed in the same time step. The time passed
+     * to all the Runge-Kutta stages of a time step is the time at the beginning of the time step.
+     */
+    
+    bool compute_shock_sensor = true;
+    
+    if (d_dim > tbox::Dimension(1))
+    {
+        if (d_freeze_shock_sensor)
+        {
+            if (d_shock_sensor_data_id < 0 || !patch.checkAllocated(d_shock_sensor_data_id))
             {
-                characteristic_variables[m].push_back(boost::make_shared<pdat::SideData<double> >(
-                    interior_box, 1, hier::IntVector::getOne(d_dim)));
+                TBOX_ERROR(d_object_name
+                    << ": "
+                    << "The data of the frozen shock sensor is not allocated on the patch."
+                    << " registerConvectiveFluxReconstructorVariables() should be called in the"
+                    << " registration of the model variables."
+                    << std::endl);
+            }
+            
+            shock_sensor = BOOST_CAST<pdat::SideData<double>, hier::PatchData>(
+                patch.getPatchData(d_shock_sensor_data_id));
+            
+            if (RK_step_number > 0 &&
+                tbox::MathUtilities<double>::equalEps(shock_sensor->getTime(), time))
+            {
+                compute_shock_sensor = false;
+            }
+            else
+            {
+                shock_sensor->setTime(time);
             }
         }
-        
-        characteristic_variables_minus.reserve(d_num_eqn);
-        characteristic_variables_plus.reserve(d_num_eqn);
-        primitive_variables_minus.reserve(d_num_eqn);
-        primitive_variables_plus.reserve(d_num_eqn);
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
+        else
         {
-            characteristic_variables_minus.push_back(boost::make_shared<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
-            characteristic_variables_plus.push_back(boost::make_shared<pdat::SideData<double> >(
+            shock_sensor.reset(new pdat::SideData<double>(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
+        }
+        
+        if (compute_shock_sensor)
+        {
+            velocity_derivatives.reset(new pdat::CellData<double>(
+                interior_box, d_dim.getValue()*d_dim.getValue(), hier::IntVector::getOne(d_dim)*2));
             
-            primitive_variables_minus.push_back(boost::make_shared<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
+            dilatation.reset(new pdat::CellData<double>(
+                interior_box, 1, hier::IntVector::getOne(d_dim)*2));
             
-            primitive_variables_plus.push_back(boost::make_shared<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
+            vorticity_magnitude.reset(new pdat::CellData<double>(
+                interior_box, 1, hier::IntVector::getOne(d_dim)*2));
         }
-        
-        bounded_flag_minus.reset(
-            new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
-        
-        bounded_flag_plus.reset(
-            new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
-        
+    }
+    
+    // Record the memory of the temporary patch data. The frozen shock sensor is stored in the patch.
+    MemoryUsage::recordTemporaryData(
+        "Convective flux reconstructor temporary data",
+        MemoryUsage::getPatchDataSize(velocity_midpoint) +
+        MemoryUsage::getPatchDataSize(convective_flux_midpoint) +
+        MemoryUsage::getPatchDataSize(convective_flux_midpoint_HLLC) +
+        MemoryUsage::getPatchDataSize(convective_flux_midpoint_HLLC_HLL) +
+        (d_freeze_shock_sensor ? 0 : MemoryUsage::getPatchDataSize(shock_sensor)) +
+        MemoryUsage::getPatchDataSize(velocity_derivatives) +
+        MemoryUsage::getPatchDataSize(dilatation) +
+        MemoryUsage::getPatchDataSize(vorticity_magnitude));
+    
+    /*
+     * Check whether the patch and the derived cell variables are already registered in the flow
+     * model by the caller, which then also unregisters the patch.
+     */
+    
+    const bool is_patch_registered = d_flow_model->hasRegisteredPatch();
+    
+    if (d_dim == tbox::Dimension(1))
+    {
         /*
-         * Compute global side data of the projection variables for transformation between
-         * primitive variables and characteristic variables.
+         * Get the dimension.
          */
         
-        d_flow_model->computeGlobalSideDataProjectionVariablesForPrimitiveVariables(
-            projection_variables);
+        const int interior_dim_0 = interior_dims[0];
         
         /*
-         * Transform primitive variables to characteristic variables.
+         * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        for (int m = 0; m < 6; m++)
+        if (!is_patch_registered)
         {
-            d_flow_model->computeGlobalSideDataCharacteristicVariablesFromPrimitiveVariables(
-                characteristic_variables[m],
-                primitive_variables,
-                projection_variables,
-                m - 3);
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForConvectiveFluxAndSource(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
         }
         
         /*
-         * Peform WENO interpolation.
+         * Get the pointers to the velocity and convective flux cell data inside the flow model.
+         * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
          */
         
-        performWENOInterpolation(
-            characteristic_variables_minus,
-            characteristic_variables_plus,
-            characteristic_variables);
-        
-        /*
-         * Transform characteristic variables back to primitive variables.
-         */
+        boost::shared_ptr<pdat::CellData<double> > velocity =
+            d_flow_model->getGlobalCellData("VELOCITY");
         
-        d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
-            primitive_variables_minus,
-            characteristic_variables_minus,
-            projection_variables);
+        std::vector<boost::shared_ptr<pdat::CellData<double> > > convective_flux_node(1);
+        convective_flux_node[0] = d_flow_model->getGlobalCellData("CONVECTIVE_FLUX_X");
         
-        d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
-            primitive_variables_plus,
-            characteristic_variables_plus,
-            projection_variables);
+        hier::IntVector num_subghosts_velocity = velocity->getGhostCellWidth();
+        hier::IntVector num_subghosts_convective_flux_x = convective_flux_node[0]->getGhostCellWidth();
+        
+        const int num_subghosts_0_velocity = num_subghosts_velocity[0];
+        const int num_subghosts_0_convective_flux_x = num_subghosts_convective_flux_x[0];
+        
+        double* u = velocity->getPointer(0);
+        
+        std::vector<double*> F_node_x;
+        F_node_x.reserve(d_num_eqn);
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            F_node_x.push_back(convective_flux_node[0]->getPointer(ei));
+        }
+        
+        std::vector<double*> F_midpoint_x;
+        F_midpoint_x.reserve(d_num_eqn);
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            F_midpoint_x.push_back(convective_flux_midpoint->getPointer(0, ei));
+        }
+        
+        /*
+         * Get the pointers to the conservative variables and primitive variables.
+         * The numbers of ghost cells are also determined.
+         */
+        
+        std::vector<boost::shared_ptr<pdat::CellData<double> > > conservative_variables =
+            d_flow_model->getGlobalCellDataConservativeVariables();
+        
+        std::vector<boost::shared_ptr<pdat::CellData<double> > > primitive_variables =
+            d_flow_model->getGlobalCellDataPrimitiveVariables();
+        
+        std::vector<hier::IntVector> num_subghosts_conservative_var;
+        num_subghosts_conservative_var.reserve(d_num_eqn);
+        
+        std::vector<hier::IntVector> num_subghosts_primitive_var;
+        num_subghosts_primitive_var.reserve(d_num_eqn);
+        
+        std::vector<double*> Q;
+        Q.reserve(d_num_eqn);
+        
+        std::vector<double*> V;
+        V.reserve(d_num_eqn);
+        
+        int count_eqn = 0;
+        
+        for (int vi = 0; vi < static_cast<int>(conservative_variables.size()); vi++)
+        {
+            int depth = conservative_variables[vi]->getDepth();
+            
+            for (int di = 0; di < depth; di++)
+            {
+                // If the last element of the conservative variable vector is not in the system of equations,
+                // ignore it.
+                if (count_eqn >= d_num_eqn)
+                    break;
+                
+                Q.push_back(conservative_variables[vi]->getPointer(di));
+                num_subghosts_conservative_var.push_back(conservative_variables[vi]->getGhostCellWidth());
+                
+                count_eqn++;
+            }
+        }
+        
+        count_eqn = 0;
+        
+        for (int vi = 0; vi < static_cast<int>(primitive_variables.size()); vi++)
+        {
+            int depth = primitive_variables[vi]->getDepth();
+            
+            for (int di = 0; di < depth; di++)
+            {
+                // If the last element of the primitive variable vector is not in the system of equations,
+                // ignore it.
+                if (count_eqn >= d_num_eqn)
+                    break;
+                
+                V.push_back(primitive_variables[vi]->getPointer(di));
+                num_subghosts_primitive_var.push_back(primitive_variables[vi]->getGhostCellWidth());
+                
+                count_eqn++;
+            }
+        }
+        
+        /*
+         * Declare temporary data containers for WENO interpolation.
+         */
+        
+        std::vector<boost::shared_ptr<pdat::SideData<double> > > projection_variables;
+        
+        std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > > characteristic_variables;
+        
+        std::vector<boost::shared_ptr<pdat::SideData<double> > > characteristic_variables_minus;
+        std::vector<boost::shared_ptr<pdat::SideData<double> > > characteristic_variables_plus;
+        
+        std::vector<boost::shared_ptr<pdat::SideData<double> > > primitive_variables_minus;
+        std::vector<boost::shared_ptr<pdat::SideData<double> > > primitive_variables_plus;
+        
+        boost::shared_ptr<pdat::SideData<int> > bounded_flag_minus;
+        boost::shared_ptr<pdat::SideData<int> > bounded_flag_plus;
+        
+        /*
+         * Initialize temporary data containers for WENO interpolation.
+         */
+        
+        primitive_variables_minus.reserve(d_num_eqn);
+        primitive_variables_plus.reserve(d_num_eqn);
+        
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            primitive_variables_minus.push_back(boost::make_shared<pdat::SideData<double> >(
+                interior_box, 1, hier::IntVector::getOne(d_dim)));
+            
+            primitive_variables_plus.push_back(boost::make_shared<pdat::SideData<double> >(
+                interior_box, 1, hier::IntVector::getOne(d_dim)));
+        }
+        
+        bounded_flag_minus.reset(
+            new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
+        
+        bounded_flag_plus.reset(
+            new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
+        
+        characteristic_variables.resize(6);
+        
+        for (int m = 0; m < 6; m++)
+        {
+            characteristic_variables[m].reserve(d_num_eqn);
+            for (int ei = 0; ei < d_num_eqn; ei++)
+            {
+                characteristic_variables[m].push_back(boost::make_shared<pdat::SideData<double> >(
+                    interior_box, 1, hier::IntVector::getOne(d_dim)));
+            }
+        }
+        
+        if (use_characteristic_interpolation)
+        {
+            int num_projection_var = d_flow_model->getNumberOfProjectionVariablesForPrimitiveVariables();
+            projection_variables.reserve(num_projection_var);
+            
+            for (int vi = 0; vi < num_projection_var; vi++)
+            {
+                projection_variables.push_back(boost::make_shared<pdat::SideData<double> >(
+                    interior_box, 1, hier::IntVector::getOne(d_dim)));
+            }
+            
+            characteristic_variables_minus.reserve(d_num_eqn);
+            characteristic_variables_plus.reserve(d_num_eqn);
+            
+            for (int ei = 0; ei < d_num_eqn; ei++)
+            {
+                characteristic_variables_minus.push_back(boost::make_shared<pdat::SideData<double> >(
+                    interior_box, 1, hier::IntVector::getOne(d_dim)));
+                
+                characteristic_variables_plus.push_back(boost::make_shared<pdat::SideData<double> >(
+                    interior_box, 1, hier::IntVector::getOne(d_dim)));
+            }
+            
+            /*
+             * Compute global side data of the projection variables for transformation between
+             * primitive variables and characteristic variables.
+             */
+            
+            d_flow_model->computeGlobalSideDataProjectionVariablesForPrimitiveVariables(
+                projection_variables);
+            
+            /*
+             * Transform primitive variables to characteristic variables.
+             */
+            
+            for (int m = 0; m < 6; m++)
+            {
+                d_flow_model->computeGlobalSideDataCharacteristicVariablesFromPrimitiveVariables(
+                    characteristic_variables[m],
+                    primitive_variables,
+                    projection_variables,
+                    m - 3);
+            }
+            
+            /*
+             * Peform WENO interpolation.
+             */
+            
+            performWENOInterpolation(
+                characteristic_variables_minus,
+                characteristic_variables_plus,
+                characteristic_variables,
+                std::vector<std::vector<int> >());
+            
+            /*
+             * Transform characteristic variables back to primitive variables.
+             */
+            
+            d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
+                primitive_variables_minus,
+                characteristic_variables_minus,
+                projection_variables);
+            
+            d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
+                primitive_variables_plus,
+                characteristic_variables_plus,
+                projection_variables);
+        }
+        else
+        {
+            /*
+             * Get the primitive variables in the stencils of the sides. The containers of the
+             * characteristic variables are used to store them.
+             */
+            
+            for (int m = 0; m < 6; m++)
+            {
+                computeGlobalSideDataPrimitiveVariablesInStencil(
+                    characteristic_variables[m],
+                    primitive_variables,
+                    interior_dims,
+                    m - 3);
+            }
+            
+            /*
+             * Peform WENO interpolation of the primitive variables component by component.
+             */
+            
+            performWENOInterpolation(
+                primitive_variables_minus,
+                primitive_variables_plus,
+                characteristic_variables,
+                std::vector<std::vector<int> >());
+        }
         
         /*
          * Declare containers to store pointers for computing mid-point fluxes.
@@ -532,7 +1298,10 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(1))
     else if (d_dim == tbox::Dimension(2))
@@ -548,22 +1317,14 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
-        
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
-        
-        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
-        
-        d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
-            d_num_conv_ghosts,
-            AVERAGING::SIMPLE);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForConvectiveFluxAndSource(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Get the pointers to the velocity and convective flux cell data inside the flow model.
@@ -600,8 +1361,6 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         double* u     = velocity->getPointer(0);
         double* v     = velocity->getPointer(1);
-        double* theta = dilatation->getPointer(0);
-        double* Omega = vorticity_magnitude->getPointer(0);
         double* s_x   = shock_sensor->getPointer(0);
         double* s_y   = shock_sensor->getPointer(1);
         
@@ -644,89 +1403,169 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         }
         
         /*
-         * Compute the derivatives of velocity, dilatation and vorticity magnitude.
+         * Compute the shock sensor unless it is frozen within the time step and has been computed
+         * at the first Runge-Kutta stage.
          */
         
-        boost::shared_ptr<DerivativeFirstOrder> derivative_first_order_x(
-            new DerivativeFirstOrder("first order derivative in x-direction", d_dim, DIRECTION::X_DIRECTION, 1));
-        
-        boost::shared_ptr<DerivativeFirstOrder> derivative_first_order_y(
-            new DerivativeFirstOrder("first order derivative in y-direction", d_dim, DIRECTION::Y_DIRECTION, 1));
-        
-        // Compute dudx.
-        derivative_first_order_x->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[0],
-            0,
-            0);
-        
-        // Compute dudy.
-        derivative_first_order_y->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[1],
-            1,
-            0);
-        
-        // Compute dvdx.
-        derivative_first_order_x->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[0],
-            2,
-            1);
-        
-        // Compute dvdy.
-        derivative_first_order_y->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[1],
-            3,
-            1);
-        
-        // Get the pointers to the cell data of velocity derivatives.
-        double* dudx = velocity_derivatives->getPointer(0);
-        double* dudy = velocity_derivatives->getPointer(1);
-        double* dvdx = velocity_derivatives->getPointer(2);
-        double* dvdy = velocity_derivatives->getPointer(3);
-        
-        // Compute the dilatation.
-        for (int j = -2; j < interior_dim_1 + 2; j++)
+        if (compute_shock_sensor)
         {
+            double* theta = dilatation->getPointer(0);
+            double* Omega = vorticity_magnitude->getPointer(0);
+            
+            /*
+             * Compute the derivatives of velocity, dilatation and vorticity magnitude.
+             */
+            
+            boost::shared_ptr<DerivativeFirstOrder> derivative_first_order_x(
+                new DerivativeFirstOrder("first order derivative in x-direction", d_dim, DIRECTION::X_DIRECTION, 1));
+            
+            boost::shared_ptr<DerivativeFirstOrder> derivative_first_order_y(
+                new DerivativeFirstOrder("first order derivative in y-direction", d_dim, DIRECTION::Y_DIRECTION, 1));
+            
+            // Compute dudx.
+            derivative_first_order_x->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[0],
+                0,
+                0);
+            
+            // Compute dudy.
+            derivative_first_order_y->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[1],
+                1,
+                0);
+            
+            // Compute dvdx.
+            derivative_first_order_x->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[0],
+                2,
+                1);
+            
+            // Compute dvdy.
+            derivative_first_order_y->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[1],
+                3,
+                1);
+            
+            // Get the pointers to the cell data of velocity derivatives.
+            double* dudx = velocity_derivatives->getPointer(0);
+            double* dudy = velocity_derivatives->getPointer(1);
+            double* dvdx = velocity_derivatives->getPointer(2);
+            double* dvdy = velocity_derivatives->getPointer(3);
+            
+            // Compute the dilatation.
+            for (int j = -2; j < interior_dim_1 + 2; j++)
+            {
 #ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
+                #pragma omp simd
 #endif
-            for (int i = -2; i < interior_dim_0 + 2; i++)
-            {
-                // Compute the linear index.
-                const int idx = (i + 2) +
-                    (j + 2)*(interior_dim_0 + 4);
-                
-                theta[idx] = dudx[idx] + dvdy[idx];
+                for (int i = -2; i < interior_dim_0 + 2; i++)
+                {
+                    // Compute the linear index.
+                    const int idx = (i + 2) +
+                        (j + 2)*(interior_dim_0 + 4);
+                    
+                    theta[idx] = dudx[idx] + dvdy[idx];
+                }
             }
-        }
-        
-        // Compute the magnitude of vorticity.
-        for (int j = -2; j < interior_dim_1 + 2; j++)
-        {
+            
+            // Compute the magnitude of vorticity.
+            for (int j = -2; j < interior_dim_1 + 2; j++)
+            {
 #ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
+                #pragma omp simd
 #endif
-            for (int i = -2; i < interior_dim_0 + 2; i++)
+                for (int i = -2; i < interior_dim_0 + 2; i++)
+                {
+                    // Compute the linear index.
+                    const int idx = (i + 2) +
+                        (j + 2)*(interior_dim_0 + 4);
+                    
+                    Omega[idx] = fabs(dvdx[idx] - dudy[idx]);
+                }
+            }
+            
+            /*
+             * Compute the Ducros-like shock sensor.
+             */
+            
+            for (int j = 0; j < interior_dim_1; j++)
             {
-                // Compute the linear index.
-                const int idx = (i + 2) +
-                    (j + 2)*(interior_dim_0 + 4);
-                
-                Omega[idx] = fabs(dvdx[idx] - dudy[idx]);
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = -1; i < interior_dim_0 + 2; i++)
+                {
+                    // Compute the linear index of the side.
+                    const int idx_midpoint_x = (i + 1) +
+                        (j + 1)*(interior_dim_0 + 3);
+                    
+                    const int idx_L = (i + 1) +
+                        (j + 2)*(interior_dim_0 + 4);
+                    
+                    const int idx_R = (i + 2) +
+                        (j + 2)*(interior_dim_0 + 4);
+                    
+                    double theta_avg = 0.5*(theta[idx_L] + theta[idx_R]);
+                    double Omega_avg = 0.5*(Omega[idx_L] + Omega[idx_R]);
+                    
+                    s_x[idx_midpoint_x] = -theta_avg/(fabs(theta_avg) + Omega_avg + EPSILON);
+                }
             }
-        }
-        
-        /*
-         * Get the pointers to the conservative variables and primitive variables.
-         * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
-         */
+            
+            for (int j = -1; j < interior_dim_1 + 2; j++)
+            {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = 0; i < interior_dim_0; i++)
+                {
+                    // Compute the linear index of the side.
+                    const int idx_midpoint_y = (i + 1) +
+                        (j + 1)*(interior_dim_0 + 2);
+                    
+                    const int idx_B = (i + 2) +
+                        (j + 1)*(interior_dim_0 + 4);
+                    
+                    const int idx_T = (i + 2) +
+                        (j + 2)*(interior_dim_0 + 4);
+                    
+                    double theta_avg = 0.5*(theta[idx_B] + theta[idx_T]);
+                    double Omega_avg = 0.5*(Omega[idx_B] + Omega[idx_T]);
+                    
+                    s_y[idx_midpoint_y] = -theta_avg/(fabs(theta_avg) + Omega_avg + EPSILON);
+                }
+            }
+        }
+        
+        /*
+         * Determine whether the characteristic WCNS interpolation is required on the patch. With
+         * the hybrid central/WCNS interpolation, it is only required if any face is flagged by the
+         * shock sensor and it is only performed on the rows of faces that contain flagged faces.
+         */
+        
+        bool use_WCNS_interpolation = true;
+        std::vector<std::vector<int> > WENO_row_flags;
+        
+        if (d_use_hybrid_central_WCNS)
+        {
+            use_WCNS_interpolation = countFacesFlaggedByShockSensor(
+                WENO_row_flags,
+                shock_sensor,
+                interior_dims);
+        }
+        
+        /*
+         * Get the pointers to the conservative variables and primitive variables.
+         * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
+         */
         
         std::vector<boost::shared_ptr<pdat::CellData<double> > > conservative_variables =
             d_flow_model->getGlobalCellDataConservativeVariables();
@@ -817,40 +1656,11 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
          * Initialize temporary data containers for WENO interpolation.
          */
         
-        int num_projection_var = d_flow_model->getNumberOfProjectionVariablesForPrimitiveVariables();
-        projection_variables.reserve(num_projection_var);
-        
-        for (int vi = 0; vi < num_projection_var; vi++)
-        {
-            projection_variables.push_back(boost::make_shared<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-        }
-        
-        characteristic_variables.resize(6);
-        
-        for (int m = 0; m < 6; m++)
-        {
-            characteristic_variables[m].reserve(d_num_eqn);
-            for (int ei = 0; ei < d_num_eqn; ei++)
-            {
-                characteristic_variables[m].push_back(boost::make_shared<pdat::SideData<double> >(
-                    interior_box, 1, hier::IntVector::getOne(d_dim)));
-            }
-        }
-        
-        characteristic_variables_minus.reserve(d_num_eqn);
-        characteristic_variables_plus.reserve(d_num_eqn);
         primitive_variables_minus.reserve(d_num_eqn);
         primitive_variables_plus.reserve(d_num_eqn);
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            characteristic_variables_minus.push_back(boost::make_shared<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
-            characteristic_variables_plus.push_back(boost::make_shared<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
             primitive_variables_minus.push_back(boost::make_shared<pdat::SideData<double> >(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
             
@@ -864,50 +1674,150 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         bounded_flag_plus.reset(
             new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
         
-        /*
-         * Compute global side data of the projection variables for transformation between
-         * primitive variables and characteristic variables.
-         */
-        
-        d_flow_model->computeGlobalSideDataProjectionVariablesForPrimitiveVariables(
-            projection_variables);
+        if (use_WCNS_interpolation)
+        {
+            characteristic_variables.resize(6);
+            
+            for (int m = 0; m < 6; m++)
+            {
+                characteristic_variables[m].reserve(d_num_eqn);
+                for (int ei = 0; ei < d_num_eqn; ei++)
+                {
+                    characteristic_variables[m].push_back(boost::make_shared<pdat::SideData<double> >(
+                        interior_box, 1, hier::IntVector::getOne(d_dim)));
+                }
+            }
+            
+            if (use_characteristic_interpolation)
+            {
+                int num_projection_var = d_flow_model->getNumberOfProjectionVariablesForPrimitiveVariables();
+                projection_variables.reserve(num_projection_var);
+                
+                for (int vi = 0; vi < num_projection_var; vi++)
+                {
+                    projection_variables.push_back(boost::make_shared<pdat::SideData<double> >(
+                        interior_box, 1, hier::IntVector::getOne(d_dim)));
+                }
+                
+                characteristic_variables_minus.reserve(d_num_eqn);
+                characteristic_variables_plus.reserve(d_num_eqn);
+                
+                for (int ei = 0; ei < d_num_eqn; ei++)
+                {
+                    characteristic_variables_minus.push_back(boost::make_shared<pdat::SideData<double> >(
+                        interior_box, 1, hier::IntVector::getOne(d_dim)));
+                    
+                    characteristic_variables_plus.push_back(boost::make_shared<pdat::SideData<double> >(
+                        interior_box, 1, hier::IntVector::getOne(d_dim)));
+                }
+                
+                /*
+                 * The rows of faces skipped by the WENO interpolation are overwritten by the linear
+                 * interpolation later. Only their characteristic variables are zeroed so that the
+                 * transformation back to the primitive variables does not read uninitialized data.
+                 * The projection variables and the transformations between the primitive and the
+                 * characteristic variables are still computed on all the faces of the patch, not
+                 * only on the rows flagged in WENO_row_flags.
+                 */
+                
+                zeroRowsSkippedByWENOInterpolation(
+                    characteristic_variables_minus,
+                    WENO_row_flags,
+                    interior_dims);
+                
+                zeroRowsSkippedByWENOInterpolation(
+                    characteristic_variables_plus,
+                    WENO_row_flags,
+                    interior_dims);
+                
+                /*
+                 * Compute global side data of the projection variables for transformation between
+                 * primitive variables and characteristic variables.
+                 */
+                
+                d_flow_model->computeGlobalSideDataProjectionVariablesForPrimitiveVariables(
+                    projection_variables);
+                
+                /*
+                 * Transform primitive variables to characteristic variables.
+                 */
+                
+                for (int m = 0; m < 6; m++)
+                {
+                    d_flow_model->computeGlobalSideDataCharacteristicVariablesFromPrimitiveVariables(
+                        characteristic_variables[m],
+                        primitive_variables,
+                        projection_variables,
+                        m - 3);
+                }
+                
+                /*
+                 * Peform WENO interpolation.
+                 */
+                
+                performWENOInterpolation(
+                    characteristic_variables_minus,
+                    characteristic_variables_plus,
+                    characteristic_variables,
+                    WENO_row_flags);
+                
+                /*
+                 * Transform characteristic variables back to primitive variables.
+                 */
+                
+                d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
+                    primitive_variables_minus,
+                    characteristic_variables_minus,
+                    projection_variables);
+                
+                d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
+                    primitive_variables_plus,
+                    characteristic_variables_plus,
+                    projection_variables);
+            }
+            else
+            {
+                /*
+                 * Get the primitive variables in the stencils of the sides. The containers of the
+                 * characteristic variables are used to store them.
+                 */
+                
+                for (int m = 0; m < 6; m++)
+                {
+                    computeGlobalSideDataPrimitiveVariablesInStencil(
+                        characteristic_variables[m],
+                        primitive_variables,
+                        interior_dims,
+                        m - 3);
+                }
+                
+                /*
+                 * Peform WENO interpolation of the primitive variables component by component.
+                 */
+                
+                performWENOInterpolation(
+                    primitive_variables_minus,
+                    primitive_variables_plus,
+                    characteristic_variables,
+                    WENO_row_flags);
+            }
+        }
         
         /*
-         * Transform primitive variables to characteristic variables.
+         * Use linear interpolation of the primitive variables on the faces that are not flagged by
+         * the shock sensor if the hybrid central/WCNS interpolation is used.
          */
         
-        for (int m = 0; m < 6; m++)
+        if (d_use_hybrid_central_WCNS)
         {
-            d_flow_model->computeGlobalSideDataCharacteristicVariablesFromPrimitiveVariables(
-                characteristic_variables[m],
+            performLinearInterpolationOnSmoothFaces(
+                primitive_variables_minus,
+                primitive_variables_plus,
                 primitive_variables,
-                projection_variables,
-                m - 3);
+                shock_sensor,
+                interior_dims);
         }
         
-        /*
-         * Peform WENO interpolation.
-         */
-        
-        performWENOInterpolation(
-            characteristic_variables_minus,
-            characteristic_variables_plus,
-            characteristic_variables);
-        
-        /*
-         * Transform characteristic variables back to primitive variables.
-         */
-        
-        d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
-            primitive_variables_minus,
-            characteristic_variables_minus,
-            projection_variables);
-        
-        d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
-            primitive_variables_plus,
-            characteristic_variables_plus,
-            projection_variables);
-        
         /*
          * Declare containers to store pointers for computing mid-point fluxes.
          */
@@ -1055,31 +1965,6 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
             DIRECTION::X_DIRECTION,
             RIEMANN_SOLVER::HLLC_HLL);
         
-        // Compute the Ducros-like shock sensor.
-        for (int j = 0; j < interior_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = -1; i < interior_dim_0 + 2; i++)
-            {
-                // Compute the linear index of the side.
-                const int idx_midpoint_x = (i + 1) +
-                    (j + 1)*(interior_dim_0 + 3);
-                
-                const int idx_L = (i + 1) +
-                    (j + 2)*(interior_dim_0 + 4);
-                
-                const int idx_R = (i + 2) +
-                    (j + 2)*(interior_dim_0 + 4);
-                
-                double theta_avg = 0.5*(theta[idx_L] + theta[idx_R]);
-                double Omega_avg = 0.5*(Omega[idx_L] + Omega[idx_R]);
-                
-                s_x[idx_midpoint_x] = -theta_avg/(fabs(theta_avg) + Omega_avg + EPSILON);
-            }
-        }
-        
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
             for (int j = 0; j < interior_dim_1; j++)
@@ -1136,31 +2021,6 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
             DIRECTION::Y_DIRECTION,
             RIEMANN_SOLVER::HLLC_HLL);
         
-        // Compute the Ducros-like shock sensor.
-        for (int j = -1; j < interior_dim_1 + 2; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0; i++)
-            {
-                // Compute the linear index of the side.
-                const int idx_midpoint_y = (i + 1) +
-                    (j + 1)*(interior_dim_0 + 2);
-                
-                const int idx_B = (i + 2) +
-                    (j + 1)*(interior_dim_0 + 4);
-                
-                const int idx_T = (i + 2) +
-                    (j + 2)*(interior_dim_0 + 4);
-                
-                double theta_avg = 0.5*(theta[idx_B] + theta[idx_T]);
-                double Omega_avg = 0.5*(Omega[idx_B] + Omega[idx_T]);
-                
-                s_y[idx_midpoint_y] = -theta_avg/(fabs(theta_avg) + Omega_avg + EPSILON);
-            }
-        }
-        
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
             for (int j = -1; j < interior_dim_1 + 2; j++)
@@ -1365,7 +2225,10 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(2))
     else if (d_dim == tbox::Dimension(3))
@@ -1382,23 +2245,14 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
-        
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Z", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
-        
-        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
-        
-        d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
-            d_num_conv_ghosts,
-            AVERAGING::SIMPLE);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForConvectiveFluxAndSource(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Get the pointers to the velocity and convective flux cell data inside the flow model.
@@ -1452,8 +2306,6 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         double* u     = velocity->getPointer(0);
         double* v     = velocity->getPointer(1);
         double* w     = velocity->getPointer(2);
-        double* theta = dilatation->getPointer(0);
-        double* Omega = vorticity_magnitude->getPointer(0);
         double* s_x   = shock_sensor->getPointer(0);
         double* s_y   = shock_sensor->getPointer(1);
         double* s_z   = shock_sensor->getPointer(2);
@@ -1509,187 +2361,318 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         }
         
         /*
-         * Compute the derivatives of velocity, dilatation and vorticity magnitude.
+         * Compute the shock sensor unless it is frozen within the time step and has been computed
+         * at the first Runge-Kutta stage.
          */
         
-        boost::shared_ptr<DerivativeFirstOrder> derivative_first_order_x(
-            new DerivativeFirstOrder("first order derivative in x-direction", d_dim, DIRECTION::X_DIRECTION, 1));
-        
-        boost::shared_ptr<DerivativeFirstOrder> derivative_first_order_y(
-            new DerivativeFirstOrder("first order derivative in y-direction", d_dim, DIRECTION::Y_DIRECTION, 1));
-        
-        boost::shared_ptr<DerivativeFirstOrder> derivative_first_order_z(
-            new DerivativeFirstOrder("first order derivative in z-direction", d_dim, DIRECTION::Z_DIRECTION, 1));
-        
-        // Compute dudx.
-        derivative_first_order_x->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[0],
-            0,
-            0);
-        
-        // Compute dudy.
-        derivative_first_order_y->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[1],
-            1,
-            0);
-        
-        // Compute dudz.
-        derivative_first_order_z->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[2],
-            2,
-            0);
-        
-        // Compute dvdx.
-        derivative_first_order_x->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[0],
-            3,
-            1);
-        
-        // Compute dvdy.
-        derivative_first_order_y->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[1],
-            4,
-            1);
-        
-        // Compute dvdz.
-        derivative_first_order_z->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[2],
-            5,
-            1);
-        
-        // Compute dwdx.
-        derivative_first_order_x->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[0],
-            6,
-            2);
-        
-        // Compute dwdy.
-        derivative_first_order_y->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[1],
-            7,
-            2);
-        
-        // Compute dwdz.
-        derivative_first_order_z->computeDerivative(
-            velocity_derivatives,
-            velocity,
-            dx[2],
-            8,
-            2);
-        
-        // Get the pointers to the cell data of velocity derivatives.
-        double* dudx = velocity_derivatives->getPointer(0);
-        double* dudy = velocity_derivatives->getPointer(1);
-        double* dudz = velocity_derivatives->getPointer(2);
-        double* dvdx = velocity_derivatives->getPointer(3);
-        double* dvdy = velocity_derivatives->getPointer(4);
-        double* dvdz = velocity_derivatives->getPointer(5);
-        double* dwdx = velocity_derivatives->getPointer(6);
-        double* dwdy = velocity_derivatives->getPointer(7);
-        double* dwdz = velocity_derivatives->getPointer(8);
-        
-        // Compute the dilatation.
-        for (int k = -2; k < interior_dim_2 + 2; k++)
+        if (compute_shock_sensor)
         {
-            for (int j = -2; j < interior_dim_1 + 2; j++)
+            double* theta = dilatation->getPointer(0);
+            double* Omega = vorticity_magnitude->getPointer(0);
+            
+            /*
+             * Compute the derivatives of velocity, dilatation and vorticity magnitude.
+             */
+            
+            boost::shared_ptr<DerivativeFirstOrder> derivative_first_order_x(
+                new DerivativeFirstOrder("first order derivative in x-direction", d_dim, DIRECTION::X_DIRECTION, 1));
+            
+            boost::shared_ptr<DerivativeFirstOrder> derivative_first_order_y(
+                new DerivativeFirstOrder("first order derivative in y-direction", d_dim, DIRECTION::Y_DIRECTION, 1));
+            
+            boost::shared_ptr<DerivativeFirstOrder> derivative_first_order_z(
+                new DerivativeFirstOrder("first order derivative in z-direction", d_dim, DIRECTION::Z_DIRECTION, 1));
+            
+            // Compute dudx.
+            derivative_first_order_x->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[0],
+                0,
+                0);
+            
+            // Compute dudy.
+            derivative_first_order_y->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[1],
+                1,
+                0);
+            
+            // Compute dudz.
+            derivative_first_order_z->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[2],
+                2,
+                0);
+            
+            // Compute dvdx.
+            derivative_first_order_x->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[0],
+                3,
+                1);
+            
+            // Compute dvdy.
+            derivative_first_order_y->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[1],
+                4,
+                1);
+            
+            // Compute dvdz.
+            derivative_first_order_z->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[2],
+                5,
+                1);
+            
+            // Compute dwdx.
+            derivative_first_order_x->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[0],
+                6,
+                2);
+            
+            // Compute dwdy.
+            derivative_first_order_y->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[1],
+                7,
+                2);
+            
+            // Compute dwdz.
+            derivative_first_order_z->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[2],
+                8,
+                2);
+            
+            // Get the pointers to the cell data of velocity derivatives.
+            double* dudx = velocity_derivatives->getPointer(0);
+            double* dudy = velocity_derivatives->getPointer(1);
+            double* dudz = velocity_derivatives->getPointer(2);
+            double* dvdx = velocity_derivatives->getPointer(3);
+            double* dvdy = velocity_derivatives->getPointer(4);
+            double* dvdz = velocity_derivatives->getPointer(5);
+            double* dwdx = velocity_derivatives->getPointer(6);
+            double* dwdy = velocity_derivatives->getPointer(7);
+            double* dwdz = velocity_derivatives->getPointer(8);
+            
+            // Compute the dilatation.
+            for (int k = -2; k < interior_dim_2 + 2; k++)
             {
+                for (int j = -2; j < interior_dim_1 + 2; j++)
+                {
 #ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
+                    #pragma omp simd
 #endif
-                for (int i = -2; i < interior_dim_0 + 2; i++)
-                {
-                    // Compute the linear index.
-                    const int idx = (i + 2) +
-                        (j + 2)*(interior_dim_0 + 4) +
-                        (k + 2)*(interior_dim_0 + 4)*
-                            (interior_dim_1 + 4);
-                    
-                    theta[idx] = dudx[idx] + dvdy[idx] + dwdz[idx];
+                    for (int i = -2; i < interior_dim_0 + 2; i++)
+                    {
+                        // Compute the linear index.
+                        const int idx = (i + 2) +
+                            (j + 2)*(interior_dim_0 + 4) +
+                            (k + 2)*(interior_dim_0 + 4)*
+                                (interior_dim_1 + 4);
+                        
+                        theta[idx] = dudx[idx] + dvdy[idx] + dwdz[idx];
+                    }
                 }
             }
-        }
-        
-        // Compute the magnitude of vorticity.
-        for (int k = -2; k < interior_dim_2 + 2; k++)
-        {
-            for (int j = -2; j < interior_dim_1 + 2; j++)
+            
+            // Compute the magnitude of vorticity.
+            for (int k = -2; k < interior_dim_2 + 2; k++)
             {
+                for (int j = -2; j < interior_dim_1 + 2; j++)
+                {
 #ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
+                    #pragma omp simd
 #endif
-                for (int i = -2; i < interior_dim_0 + 2; i++)
-                {
-                    // Compute the linear index.
-                    const int idx = (i + 2) +
-                        (j + 2)*(interior_dim_0 + 4) +
-                        (k + 2)*(interior_dim_0 + 4)*
-                            (interior_dim_1 + 4);
-                    
-                    const double omega_x = dwdy[idx] - dvdz[idx];
-                    const double omega_y = dudz[idx] - dwdx[idx];
-                    const double omega_z = dvdx[idx] - dudy[idx];
-                    
-                    Omega[idx] = sqrt(omega_x*omega_x + omega_y*omega_y + omega_z*omega_z);
+                    for (int i = -2; i < interior_dim_0 + 2; i++)
+                    {
+                        // Compute the linear index.
+                        const int idx = (i + 2) +
+                            (j + 2)*(interior_dim_0 + 4) +
+                            (k + 2)*(interior_dim_0 + 4)*
+                                (interior_dim_1 + 4);
+                        
+                        const double omega_x = dwdy[idx] - dvdz[idx];
+                        const double omega_y = dudz[idx] - dwdx[idx];
+                        const double omega_z = dvdx[idx] - dudy[idx];
+                        
+                        Omega[idx] = sqrt(omega_x*omega_x + omega_y*omega_y + omega_z*omega_z);
+                    }
                 }
             }
-        }
-        
-        /*
-         * Get the pointers to the conservative variables and primitive variables.
-         * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
-         */
-        
-        std::vector<boost::shared_ptr<pdat::CellData<double> > > conservative_variables =
-            d_flow_model->getGlobalCellDataConservativeVariables();
-        
-        std::vector<boost::shared_ptr<pdat::CellData<double> > > primitive_variables =
-            d_flow_model->getGlobalCellDataPrimitiveVariables();
-        
-        std::vector<hier::IntVector> num_subghosts_conservative_var;
-        num_subghosts_conservative_var.reserve(d_num_eqn);
-        
-        std::vector<hier::IntVector> num_subghosts_primitive_var;
-        num_subghosts_primitive_var.reserve(d_num_eqn);
-        
-        std::vector<hier::IntVector> subghostcell_dims_conservative_var;
-        subghostcell_dims_conservative_var.reserve(d_num_eqn);
-        
-        std::vector<hier::IntVector> subghostcell_dims_primitive_var;
-        subghostcell_dims_primitive_var.reserve(d_num_eqn);
-        
-        std::vector<double*> Q;
-        Q.reserve(d_num_eqn);
-        
-        std::vector<double*> V;
-        V.reserve(d_num_eqn);
-        
-        int count_eqn = 0;
-        
-        for (int vi = 0; vi < static_cast<int>(conservative_variables.size()); vi++)
-        {
-            int depth = conservative_variables[vi]->getDepth();
             
-            for (int di = 0; di < depth; di++)
+            /*
+             * Compute the Ducros-like shock sensor.
+             */
+            
+            for (int k = 0; k < interior_dim_2; k++)
             {
-                // If the last element of the conservative variable vector is not in the system of equations,
-                // ignore it.
-                if (count_eqn >= d_num_eqn)
+                for (int j = 0; j < interior_dim_1; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = -1; i < interior_dim_0 + 2; i++)
+                    {
+                        // Compute the linear index of the side.
+                        const int idx_midpoint_x = (i + 1) +
+                            (j + 1)*(interior_dim_0 + 3) +
+                            (k + 1)*(interior_dim_0 + 3)*
+                                (interior_dim_1 + 2);
+                        
+                        const int idx_L = (i + 1) +
+                            (j + 2)*(interior_dim_0 + 4) +
+                            (k + 2)*(interior_dim_0 + 4)*
+                                (interior_dim_1 + 4);
+                        
+                        const int idx_R = (i + 2) +
+                            (j + 2)*(interior_dim_0 + 4) +
+                            (k + 2)*(interior_dim_0 + 4)*
+                                (interior_dim_1 + 4);
+                        
+                        double theta_avg = 0.5*(theta[idx_L] + theta[idx_R]);
+                        double Omega_avg = 0.5*(Omega[idx_L] + Omega[idx_R]);
+                        
+                        s_x[idx_midpoint_x] = -theta_avg/(fabs(theta_avg) + Omega_avg + EPSILON);
+                    }
+                }
+            }
+            
+            for (int k = 0; k < interior_dim_2; k++)
+            {
+                for (int j = -1; j < interior_dim_1 + 2; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dim_0; i++)
+                    {
+                        // Compute the linear index of the side.
+                        const int idx_midpoint_y = (i + 1) +
+                            (j + 1)*(interior_dim_0 + 2) +
+                            (k + 1)*(interior_dim_0 + 2)*
+                                (interior_dim_1 + 3);
+                        
+                        const int idx_B = (i + 2) +
+                            (j + 1)*(interior_dim_0 + 4) +
+                            (k + 2)*(interior_dim_0 + 4)*
+                                (interior_dim_1 + 4);
+                        
+                        const int idx_T = (i + 2) +
+                            (j + 2)*(interior_dim_0 + 4) +
+                            (k + 2)*(interior_dim_0 + 4)*
+                                (interior_dim_1 + 4);
+                        
+                        double theta_avg = 0.5*(theta[idx_B] + theta[idx_T]);
+                        double Omega_avg = 0.5*(Omega[idx_B] + Omega[idx_T]);
+                        
+                        s_y[idx_midpoint_y] = -theta_avg/(fabs(theta_avg) + Omega_avg + EPSILON);
+                    }
+                }
+            }
+            
+            for (int k = -1; k < interior_dim_2 + 2; k++)
+            {
+                for (int j = 0; j < interior_dim_1; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dim_0; i++)
+                    {
+                        // Compute the linear index of the side.
+                        const int idx_midpoint_z = (i + 1) +
+                            (j + 1)*(interior_dim_0 + 2) +
+                            (k + 1)*(interior_dim_0 + 2)*
+                                (interior_dim_1 + 2);
+                        
+                        const int idx_B = (i + 2) +
+                            (j + 2)*(interior_dim_0 + 4) +
+                            (k + 1)*(interior_dim_0 + 4)*
+                                (interior_dim_1 + 4);
+                        
+                        const int idx_F = (i + 2) +
+                            (j + 2)*(interior_dim_0 + 4) +
+                            (k + 2)*(interior_dim_0 + 4)*
+                                (interior_dim_1 + 4);
+                        
+                        double theta_avg = 0.5*(theta[idx_B] + theta[idx_F]);
+                        double Omega_avg = 0.5*(Omega[idx_B] + Omega[idx_F]);
+                        
+                        s_z[idx_midpoint_z] = -theta_avg/(fabs(theta_avg) + Omega_avg + EPSILON);
+                    }
+                }
+            }
+        }
+        
+        /*
+         * Determine whether the characteristic WCNS interpolation is required on the patch. With
+         * the hybrid central/WCNS interpolation, it is only required if any face is flagged by the
+         * shock sensor and it is only performed on the rows of faces that contain flagged faces.
+         */
+        
+        bool use_WCNS_interpolation = true;
+        std::vector<std::vector<int> > WENO_row_flags;
+        
+        if (d_use_hybrid_central_WCNS)
+        {
+            use_WCNS_interpolation = countFacesFlaggedByShockSensor(
+                WENO_row_flags,
+                shock_sensor,
+                interior_dims);
+        }
+        
+        /*
+         * Get the pointers to the conservative variables and primitive variables.
+         * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
+         */
+        
+        std::vector<boost::shared_ptr<pdat::CellData<double> > > conservative_variables =
+            d_flow_model->getGlobalCellDataConservativeVariables();
+        
+        std::vector<boost::shared_ptr<pdat::CellData<double> > > primitive_variables =
+            d_flow_model->getGlobalCellDataPrimitiveVariables();
+        
+        std::vector<hier::IntVector> num_subghosts_conservative_var;
+        num_subghosts_conservative_var.reserve(d_num_eqn);
+        
+        std::vector<hier::IntVector> num_subghosts_primitive_var;
+        num_subghosts_primitive_var.reserve(d_num_eqn);
+        
+        std::vector<hier::IntVector> subghostcell_dims_conservative_var;
+        subghostcell_dims_conservative_var.reserve(d_num_eqn);
+        
+        std::vector<hier::IntVector> subghostcell_dims_primitive_var;
+        subghostcell_dims_primitive_var.reserve(d_num_eqn);
+        
+        std::vector<double*> Q;
+        Q.reserve(d_num_eqn);
+        
+        std::vector<double*> V;
+        V.reserve(d_num_eqn);
+        
+        int count_eqn = 0;
+        
+        for (int vi = 0; vi < static_cast<int>(conservative_variables.size()); vi++)
+        {
+            int depth = conservative_variables[vi]->getDepth();
+            
+            for (int di = 0; di < depth; di++)
+            {
+                // If the last element of the conservative variable vector is not in the system of equations,
+                // ignore it.
+                if (count_eqn >= d_num_eqn)
                     break;
                 
                 Q.push_back(conservative_variables[vi]->getPointer(di));
@@ -1744,40 +2727,11 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
          * Initialize temporary data containers for WENO interpolation.
          */
         
-        int num_projection_var = d_flow_model->getNumberOfProjectionVariablesForPrimitiveVariables();
-        projection_variables.reserve(num_projection_var);
-        
-        for (int vi = 0; vi < num_projection_var; vi++)
-        {
-            projection_variables.push_back(boost::make_shared<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-        }
-        
-        characteristic_variables.resize(6);
-        
-        for (int m = 0; m < 6; m++)
-        {
-            characteristic_variables[m].reserve(d_num_eqn);
-            for (int ei = 0; ei < d_num_eqn; ei++)
-            {
-                characteristic_variables[m].push_back(boost::make_shared<pdat::SideData<double> >(
-                    interior_box, 1, hier::IntVector::getOne(d_dim)));
-            }
-        }
-        
-        characteristic_variables_minus.reserve(d_num_eqn);
-        characteristic_variables_plus.reserve(d_num_eqn);
         primitive_variables_minus.reserve(d_num_eqn);
         primitive_variables_plus.reserve(d_num_eqn);
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            characteristic_variables_minus.push_back(boost::make_shared<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
-            characteristic_variables_plus.push_back(boost::make_shared<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
             primitive_variables_minus.push_back(boost::make_shared<pdat::SideData<double> >(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
             
@@ -1791,50 +2745,150 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         bounded_flag_plus.reset(
             new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
         
-        /*
-         * Compute global side data of the projection variables for transformation between
-         * primitive variables and characteristic variables.
-         */
-        
-        d_flow_model->computeGlobalSideDataProjectionVariablesForPrimitiveVariables(
-            projection_variables);
+        if (use_WCNS_interpolation)
+        {
+            characteristic_variables.resize(6);
+            
+            for (int m = 0; m < 6; m++)
+            {
+                characteristic_variables[m].reserve(d_num_eqn);
+                for (int ei = 0; ei < d_num_eqn; ei++)
+                {
+                    characteristic_variables[m].push_back(boost::make_shared<pdat::SideData<double> >(
+                        interior_box, 1, hier::IntVector::getOne(d_dim)));
+                }
+            }
+            
+            if (use_characteristic_interpolation)
+            {
+                int num_projection_var = d_flow_model->getNumberOfProjectionVariablesForPrimitiveVariables();
+                projection_variables.reserve(num_projection_var);
+                
+                for (int vi = 0; vi < num_projection_var; vi++)
+                {
+                    projection_variables.push_back(boost::make_shared<pdat::SideData<double> >(
+                        interior_box, 1, hier::IntVector::getOne(d_dim)));
+                }
+                
+                characteristic_variables_minus.reserve(d_num_eqn);
+                characteristic_variables_plus.reserve(d_num_eqn);
+                
+                for (int ei = 0; ei < d_num_eqn; ei++)
+                {
+                    characteristic_variables_minus.push_back(boost::make_shared<pdat::SideData<double> >(
+                        interior_box, 1, hier::IntVector::getOne(d_dim)));
+                    
+                    characteristic_variables_plus.push_back(boost::make_shared<pdat::SideData<double> >(
+                        interior_box, 1, hier::IntVector::getOne(d_dim)));
+                }
+                
+                /*
+                 * The rows of faces skipped by the WENO interpolation are overwritten by the linear
+                 * interpolation later. Only their characteristic variables are zeroed so that the
+                 * transformation back to the primitive variables does not read uninitialized data.
+                 * The projection variables and the transformations between the primitive and the
+                 * characteristic variables are still computed on all the faces of the patch, not
+                 * only on the rows flagged in WENO_row_flags.
+                 */
+                
+                zeroRowsSkippedByWENOInterpolation(
+                    characteristic_variables_minus,
+                    WENO_row_flags,
+                    interior_dims);
+                
+                zeroRowsSkippedByWENOInterpolation(
+                    characteristic_variables_plus,
+                    WENO_row_flags,
+                    interior_dims);
+                
+                /*
+                 * Compute global side data of the projection variables for transformation between
+                 * primitive variables and characteristic variables.
+                 */
+                
+                d_flow_model->computeGlobalSideDataProjectionVariablesForPrimitiveVariables(
+                    projection_variables);
+                
+                /*
+                 * Transform primitive variables to characteristic variables.
+                 */
+                
+                for (int m = 0; m < 6; m++)
+                {
+                    d_flow_model->computeGlobalSideDataCharacteristicVariablesFromPrimitiveVariables(
+                        characteristic_variables[m],
+                        primitive_variables,
+                        projection_variables,
+                        m - 3);
+                }
+                
+                /*
+                 * Peform WENO interpolation.
+                 */
+                
+                performWENOInterpolation(
+                    characteristic_variables_minus,
+                    characteristic_variables_plus,
+                    characteristic_variables,
+                    WENO_row_flags);
+                
+                /*
+                 * Transform characteristic variables back to primitive variables.
+                 */
+                
+                d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
+                    primitive_variables_minus,
+                    characteristic_variables_minus,
+                    projection_variables);
+                
+                d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
+                    primitive_variables_plus,
+                    characteristic_variables_plus,
+                    projection_variables);
+            }
+            else
+            {
+                /*
+                 * Get the primitive variables in the stencils of the sides. The containers of the
+                 * characteristic variables are used to store them.
+                 */
+                
+                for (int m = 0; m < 6; m++)
+                {
+                    computeGlobalSideDataPrimitiveVariablesInStencil(
+                        characteristic_variables[m],
+                        primitive_variables,
+                        interior_dims,
+                        m - 3);
+                }
+                
+                /*
+                 * Peform WENO interpolation of the primitive variables component by component.
+                 */
+                
+                performWENOInterpolation(
+                    primitive_variables_minus,
+                    primitive_variables_plus,
+                    characteristic_variables,
+                    WENO_row_flags);
+            }
+        }
         
         /*
-         * Transform primitive variables to characteristic variables.
+         * Use linear interpolation of the primitive variables on the faces that are not flagged by
+         * the shock sensor if the hybrid central/WCNS interpolation is used.
          */
         
-        for (int m = 0; m < 6; m++)
+        if (d_use_hybrid_central_WCNS)
         {
-            d_flow_model->computeGlobalSideDataCharacteristicVariablesFromPrimitiveVariables(
-                characteristic_variables[m],
+            performLinearInterpolationOnSmoothFaces(
+                primitive_variables_minus,
+                primitive_variables_plus,
                 primitive_variables,
-                projection_variables,
-                m - 3);
+                shock_sensor,
+                interior_dims);
         }
         
-        /*
-         * Peform WENO interpolation.
-         */
-        
-        performWENOInterpolation(
-            characteristic_variables_minus,
-            characteristic_variables_plus,
-            characteristic_variables);
-        
-        /*
-         * Transform characteristic variables back to primitive variables.
-         */
-        
-        d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
-            primitive_variables_minus,
-            characteristic_variables_minus,
-            projection_variables);
-        
-        d_flow_model->computeGlobalSideDataPrimitiveVariablesFromCharacteristicVariables(
-            primitive_variables_plus,
-            characteristic_variables_plus,
-            projection_variables);
-        
         /*
          * Declare containers to store pointers for computing mid-point fluxes.
          */
@@ -2061,40 +3115,6 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
             DIRECTION::X_DIRECTION,
             RIEMANN_SOLVER::HLLC_HLL);
         
-        // Compute the Ducros-like shock sensor.
-        for (int k = 0; k < interior_dim_2; k++)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = -1; i < interior_dim_0 + 2; i++)
-                {
-                    // Compute the linear index of the side.
-                    const int idx_midpoint_x = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 3) +
-                        (k + 1)*(interior_dim_0 + 3)*
-                            (interior_dim_1 + 2);
-                    
-                    const int idx_L = (i + 1) +
-                        (j + 2)*(interior_dim_0 + 4) +
-                        (k + 2)*(interior_dim_0 + 4)*
-                            (interior_dim_1 + 4);
-                    
-                    const int idx_R = (i + 2) +
-                        (j + 2)*(interior_dim_0 + 4) +
-                        (k + 2)*(interior_dim_0 + 4)*
-                            (interior_dim_1 + 4);
-                    
-                    double theta_avg = 0.5*(theta[idx_L] + theta[idx_R]);
-                    double Omega_avg = 0.5*(Omega[idx_L] + Omega[idx_R]);
-                    
-                    s_x[idx_midpoint_x] = -theta_avg/(fabs(theta_avg) + Omega_avg + EPSILON);
-                }
-            }
-        }
-        
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
             for (int k = 0; k < interior_dim_2; k++)
@@ -2156,40 +3176,6 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
             DIRECTION::Y_DIRECTION,
             RIEMANN_SOLVER::HLLC_HLL);
         
-        // Compute the Ducros-like shock sensor.
-        for (int k = 0; k < interior_dim_2; k++)
-        {
-            for (int j = -1; j < interior_dim_1 + 2; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    // Compute the linear index of the side.
-                    const int idx_midpoint_y = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 2) +
-                        (k + 1)*(interior_dim_0 + 2)*
-                            (interior_dim_1 + 3);
-                    
-                    const int idx_B = (i + 2) +
-                        (j + 1)*(interior_dim_0 + 4) +
-                        (k + 2)*(interior_dim_0 + 4)*
-                            (interior_dim_1 + 4);
-                    
-                    const int idx_T = (i + 2) +
-                        (j + 2)*(interior_dim_0 + 4) +
-                        (k + 2)*(interior_dim_0 + 4)*
-                            (interior_dim_1 + 4);
-                    
-                    double theta_avg = 0.5*(theta[idx_B] + theta[idx_T]);
-                    double Omega_avg = 0.5*(Omega[idx_B] + Omega[idx_T]);
-                    
-                    s_y[idx_midpoint_y] = -theta_avg/(fabs(theta_avg) + Omega_avg + EPSILON);
-                }
-            }
-        }
-        
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
             for (int k = 0; k < interior_dim_2; k++)
@@ -2251,48 +3237,14 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
             DIRECTION::Z_DIRECTION,
             RIEMANN_SOLVER::HLLC_HLL);
         
-        // Compute the Ducros-like shock sensor.
-        for (int k = -1; k < interior_dim_2 + 2; k++)
+        for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            for (int j = 0; j < interior_dim_1; j++)
+            for (int k = -1; k < interior_dim_2 + 2; k++)
             {
+                for (int j = 0; j < interior_dim_1; j++)
+                {
 #ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    // Compute the linear index of the side.
-                    const int idx_midpoint_z = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 2) +
-                        (k + 1)*(interior_dim_0 + 2)*
-                            (interior_dim_1 + 2);
-                    
-                    const int idx_B = (i + 2) +
-                        (j + 2)*(interior_dim_0 + 4) +
-                        (k + 1)*(interior_dim_0 + 4)*
-                            (interior_dim_1 + 4);
-                    
-                    const int idx_F = (i + 2) +
-                        (j + 2)*(interior_dim_0 + 4) +
-                        (k + 2)*(interior_dim_0 + 4)*
-                            (interior_dim_1 + 4);
-                    
-                    double theta_avg = 0.5*(theta[idx_B] + theta[idx_F]);
-                    double Omega_avg = 0.5*(Omega[idx_B] + Omega[idx_F]);
-                    
-                    s_z[idx_midpoint_z] = -theta_avg/(fabs(theta_avg) + Omega_avg + EPSILON);
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            for (int k = -1; k < interior_dim_2 + 2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
+                    #pragma omp simd
 #endif
                     for (int i = 0; i < interior_dim_0; i++)
                     {
@@ -2642,7 +3594,884 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(3))
 }
+
+
+/*
+ * Count the faces flagged by the shock sensor for the hybrid central/WCNS interpolation and flag
+ * the rows of faces that contain any flagged face for the WENO interpolation. Return whether any
+ * face used by the flux reconstruction on the patch is flagged.
+ */
+bool
+ConvectiveFluxReconstructorWCNS56::countFacesFlaggedByShockSensor(
+    std::vector<std::vector<int> >& WENO_row_flags,
+    const boost::shared_ptr<pdat::SideData<double> >& shock_sensor,
+    const hier::IntVector& interior_dims)
+{
+    bool has_flagged_face = false;
+    
+    long num_faces_flagged = 0;
+    long num_faces = 0;
+    
+    WENO_row_flags.resize(d_dim.getValue());
+    
+    if (d_dim == tbox::Dimension(2))
+    {
+        const int interior_dim_0 = interior_dims[0];
+        const int interior_dim_1 = interior_dims[1];
+        
+        double* s_x = shock_sensor->getPointer(0);
+        double* s_y = shock_sensor->getPointer(1);
+        
+        WENO_row_flags[0].assign(interior_dim_1, 0);
+        WENO_row_flags[1].assign(interior_dim_1 + 3, 0);
+        
+        for (int j = 0; j < interior_dim_1; j++)
+        {
+            for (int i = -1; i < interior_dim_0 + 2; i++)
+            {
+                // Compute the linear index of the side.
+                const int idx_midpoint_x = (i + 1) +
+                    (j + 1)*(interior_dim_0 + 3);
+                
+                if (s_x[idx_midpoint_x] > d_hybrid_shock_sensor_threshold)
+                {
+                    has_flagged_face = true;
+                    WENO_row_flags[0][j] = 1;
+                    
+                    if (i >= 0 && i <= interior_dim_0)
+                    {
+                        num_faces_flagged++;
+                    }
+                }
+            }
+        }
+        
+        for (int j = -1; j < interior_dim_1 + 2; j++)
+        {
+            for (int i = 0; i < interior_dim_0; i++)
+            {
+                // Compute the linear index of the side.
+                const int idx_midpoint_y = (i + 1) +
+                    (j + 1)*(interior_dim_0 + 2);
+                
+                if (s_y[idx_midpoint_y] > d_hybrid_shock_sensor_threshold)
+                {
+                    has_flagged_face = true;
+                    WENO_row_flags[1][j + 1] = 1;
+                    
+                    if (j >= 0 && j <= interior_dim_1)
+                    {
+                        num_faces_flagged++;
+                    }
+                }
+            }
+        }
+        
+        num_faces = long(interior_dim_0 + 1)*long(interior_dim_1) +
+            long(interior_dim_0)*long(interior_dim_1 + 1);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        const int interior_dim_0 = interior_dims[0];
+        const int interior_dim_1 = interior_dims[1];
+        const int interior_dim_2 = interior_dims[2];
+        
+        double* s_x = shock_sensor->getPointer(0);
+        double* s_y = shock_sensor->getPointer(1);
+        double* s_z = shock_sensor->getPointer(2);
+        
+        WENO_row_flags[0].assign(interior_dim_1*interior_dim_2, 0);
+        WENO_row_flags[1].assign((interior_dim_1 + 3)*interior_dim_2, 0);
+        WENO_row_flags[2].assign(interior_dim_1*(interior_dim_2 + 3), 0);
+        
+        for (int k = 0; k < interior_dim_2; k++)
+        {
+            for (int j = 0; j < interior_dim_1; j++)
+            {
+                for (int i = -1; i < interior_dim_0 + 2; i++)
+                {
+                    // Compute the linear index of the side.
+                    const int idx_midpoint_x = (i + 1) +
+                        (j + 1)*(interior_dim_0 + 3) +
+                        (k + 1)*(interior_dim_0 + 3)*
+                            (interior_dim_1 + 2);
+                    
+                    if (s_x[idx_midpoint_x] > d_hybrid_shock_sensor_threshold)
+                    {
+                        has_flagged_face = true;
+                        WENO_row_flags[0][j + k*interior_dim_1] = 1;
+                        
+                        if (i >= 0 && i <= interior_dim_0)
+                        {
+                            num_faces_flagged++;
+                        }
+                    }
+                }
+            }
+        }
+        
+        for (int k = 0; k < interior_dim_2; k++)
+        {
+            for (int j = -1; j < interior_dim_1 + 2; j++)
+            {
+                for (int i = 0; i < interior_dim_0; i++)
+                {
+                    // Compute the linear index of the side.
+                    const int idx_midpoint_y = (i + 1) +
+                        (j + 1)*(interior_dim_0 + 2) +
+                        (k + 1)*(interior_dim_0 + 2)*
+                            (interior_dim_1 + 3);
+                    
+                    if (s_y[idx_midpoint_y] > d_hybrid_shock_sensor_threshold)
+                    {
+                        has_flagged_face = true;
+                        WENO_row_flags[1][(j + 1) + k*(interior_dim_1 + 3)] = 1;
+                        
+                        if (j >= 0 && j <= interior_dim_1)
+                        {
+                            num_faces_flagged++;
+                        }
+                    }
+                }
+            }
+        }
+        
+        for (int k = -1; k < interior_dim_2 + 2; k++)
+        {
+            for (int j = 0; j < interior_dim_1; j++)
+            {
+                for (int i = 0; i < interior_dim_0; i++)
+                {
+                    // Compute the linear index of the side.
+                    const int idx_midpoint_z = (i + 1) +
+                        (j + 1)*(interior_dim_0 + 2) +
+                        (k + 1)*(interior_dim_0 + 2)*
+                            (interior_dim_1 + 2);
+                    
+                    if (s_z[idx_midpoint_z] > d_hybrid_shock_sensor_threshold)
+                    {
+                        has_flagged_face = true;
+                        WENO_row_flags[2][j + (k + 1)*interior_dim_1] = 1;
+                        
+                        if (k >= 0 && k <= interior_dim_2)
+                        {
+                            num_faces_flagged++;
+                        }
+                    }
+                }
+            }
+        }
+        
+        num_faces = long(interior_dim_0 + 1)*long(interior_dim_1)*long(interior_dim_2) +
+            long(interior_dim_0)*long(interior_dim_1 + 1)*long(interior_dim_2) +
+            long(interior_dim_0)*long(interior_dim_1)*long(interior_dim_2 + 1);
+    }
+    
+    d_num_faces_flagged += num_faces_flagged;
+    d_num_faces += num_faces;
+    
+    return has_flagged_face;
+}
+
+
+/*
+ * Zero the faces in the rows of faces skipped by the WENO interpolation, which are the rows whose
+ * flags in WENO_row_flags are zero.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::zeroRowsSkippedByWENOInterpolation(
+    std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables,
+    const std::vector<std::vector<int> >& WENO_row_flags,
+    const hier::IntVector& interior_dims)
+{
+    if (WENO_row_flags.empty())
+    {
+        return;
+    }
+    
+    if (d_dim == tbox::Dimension(2))
+    {
+        const int interior_dim_0 = interior_dims[0];
+        const int interior_dim_1 = interior_dims[1];
+        
+        for (int ei = 0; ei < static_cast<int>(variables.size()); ei++)
+        {
+            double* U_x = variables[ei]->getPointer(0);
+            double* U_y = variables[ei]->getPointer(1);
+            
+            for (int j = 0; j < interior_dim_1; j++)
+            {
+                if (WENO_row_flags[0][j] != 0)
+                {
+                    continue;
+                }
+                
+                // Compute the linear index of the first side of the row.
+                const int idx_row_x = (j + 1)*(interior_dim_0 + 3);
+                
+                std::fill(U_x + idx_row_x, U_x + idx_row_x + interior_dim_0 + 3, double(0));
+            }
+            
+            for (int j = -1; j < interior_dim_1 + 2; j++)
+            {
+                if (WENO_row_flags[1][j + 1] != 0)
+                {
+                    continue;
+                }
+                
+                // Compute the linear index of the first side of the row.
+                const int idx_row_y = 1 +
+                    (j + 1)*(interior_dim_0 + 2);
+                
+                std::fill(U_y + idx_row_y, U_y + idx_row_y + interior_dim_0, double(0));
+            }
+        }
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        const int interior_dim_0 = interior_dims[0];
+        const int interior_dim_1 = interior_dims[1];
+        const int interior_dim_2 = interior_dims[2];
+        
+        for (int ei = 0; ei < static_cast<int>(variables.size()); ei++)
+        {
+            double* U_x = variables[ei]->getPointer(0);
+            double* U_y = variables[ei]->getPointer(1);
+            double* U_z = variables[ei]->getPointer(2);
+            
+            for (int k = 0; k < interior_dim_2; k++)
+            {
+                for (int j = 0; j < interior_dim_1; j++)
+                {
+                    if (WENO_row_flags[0][j + k*interior_dim_1] != 0)
+                    {
+                        continue;
+                    }
+                    
+                    // Compute the linear index of the first side of the row.
+                    const int idx_row_x = (j + 1)*(interior_dim_0 + 3) +
+                        (k + 1)*(interior_dim_0 + 3)*
+                            (interior_dim_1 + 2);
+                    
+                    std::fill(U_x + idx_row_x, U_x + idx_row_x + interior_dim_0 + 3, double(0));
+                }
+            }
+            
+            for (int k = 0; k < interior_dim_2; k++)
+            {
+                for (int j = -1; j < interior_dim_1 + 2; j++)
+                {
+                    if (WENO_row_flags[1][(j + 1) + k*(interior_dim_1 + 3)] != 0)
+                    {
+                        continue;
+                    }
+                    
+                    // Compute the linear index of the first side of the row.
+                    const int idx_row_y = 1 +
+                        (j + 1)*(interior_dim_0 + 2) +
+                        (k + 1)*(interior_dim_0 + 2)*
+                            (interior_dim_1 + 3);
+                    
+                    std::fill(U_y + idx_row_y, U_y + idx_row_y + interior_dim_0, double(0));
+                }
+            }
+            
+            for (int k = -1; k < interior_dim_2 + 2; k++)
+            {
+                for (int j = 0; j < interior_dim_1; j++)
+                {
+                    if (WENO_row_flags[2][j + (k + 1)*interior_dim_1] != 0)
+                    {
+                        continue;
+                    }
+                    
+                    // Compute the linear index of the first side of the row.
+                    const int idx_row_z = 1 +
+                        (j + 1)*(interior_dim_0 + 2) +
+                        (k + 1)*(interior_dim_0 + 2)*
+                            (interior_dim_1 + 2);
+                    
+                    std::fill(U_z + idx_row_z, U_z + idx_row_z + interior_dim_0, double(0));
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * Perform linear sixth order interpolation of the primitive variables on the faces that are not
+ * flagged by the shock sensor.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::performLinearInterpolationOnSmoothFaces(
+    std::vector<boost::shared_ptr<pdat::SideData<double> > >& primitive_variables_minus,
+    std::vector<boost::shared_ptr<pdat::SideData<double> > >& primitive_variables_plus,
+    const std::vector<boost::shared_ptr<pdat::CellData<double> > >& primitive_variables,
+    const boost::shared_ptr<pdat::SideData<double> >& shock_sensor,
+    const hier::IntVector& interior_dims)
+{
+    /*
+     * Get the pointers to the primitive variables.
+     * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
+     */
+    
+    std::vector<hier::IntVector> num_subghosts_primitive_var;
+    num_subghosts_primitive_var.reserve(d_num_eqn);
+    
+    std::vector<hier::IntVector> subghostcell_dims_primitive_var;
+    subghostcell_dims_primitive_var.reserve(d_num_eqn);
+    
+    std::vector<double*> V;
+    V.reserve(d_num_eqn);
+    
+    int count_eqn = 0;
+    
+    for (int vi = 0; vi < static_cast<int>(primitive_variables.size()); vi++)
+    {
+        int depth = primitive_variables[vi]->getDepth();
+        
+        for (int di = 0; di < depth; di++)
+        {
+            // If the last element of the primitive variable vector is not in the system of equations,
+            // ignore it.
+            if (count_eqn >= d_num_eqn)
+                break;
+            
+            V.push_back(primitive_variables[vi]->getPointer(di));
+            num_subghosts_primitive_var.push_back(primitive_variables[vi]->getGhostCellWidth());
+            subghostcell_dims_primitive_var.push_back(
+                primitive_variables[vi]->getGhostBox().numberCells());
+            
+            count_eqn++;
+        }
+    }
+    
+    if (d_dim == tbox::Dimension(2))
+    {
+        const int interior_dim_0 = interior_dims[0];
+        const int interior_dim_1 = interior_dims[1];
+        
+        double* s_x = shock_sensor->getPointer(0);
+        double* s_y = shock_sensor->getPointer(1);
+        
+        /*
+         * Interpolate in the x-direction.
+         */
+        
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            const int num_subghosts_0_primitive_var = num_subghosts_primitive_var[ei][0];
+            const int num_subghosts_1_primitive_var = num_subghosts_primitive_var[ei][1];
+            const int subghostcell_dim_0_primitive_var = subghostcell_dims_primitive_var[ei][0];
+            
+            double* V_L = primitive_variables_minus[ei]->getPointer(0);
+            double* V_R = primitive_variables_plus[ei]->getPointer(0);
+            
+            for (int j = 0; j < interior_dim_1; j++)
+            {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = -1; i < interior_dim_0 + 2; i++)
+                {
+                    // Compute the linear indices.
+                    const int idx_midpoint_x = (i + 1) +
+                        (j + 1)*(interior_dim_0 + 3);
+                    
+                    const int idx_cell_R = (i + num_subghosts_0_primitive_var) +
+                        (j + num_subghosts_1_primitive_var)*subghostcell_dim_0_primitive_var;
+                    
+                    if (s_x[idx_midpoint_x] <= d_hybrid_shock_sensor_threshold)
+                    {
+                        V_L[idx_midpoint_x] = performLocalLinearInterpolation(V[ei], idx_cell_R, 1);
+                        V_R[idx_midpoint_x] = V_L[idx_midpoint_x];
+                    }
+                }
+            }
+        }
+        
+        /*
+         * Interpolate in the y-direction.
+         */
+        
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            const int num_subghosts_0_primitive_var = num_subghosts_primitive_var[ei][0];
+            const int num_subghosts_1_primitive_var = num_subghosts_primitive_var[ei][1];
+            const int subghostcell_dim_0_primitive_var = subghostcell_dims_primitive_var[ei][0];
+            
+            double* V_B = primitive_variables_minus[ei]->getPointer(1);
+            double* V_T = primitive_variables_plus[ei]->getPointer(1);
+            
+            for (int j = -1; j < interior_dim_1 + 2; j++)
+            {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = 0; i < interior_dim_0; i++)
+                {
+                    // Compute the linear indices.
+                    const int idx_midpoint_y = (i + 1) +
+                        (j + 1)*(interior_dim_0 + 2);
+                    
+                    const int idx_cell_T = (i + num_subghosts_0_primitive_var) +
+                        (j + num_subghosts_1_primitive_var)*subghostcell_dim_0_primitive_var;
+                    
+                    if (s_y[idx_midpoint_y] <= d_hybrid_shock_sensor_threshold)
+                    {
+                        V_B[idx_midpoint_y] = performLocalLinearInterpolation(
+                            V[ei],
+                            idx_cell_T,
+                            subghostcell_dim_0_primitive_var);
+                        
+                        V_T[idx_midpoint_y] = V_B[idx_midpoint_y];
+                    }
+                }
+            }
+        }
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        const int interior_dim_0 = interior_dims[0];
+        const int interior_dim_1 = interior_dims[1];
+        const int interior_dim_2 = interior_dims[2];
+        
+        double* s_x = shock_sensor->getPointer(0);
+        double* s_y = shock_sensor->getPointer(1);
+        double* s_z = shock_sensor->getPointer(2);
+        
+        /*
+         * Interpolate in the x-direction.
+         */
+        
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            const int num_subghosts_0_primitive_var = num_subghosts_primitive_var[ei][0];
+            const int num_subghosts_1_primitive_var = num_subghosts_primitive_var[ei][1];
+            const int num_subghosts_2_primitive_var = num_subghosts_primitive_var[ei][2];
+            const int subghostcell_dim_0_primitive_var = subghostcell_dims_primitive_var[ei][0];
+            const int subghostcell_dim_1_primitive_var = subghostcell_dims_primitive_var[ei][1];
+            
+            double* V_L = primitive_variables_minus[ei]->getPointer(0);
+            double* V_R = primitive_variables_plus[ei]->getPointer(0);
+            
+            for (int k = 0; k < interior_dim_2; k++)
+            {
+                for (int j = 0; j < interior_dim_1; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = -1; i < interior_dim_0 + 2; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_midpoint_x = (i + 1) +
+                            (j + 1)*(interior_dim_0 + 3) +
+                            (k + 1)*(interior_dim_0 + 3)*
+                                (interior_dim_1 + 2);
+                        
+                        const int idx_cell_R = (i + num_subghosts_0_primitive_var) +
+                            (j + num_subghosts_1_primitive_var)*subghostcell_dim_0_primitive_var +
+                            (k + num_subghosts_2_primitive_var)*subghostcell_dim_0_primitive_var*
+                                subghostcell_dim_1_primitive_var;
+                        
+                        if (s_x[idx_midpoint_x] <= d_hybrid_shock_sensor_threshold)
+                        {
+                            V_L[idx_midpoint_x] = performLocalLinearInterpolation(V[ei], idx_cell_R, 1);
+                            V_R[idx_midpoint_x] = V_L[idx_midpoint_x];
+                        }
+                    }
+                }
+            }
+        }
+        
+        /*
+         * Interpolate in the y-direction.
+         */
+        
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            const int num_subghosts_0_primitive_var = num_subghosts_primitive_var[ei][0];
+            const int num_subghosts_1_primitive_var = num_subghosts_primitive_var[ei][1];
+            const int num_subghosts_2_primitive_var = num_subghosts_primitive_var[ei][2];
+            const int subghostcell_dim_0_primitive_var = subghostcell_dims_primitive_var[ei][0];
+            const int subghostcell_dim_1_primitive_var = subghostcell_dims_primitive_var[ei][1];
+            
+            double* V_B = primitive_variables_minus[ei]->getPointer(1);
+            double* V_T = primitive_variables_plus[ei]->getPointer(1);
+            
+            for (int k = 0; k < interior_dim_2; k++)
+            {
+                for (int j = -1; j < interior_dim_1 + 2; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dim_0; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_midpoint_y = (i + 1) +
+                            (j + 1)*(interior_dim_0 + 2) +
+                            (k + 1)*(interior_dim_0 + 2)*
+                                (interior_dim_1 + 3);
+                        
+                        const int idx_cell_T = (i + num_subghosts_0_primitive_var) +
+                            (j + num_subghosts_1_primitive_var)*subghostcell_dim_0_primitive_var +
+                            (k + num_subghosts_2_primitive_var)*subghostcell_dim_0_primitive_var*
+                                subghostcell_dim_1_primitive_var;
+                        
+                        if (s_y[idx_midpoint_y] <= d_hybrid_shock_sensor_threshold)
+                        {
+                            V_B[idx_midpoint_y] = performLocalLinearInterpolation(
+                                V[ei],
+                                idx_cell_T,
+                                subghostcell_dim_0_primitive_var);
+                            
+                            V_T[idx_midpoint_y] = V_B[idx_midpoint_y];
+                        }
+                    }
+                }
+            }
+        }
+        
+        /*
+         * Interpolate in the z-direction.
+         */
+        
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            const int num_subghosts_0_primitive_var = num_subghosts_primitive_var[ei][0];
+            const int num_subghosts_1_primitive_var = num_subghosts_primitive_var[ei][1];
+            const int num_subghosts_2_primitive_var = num_subghosts_primitive_var[ei][2];
+            const int subghostcell_dim_0_primitive_var = subghostcell_dims_primitive_var[ei][0];
+            const int subghostcell_dim_1_primitive_var = subghostcell_dims_primitive_var[ei][1];
+            
+            double* V_B = primitive_variables_minus[ei]->getPointer(2);
+            double* V_F = primitive_variables_plus[ei]->getPointer(2);
+            
+            for (int k = -1; k < interior_dim_2 + 2; k++)
+            {
+                for (int j = 0; j < interior_dim_1; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dim_0; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_midpoint_z = (i + 1) +
+                            (j + 1)*(interior_dim_0 + 2) +
+                            (k + 1)*(interior_dim_0 + 2)*
+                                (interior_dim_1 + 2);
+                        
+                        const int idx_cell_F = (i + num_subghosts_0_primitive_var) +
+                            (j + num_subghosts_1_primitive_var)*subghostcell_dim_0_primitive_var +
+                            (k + num_subghosts_2_primitive_var)*subghostcell_dim_0_primitive_var*
+                                subghostcell_dim_1_primitive_var;
+                        
+                        if (s_z[idx_midpoint_z] <= d_hybrid_shock_sensor_threshold)
+                        {
+                            V_B[idx_midpoint_z] = performLocalLinearInterpolation(
+                                V[ei],
+                                idx_cell_F,
+                                subghostcell_dim_0_primitive_var*subghostcell_dim_1_primitive_var);
+                            
+                            V_F[idx_midpoint_z] = V_B[idx_midpoint_z];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * Compute global side data of the primitive variables in the stencils of the sides for
+ * component-wise WENO interpolation. The value at a side is that of the cell at idx_offset from
+ * the cell on the right of the side.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::computeGlobalSideDataPrimitiveVariablesInStencil(
+    std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_side,
+    const std::vector<boost::shared_ptr<pdat::CellData<double> > >& primitive_variables,
+    const hier::IntVector& interior_dims,
+    const int idx_offset)
+{
+    /*
+     * Get the numbers of ghost cells and the ghost cell dimensions of the side data.
+     */
+    
+    const hier::IntVector num_ghosts_side_var = variables_side[0]->getGhostCellWidth();
+    const hier::IntVector ghostcell_dims_side_var = variables_side[0]->getGhostBox().numberCells();
+    
+    /*
+     * Get the pointers to the primitive variables.
+     * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
+     */
+    
+    std::vector<hier::IntVector> num_subghosts_primitive_var;
+    num_subghosts_primitive_var.reserve(d_num_eqn);
+    
+    std::vector<hier::IntVector> subghostcell_dims_primitive_var;
+    subghostcell_dims_primitive_var.reserve(d_num_eqn);
+    
+    std::vector<double*> V;
+    V.reserve(d_num_eqn);
+    
+    int count_eqn = 0;
+    
+    for (int vi = 0; vi < static_cast<int>(primitive_variables.size()); vi++)
+    {
+        int depth = primitive_variables[vi]->getDepth();
+        
+        for (int di = 0; di < depth; di++)
+        {
+            // If the last element of the primitive variable vector is not in the system of equations,
+            // ignore it.
+            if (count_eqn >= d_num_eqn)
+                break;
+            
+            V.push_back(primitive_variables[vi]->getPointer(di));
+            num_subghosts_primitive_var.push_back(primitive_variables[vi]->getGhostCellWidth());
+            subghostcell_dims_primitive_var.push_back(
+                primitive_variables[vi]->getGhostBox().numberCells());
+            
+            count_eqn++;
+        }
+    }
+    
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    for (int ei = 0; ei < d_num_eqn; ei++)
+    {
+        TBOX_ASSERT(num_subghosts_primitive_var[ei] - num_ghosts_side_var +
+            hier::IntVector::getOne(d_dim)*idx_offset >= hier::IntVector::getZero(d_dim));
+        TBOX_ASSERT(num_ghosts_side_var - num_subghosts_primitive_var[ei] +
+            hier::IntVector::getOne(d_dim)*(idx_offset + 1) <= hier::IntVector::getZero(d_dim));
+    }
+#endif
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        const int interior_dim_0 = interior_dims[0];
+        
+        const int num_ghosts_0_side_var = num_ghosts_side_var[0];
+        
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            const int num_subghosts_0_primitive_var = num_subghosts_primitive_var[ei][0];
+            
+            double* U = variables_side[ei]->getPointer(0);
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = -num_ghosts_0_side_var;
+                 i < interior_dim_0 + 1 + num_ghosts_0_side_var;
+                 i++)
+            {
+                // Compute the linear indices.
+                const int idx_face = i + num_ghosts_0_side_var;
+                const int idx_cell = i + idx_offset + num_subghosts_0_primitive_var;
+                
+                U[idx_face] = V[ei][idx_cell];
+            }
+        }
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        const int interior_dim_0 = interior_dims[0];
+        const int interior_dim_1 = interior_dims[1];
+        
+        const int num_ghosts_0_side_var = num_ghosts_side_var[0];
+        const int num_ghosts_1_side_var = num_ghosts_side_var[1];
+        const int ghostcell_dim_0_side_var = ghostcell_dims_side_var[0];
+        
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            const int num_subghosts_0_primitive_var = num_subghosts_primitive_var[ei][0];
+            const int num_subghosts_1_primitive_var = num_subghosts_primitive_var[ei][1];
+            const int subghostcell_dim_0_primitive_var = subghostcell_dims_primitive_var[ei][0];
+            
+            /*
+             * Get the primitive variables in the x-direction.
+             */
+            
+            double* U = variables_side[ei]->getPointer(0);
+            
+            for (int j = 0; j < interior_dim_1; j++)
+            {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = -num_ghosts_0_side_var;
+                     i < interior_dim_0 + 1 + num_ghosts_0_side_var;
+                     i++)
+                {
+                    // Compute the linear indices.
+                    const int idx_face = (i + num_ghosts_0_side_var) +
+                        (j + num_ghosts_1_side_var)*(ghostcell_dim_0_side_var + 1);
+                    
+                    const int idx_cell = (i + idx_offset + num_subghosts_0_primitive_var) +
+                        (j + num_subghosts_1_primitive_var)*subghostcell_dim_0_primitive_var;
+                    
+                    U[idx_face] = V[ei][idx_cell];
+                }
+            }
+            
+            /*
+             * Get the primitive variables in the y-direction.
+             */
+            
+            U = variables_side[ei]->getPointer(1);
+            
+            for (int j = -num_ghosts_1_side_var;
+                 j < interior_dim_1 + 1 + num_ghosts_1_side_var;
+                 j++)
+            {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = 0; i < interior_dim_0; i++)
+                {
+                    // Compute the linear indices.
+                    const int idx_face = (i + num_ghosts_0_side_var) +
+                        (j + num_ghosts_1_side_var)*ghostcell_dim_0_side_var;
+                    
+                    const int idx_cell = (i + num_subghosts_0_primitive_var) +
+                        (j + idx_offset + num_subghosts_1_primitive_var)*subghostcell_dim_0_primitive_var;
+                    
+                    U[idx_face] = V[ei][idx_cell];
+                }
+            }
+        }
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        const int interior_dim_0 = interior_dims[0];
+        const int interior_dim_1 = interior_dims[1];
+        const int interior_dim_2 = interior_dims[2];
+        
+        const int num_ghosts_0_side_var = num_ghosts_side_var[0];
+        const int num_ghosts_1_side_var = num_ghosts_side_var[1];
+        const int num_ghosts_2_side_var = num_ghosts_side_var[2];
+        const int ghostcell_dim_0_side_var = ghostcell_dims_side_var[0];
+        const int ghostcell_dim_1_side_var = ghostcell_dims_side_var[1];
+        
+        for (int ei = 0; ei < d_num_eqn; ei++)
+        {
+            const int num_subghosts_0_primitive_var = num_subghosts_primitive_var[ei][0];
+            const int num_subghosts_1_primitive_var = num_subghosts_primitive_var[ei][1];
+            const int num_subghosts_2_primitive_var = num_subghosts_primitive_var[ei][2];
+            const int subghostcell_dim_0_primitive_var = subghostcell_dims_primitive_var[ei][0];
+            const int subghostcell_dim_1_primitive_var = subghostcell_dims_primitive_var[ei][1];
+            
+            /*
+             * Get the primitive variables in the x-direction.
+             */
+            
+            double* U = variables_side[ei]->getPointer(0);
+            
+            for (int k = 0; k < interior_dim_2; k++)
+            {
+                for (int j = 0; j < interior_dim_1; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = -num_ghosts_0_side_var;
+                         i < interior_dim_0 + 1 + num_ghosts_0_side_var;
+                         i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_face = (i + num_ghosts_0_side_var) +
+                            (j + num_ghosts_1_side_var)*(ghostcell_dim_0_side_var + 1) +
+                            (k + num_ghosts_2_side_var)*(ghostcell_dim_0_side_var + 1)*
+                                ghostcell_dim_1_side_var;
+                        
+                        const int idx_cell = (i + idx_offset + num_subghosts_0_primitive_var) +
+                            (j + num_subghosts_1_primitive_var)*subghostcell_dim_0_primitive_var +
+                            (k + num_subghosts_2_primitive_var)*subghostcell_dim_0_primitive_var*
+                                subghostcell_dim_1_primitive_var;
+                        
+                        U[idx_face] = V[ei][idx_cell];
+                    }
+                }
+            }
+            
+            /*
+             * Get the primitive variables in the y-direction.
+             */
+            
+            U = variables_side[ei]->getPointer(1);
+            
+            for (int k = 0; k < interior_dim_2; k++)
+            {
+                for (int j = -num_ghosts_1_side_var;
+                     j < interior_dim_1 + 1 + num_ghosts_1_side_var;
+                     j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dim_0; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_face = (i + num_ghosts_0_side_var) +
+                            (j + num_ghosts_1_side_var)*ghostcell_dim_0_side_var +
+                            (k + num_ghosts_2_side_var)*ghostcell_dim_0_side_var*
+                                (ghostcell_dim_1_side_var + 1);
+                        
+                        const int idx_cell = (i + num_subghosts_0_primitive_var) +
+                            (j + idx_offset + num_subghosts_1_primitive_var)*subghostcell_dim_0_primitive_var +
+                            (k + num_subghosts_2_primitive_var)*subghostcell_dim_0_primitive_var*
+                                subghostcell_dim_1_primitive_var;
+                        
+                        U[idx_face] = V[ei][idx_cell];
+                    }
+                }
+            }
+            
+            /*
+             * Get the primitive variables in the z-direction.
+             */
+            
+            U = variables_side[ei]->getPointer(2);
+            
+            for (int k = -num_ghosts_2_side_var;
+                 k < interior_dim_2 + 1 + num_ghosts_2_side_var;
+                 k++)
+            {
+                for (int j = 0; j < interior_dim_1; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dim_0; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_face = (i + num_ghosts_0_side_var) +
+                            (j + num_ghosts_1_side_var)*ghostcell_dim_0_side_var +
+                            (k + num_ghosts_2_side_var)*ghostcell_dim_0_side_var*
+                                ghostcell_dim_1_side_var;
+                        
+                        const int idx_cell = (i + num_subghosts_0_primitive_var) +
+                            (j + num_subghosts_1_primitive_var)*subghostcell_dim_0_primitive_var +
+                            (k + idx_offset + num_subghosts_2_primitive_var)*subghostcell_dim_0_primitive_var*
+                                subghostcell_dim_1_primitive_var;
+                        
+                        U[idx_face] = V[ei][idx_cell];
+                    }
+                }
+            }
+        }
+    }
+}
@@ -299,6 +299,24 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::printClassData(
     os << "d_constant_epsilon = "
        << d_constant_epsilon
        << std::endl;
+    os << "d_use_tiling = "
+       << d_use_tiling
+       << std::endl;
+    os << "d_tile_size = "
+       << d_tile_size
+       << std::endl;
+    os << "d_use_hybrid_central_WCNS = "
+       << d_use_hybrid_central_WCNS
+       << std::endl;
+    os << "d_hybrid_shock_sensor_threshold = "
+       << d_hybrid_shock_sensor_threshold
+       << std::endl;
+    os << "d_freeze_shock_sensor = "
+       << d_freeze_shock_sensor
+       << std::endl;
+    os << "d_component_wise_interpolation_start_level = "
+       << d_component_wise_interpolation_start_level
+       << std::endl;
 }
 
 
@@ -314,6 +332,23 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::putToRestart(
     restart_db->putDouble("d_constant_C", d_constant_C);
     restart_db->putDouble("d_constant_Chi", d_constant_Chi);
     restart_db->putDouble("d_constant_epsilon", d_constant_epsilon);
+    
+    if (d_use_tiling)
+    {
+        std::vector<int> tile_size(d_dim.getValue());
+        for (int di = 0; di < d_dim.getValue(); di++)
+        {
+            tile_size[di] = d_tile_size[di];
+        }
+        
+        restart_db->putIntegerVector("d_tile_size", tile_size);
+    }
+    
+    restart_db->putBool("d_use_hybrid_central_WCNS", d_use_hybrid_central_WCNS);
+    restart_db->putDouble("d_hybrid_shock_sensor_threshold", d_hybrid_shock_sensor_threshold);
+    restart_db->putBool("d_freeze_shock_sensor", d_freeze_shock_sensor);
+    restart_db->putInteger("d_component_wise_interpolation_start_level",
+        d_component_wise_interpolation_start_level);
 }
 
 
@@ -324,7 +359,8 @@ void
 ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
     std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_minus,
     std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_plus,
-    const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables)
+    const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables,
+    const std::vector<std::vector<int> >& WENO_row_flags)
 {
 #ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
     TBOX_ASSERT(static_cast<int>(variables_minus.size()) == d_num_eqn);
@@ -474,6 +510,11 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
             
             for (int j = 0; j < interior_dim_1; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[0][j] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -510,6 +551,11 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
             
             for (int j = 0; j < interior_dim_1; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[0][j] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -552,6 +598,11 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
             
             for (int j = -1; j < interior_dim_1 + 2; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[1][j + 1] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -588,6 +639,11 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
             
             for (int j = -1; j < interior_dim_1 + 2; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[1][j + 1] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -643,6 +699,11 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[0][j + k*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -684,6 +745,11 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[0][j + k*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -731,6 +797,11 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = -1; j < interior_dim_1 + 2; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[1][(j + 1) + k*(interior_dim_1 + 3)] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -772,6 +843,11 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = -1; j < interior_dim_1 + 2; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[1][(j + 1) + k*(interior_dim_1 + 3)] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -819,6 +895,11 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[2][j + (k + 1)*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -860,6 +941,11 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[2][j + (k + 1)*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
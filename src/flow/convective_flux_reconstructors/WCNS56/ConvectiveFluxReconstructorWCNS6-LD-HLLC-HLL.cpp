@@ -390,6 +390,24 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::printClassData(
     os << "d_constant_alpha_tau = "
        << d_constant_alpha_tau
        << std::endl;
+    os << "d_use_tiling = "
+       << d_use_tiling
+       << std::endl;
+    os << "d_tile_size = "
+       << d_tile_size
+       << std::endl;
+    os << "d_use_hybrid_central_WCNS = "
+       << d_use_hybrid_central_WCNS
+       << std::endl;
+    os << "d_hybrid_shock_sensor_threshold = "
+       << d_hybrid_shock_sensor_threshold
+       << std::endl;
+    os << "d_freeze_shock_sensor = "
+       << d_freeze_shock_sensor
+       << std::endl;
+    os << "d_component_wise_interpolation_start_level = "
+       << d_component_wise_interpolation_start_level
+       << std::endl;
 }
 
 
@@ -405,6 +423,23 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::putToRestart(
     restart_db->putInteger("d_constant_q", d_constant_q);
     restart_db->putDouble("d_constant_C", d_constant_C);
     restart_db->putDouble("d_constant_alpha_tau", d_constant_alpha_tau);
+    
+    if (d_use_tiling)
+    {
+        std::vector<int> tile_size(d_dim.getValue());
+        for (int di = 0; di < d_dim.getValue(); di++)
+        {
+            tile_size[di] = d_tile_size[di];
+        }
+        
+        restart_db->putIntegerVector("d_tile_size", tile_size);
+    }
+    
+    restart_db->putBool("d_use_hybrid_central_WCNS", d_use_hybrid_central_WCNS);
+    restart_db->putDouble("d_hybrid_shock_sensor_threshold", d_hybrid_shock_sensor_threshold);
+    restart_db->putBool("d_freeze_shock_sensor", d_freeze_shock_sensor);
+    restart_db->putInteger("d_component_wise_interpolation_start_level",
+        d_component_wise_interpolation_start_level);
 }
 
 
@@ -415,7 +450,8 @@ void
 ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
     std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_minus,
     std::vector<boost::shared_ptr<pdat::SideData<double> > >& variables_plus,
-    const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables)
+    const std::vector<std::vector<boost::shared_ptr<pdat::SideData<double> > > >& variables,
+    const std::vector<std::vector<int> >& WENO_row_flags)
 {
 #ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
     TBOX_ASSERT(static_cast<int>(variables_minus.size()) == d_num_eqn);
@@ -556,6 +592,11 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
             
             for (int j = 0; j < interior_dim_1; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[0][j] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -591,6 +632,11 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
             
             for (int j = 0; j < interior_dim_1; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[0][j] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -630,6 +676,11 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
             
             for (int j = -1; j < interior_dim_1 + 2; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[1][j + 1] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -665,6 +716,11 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
             
             for (int j = -1; j < interior_dim_1 + 2; j++)
             {
+                if (!WENO_row_flags.empty() && WENO_row_flags[1][j + 1] == 0)
+                {
+                    continue;
+                }
+                
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
 #endif
@@ -717,6 +773,11 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[0][j + k*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -757,6 +818,11 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[0][j + k*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -801,6 +867,11 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = -1; j < interior_dim_1 + 2; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[1][(j + 1) + k*(interior_dim_1 + 3)] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -841,6 +912,11 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = -1; j < interior_dim_1 + 2; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[1][(j + 1) + k*(interior_dim_1 + 3)] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -885,6 +961,11 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[2][j + (k + 1)*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
@@ -925,6 +1006,11 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
             {
                 for (int j = 0; j < interior_dim_1; j++)
                 {
+                    if (!WENO_row_flags.empty() && WENO_row_flags[2][j + (k + 1)*interior_dim_1] == 0)
+                    {
+                        continue;
+                    }
+                    
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
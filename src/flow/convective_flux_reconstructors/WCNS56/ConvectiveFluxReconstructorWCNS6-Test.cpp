@@ -452,6 +452,63 @@ ConvectiveFluxReconstructorWCNS6_Test::putToRestart(
 }
 
 
+/*
+ * Register the derived cell variables required by the convective flux and source in the flow model.
+ */
+void
+ConvectiveFluxReconstructorWCNS6_Test::registerDerivedVariablesForConvectiveFluxAndSource(
+    const hier::Patch& patch)
+{
+    NULL_USE(patch);
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
+        
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
+        
+        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
+        
+        d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
+            d_num_conv_ghosts,
+            AVERAGING::SIMPLE);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
+        
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
+        
+        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
+        
+        d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
+            d_num_conv_ghosts,
+            AVERAGING::SIMPLE);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
+        
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Z", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
+        
+        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
+        
+        d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
+            d_num_conv_ghosts,
+            AVERAGING::SIMPLE);
+    }
+}
+
+
 /*
  * Compute the convective flux and source due to splitting of convective term on a patch.
  */
@@ -549,6 +606,13 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             interior_box, 1, hier::IntVector::getOne(d_dim)));
     }
     
+    /*
+     * Check whether the patch and the derived cell variables are already registered in the flow
+     * model by the caller, which then also unregisters the patch.
+     */
+    
+    const bool is_patch_registered = d_flow_model->hasRegisteredPatch();
+    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -561,21 +625,14 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
-        
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
-        
-        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
-        
-        d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
-            d_num_conv_ghosts,
-            AVERAGING::SIMPLE);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForConvectiveFluxAndSource(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Get the pointers to the velocity and convective flux cell data inside the flow model.
@@ -981,7 +1038,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(1))
     else if (d_dim == tbox::Dimension(2))
@@ -997,22 +1057,14 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
-        
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
-        
-        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
-        
-        d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
-            d_num_conv_ghosts,
-            AVERAGING::SIMPLE);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForConvectiveFluxAndSource(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Get the pointers to the velocity and convective flux cell data inside the flow model.
@@ -1850,7 +1902,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(2))
     else if (d_dim == tbox::Dimension(3))
@@ -1867,23 +1922,14 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
-        
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Z", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRIMITIVE_VARIABLES", d_num_conv_ghosts));
-        
-        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
-        
-        d_flow_model->registerDerivedVariablesForCharacteristicProjectionOfPrimitiveVariables(
-            d_num_conv_ghosts,
-            AVERAGING::SIMPLE);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForConvectiveFluxAndSource(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Get the pointers to the velocity and convective flux cell data inside the flow model.
@@ -3175,7 +3221,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(3))
 }
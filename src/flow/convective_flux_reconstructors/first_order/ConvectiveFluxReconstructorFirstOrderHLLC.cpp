@@ -63,6 +63,18 @@ ConvectiveFluxReconstructorFirstOrderHLLC::putToRestart(
 }
 
 
+/*
+ * Register the derived cell variables required by the convective flux and source in the flow model.
+ * The first order HLLC reconstruction only uses the conservative variables.
+ */
+void
+ConvectiveFluxReconstructorFirstOrderHLLC::registerDerivedVariablesForConvectiveFluxAndSource(
+    const hier::Patch& patch)
+{
+    NULL_USE(patch);
+}
+
+
 /*
  * Compute the convective flux and source due to splitting of convective term on a patch.
  */
@@ -126,6 +138,13 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
             interior_box, d_dim.getValue(), hier::IntVector::getZero(d_dim)));
     }
     
+    /*
+     * Check whether the patch and the derived cell variables are already registered in the flow
+     * model by the caller, which then also unregisters the patch.
+     */
+    
+    const bool is_patch_registered = d_flow_model->hasRegisteredPatch();
+    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -143,7 +162,10 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
          * Register the patch and data context.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+        }
         
         /*
          * Get the pointers to the conservative variables.
@@ -218,12 +240,17 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
             for (int i = 0; i < interior_dims[0] + 1; i++)
             {
                 // Compute the linear indices.
                 const int idx_face_x = i;
-                const int idx_L = i - 1 + num_subghosts_conservative_var[ei][0];
-                const int idx_R = i + num_subghosts_conservative_var[ei][0];
+                const int idx_L = i - 1 + num_subghosts_0_conservative_var;
+                const int idx_R = i + num_subghosts_0_conservative_var;
                 
                 Q_minus[ei][idx_face_x] = Q[ei][idx_L];
                 Q_plus[ei][idx_face_x] = Q[ei][idx_R];
@@ -257,6 +284,9 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         // Multiply flux by dt.
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
             for (int i = 0; i < interior_dims[0] + 1; i++)
             {
                 // Compute the linear index.
@@ -274,14 +304,19 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         {
             for (int ei = 0; ei < d_num_eqn; ei ++)
             {
+                const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+                
                 if (d_eqn_form[ei] == EQN_FORM::ADVECTIVE)
                 {
                     double* S = source->getPointer(ei);
                     
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
                     for (int i = 0; i < interior_dims[0]; i++)
                     {
                         // Compute the linear indices. 
-                        const int idx_cell_wghost = i + num_subghosts_conservative_var[ei][0];
+                        const int idx_cell_wghost = i + num_subghosts_0_conservative_var;
                         const int idx_cell_nghost = i;
                         const int idx_face_x_L = i;
                         const int idx_face_x_R = i + 1;
@@ -299,7 +334,10 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
          * Unregister the patch in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(1))
     else if (d_dim == tbox::Dimension(2))
@@ -322,7 +360,10 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
          * Register the patch and data context.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+        }
         
         /*
          * Get the pointers to the conservative variables.
@@ -397,21 +438,28 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+            const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+            
             for (int j = 0; j < interior_dims[1]; j++)
             {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
                 for (int i = 0; i < interior_dims[0] + 1; i++)
                 {
                     // Compute the linear indices.
                     const int idx_face_x = i +
                         j*(interior_dims[0] + 1);
                     
-                    const int idx_L = (i - 1 + num_subghosts_conservative_var[ei][0]) +
-                        (j + num_subghosts_conservative_var[ei][1])*
-                            subghostcell_dims_conservative_var[ei][0];
+                    const int idx_L = (i - 1 + num_subghosts_0_conservative_var) +
+                        (j + num_subghosts_1_conservative_var)*
+                            subghostcell_dim_0_conservative_var;
                     
-                    const int idx_R = (i + num_subghosts_conservative_var[ei][0]) +
-                        (j + num_subghosts_conservative_var[ei][1])*
-                            subghostcell_dims_conservative_var[ei][0];
+                    const int idx_R = (i + num_subghosts_0_conservative_var) +
+                        (j + num_subghosts_1_conservative_var)*
+                            subghostcell_dim_0_conservative_var;
                     
                     Q_minus[ei][idx_face_x] = Q[ei][idx_L];
                     Q_plus[ei][idx_face_x] = Q[ei][idx_R];
@@ -448,6 +496,9 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         {
             for (int j = 0; j < interior_dims[1]; j++)
             {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
                 for (int i = 0; i < interior_dims[0] + 1; i++)
                 {
                     // Compute the linear index.
@@ -471,21 +522,28 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+            const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+            
             for (int j = 0; j < interior_dims[1] + 1; j++)
             {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
                 for (int i = 0; i < interior_dims[0]; i++)
                 {
                     // Compute the linear indices.
                     const int idx_face_y = i +
                         j*interior_dims[0];
                     
-                    const int idx_B = (i + num_subghosts_conservative_var[ei][0]) +
-                        (j - 1 + num_subghosts_conservative_var[ei][1])*
-                            subghostcell_dims_conservative_var[ei][0];
+                    const int idx_B = (i + num_subghosts_0_conservative_var) +
+                        (j - 1 + num_subghosts_1_conservative_var)*
+                            subghostcell_dim_0_conservative_var;
                     
-                    const int idx_T = (i + num_subghosts_conservative_var[ei][0]) +
-                        (j + num_subghosts_conservative_var[ei][1])*
-                            subghostcell_dims_conservative_var[ei][0];
+                    const int idx_T = (i + num_subghosts_0_conservative_var) +
+                        (j + num_subghosts_1_conservative_var)*
+                            subghostcell_dim_0_conservative_var;
                     
                     Q_minus[ei][idx_face_y] = Q[ei][idx_B];
                     Q_plus[ei][idx_face_y] = Q[ei][idx_T];
@@ -522,6 +580,9 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         {
             for (int j = 0; j < interior_dims[1] + 1; j++)
             {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
                 for (int i = 0; i < interior_dims[0]; i++)
                 {
                     // Compute the linear index.
@@ -541,17 +602,24 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         {
             for (int ei = 0; ei < d_num_eqn; ei++)
             {
+                const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+                const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+                const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+                
                 if (d_eqn_form[ei] == EQN_FORM::ADVECTIVE)
                 {
                     double* S = source->getPointer(ei);
                     
                     for (int j = 0; j < interior_dims[1]; j++)
                     {
+#ifdef HAMERS_ENABLE_SIMD
+                        #pragma omp simd
+#endif
                         for (int i = 0; i < interior_dims[0]; i++)
                         {
                             // Compute the linear indices.
-                            const int idx_cell_wghost = (i + num_subghosts_conservative_var[ei][0]) +
-                                (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0];
+                            const int idx_cell_wghost = (i + num_subghosts_0_conservative_var) +
+                                (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var;
                             
                             const int idx_cell_nghost = i + j*interior_dims[0];
                             
@@ -584,7 +652,10 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
          * Unregister the patch in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(2))
     else if (d_dim == tbox::Dimension(3))
@@ -610,7 +681,10 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
          * Register the patch and data context.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+        }
         
         /*
          * Get the pointers to the conservative variables.
@@ -685,10 +759,19 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+            const int num_subghosts_2_conservative_var = num_subghosts_conservative_var[ei][2];
+            const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+            const int subghostcell_dim_1_conservative_var = subghostcell_dims_conservative_var[ei][1];
+            
             for (int k = 0; k < interior_dims[2]; k++)
             {
                 for (int j = 0; j < interior_dims[1]; j++)
                 {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
                     for (int i = 0; i < interior_dims[0] + 1; i++)
                     {
                         // Compute the linear indices.
@@ -696,19 +779,19 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
                             j*(interior_dims[0] + 1) +
                             k*(interior_dims[0] + 1)*interior_dims[1];
                         
-                        const int idx_L = (i - 1 + num_subghosts_conservative_var[ei][0]) +
-                            (j + num_subghosts_conservative_var[ei][1])*
-                                subghostcell_dims_conservative_var[ei][0] +
-                            (k + num_subghosts_conservative_var[ei][2])*
-                                subghostcell_dims_conservative_var[ei][0]*
-                                    subghostcell_dims_conservative_var[ei][1];
+                        const int idx_L = (i - 1 + num_subghosts_0_conservative_var) +
+                            (j + num_subghosts_1_conservative_var)*
+                                subghostcell_dim_0_conservative_var +
+                            (k + num_subghosts_2_conservative_var)*
+                                subghostcell_dim_0_conservative_var*
+                                    subghostcell_dim_1_conservative_var;
                         
-                        const int idx_R = (i + num_subghosts_conservative_var[ei][0]) +
-                            (j + num_subghosts_conservative_var[ei][1])*
-                                subghostcell_dims_conservative_var[ei][0] +
-                            (k + num_subghosts_conservative_var[ei][2])*
-                                subghostcell_dims_conservative_var[ei][0]*
-                                    subghostcell_dims_conservative_var[ei][1];
+                        const int idx_R = (i + num_subghosts_0_conservative_var) +
+                            (j + num_subghosts_1_conservative_var)*
+                                subghostcell_dim_0_conservative_var +
+                            (k + num_subghosts_2_conservative_var)*
+                                subghostcell_dim_0_conservative_var*
+                                    subghostcell_dim_1_conservative_var;
                         
                         Q_minus[ei][idx_face_x] = Q[ei][idx_L];
                         Q_plus[ei][idx_face_x] = Q[ei][idx_R];
@@ -748,6 +831,9 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
             {
                 for (int j = 0; j < interior_dims[1]; j++)
                 {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
                     for (int i = 0; i < interior_dims[0] + 1; i++)
                     {
                         // Compute the linear index.
@@ -773,10 +859,19 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+            const int num_subghosts_2_conservative_var = num_subghosts_conservative_var[ei][2];
+            const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+            const int subghostcell_dim_1_conservative_var = subghostcell_dims_conservative_var[ei][1];
+            
             for (int k = 0; k < interior_dims[2]; k++)
             {
                 for (int j = 0; j < interior_dims[1] + 1; j++)
                 {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
                     for (int i = 0; i < interior_dims[0]; i++)
                     {
                         // Compute the linear indices.
@@ -785,19 +880,19 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
                             k*interior_dims[0]*(interior_dims[1] + 1);
                         
                         // Compute the linear indices.
-                        const int idx_B = (i + num_subghosts_conservative_var[ei][0]) +
-                            (j - 1 + num_subghosts_conservative_var[ei][1])*
-                                subghostcell_dims_conservative_var[ei][0] +
-                            (k + num_subghosts_conservative_var[ei][2])*
-                                subghostcell_dims_conservative_var[ei][0]*
-                                    subghostcell_dims_conservative_var[ei][1];
+                        const int idx_B = (i + num_subghosts_0_conservative_var) +
+                            (j - 1 + num_subghosts_1_conservative_var)*
+                                subghostcell_dim_0_conservative_var +
+                            (k + num_subghosts_2_conservative_var)*
+                                subghostcell_dim_0_conservative_var*
+                                    subghostcell_dim_1_conservative_var;
                         
-                        const int idx_T = (i + num_subghosts_conservative_var[ei][0]) +
-                            (j + num_subghosts_conservative_var[ei][1])*
-                                subghostcell_dims_conservative_var[ei][0] +
-                            (k + num_subghosts_conservative_var[ei][2])*
-                                subghostcell_dims_conservative_var[ei][0]*
-                                    subghostcell_dims_conservative_var[ei][1];
+                        const int idx_T = (i + num_subghosts_0_conservative_var) +
+                            (j + num_subghosts_1_conservative_var)*
+                                subghostcell_dim_0_conservative_var +
+                            (k + num_subghosts_2_conservative_var)*
+                                subghostcell_dim_0_conservative_var*
+                                    subghostcell_dim_1_conservative_var;
                         
                         Q_minus[ei][idx_face_y] = Q[ei][idx_B];
                         Q_plus[ei][idx_face_y] = Q[ei][idx_T];
@@ -837,6 +932,9 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
             {
                 for (int j = 0; j < interior_dims[1] + 1; j++)
                 {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
                     for (int i = 0; i < interior_dims[0]; i++)
                     {
                         // Compute the linear index.
@@ -862,10 +960,19 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+            const int num_subghosts_2_conservative_var = num_subghosts_conservative_var[ei][2];
+            const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+            const int subghostcell_dim_1_conservative_var = subghostcell_dims_conservative_var[ei][1];
+            
             for (int k = 0; k < interior_dims[2] + 1; k++)
             {
                 for (int j = 0; j < interior_dims[1]; j++)
                 {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
                     for (int i = 0; i < interior_dims[0]; i++)
                     {
                         // Compute the linear indices.
@@ -873,19 +980,19 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
                             j*interior_dims[0] +
                             k*interior_dims[0]*interior_dims[1];
                         
-                        const int idx_B = (i + num_subghosts_conservative_var[ei][0]) +
-                            (j + num_subghosts_conservative_var[ei][1])*
-                                subghostcell_dims_conservative_var[ei][0] +
-                            (k - 1 + num_subghosts_conservative_var[ei][2])*
-                                subghostcell_dims_conservative_var[ei][0]*
-                                    subghostcell_dims_conservative_var[ei][1];
+                        const int idx_B = (i + num_subghosts_0_conservative_var) +
+                            (j + num_subghosts_1_conservative_var)*
+                                subghostcell_dim_0_conservative_var +
+                            (k - 1 + num_subghosts_2_conservative_var)*
+                                subghostcell_dim_0_conservative_var*
+                                    subghostcell_dim_1_conservative_var;
                         
-                        const int idx_F = (i + num_subghosts_conservative_var[ei][0]) +
-                            (j + num_subghosts_conservative_var[ei][1])*
-                                subghostcell_dims_conservative_var[ei][0] +
-                            (k + num_subghosts_conservative_var[ei][2])*
-                                subghostcell_dims_conservative_var[ei][0]*
-                                    subghostcell_dims_conservative_var[ei][1];
+                        const int idx_F = (i + num_subghosts_0_conservative_var) +
+                            (j + num_subghosts_1_conservative_var)*
+                                subghostcell_dim_0_conservative_var +
+                            (k + num_subghosts_2_conservative_var)*
+                                subghostcell_dim_0_conservative_var*
+                                    subghostcell_dim_1_conservative_var;
                         
                         Q_minus[ei][idx_face_z] = Q[ei][idx_B];
                         Q_plus[ei][idx_face_z] = Q[ei][idx_F];
@@ -925,6 +1032,9 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
             {
                 for (int j = 0; j < interior_dims[1]; j++)
                 {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
                     for (int i = 0; i < interior_dims[0]; i++)
                     {
                         // Compute the linear index.
@@ -946,6 +1056,12 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         {
             for (int ei = 0; ei < d_num_eqn; ei++)
             {
+                const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+                const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+                const int num_subghosts_2_conservative_var = num_subghosts_conservative_var[ei][2];
+                const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+                const int subghostcell_dim_1_conservative_var = subghostcell_dims_conservative_var[ei][1];
+                
                 if (d_eqn_form[ei] == EQN_FORM::ADVECTIVE)
                 {
                     double* S = source->getPointer(ei);
@@ -954,13 +1070,16 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
                     {
                         for (int j = 0; j < interior_dims[1]; j++)
                         {
+#ifdef HAMERS_ENABLE_SIMD
+                            #pragma omp simd
+#endif
                             for (int i = 0; i < interior_dims[0]; i++)
                             {
                                 // Compute the linear indices. 
-                                const int idx_cell_wghost = (i + num_subghosts_conservative_var[ei][0]) +
-                                    (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0] +
-                                    (k + num_subghosts_conservative_var[ei][2])*subghostcell_dims_conservative_var[ei][0]*
-                                        subghostcell_dims_conservative_var[ei][1];
+                                const int idx_cell_wghost = (i + num_subghosts_0_conservative_var) +
+                                    (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var +
+                                    (k + num_subghosts_2_conservative_var)*subghostcell_dim_0_conservative_var*
+                                        subghostcell_dim_1_conservative_var;
                                 
                                 const int idx_cell_nghost = i +
                                     j*interior_dims[0] +
@@ -1012,7 +1131,10 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
          * Unregister the patch in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(3))
 }
@@ -54,6 +54,82 @@ ConvectiveFluxReconstructorFirstOrderLLF::putToRestart(
 }
 
 
+/*
+ * Register the derived cell variables required by the convective flux and source in the flow model.
+ */
+void
+ConvectiveFluxReconstructorFirstOrderLLF::registerDerivedVariablesForConvectiveFluxAndSource(
+    const hier::Patch& patch)
+{
+    NULL_USE(patch);
+    
+    /*
+     * Get the forms of equation and check whether there are advection equations in the system of equations.
+     */
+    
+    const std::vector<EQN_FORM::TYPE> eqn_form = d_flow_model->getEquationsForm();
+    
+    bool has_advection_eqn = false;
+    
+    if (std::find(eqn_form.begin(), eqn_form.end(), EQN_FORM::ADVECTIVE) != eqn_form.end())
+    {
+        has_advection_eqn = true;
+    }
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
+        
+        if (has_advection_eqn)
+        {
+            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("DENSITY", d_num_conv_ghosts));
+            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRESSURE", d_num_conv_ghosts));
+            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+        }
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
+        
+        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
+        
+        if (has_advection_eqn)
+        {
+            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("DENSITY", d_num_conv_ghosts));
+            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRESSURE", d_num_conv_ghosts));
+            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+        }
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_Y", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
+        
+        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
+        
+        if (has_advection_eqn)
+        {
+            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("DENSITY", d_num_conv_ghosts));
+            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRESSURE", d_num_conv_ghosts));
+            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+        }
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_Y", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_Z", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
+        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Z", d_num_conv_ghosts));
+        
+        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
+    }
+}
+
+
 /*
  * Compute the convective flux and source due to splitting of convective term on a patch.
  */
@@ -127,28 +203,27 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
             new pdat::SideData<double>(interior_box, d_dim.getValue(), hier::IntVector::getZero(d_dim)));
     }
     
+    /*
+     * Check whether the patch and the derived cell variables are already registered in the flow
+     * model by the caller, which then also unregisters the patch.
+     */
+    
+    const bool is_patch_registered = d_flow_model->hasRegisteredPatch();
+    
     if (d_dim == tbox::Dimension(1))
     {
         /*
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
-        
-        if (has_advection_eqn)
+        if (!is_patch_registered)
         {
-            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("DENSITY", d_num_conv_ghosts));
-            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRESSURE", d_num_conv_ghosts));
-            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForConvectiveFluxAndSource(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
         }
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
-        
-        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
-        
-        d_flow_model->computeGlobalDerivedCellData();
         
         /*
          * Get the pointer to the cell data inside the flow model.
@@ -259,32 +334,49 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
          * Compute the fluxes in the x direction.
          */
         
-        for (int i = 0; i < interior_dims[0] + 1; i++)
+        for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            // Compute the linear indices.
-            const int idx_midpoint_x = i;
-            const int idx_L_max_wave_speed_x = i - 1 + num_subghosts_max_wave_speed_x[0];
-            const int idx_R_max_wave_speed_x = i + num_subghosts_max_wave_speed_x[0];
-            const int idx_L_convective_flux_x = i - 1 + num_subghosts_convective_flux_x[0];
-            const int idx_R_convective_flux_x = i + num_subghosts_convective_flux_x[0];
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
             
-            const double alpha_x = fmax(max_lambda_x[idx_L_max_wave_speed_x], max_lambda_x[idx_R_max_wave_speed_x]);
+            double* F_face_x = convective_flux->getPointer(0, ei);
             
-            // Compute the fluxes.
-            for (int ei = 0; ei < d_num_eqn; ei++)
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = 0; i < interior_dims[0] + 1; i++)
             {
                 // Compute the linear indices.
-                const int idx_L_conservative_var = i - 1 + num_subghosts_conservative_var[ei][0];
-                const int idx_R_conservative_var = i + num_subghosts_conservative_var[ei][0];
+                const int idx_midpoint_x = i;
+                const int idx_L_max_wave_speed_x = i - 1 + num_subghosts_max_wave_speed_x[0];
+                const int idx_R_max_wave_speed_x = i + num_subghosts_max_wave_speed_x[0];
+                const int idx_L_convective_flux_x = i - 1 + num_subghosts_convective_flux_x[0];
+                const int idx_R_convective_flux_x = i + num_subghosts_convective_flux_x[0];
+                
+                const double alpha_x = fmax(max_lambda_x[idx_L_max_wave_speed_x], max_lambda_x[idx_R_max_wave_speed_x]);
                 
-                convective_flux->getPointer(0, ei)[idx_midpoint_x] = 0.5*dt*(
+                const int idx_L_conservative_var = i - 1 + num_subghosts_0_conservative_var;
+                const int idx_R_conservative_var = i + num_subghosts_0_conservative_var;
+                
+                F_face_x[idx_midpoint_x] = 0.5*dt*(
                     F_x_node[ei][idx_L_convective_flux_x] + F_x_node[ei][idx_R_convective_flux_x] -
                         alpha_x*(Q[ei][idx_R_conservative_var] - Q[ei][idx_L_conservative_var]));
             }
-            
-            if (has_advection_eqn)
+        }
+        
+        if (has_advection_eqn)
+        {
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = 0; i < interior_dims[0] + 1; i++)
             {
                 // Compute the linear indices.
+                const int idx_midpoint_x = i;
+                const int idx_L_max_wave_speed_x = i - 1 + num_subghosts_max_wave_speed_x[0];
+                const int idx_R_max_wave_speed_x = i + num_subghosts_max_wave_speed_x[0];
+                
+                const double alpha_x = fmax(max_lambda_x[idx_L_max_wave_speed_x], max_lambda_x[idx_R_max_wave_speed_x]);
+                
                 const int idx_L_density = i - 1 + num_subghosts_density[0];
                 const int idx_R_density = i + num_subghosts_density[0];
                 const int idx_L_pressure = i - 1 + num_subghosts_pressure[0];
@@ -308,14 +400,19 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
         {
             for (int ei = 0; ei < d_num_eqn; ei ++)
             {
+                const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+                
                 if (eqn_form[ei] == EQN_FORM::ADVECTIVE)
                 {
                     double* S = source->getPointer(ei);
                     
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
                     for (int i = 0; i < interior_dims[0]; i++)
                     {
                         // Compute the linear indices. 
-                        const int idx_cell_wghost = i + num_subghosts_conservative_var[ei][0];
+                        const int idx_cell_wghost = i + num_subghosts_0_conservative_var;
                         const int idx_cell_nghost = i;
                         const int idx_midpoint_x_L = i;
                         const int idx_midpoint_x_R = i + 1;
@@ -333,7 +430,10 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
     }
     else if (d_dim == tbox::Dimension(2))
     {
@@ -341,24 +441,14 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
-        
-        if (has_advection_eqn)
+        if (!is_patch_registered)
         {
-            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("DENSITY", d_num_conv_ghosts));
-            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRESSURE", d_num_conv_ghosts));
-            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForConvectiveFluxAndSource(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
         }
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_Y", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
-        
-        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
-        
-        d_flow_model->computeGlobalDerivedCellData();
         
         /*
          * Get the pointer to the cell data inside the flow model.
@@ -484,47 +574,74 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
         /*
          * Compute the fluxes in the x direction.
          */
-
-        for (int j = 0; j < interior_dims[1]; j++)
+        
+        for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            for (int i = 0; i < interior_dims[0] + 1; i++)
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+            const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+            
+            double* F_face_x = convective_flux->getPointer(0, ei);
+            
+            for (int j = 0; j < interior_dims[1]; j++)
             {
-                // Compute the linear indices.
-                const int idx_midpoint_x = i +
-                    j*(interior_dims[0] + 1);
-                
-                const int idx_L_max_wave_speed_x = (i - 1 + num_subghosts_max_wave_speed_x[0]) +
-                    (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0];
-                
-                const int idx_R_max_wave_speed_x = (i + num_subghosts_max_wave_speed_x[0]) +
-                    (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0];
-                
-                const int idx_L_convective_flux_x = (i - 1 + num_subghosts_convective_flux_x[0]) +
-                    (j + num_subghosts_convective_flux_x[1])*subghostcell_dims_convective_flux_x[0];
-                
-                const int idx_R_convective_flux_x = (i + num_subghosts_convective_flux_x[0]) +
-                    (j + num_subghosts_convective_flux_x[1])*subghostcell_dims_convective_flux_x[0];
-                
-                const double alpha_x = fmax(max_lambda_x[idx_L_max_wave_speed_x], max_lambda_x[idx_R_max_wave_speed_x]);
-                
-                // Compute the fluxes.
-                for (int ei = 0; ei < d_num_eqn; ei++)
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = 0; i < interior_dims[0] + 1; i++)
                 {
                     // Compute the linear indices.
-                    const int idx_L_conservative_var = (i - 1 + num_subghosts_conservative_var[ei][0]) +
-                        (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0];
+                    const int idx_midpoint_x = i +
+                        j*(interior_dims[0] + 1);
+                    
+                    const int idx_L_max_wave_speed_x = (i - 1 + num_subghosts_max_wave_speed_x[0]) +
+                        (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0];
+                    
+                    const int idx_R_max_wave_speed_x = (i + num_subghosts_max_wave_speed_x[0]) +
+                        (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0];
                     
-                    const int idx_R_conservative_var = (i + num_subghosts_conservative_var[ei][0]) +
-                        (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0];
+                    const int idx_L_convective_flux_x = (i - 1 + num_subghosts_convective_flux_x[0]) +
+                        (j + num_subghosts_convective_flux_x[1])*subghostcell_dims_convective_flux_x[0];
+                    
+                    const int idx_R_convective_flux_x = (i + num_subghosts_convective_flux_x[0]) +
+                        (j + num_subghosts_convective_flux_x[1])*subghostcell_dims_convective_flux_x[0];
                     
-                    convective_flux->getPointer(0, ei)[idx_midpoint_x] = 0.5*dt*(
+                    const double alpha_x = fmax(max_lambda_x[idx_L_max_wave_speed_x], max_lambda_x[idx_R_max_wave_speed_x]);
+                    
+                    const int idx_L_conservative_var = (i - 1 + num_subghosts_0_conservative_var) +
+                        (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var;
+                    
+                    const int idx_R_conservative_var = (i + num_subghosts_0_conservative_var) +
+                        (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var;
+                    
+                    F_face_x[idx_midpoint_x] = 0.5*dt*(
                         F_x_node[ei][idx_L_convective_flux_x] + F_x_node[ei][idx_R_convective_flux_x] -
                             alpha_x*(Q[ei][idx_R_conservative_var] - Q[ei][idx_L_conservative_var]));
                 }
-                
-                if (has_advection_eqn)
+            }
+        }
+        
+        if (has_advection_eqn)
+        {
+            for (int j = 0; j < interior_dims[1]; j++)
+            {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = 0; i < interior_dims[0] + 1; i++)
                 {
                     // Compute the linear indices.
+                    const int idx_midpoint_x = i +
+                        j*(interior_dims[0] + 1);
+                    
+                    const int idx_L_max_wave_speed_x = (i - 1 + num_subghosts_max_wave_speed_x[0]) +
+                        (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0];
+                    
+                    const int idx_R_max_wave_speed_x = (i + num_subghosts_max_wave_speed_x[0]) +
+                        (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0];
+                    
+                    const double alpha_x = fmax(max_lambda_x[idx_L_max_wave_speed_x], max_lambda_x[idx_R_max_wave_speed_x]);
+                    
                     const int idx_L_density = (i - 1 + num_subghosts_density[0]) +
                         (j + num_subghosts_density[1])*subghostcell_dims_density[0];
                     
@@ -562,46 +679,73 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
          * Compute the fluxes in the y direction.
          */
         
-        for (int j = 0; j < interior_dims[1] + 1; j++)
+        for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            for (int i = 0; i < interior_dims[0]; i++)
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+            const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+            
+            double* F_face_y = convective_flux->getPointer(1, ei);
+            
+            for (int j = 0; j < interior_dims[1] + 1; j++)
             {
-                // Compute the linear indices.
-                const int idx_midpoint_y = i +
-                    j*interior_dims[0];
-                
-                const int idx_B_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
-                    (j - 1 + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0];
-                
-                const int idx_T_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
-                    (j + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0];
-                
-                const int idx_B_convective_flux_y = (i + num_subghosts_convective_flux_y[0]) +
-                    (j - 1 + num_subghosts_convective_flux_y[1])*subghostcell_dims_convective_flux_y[0];
-                
-                const int idx_T_convective_flux_y = (i + num_subghosts_convective_flux_y[0]) +
-                    (j + num_subghosts_convective_flux_y[1])*subghostcell_dims_convective_flux_y[0];
-                
-                const double alpha_y = fmax(max_lambda_y[idx_B_max_wave_speed_y], max_lambda_y[idx_T_max_wave_speed_y]);
-                
-                // Compute the fluxes.
-                for (int ei = 0; ei < d_num_eqn; ei++)
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = 0; i < interior_dims[0]; i++)
                 {
                     // Compute the linear indices.
-                    const int idx_B_conservative_var = (i + num_subghosts_conservative_var[ei][0]) +
-                        (j - 1 + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0];
+                    const int idx_midpoint_y = i +
+                        j*interior_dims[0];
                     
-                    const int idx_T_conservative_var = (i + num_subghosts_conservative_var[ei][0]) +
-                        (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0];
+                    const int idx_B_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
+                        (j - 1 + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0];
+                    
+                    const int idx_T_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
+                        (j + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0];
                     
-                    convective_flux->getPointer(1, ei)[idx_midpoint_y] = 0.5*dt*(
+                    const int idx_B_convective_flux_y = (i + num_subghosts_convective_flux_y[0]) +
+                        (j - 1 + num_subghosts_convective_flux_y[1])*subghostcell_dims_convective_flux_y[0];
+                    
+                    const int idx_T_convective_flux_y = (i + num_subghosts_convective_flux_y[0]) +
+                        (j + num_subghosts_convective_flux_y[1])*subghostcell_dims_convective_flux_y[0];
+                    
+                    const double alpha_y = fmax(max_lambda_y[idx_B_max_wave_speed_y], max_lambda_y[idx_T_max_wave_speed_y]);
+                    
+                    const int idx_B_conservative_var = (i + num_subghosts_0_conservative_var) +
+                        (j - 1 + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var;
+                    
+                    const int idx_T_conservative_var = (i + num_subghosts_0_conservative_var) +
+                        (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var;
+                    
+                    F_face_y[idx_midpoint_y] = 0.5*dt*(
                         F_y_node[ei][idx_B_convective_flux_y] + F_y_node[ei][idx_T_convective_flux_y] -
                             alpha_y*(Q[ei][idx_T_conservative_var] - Q[ei][idx_B_conservative_var]));
                 }
-                
-                if (has_advection_eqn)
+            }
+        }
+        
+        if (has_advection_eqn)
+        {
+            for (int j = 0; j < interior_dims[1] + 1; j++)
+            {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = 0; i < interior_dims[0]; i++)
                 {
                     // Compute the linear indices.
+                    const int idx_midpoint_y = i +
+                        j*interior_dims[0];
+                    
+                    const int idx_B_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
+                        (j - 1 + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0];
+                    
+                    const int idx_T_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
+                        (j + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0];
+                    
+                    const double alpha_y = fmax(max_lambda_y[idx_B_max_wave_speed_y], max_lambda_y[idx_T_max_wave_speed_y]);
+                    
                     const int idx_B_density = (i + num_subghosts_density[0]) +
                         (j - 1 + num_subghosts_density[1])*subghostcell_dims_density[0];
                     
@@ -644,17 +788,24 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
         {
             for (int ei = 0; ei < d_num_eqn; ei++)
             {
+                const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+                const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+                const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+                
                 if (eqn_form[ei] == EQN_FORM::ADVECTIVE)
                 {
                     double* S = source->getPointer(ei);
                     
                     for (int j = 0; j < interior_dims[1]; j++)
                     {
+#ifdef HAMERS_ENABLE_SIMD
+                        #pragma omp simd
+#endif
                         for (int i = 0; i < interior_dims[0]; i++)
                         {
                             // Compute the linear indices.
-                            const int idx_cell_wghost = (i + num_subghosts_conservative_var[ei][0]) +
-                                (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0];
+                            const int idx_cell_wghost = (i + num_subghosts_0_conservative_var) +
+                                (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var;
                             
                             const int idx_cell_nghost = i + j*interior_dims[0];
                             
@@ -687,7 +838,10 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     }
     else if (d_dim == tbox::Dimension(3))
@@ -696,26 +850,14 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
-        
-        if (has_advection_eqn)
+        if (!is_patch_registered)
         {
-            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("DENSITY", d_num_conv_ghosts));
-            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("PRESSURE", d_num_conv_ghosts));
-            num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("VELOCITY", d_num_conv_ghosts));
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForConvectiveFluxAndSource(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
         }
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_Y", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("MAX_WAVE_SPEED_Z", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_X", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Y", d_num_conv_ghosts));
-        num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>("CONVECTIVE_FLUX_Z", d_num_conv_ghosts));
-        
-        d_flow_model->registerDerivedCellVariable(num_subghosts_of_data);
-        
-        d_flow_model->computeGlobalDerivedCellData();
         
         /*
          * Get the pointer to the cell data inside the flow model.
@@ -858,61 +1000,98 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
          * Compute the fluxes in the x direction.
          */
         
-        for (int k = 0; k < interior_dims[2]; k++)
+        for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            for (int j = 0; j < interior_dims[1]; j++)
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+            const int num_subghosts_2_conservative_var = num_subghosts_conservative_var[ei][2];
+            const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+            const int subghostcell_dim_1_conservative_var = subghostcell_dims_conservative_var[ei][1];
+            
+            double* F_face_x = convective_flux->getPointer(0, ei);
+            
+            for (int k = 0; k < interior_dims[2]; k++)
             {
-                for (int i = 0; i < interior_dims[0] + 1; i++)
+                for (int j = 0; j < interior_dims[1]; j++)
                 {
-                    // Compute the linear indices.
-                    const int idx_midpoint_x = i +
-                        j*(interior_dims[0] + 1) +
-                        k*(interior_dims[0] + 1)*interior_dims[1];
-                    
-                    const int idx_L_max_wave_speed_x = (i - 1 + num_subghosts_max_wave_speed_x[0]) +
-                        (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0] +
-                        (k + num_subghosts_max_wave_speed_x[2])*subghostcell_dims_max_wave_speed_x[0]*
-                            subghostcell_dims_max_wave_speed_x[1];
-                    
-                    const int idx_R_max_wave_speed_x = (i + num_subghosts_max_wave_speed_x[0]) +
-                        (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0] +
-                        (k + num_subghosts_max_wave_speed_x[2])*subghostcell_dims_max_wave_speed_x[0]*
-                            subghostcell_dims_max_wave_speed_x[1];
-                    
-                    const int idx_L_convective_flux_x = (i - 1 + num_subghosts_convective_flux_x[0]) +
-                        (j + num_subghosts_convective_flux_x[1])*subghostcell_dims_convective_flux_x[0] +
-                        (k + num_subghosts_convective_flux_x[2])*subghostcell_dims_convective_flux_x[0]*
-                            subghostcell_dims_convective_flux_x[1];
-                    
-                    const int idx_R_convective_flux_x = (i + num_subghosts_convective_flux_x[0]) +
-                        (j + num_subghosts_convective_flux_x[1])*subghostcell_dims_convective_flux_x[0] +
-                        (k + num_subghosts_convective_flux_x[2])*subghostcell_dims_convective_flux_x[0]*
-                            subghostcell_dims_convective_flux_x[1];
-                    
-                    const double alpha_x = fmax(max_lambda_x[idx_L_max_wave_speed_x], max_lambda_x[idx_R_max_wave_speed_x]);
-                    
-                    // Compute the fluxes.
-                    for (int ei = 0; ei < d_num_eqn; ei++)
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dims[0] + 1; i++)
                     {
                         // Compute the linear indices.
-                        const int idx_L_conservative_var = (i - 1 + num_subghosts_conservative_var[ei][0]) +
-                            (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0] +
-                            (k + num_subghosts_conservative_var[ei][2])*subghostcell_dims_conservative_var[ei][0]*
-                                subghostcell_dims_conservative_var[ei][1];
+                        const int idx_midpoint_x = i +
+                            j*(interior_dims[0] + 1) +
+                            k*(interior_dims[0] + 1)*interior_dims[1];
+                        
+                        const int idx_L_max_wave_speed_x = (i - 1 + num_subghosts_max_wave_speed_x[0]) +
+                            (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0] +
+                            (k + num_subghosts_max_wave_speed_x[2])*subghostcell_dims_max_wave_speed_x[0]*
+                                subghostcell_dims_max_wave_speed_x[1];
+                        
+                        const int idx_R_max_wave_speed_x = (i + num_subghosts_max_wave_speed_x[0]) +
+                            (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0] +
+                            (k + num_subghosts_max_wave_speed_x[2])*subghostcell_dims_max_wave_speed_x[0]*
+                                subghostcell_dims_max_wave_speed_x[1];
+                        
+                        const int idx_L_convective_flux_x = (i - 1 + num_subghosts_convective_flux_x[0]) +
+                            (j + num_subghosts_convective_flux_x[1])*subghostcell_dims_convective_flux_x[0] +
+                            (k + num_subghosts_convective_flux_x[2])*subghostcell_dims_convective_flux_x[0]*
+                                subghostcell_dims_convective_flux_x[1];
+                        
+                        const int idx_R_convective_flux_x = (i + num_subghosts_convective_flux_x[0]) +
+                            (j + num_subghosts_convective_flux_x[1])*subghostcell_dims_convective_flux_x[0] +
+                            (k + num_subghosts_convective_flux_x[2])*subghostcell_dims_convective_flux_x[0]*
+                                subghostcell_dims_convective_flux_x[1];
+                        
+                        const double alpha_x = fmax(max_lambda_x[idx_L_max_wave_speed_x], max_lambda_x[idx_R_max_wave_speed_x]);
                         
-                        const int idx_R_conservative_var = (i + num_subghosts_conservative_var[ei][0]) +
-                            (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0] +
-                            (k + num_subghosts_conservative_var[ei][2])*subghostcell_dims_conservative_var[ei][0]*
-                                subghostcell_dims_conservative_var[ei][1];
+                        const int idx_L_conservative_var = (i - 1 + num_subghosts_0_conservative_var) +
+                            (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var +
+                            (k + num_subghosts_2_conservative_var)*subghostcell_dim_0_conservative_var*
+                                subghostcell_dim_1_conservative_var;
                         
-                        convective_flux->getPointer(0, ei)[idx_midpoint_x] = 0.5*dt*(
+                        const int idx_R_conservative_var = (i + num_subghosts_0_conservative_var) +
+                            (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var +
+                            (k + num_subghosts_2_conservative_var)*subghostcell_dim_0_conservative_var*
+                                subghostcell_dim_1_conservative_var;
+                        
+                        F_face_x[idx_midpoint_x] = 0.5*dt*(
                             F_x_node[ei][idx_L_convective_flux_x] + F_x_node[ei][idx_R_convective_flux_x] -
                                 alpha_x*(Q[ei][idx_R_conservative_var] - Q[ei][idx_L_conservative_var]));
                     }
-                    
-                    if (has_advection_eqn)
+                }
+            }
+        }
+        
+        if (has_advection_eqn)
+        {
+            for (int k = 0; k < interior_dims[2]; k++)
+            {
+                for (int j = 0; j < interior_dims[1]; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dims[0] + 1; i++)
                     {
                         // Compute the linear indices.
+                        const int idx_midpoint_x = i +
+                            j*(interior_dims[0] + 1) +
+                            k*(interior_dims[0] + 1)*interior_dims[1];
+                        
+                        const int idx_L_max_wave_speed_x = (i - 1 + num_subghosts_max_wave_speed_x[0]) +
+                            (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0] +
+                            (k + num_subghosts_max_wave_speed_x[2])*subghostcell_dims_max_wave_speed_x[0]*
+                                subghostcell_dims_max_wave_speed_x[1];
+                        
+                        const int idx_R_max_wave_speed_x = (i + num_subghosts_max_wave_speed_x[0]) +
+                            (j + num_subghosts_max_wave_speed_x[1])*subghostcell_dims_max_wave_speed_x[0] +
+                            (k + num_subghosts_max_wave_speed_x[2])*subghostcell_dims_max_wave_speed_x[0]*
+                                subghostcell_dims_max_wave_speed_x[1];
+                        
+                        const double alpha_x = fmax(max_lambda_x[idx_L_max_wave_speed_x], max_lambda_x[idx_R_max_wave_speed_x]);
+                        
                         const int idx_L_density = (i - 1 + num_subghosts_density[0]) +
                             (j + num_subghosts_density[1])*subghostcell_dims_density[0] +
                             (k + num_subghosts_density[2])*subghostcell_dims_density[0]*
@@ -969,61 +1148,98 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
          * Compute the fluxes in the y direction.
          */
         
-        for (int k = 0; k < interior_dims[2]; k++)
+        for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            for (int j = 0; j < interior_dims[1] + 1; j++)
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+            const int num_subghosts_2_conservative_var = num_subghosts_conservative_var[ei][2];
+            const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+            const int subghostcell_dim_1_conservative_var = subghostcell_dims_conservative_var[ei][1];
+            
+            double* F_face_y = convective_flux->getPointer(1, ei);
+            
+            for (int k = 0; k < interior_dims[2]; k++)
             {
-                for (int i = 0; i < interior_dims[0]; i++)
+                for (int j = 0; j < interior_dims[1] + 1; j++)
                 {
-                    // Compute the linear indices.
-                    const int idx_midpoint_y = i +
-                        j*interior_dims[0] +
-                        k*interior_dims[0]*(interior_dims[1] + 1);
-                    
-                    const int idx_B_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
-                        (j - 1 + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0] +
-                        (k + num_subghosts_max_wave_speed_y[2])*subghostcell_dims_max_wave_speed_y[0]*
-                            subghostcell_dims_max_wave_speed_y[1];
-                    
-                    const int idx_T_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
-                        (j + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0] +
-                        (k + num_subghosts_max_wave_speed_y[2])*subghostcell_dims_max_wave_speed_y[0]*
-                            subghostcell_dims_max_wave_speed_y[1];
-                    
-                    const int idx_B_convective_flux_y = (i + num_subghosts_convective_flux_y[0]) +
-                        (j - 1 + num_subghosts_convective_flux_y[1])*subghostcell_dims_convective_flux_y[0] +
-                        (k + num_subghosts_convective_flux_y[2])*subghostcell_dims_convective_flux_y[0]*
-                            subghostcell_dims_convective_flux_y[1];
-                    
-                    const int idx_T_convective_flux_y = (i + num_subghosts_convective_flux_y[0]) +
-                        (j + num_subghosts_convective_flux_y[1])*subghostcell_dims_convective_flux_y[0] +
-                        (k + num_subghosts_convective_flux_y[2])*subghostcell_dims_convective_flux_y[0]*
-                            subghostcell_dims_convective_flux_y[1];
-                    
-                    const double alpha_y = fmax(max_lambda_y[idx_B_max_wave_speed_y], max_lambda_y[idx_T_max_wave_speed_y]);
-                    
-                    // Compute the fluxes.
-                    for (int ei = 0; ei < d_num_eqn; ei++)
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dims[0]; i++)
                     {
                         // Compute the linear indices.
-                        const int idx_B_conservative_var = (i + num_subghosts_conservative_var[ei][0]) +
-                        (j - 1 + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0] +
-                        (k + num_subghosts_conservative_var[ei][2])*subghostcell_dims_conservative_var[ei][0]*
-                            subghostcell_dims_conservative_var[ei][1];
+                        const int idx_midpoint_y = i +
+                            j*interior_dims[0] +
+                            k*interior_dims[0]*(interior_dims[1] + 1);
+                        
+                        const int idx_B_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
+                            (j - 1 + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0] +
+                            (k + num_subghosts_max_wave_speed_y[2])*subghostcell_dims_max_wave_speed_y[0]*
+                                subghostcell_dims_max_wave_speed_y[1];
+                        
+                        const int idx_T_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
+                            (j + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0] +
+                            (k + num_subghosts_max_wave_speed_y[2])*subghostcell_dims_max_wave_speed_y[0]*
+                                subghostcell_dims_max_wave_speed_y[1];
+                        
+                        const int idx_B_convective_flux_y = (i + num_subghosts_convective_flux_y[0]) +
+                            (j - 1 + num_subghosts_convective_flux_y[1])*subghostcell_dims_convective_flux_y[0] +
+                            (k + num_subghosts_convective_flux_y[2])*subghostcell_dims_convective_flux_y[0]*
+                                subghostcell_dims_convective_flux_y[1];
+                        
+                        const int idx_T_convective_flux_y = (i + num_subghosts_convective_flux_y[0]) +
+                            (j + num_subghosts_convective_flux_y[1])*subghostcell_dims_convective_flux_y[0] +
+                            (k + num_subghosts_convective_flux_y[2])*subghostcell_dims_convective_flux_y[0]*
+                                subghostcell_dims_convective_flux_y[1];
                         
-                        const int idx_T_conservative_var = (i + num_subghosts_conservative_var[ei][0]) +
-                        (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0] +
-                        (k + num_subghosts_conservative_var[ei][2])*subghostcell_dims_conservative_var[ei][0]*
-                            subghostcell_dims_conservative_var[ei][1];
+                        const double alpha_y = fmax(max_lambda_y[idx_B_max_wave_speed_y], max_lambda_y[idx_T_max_wave_speed_y]);
                         
-                        convective_flux->getPointer(1, ei)[idx_midpoint_y] = 0.5*dt*(
+                        const int idx_B_conservative_var = (i + num_subghosts_0_conservative_var) +
+                        (j - 1 + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var +
+                        (k + num_subghosts_2_conservative_var)*subghostcell_dim_0_conservative_var*
+                            subghostcell_dim_1_conservative_var;
+                        
+                        const int idx_T_conservative_var = (i + num_subghosts_0_conservative_var) +
+                        (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var +
+                        (k + num_subghosts_2_conservative_var)*subghostcell_dim_0_conservative_var*
+                            subghostcell_dim_1_conservative_var;
+                        
+                        F_face_y[idx_midpoint_y] = 0.5*dt*(
                             F_y_node[ei][idx_B_convective_flux_y] + F_y_node[ei][idx_T_convective_flux_y] -
                                 alpha_y*(Q[ei][idx_T_conservative_var] - Q[ei][idx_B_conservative_var]));
                     }
-                    
-                    if (has_advection_eqn)
+                }
+            }
+        }
+        
+        if (has_advection_eqn)
+        {
+            for (int k = 0; k < interior_dims[2]; k++)
+            {
+                for (int j = 0; j < interior_dims[1] + 1; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dims[0]; i++)
                     {
                         // Compute the linear indices.
+                        const int idx_midpoint_y = i +
+                            j*interior_dims[0] +
+                            k*interior_dims[0]*(interior_dims[1] + 1);
+                        
+                        const int idx_B_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
+                            (j - 1 + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0] +
+                            (k + num_subghosts_max_wave_speed_y[2])*subghostcell_dims_max_wave_speed_y[0]*
+                                subghostcell_dims_max_wave_speed_y[1];
+                        
+                        const int idx_T_max_wave_speed_y = (i + num_subghosts_max_wave_speed_y[0]) +
+                            (j + num_subghosts_max_wave_speed_y[1])*subghostcell_dims_max_wave_speed_y[0] +
+                            (k + num_subghosts_max_wave_speed_y[2])*subghostcell_dims_max_wave_speed_y[0]*
+                                subghostcell_dims_max_wave_speed_y[1];
+                        
+                        const double alpha_y = fmax(max_lambda_y[idx_B_max_wave_speed_y], max_lambda_y[idx_T_max_wave_speed_y]);
+                        
                         const int idx_B_density = (i + num_subghosts_density[0]) +
                             (j - 1 + num_subghosts_density[1])*subghostcell_dims_density[0] +
                                 (k + num_subghosts_density[2])*subghostcell_dims_density[0]*
@@ -1081,60 +1297,98 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
          * Compute the fluxes in the z direction.
          */
         
-        for (int k = 0; k < interior_dims[2] + 1; k++)
+        for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            for (int j = 0; j < interior_dims[1]; j++)
+            const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+            const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+            const int num_subghosts_2_conservative_var = num_subghosts_conservative_var[ei][2];
+            const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+            const int subghostcell_dim_1_conservative_var = subghostcell_dims_conservative_var[ei][1];
+            
+            double* F_face_z = convective_flux->getPointer(2, ei);
+            
+            for (int k = 0; k < interior_dims[2] + 1; k++)
             {
-                for (int i = 0; i < interior_dims[0]; i++)
+                for (int j = 0; j < interior_dims[1]; j++)
                 {
-                    // Compute the linear indices.
-                    const int idx_midpoint_z = i +
-                        j*interior_dims[0] +
-                        k*interior_dims[0]*interior_dims[1];
-                    
-                    const int idx_B_max_wave_speed_z = (i + num_subghosts_max_wave_speed_z[0]) +
-                        (j + num_subghosts_max_wave_speed_z[1])*subghostcell_dims_max_wave_speed_z[0] +
-                        (k - 1 + num_subghosts_max_wave_speed_z[2])*subghostcell_dims_max_wave_speed_z[0]*
-                            subghostcell_dims_max_wave_speed_z[1];
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dims[0]; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_midpoint_z = i +
+                            j*interior_dims[0] +
+                            k*interior_dims[0]*interior_dims[1];
                         
-                    const int idx_F_max_wave_speed_z = (i + num_subghosts_max_wave_speed_z[0]) +
-                        (j + num_subghosts_max_wave_speed_z[1])*subghostcell_dims_max_wave_speed_z[0] +
-                        (k + num_subghosts_max_wave_speed_z[2])*subghostcell_dims_max_wave_speed_z[0]*
-                            subghostcell_dims_max_wave_speed_z[1];
-                    
-                    const int idx_B_convective_flux_z = (i + num_subghosts_convective_flux_z[0]) +
-                        (j + num_subghosts_convective_flux_z[1])*subghostcell_dims_convective_flux_z[0] +
-                        (k - 1 + num_subghosts_convective_flux_z[2])*subghostcell_dims_convective_flux_z[0]*
-                            subghostcell_dims_convective_flux_z[1];
+                        const int idx_B_max_wave_speed_z = (i + num_subghosts_max_wave_speed_z[0]) +
+                            (j + num_subghosts_max_wave_speed_z[1])*subghostcell_dims_max_wave_speed_z[0] +
+                            (k - 1 + num_subghosts_max_wave_speed_z[2])*subghostcell_dims_max_wave_speed_z[0]*
+                                subghostcell_dims_max_wave_speed_z[1];
+                            
+                        const int idx_F_max_wave_speed_z = (i + num_subghosts_max_wave_speed_z[0]) +
+                            (j + num_subghosts_max_wave_speed_z[1])*subghostcell_dims_max_wave_speed_z[0] +
+                            (k + num_subghosts_max_wave_speed_z[2])*subghostcell_dims_max_wave_speed_z[0]*
+                                subghostcell_dims_max_wave_speed_z[1];
                         
-                    const int idx_F_convective_flux_z = (i + num_subghosts_convective_flux_z[0]) +
-                        (j + num_subghosts_convective_flux_z[1])*subghostcell_dims_convective_flux_z[0] +
-                        (k + num_subghosts_convective_flux_z[2])*subghostcell_dims_convective_flux_z[0]*
-                            subghostcell_dims_convective_flux_z[1];
-                    
-                    const double alpha_z = fmax(max_lambda_z[idx_B_max_wave_speed_z], max_lambda_z[idx_F_max_wave_speed_z]);
-                    
-                    // Compute the fluxes.
-                    for (int ei = 0; ei < d_num_eqn; ei++)
-                    {
-                        const int idx_B_conservative_var = (i + num_subghosts_conservative_var[ei][0]) +
-                            (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0] +
-                            (k - 1 + num_subghosts_conservative_var[ei][2])*subghostcell_dims_conservative_var[ei][0]*
-                                subghostcell_dims_conservative_var[ei][1];
+                        const int idx_B_convective_flux_z = (i + num_subghosts_convective_flux_z[0]) +
+                            (j + num_subghosts_convective_flux_z[1])*subghostcell_dims_convective_flux_z[0] +
+                            (k - 1 + num_subghosts_convective_flux_z[2])*subghostcell_dims_convective_flux_z[0]*
+                                subghostcell_dims_convective_flux_z[1];
                             
-                        const int idx_F_conservative_var = (i + num_subghosts_conservative_var[ei][0]) +
-                            (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0] +
-                            (k + num_subghosts_conservative_var[ei][2])*subghostcell_dims_conservative_var[ei][0]*
-                                subghostcell_dims_conservative_var[ei][1];
+                        const int idx_F_convective_flux_z = (i + num_subghosts_convective_flux_z[0]) +
+                            (j + num_subghosts_convective_flux_z[1])*subghostcell_dims_convective_flux_z[0] +
+                            (k + num_subghosts_convective_flux_z[2])*subghostcell_dims_convective_flux_z[0]*
+                                subghostcell_dims_convective_flux_z[1];
                         
-                        convective_flux->getPointer(2, ei)[idx_midpoint_z] = 0.5*dt*(
+                        const double alpha_z = fmax(max_lambda_z[idx_B_max_wave_speed_z], max_lambda_z[idx_F_max_wave_speed_z]);
+                        
+                        const int idx_B_conservative_var = (i + num_subghosts_0_conservative_var) +
+                            (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var +
+                            (k - 1 + num_subghosts_2_conservative_var)*subghostcell_dim_0_conservative_var*
+                                subghostcell_dim_1_conservative_var;
+                            
+                        const int idx_F_conservative_var = (i + num_subghosts_0_conservative_var) +
+                            (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var +
+                            (k + num_subghosts_2_conservative_var)*subghostcell_dim_0_conservative_var*
+                                subghostcell_dim_1_conservative_var;
+                        
+                        F_face_z[idx_midpoint_z] = 0.5*dt*(
                             F_z_node[ei][idx_B_convective_flux_z] + F_z_node[ei][idx_F_convective_flux_z] -
                                 alpha_z*(Q[ei][idx_F_conservative_var] - Q[ei][idx_B_conservative_var]));       
                     }
-                    
-                    if (has_advection_eqn)
+                }
+            }
+        }
+        
+        if (has_advection_eqn)
+        {
+            for (int k = 0; k < interior_dims[2] + 1; k++)
+            {
+                for (int j = 0; j < interior_dims[1]; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < interior_dims[0]; i++)
                     {
                         // Compute the linear indices.
+                        const int idx_midpoint_z = i +
+                            j*interior_dims[0] +
+                            k*interior_dims[0]*interior_dims[1];
+                        
+                        const int idx_B_max_wave_speed_z = (i + num_subghosts_max_wave_speed_z[0]) +
+                            (j + num_subghosts_max_wave_speed_z[1])*subghostcell_dims_max_wave_speed_z[0] +
+                            (k - 1 + num_subghosts_max_wave_speed_z[2])*subghostcell_dims_max_wave_speed_z[0]*
+                                subghostcell_dims_max_wave_speed_z[1];
+                            
+                        const int idx_F_max_wave_speed_z = (i + num_subghosts_max_wave_speed_z[0]) +
+                            (j + num_subghosts_max_wave_speed_z[1])*subghostcell_dims_max_wave_speed_z[0] +
+                            (k + num_subghosts_max_wave_speed_z[2])*subghostcell_dims_max_wave_speed_z[0]*
+                                subghostcell_dims_max_wave_speed_z[1];
+                        
+                        const double alpha_z = fmax(max_lambda_z[idx_B_max_wave_speed_z], max_lambda_z[idx_F_max_wave_speed_z]);
+                        
                         const int idx_B_density = (i + num_subghosts_density[0]) +
                             (j + num_subghosts_density[1])*subghostcell_dims_density[0] +
                             (k - 1 + num_subghosts_density[2])*subghostcell_dims_density[0]*
@@ -1196,6 +1450,12 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
         {
             for (int ei = 0; ei < d_num_eqn; ei++)
             {
+                const int num_subghosts_0_conservative_var = num_subghosts_conservative_var[ei][0];
+                const int num_subghosts_1_conservative_var = num_subghosts_conservative_var[ei][1];
+                const int num_subghosts_2_conservative_var = num_subghosts_conservative_var[ei][2];
+                const int subghostcell_dim_0_conservative_var = subghostcell_dims_conservative_var[ei][0];
+                const int subghostcell_dim_1_conservative_var = subghostcell_dims_conservative_var[ei][1];
+                
                 if (eqn_form[ei] == EQN_FORM::ADVECTIVE)
                 {
                     double* S = source->getPointer(ei);
@@ -1204,13 +1464,16 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
                     {
                         for (int j = 0; j < interior_dims[1]; j++)
                         {
+#ifdef HAMERS_ENABLE_SIMD
+                            #pragma omp simd
+#endif
                             for (int i = 0; i < interior_dims[0]; i++)
                             {
                                 // Compute the linear indices. 
-                                const int idx_cell_wghost = (i + num_subghosts_conservative_var[ei][0]) +
-                                    (j + num_subghosts_conservative_var[ei][1])*subghostcell_dims_conservative_var[ei][0] +
-                                    (k + num_subghosts_conservative_var[ei][2])*subghostcell_dims_conservative_var[ei][0]*
-                                        subghostcell_dims_conservative_var[ei][1];
+                                const int idx_cell_wghost = (i + num_subghosts_0_conservative_var) +
+                                    (j + num_subghosts_1_conservative_var)*subghostcell_dim_0_conservative_var +
+                                    (k + num_subghosts_2_conservative_var)*subghostcell_dim_0_conservative_var*
+                                        subghostcell_dim_1_conservative_var;
                                 
                                 const int idx_cell_nghost = i +
                                     j*interior_dims[0] +
@@ -1262,7 +1525,10 @@ ConvectiveFluxReconstructorFirstOrderLLF::computeConvectiveFluxAndSourceOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     }
 }
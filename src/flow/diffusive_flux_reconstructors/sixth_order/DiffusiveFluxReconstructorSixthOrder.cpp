@@ -1,8 +1,7 @@
 #include "flow/diffusive_flux_reconstructors/sixth_order/DiffusiveFluxReconstructorSixthOrder.hpp"
 
 #include "SAMRAI/geom/CartesianPatchGeometry.h"
-
-#include <map>
+#include "SAMRAI/tbox/MathUtilities.h"
 
 DiffusiveFluxReconstructorSixthOrder::DiffusiveFluxReconstructorSixthOrder(
     const std::string& object_name,
@@ -56,6 +55,19 @@ DiffusiveFluxReconstructorSixthOrder::putToRestart(
 }
 
 
+/*
+ * Register the derived cell variables required by the diffusive flux in the flow model.
+ */
+void
+DiffusiveFluxReconstructorSixthOrder::registerDerivedVariablesForDiffusiveFlux(
+    const hier::Patch& patch)
+{
+    NULL_USE(patch);
+    
+    d_flow_model->registerDiffusiveFlux(d_num_diff_ghosts);
+}
+
+
 /*
  * Compute the diffusive flux on a patch.
  */
@@ -95,8 +107,18 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
     TBOX_ASSERT(diffusive_flux->getGhostCellWidth() == hier::IntVector::getZero(d_dim));
 #endif
     
-    // Initialize the data of diffusive flux to zero.
-    diffusive_flux->fillAll(double(0));
+    // The diffusive flux on each face is set only once below, so the data is not initialized to
+    // zero. Fill it with signaling NaNs in debug mode to catch faces that are not set.
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    diffusive_flux->fillAll(tbox::MathUtilities<double>::getSignalingNaN());
+#endif
+    
+    /*
+     * Check whether the patch and the derived cell variables are already registered in the flow
+     * model by the caller, which then also unregisters the patch.
+     */
+    
+    const bool is_patch_registered = d_flow_model->hasRegisteredPatch();
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -112,11 +134,14 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        d_flow_model->registerDiffusiveFlux(d_num_diff_ghosts);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForDiffusiveFlux(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Delcare containers for computing fluxes in different directions.
@@ -130,13 +155,13 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         
         std::vector<std::vector<int> > diffusivities_component_idx_x;
         
-        std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > derivative_x;
-        
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_x_computed;
-        
         std::vector<boost::shared_ptr<pdat::CellData<double> > > diffusive_flux_node(1);
         diffusive_flux_node[0].reset(new pdat::CellData<double>(interior_box, d_num_eqn, d_num_diff_ghosts));
         
+        MemoryUsage::recordTemporaryData(
+            "Diffusive flux reconstructor temporary data",
+            MemoryUsage::getPatchDataSize(diffusive_flux_node[0])*diffusive_flux_node.size());
+        
         std::vector<double*> F_node_x;
         F_node_x.reserve(d_num_eqn);
         for (int ei = 0; ei < d_num_eqn; ei++)
@@ -167,64 +192,21 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         TBOX_ASSERT(static_cast<int>(diffusivities_data_x.size()) == d_num_eqn);
         TBOX_ASSERT(static_cast<int>(diffusivities_component_idx_x.size()) == d_num_eqn);
         
-        /*
-         * Compute the derivatives in x-direction for diffusive flux in x-direction.
-         */
-        
-        computeFirstDerivativesInX(
-            patch,
-            derivative_x,
-            derivative_x_computed,
-            var_data_x,
-            var_component_idx_x);
-        
         /*
          * Compute diffusive flux in x-direction at nodes.
          */
         
         diffusive_flux_node[0]->fillAll(double(0));
         
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            TBOX_ASSERT(static_cast<int>(derivative_x[ei].size()) ==
-                        static_cast<int>(diffusivities_data_x[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_x[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_x[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_x[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_x[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudx = derivative_x[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostCellWidth();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = -3; i < interior_dim_0 + 3; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx = i + num_diff_ghosts_0;
-                    const int idx_diffusivity = i + num_subghosts_0_diffusivity;
-                    
-                    F_node_x[ei][idx] += mu[idx_diffusivity]*dudx[idx];
-                }
-            }
-        }
+        addDiffusiveFluxAtNodes(
+            patch,
+            F_node_x,
+            DIRECTION::X_DIRECTION,
+            DIRECTION::X_DIRECTION,
+            var_data_x,
+            var_component_idx_x,
+            diffusivities_data_x,
+            diffusivities_component_idx_x);
         
         /*
          * Reconstruct the flux in x-direction.
@@ -248,7 +230,7 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
                 const int idx_node_RR  = i + 1 + num_diff_ghosts_0;
                 const int idx_node_RRR = i + 2 + num_diff_ghosts_0;
                 
-                F_face_x[idx_face_x] += dt*(
+                F_face_x[idx_face_x] = dt*(
                     double(37)/double(60)*(F_node_x[ei][idx_node_L] + F_node_x[ei][idx_node_R]) +
                     double(-2)/double(15)*(F_node_x[ei][idx_node_LL] + F_node_x[ei][idx_node_RR]) +
                     double(1)/double(60)*(F_node_x[ei][idx_node_LLL] + F_node_x[ei][idx_node_RRR]));
@@ -259,13 +241,15 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         diffusivities_data_x.clear();
         var_component_idx_x.clear();
         diffusivities_component_idx_x.clear();
-        derivative_x.clear();
         
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(1))
     else if (d_dim == tbox::Dimension(2))
@@ -286,11 +270,14 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        d_flow_model->registerDiffusiveFlux(d_num_diff_ghosts);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForDiffusiveFlux(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Delcare containers for computing fluxes in different directions.
@@ -308,16 +295,14 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         std::vector<std::vector<int> > diffusivities_component_idx_x;
         std::vector<std::vector<int> > diffusivities_component_idx_y;
         
-        std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > derivative_x;
-        std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > derivative_y;
-        
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_x_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_y_computed;
-        
         std::vector<boost::shared_ptr<pdat::CellData<double> > > diffusive_flux_node(2);
         diffusive_flux_node[0].reset(new pdat::CellData<double>(interior_box, d_num_eqn, d_num_diff_ghosts));
         diffusive_flux_node[1].reset(new pdat::CellData<double>(interior_box, d_num_eqn, d_num_diff_ghosts));
         
+        MemoryUsage::recordTemporaryData(
+            "Diffusive flux reconstructor temporary data",
+            MemoryUsage::getPatchDataSize(diffusive_flux_node[0])*diffusive_flux_node.size());
+        
         std::vector<double*> F_node_x;
         std::vector<double*> F_node_y;
         F_node_x.reserve(d_num_eqn);
@@ -368,135 +353,30 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         TBOX_ASSERT(static_cast<int>(diffusivities_component_idx_y.size()) == d_num_eqn);
         
         /*
-         * Compute the derivatives in x-direction for diffusive flux in x-direction.
+         * Compute diffusive flux in x-direction at nodes.
          */
         
-        computeFirstDerivativesInX(
+        diffusive_flux_node[0]->fillAll(double(0));
+        
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_x,
-            derivative_x_computed,
+            F_node_x,
+            DIRECTION::X_DIRECTION,
+            DIRECTION::X_DIRECTION,
             var_data_x,
-            var_component_idx_x);
-        
-        /*
-         * Compute the derivatives in y-direction for diffusive flux in x-direction.
-         */
+            var_component_idx_x,
+            diffusivities_data_x,
+            diffusivities_component_idx_x);
         
-        computeFirstDerivativesInY(
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_y,
-            derivative_y_computed,
+            F_node_x,
+            DIRECTION::X_DIRECTION,
+            DIRECTION::Y_DIRECTION,
             var_data_y,
-            var_component_idx_y);
-        
-        /*
-         * Compute diffusive flux in x-direction at nodes.
-         */
-        
-        diffusive_flux_node[0]->fillAll(double(0));
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            TBOX_ASSERT(static_cast<int>(derivative_x[ei].size()) ==
-                        static_cast<int>(diffusivities_data_x[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_x[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_x[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_x[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_x[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudx = derivative_x[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -3; i < interior_dim_0 + 3; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx = (i + num_diff_ghosts_0) +
-                            (j + num_diff_ghosts_1)*diff_ghostcell_dim_0;
-                        
-                        const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                            (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity;
-                        
-                        F_node_x[ei][idx] += mu[idx_diffusivity]*dudx[idx];
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivative_y[ei].size()) ==
-                        static_cast<int>(diffusivities_data_y[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_y[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_y[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_y[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_y[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_y[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudy = derivative_y[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -3; i < interior_dim_0 + 3; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx = (i + num_diff_ghosts_0) +
-                            (j + num_diff_ghosts_1)*diff_ghostcell_dim_0;
-                        
-                        const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                            (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity;
-                        
-                        F_node_x[ei][idx] += mu[idx_diffusivity]*dudy[idx];
-                    }
-                }
-            }
-        }
+            var_component_idx_y,
+            diffusivities_data_y,
+            diffusivities_component_idx_y);
         
         /*
          * Reconstruct the flux in x-direction.
@@ -535,7 +415,7 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
                     const int idx_node_RRR = (i + 2 + num_diff_ghosts_0) +
                         (j + num_diff_ghosts_1)*diff_ghostcell_dim_0;
                     
-                    F_face_x[idx_face_x] += dt*(
+                    F_face_x[idx_face_x] = dt*(
                         double(37)/double(60)*(F_node_x[ei][idx_node_L] + F_node_x[ei][idx_node_R]) +
                         double(-2)/double(15)*(F_node_x[ei][idx_node_LL] + F_node_x[ei][idx_node_RR]) +
                         double(1)/double(60)*(F_node_x[ei][idx_node_LLL] + F_node_x[ei][idx_node_RRR]));
@@ -555,9 +435,6 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         diffusivities_component_idx_x.clear();
         diffusivities_component_idx_y.clear();
         
-        derivative_x.clear();
-        derivative_y.clear();
-        
         /*
          * (2) Compute the flux in the y-direction.
          */
@@ -598,135 +475,30 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         TBOX_ASSERT(static_cast<int>(diffusivities_component_idx_y.size()) == d_num_eqn);
         
         /*
-         * Compute the derivatives in x-direction for diffusive flux in y-direction.
+         * Compute diffusive flux in y-direction at nodes.
          */
         
-        computeFirstDerivativesInX(
+        diffusive_flux_node[1]->fillAll(double(0));
+        
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_x,
-            derivative_x_computed,
+            F_node_y,
+            DIRECTION::Y_DIRECTION,
+            DIRECTION::X_DIRECTION,
             var_data_x,
-            var_component_idx_x);
-        
-        /*
-         * Compute the derivatives in y-direction for diffusive flux in y-direction.
-         */
+            var_component_idx_x,
+            diffusivities_data_x,
+            diffusivities_component_idx_x);
         
-        computeFirstDerivativesInY(
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_y,
-            derivative_y_computed,
+            F_node_y,
+            DIRECTION::Y_DIRECTION,
+            DIRECTION::Y_DIRECTION,
             var_data_y,
-            var_component_idx_y);
-        
-        /*
-         * Compute diffusive flux in y-direction at nodes.
-         */
-        
-        diffusive_flux_node[1]->fillAll(double(0));
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            TBOX_ASSERT(static_cast<int>(derivative_x[ei].size()) ==
-                        static_cast<int>(diffusivities_data_x[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_x[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_x[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_x[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_x[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudx = derivative_x[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                
-                for (int j = -3; j < interior_dim_1 + 3; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx = (i + num_diff_ghosts_0) +
-                            (j + num_diff_ghosts_1)*diff_ghostcell_dim_0;
-                        
-                        const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                            (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity;
-                        
-                        F_node_y[ei][idx] += mu[idx_diffusivity]*dudx[idx];
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivative_y[ei].size()) ==
-                        static_cast<int>(diffusivities_data_y[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_y[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_y[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_y[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_y[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_y[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudy = derivative_y[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                
-                for (int j = -3; j < interior_dim_1 + 3; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx = (i + num_diff_ghosts_0) +
-                            (j + num_diff_ghosts_1)*diff_ghostcell_dim_0;
-                        
-                        const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                            (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity;
-                        
-                        F_node_y[ei][idx] += mu[idx_diffusivity]*dudy[idx];
-                    }
-                }
-            }
-        }
+            var_component_idx_y,
+            diffusivities_data_y,
+            diffusivities_component_idx_y);
         
         /*
          * Reconstruct the flux in y-direction.
@@ -765,7 +537,7 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
                     const int idx_node_TTT = (i + num_diff_ghosts_0) +
                         (j + 2 + num_diff_ghosts_1)*diff_ghostcell_dim_0;
                     
-                    F_face_y[idx_face_y] += dt*(
+                    F_face_y[idx_face_y] = dt*(
                         double(37)/double(60)*(F_node_y[ei][idx_node_B] + F_node_y[ei][idx_node_T]) +
                         double(-2)/double(15)*(F_node_y[ei][idx_node_BB] + F_node_y[ei][idx_node_TT]) +
                         double(1)/double(60)*(F_node_y[ei][idx_node_BBB] + F_node_y[ei][idx_node_TTT]));
@@ -785,14 +557,14 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         diffusivities_component_idx_x.clear();
         diffusivities_component_idx_y.clear();
         
-        derivative_x.clear();
-        derivative_y.clear();
-        
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
         
     } // if (d_dim == tbox::Dimension(2))
     else if (d_dim == tbox::Dimension(3))
@@ -816,11 +588,14 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        d_flow_model->registerDiffusiveFlux(d_num_diff_ghosts);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForDiffusiveFlux(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Delcare containers for computing fluxes in different directions.
@@ -842,19 +617,15 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         std::vector<std::vector<int> > diffusivities_component_idx_y;
         std::vector<std::vector<int> > diffusivities_component_idx_z;
         
-        std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > derivative_x;
-        std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > derivative_y;
-        std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > derivative_z;
-        
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_x_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_y_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_z_computed;
-        
         std::vector<boost::shared_ptr<pdat::CellData<double> > > diffusive_flux_node(3);
         diffusive_flux_node[0].reset(new pdat::CellData<double>(interior_box, d_num_eqn, d_num_diff_ghosts));
         diffusive_flux_node[1].reset(new pdat::CellData<double>(interior_box, d_num_eqn, d_num_diff_ghosts));
         diffusive_flux_node[2].reset(new pdat::CellData<double>(interior_box, d_num_eqn, d_num_diff_ghosts));
         
+        MemoryUsage::recordTemporaryData(
+            "Diffusive flux reconstructor temporary data",
+            MemoryUsage::getPatchDataSize(diffusive_flux_node[0])*diffusive_flux_node.size());
+        
         std::vector<double*> F_node_x;
         std::vector<double*> F_node_y;
         std::vector<double*> F_node_z;
@@ -924,223 +695,40 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         TBOX_ASSERT(static_cast<int>(diffusivities_component_idx_z.size()) == d_num_eqn);
         
         /*
-         * Compute the derivatives in x-direction for diffusive flux in x-direction.
+         * Compute diffusive flux in x-direction at nodes.
          */
         
-        computeFirstDerivativesInX(
-            patch,
-            derivative_x,
-            derivative_x_computed,
-            var_data_x,
-            var_component_idx_x);
+        diffusive_flux_node[0]->fillAll(double(0));
         
-        /*
-         * Compute the derivatives in y-direction for diffusive flux in x-direction.
-         */
+        addDiffusiveFluxAtNodes(
+            patch,
+            F_node_x,
+            DIRECTION::X_DIRECTION,
+            DIRECTION::X_DIRECTION,
+            var_data_x,
+            var_component_idx_x,
+            diffusivities_data_x,
+            diffusivities_component_idx_x);
         
-        computeFirstDerivativesInY(
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_y,
-            derivative_y_computed,
+            F_node_x,
+            DIRECTION::X_DIRECTION,
+            DIRECTION::Y_DIRECTION,
             var_data_y,
-            var_component_idx_y);
-        
-        /*
-         * Compute the derivatives in z-direction for diffusive flux in x-direction.
-         */
+            var_component_idx_y,
+            diffusivities_data_y,
+            diffusivities_component_idx_y);
         
-        computeFirstDerivativesInZ(
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_z,
-            derivative_z_computed,
+            F_node_x,
+            DIRECTION::X_DIRECTION,
+            DIRECTION::Z_DIRECTION,
             var_data_z,
-            var_component_idx_z);
-        
-        /*
-         * Compute diffusive flux in x-direction at nodes.
-         */
-        
-        diffusive_flux_node[0]->fillAll(double(0));
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            TBOX_ASSERT(static_cast<int>(derivative_x[ei].size()) ==
-                        static_cast<int>(diffusivities_data_x[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_x[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_x[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_x[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_x[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudx = derivative_x[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = -3; i < interior_dim_0 + 3; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_node_x[ei][idx] += mu[idx_diffusivity]*dudx[idx];
-                        }
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivative_y[ei].size()) ==
-                        static_cast<int>(diffusivities_data_y[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_y[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_y[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_y[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_y[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_y[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudy = derivative_y[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = -3; i < interior_dim_0 + 3; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_node_x[ei][idx] += mu[idx_diffusivity]*dudy[idx];
-                        }
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivative_z[ei].size()) ==
-                        static_cast<int>(diffusivities_data_z[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_z[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_z[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_z[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_z[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_z[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudz = derivative_z[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = -3; i < interior_dim_0 + 3; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_node_x[ei][idx] += mu[idx_diffusivity]*dudz[idx];
-                        }
-                    }
-                }
-            }
-        }
+            var_component_idx_z,
+            diffusivities_data_z,
+            diffusivities_component_idx_z);
         
         /*
          * Reconstruct the flux in x-direction.
@@ -1194,7 +782,7 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
                             (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
                                 diff_ghostcell_dim_1;
                         
-                        F_face_x[idx_face_x] += dt*(
+                        F_face_x[idx_face_x] = dt*(
                             double(37)/double(60)*(F_node_x[ei][idx_node_L] + F_node_x[ei][idx_node_R]) +
                             double(-2)/double(15)*(F_node_x[ei][idx_node_LL] + F_node_x[ei][idx_node_RR]) +
                             double(1)/double(60)*(F_node_x[ei][idx_node_LLL] + F_node_x[ei][idx_node_RRR]));
@@ -1219,10 +807,6 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         diffusivities_component_idx_y.clear();
         diffusivities_component_idx_z.clear();
         
-        derivative_x.clear();
-        derivative_y.clear();
-        derivative_z.clear();
-        
         /*
          * (2) Compute the flux in the y-direction.
          */
@@ -1279,280 +863,97 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         TBOX_ASSERT(static_cast<int>(diffusivities_component_idx_z.size()) == d_num_eqn);
         
         /*
-         * Compute the derivatives in x-direction for diffusive flux in y-direction.
+         * Compute diffusive flux in y-direction at nodes.
          */
         
-        computeFirstDerivativesInX(
+        diffusive_flux_node[1]->fillAll(double(0));
+        
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_x,
-            derivative_x_computed,
+            F_node_y,
+            DIRECTION::Y_DIRECTION,
+            DIRECTION::X_DIRECTION,
             var_data_x,
-            var_component_idx_x);
-        
-        /*
-         * Compute the derivatives in y-direction for diffusive flux in y-direction.
-         */
+            var_component_idx_x,
+            diffusivities_data_x,
+            diffusivities_component_idx_x);
         
-        computeFirstDerivativesInY(
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_y,
-            derivative_y_computed,
+            F_node_y,
+            DIRECTION::Y_DIRECTION,
+            DIRECTION::Y_DIRECTION,
             var_data_y,
-            var_component_idx_y);
-        
-        /*
-         * Compute the derivatives in z-direction for diffusive flux in y-direction.
-         */
+            var_component_idx_y,
+            diffusivities_data_y,
+            diffusivities_component_idx_y);
         
-        computeFirstDerivativesInZ(
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_z,
-            derivative_z_computed,
+            F_node_y,
+            DIRECTION::Y_DIRECTION,
+            DIRECTION::Z_DIRECTION,
             var_data_z,
-            var_component_idx_z);
+            var_component_idx_z,
+            diffusivities_data_z,
+            diffusivities_component_idx_z);
         
         /*
-         * Compute diffusive flux in y-direction at nodes.
+         * Reconstruct the flux in y-direction.
          */
         
-        diffusive_flux_node[1]->fillAll(double(0));
-        
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            TBOX_ASSERT(static_cast<int>(derivative_x[ei].size()) ==
-                        static_cast<int>(diffusivities_data_x[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_x[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_x[ei].size()));
+            double* F_face_y = diffusive_flux->getPointer(1, ei);
             
-            for (int vi = 0; vi < static_cast<int>(var_data_x[ei].size()); vi++)
+            for (int k = 0; k < interior_dim_2; k++)
             {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_x[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_x[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudx = derivative_x[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
+                for (int j = 0; j < interior_dim_1 + 1; j++)
                 {
-                    for (int j = -3; j < interior_dim_1 + 3; j++)
-                    {
 #ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
+                    #pragma omp simd
 #endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_node_y[ei][idx] += mu[idx_diffusivity]*dudx[idx];
-                        }
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivative_y[ei].size()) ==
-                        static_cast<int>(diffusivities_data_y[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_y[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_y[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_y[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_y[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_y[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudy = derivative_y[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = -3; j < interior_dim_1 + 3; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_node_y[ei][idx] += mu[idx_diffusivity]*dudy[idx];
-                        }
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivative_z[ei].size()) ==
-                        static_cast<int>(diffusivities_data_z[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_z[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_z[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_z[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_z[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_z[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudz = derivative_z[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = -3; j < interior_dim_1 + 3; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_node_y[ei][idx] += mu[idx_diffusivity]*dudz[idx];
-                        }
-                    }
-                }
-            }
-        }
-        
-        /*
-         * Reconstruct the flux in y-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            double* F_face_y = diffusive_flux->getPointer(1, ei);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_face_y = i +
-                            j*interior_dim_0 +
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_node_BBB = (i + num_diff_ghosts_0) +
-                            (j - 3 + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                diff_ghostcell_dim_1;
-                        
-                        const int idx_node_BB = (i + num_diff_ghosts_0) +
-                            (j - 2 + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                diff_ghostcell_dim_1;
-                        
-                        const int idx_node_B = (i + num_diff_ghosts_0) +
-                            (j - 1 + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                diff_ghostcell_dim_1;
-                        
-                        const int idx_node_T = (i + num_diff_ghosts_0) +
-                            (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                diff_ghostcell_dim_1;
-                        
-                        const int idx_node_TT = (i + num_diff_ghosts_0) +
-                            (j + 1 + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                diff_ghostcell_dim_1;
-                        
-                        const int idx_node_TTT = (i + num_diff_ghosts_0) +
-                            (j + 2 + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                diff_ghostcell_dim_1;
-                        
-                        F_face_y[idx_face_y] += dt*(
-                            double(37)/double(60)*(F_node_y[ei][idx_node_B] + F_node_y[ei][idx_node_T]) +
-                            double(-2)/double(15)*(F_node_y[ei][idx_node_BB] + F_node_y[ei][idx_node_TT]) +
-                            double(1)/double(60)*(F_node_y[ei][idx_node_BBB] + F_node_y[ei][idx_node_TTT]));
+                    for (int i = 0; i < interior_dim_0; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_face_y = i +
+                            j*interior_dim_0 +
+                            k*interior_dim_0*(interior_dim_1 + 1);
+                        
+                        const int idx_node_BBB = (i + num_diff_ghosts_0) +
+                            (j - 3 + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
+                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
+                                diff_ghostcell_dim_1;
+                        
+                        const int idx_node_BB = (i + num_diff_ghosts_0) +
+                            (j - 2 + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
+                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
+                                diff_ghostcell_dim_1;
+                        
+                        const int idx_node_B = (i + num_diff_ghosts_0) +
+                            (j - 1 + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
+                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
+                                diff_ghostcell_dim_1;
+                        
+                        const int idx_node_T = (i + num_diff_ghosts_0) +
+                            (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
+                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
+                                diff_ghostcell_dim_1;
+                        
+                        const int idx_node_TT = (i + num_diff_ghosts_0) +
+                            (j + 1 + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
+                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
+                                diff_ghostcell_dim_1;
+                        
+                        const int idx_node_TTT = (i + num_diff_ghosts_0) +
+                            (j + 2 + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
+                            (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
+                                diff_ghostcell_dim_1;
+                        
+                        F_face_y[idx_face_y] = dt*(
+                            double(37)/double(60)*(F_node_y[ei][idx_node_B] + F_node_y[ei][idx_node_T]) +
+                            double(-2)/double(15)*(F_node_y[ei][idx_node_BB] + F_node_y[ei][idx_node_TT]) +
+                            double(1)/double(60)*(F_node_y[ei][idx_node_BBB] + F_node_y[ei][idx_node_TTT]));
                     }
                 }
             }
@@ -1574,10 +975,6 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         diffusivities_component_idx_y.clear();
         diffusivities_component_idx_z.clear();
         
-        derivative_x.clear();
-        derivative_y.clear();
-        derivative_z.clear();
-        
         /*
          * (3) Compute the flux in the z-direction.
          */
@@ -1634,223 +1031,40 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
         TBOX_ASSERT(static_cast<int>(diffusivities_component_idx_z.size()) == d_num_eqn);
         
         /*
-         * Compute the derivatives in x-direction for diffusive flux in z-direction.
+         * Compute diffusive flux in z-direction at nodes.
          */
         
-        computeFirstDerivativesInX(
+        diffusive_flux_node[2]->fillAll(double(0));
+        
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_x,
-            derivative_x_computed,
+            F_node_z,
+            DIRECTION::Z_DIRECTION,
+            DIRECTION::X_DIRECTION,
             var_data_x,
-            var_component_idx_x);
-        
-        /*
-         * Compute the derivatives in y-direction for diffusive flux in z-direction.
-         */
+            var_component_idx_x,
+            diffusivities_data_x,
+            diffusivities_component_idx_x);
         
-        computeFirstDerivativesInY(
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_y,
-            derivative_y_computed,
+            F_node_z,
+            DIRECTION::Z_DIRECTION,
+            DIRECTION::Y_DIRECTION,
             var_data_y,
-            var_component_idx_y);
-        
-        /*
-         * Compute the derivatives in z-direction for diffusive flux in z-direction.
-         */
+            var_component_idx_y,
+            diffusivities_data_y,
+            diffusivities_component_idx_y);
         
-        computeFirstDerivativesInZ(
+        addDiffusiveFluxAtNodes(
             patch,
-            derivative_z,
-            derivative_z_computed,
+            F_node_z,
+            DIRECTION::Z_DIRECTION,
+            DIRECTION::Z_DIRECTION,
             var_data_z,
-            var_component_idx_z);
-        
-        /*
-         * Compute diffusive flux in z-direction at nodes.
-         */
-        
-        diffusive_flux_node[2]->fillAll(double(0));
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            TBOX_ASSERT(static_cast<int>(derivative_x[ei].size()) ==
-                        static_cast<int>(diffusivities_data_x[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_x[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_x[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_x[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_x[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudx = derivative_x[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = -3; k < interior_dim_2 + 3; k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_node_z[ei][idx] += mu[idx_diffusivity]*dudx[idx];
-                        }
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivative_y[ei].size()) ==
-                        static_cast<int>(diffusivities_data_y[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_y[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_y[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_y[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_y[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_y[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudy = derivative_y[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = -3; k < interior_dim_2 + 3; k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_node_z[ei][idx] += mu[idx_diffusivity]*dudy[idx];
-                        }
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivative_z[ei].size()) ==
-                        static_cast<int>(diffusivities_data_z[ei].size()));
-            
-            TBOX_ASSERT(static_cast<int>(diffusivities_data_z[ei].size()) ==
-                        static_cast<int>(diffusivities_component_idx_z[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(var_data_z[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_z[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_z[ei][vi]->getPointer(mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudz = derivative_z[ei][vi]->getPointer(0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = -3; k < interior_dim_2 + 3; k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_node_z[ei][idx] += mu[idx_diffusivity]*dudz[idx];
-                        }
-                    }
-                }
-            }
-        }
+            var_component_idx_z,
+            diffusivities_data_z,
+            diffusivities_component_idx_z);
         
         /*
          * Reconstruct the flux in z-direction.
@@ -1901,409 +1115,68 @@ DiffusiveFluxReconstructorSixthOrder::computeDiffusiveFluxOnPatch(
                         
                         const int idx_node_FFF = (i + num_diff_ghosts_0) +
                             (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                            (k + 2 + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                diff_ghostcell_dim_1;
-                        
-                        F_face_z[idx_face_z] += dt*(
-                            double(37)/double(60)*(F_node_z[ei][idx_node_B] + F_node_z[ei][idx_node_F]) +
-                            double(-2)/double(15)*(F_node_z[ei][idx_node_BB] + F_node_z[ei][idx_node_FF]) +
-                            double(1)/double(60)*(F_node_z[ei][idx_node_BBB] + F_node_z[ei][idx_node_FFF]));
-                    }
-                }
-            }
-        }
-        
-        var_data_x.clear();
-        var_data_y.clear();
-        var_data_z.clear();
-        
-        diffusivities_data_x.clear();
-        diffusivities_data_y.clear();
-        diffusivities_data_z.clear();
-        
-        var_component_idx_x.clear();
-        var_component_idx_y.clear();
-        var_component_idx_z.clear();
-        
-        diffusivities_component_idx_x.clear();
-        diffusivities_component_idx_y.clear();
-        diffusivities_component_idx_z.clear();
-        
-        derivative_x.clear();
-        derivative_y.clear();
-        derivative_z.clear();
-        
-        /*
-         * Unregister the patch and data of all registered derived cell variables in the flow model.
-         */
-        
-        d_flow_model->unregisterPatch();
-        
-    } // if (d_dim == tbox::Dimension(3))
-}
-
-
-/*
- * Compute the first derivatives in the x-direction.
- */
-void
-DiffusiveFluxReconstructorSixthOrder::computeFirstDerivativesInX(
-    hier::Patch& patch,
-    std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& derivative_x,
-    std::map<double*, boost::shared_ptr<pdat::CellData<double> > >& derivative_x_computed,
-    const std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& data_x,
-    const std::vector<std::vector<int> >& data_component_idx_x)
-{
-#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
-    for (int ei = 0; ei < d_num_eqn; ei++)
-    {
-        TBOX_ASSERT(static_cast<int>(data_x[ei].size()) ==
-                    static_cast<int>(data_component_idx_x[ei].size()));
-    }
-#endif
-    
-    derivative_x.resize(d_num_eqn);
-    
-    // Get the dimensions of box that covers the interior of patch.
-    hier::Box interior_box = patch.getBox();
-    const hier::IntVector interior_dims = interior_box.numberCells();
-    
-    // Get the dimensions of box that covers interior of patch plus
-    // diffusive ghost cells.
-    hier::Box diff_ghost_box = interior_box;
-    diff_ghost_box.grow(d_num_diff_ghosts);
-    const hier::IntVector diff_ghostcell_dims = diff_ghost_box.numberCells();
-    
-    // Get the grid spacing.
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    
-    const double* const dx = patch_geom->getDx();
-    
-    const double dx_0 = dx[0];
-    
-    if (d_dim == tbox::Dimension(1))
-    {
-        /*
-         * Get the dimensions and number of ghost cells.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        
-        const int num_diff_ghosts_0 = d_num_diff_ghosts[0];
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            derivative_x[ei].reserve(static_cast<int>(data_x[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int u_idx = data_component_idx_x[ei][vi];
-                
-                if (derivative_x_computed.find(data_x[ei][vi]->getPointer(u_idx))
-                    == derivative_x_computed.end())
-                {
-                    // Get the pointer to variable for derivative.
-                    double* u = data_x[ei][vi]->getPointer(u_idx);
-                    
-                    // Declare container to store the derivative.
-                    boost::shared_ptr<pdat::CellData<double> > derivative(
-                        new pdat::CellData<double>(
-                            interior_box, 1, d_num_diff_ghosts));
-                    
-                    // Get the pointer to the derivative.
-                    double* dudx = derivative->getPointer(0);
-                    
-                    /*
-                     * Get the sub-ghost cell width of the variable.
-                     */
-                    
-                    hier::IntVector num_subghosts_data =
-                        data_x[ei][vi]->getGhostCellWidth();
-                    
-                    const int num_subghosts_0_data = num_subghosts_data[0];
-                    
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -3; i < interior_dim_0 + 3; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx = i + num_diff_ghosts_0;
-                        
-                        const int idx_data_LLL = i - 3 + num_subghosts_0_data;
-                        const int idx_data_LL  = i - 2 + num_subghosts_0_data;
-                        const int idx_data_L   = i - 1 + num_subghosts_0_data;
-                        const int idx_data_R   = i + 1 + num_subghosts_0_data;
-                        const int idx_data_RR  = i + 2 + num_subghosts_0_data;
-                        const int idx_data_RRR = i + 3 + num_subghosts_0_data;
-                        
-                        dudx[idx] = (double(3)/double(4)*(u[idx_data_R] - u[idx_data_L]) +
-                                     double(-3)/double(20)*(u[idx_data_RR] - u[idx_data_LL]) +
-                                     double(1)/double(60)*(u[idx_data_RRR] - u[idx_data_LLL]))/
-                                        dx_0;
-                    }
-                    
-                    std::pair<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_pair(
-                        u,
-                        derivative);
-                    
-                    derivative_x_computed.insert(derivative_pair);
-                }
-                
-                derivative_x[ei].push_back(
-                    derivative_x_computed.find(data_x[ei][vi]->getPointer(u_idx))->
-                        second);
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(2))
-    {
-        /*
-         * Get the dimensions and number of ghost cells.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        const int num_diff_ghosts_0 = d_num_diff_ghosts[0];
-        const int num_diff_ghosts_1 = d_num_diff_ghosts[1];
-        
-        const int diff_ghostcell_dim_0 = diff_ghostcell_dims[0];
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            derivative_x[ei].reserve(static_cast<int>(data_x[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int u_idx = data_component_idx_x[ei][vi];
-                
-                if (derivative_x_computed.find(data_x[ei][vi]->getPointer(u_idx))
-                    == derivative_x_computed.end())
-                {
-                    // Get the pointer to variable for derivative.
-                    double* u = data_x[ei][vi]->getPointer(u_idx);
-                    
-                    // Declare container to store the derivative.
-                    boost::shared_ptr<pdat::CellData<double> > derivative(
-                        new pdat::CellData<double>(
-                            interior_box, 1, d_num_diff_ghosts));
-                    
-                    // Get the pointer to the derivative.
-                    double* dudx = derivative->getPointer(0);
-                    
-                    /*
-                     * Get the sub-ghost cell width and ghost box dimensions of the variable.
-                     */
-                    
-                    hier::IntVector num_subghosts_data =
-                        data_x[ei][vi]->getGhostCellWidth();
-                    
-                    hier::IntVector subghostcell_dims_data =
-                        data_x[ei][vi]->getGhostBox().numberCells();
-                    
-                    const int num_subghosts_0_data = num_subghosts_data[0];
-                    const int num_subghosts_1_data = num_subghosts_data[1];
-                    const int subghostcell_dim_0_data = subghostcell_dims_data[0];
-                    
-                    for (int j = -3; j < interior_dim_1 + 3; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = -3; i < interior_dim_0 + 3; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0;
-                            
-                            const int idx_data_LLL = (i - 3 + num_subghosts_0_data) +
-                                (j + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            const int idx_data_LL = (i - 2 + num_subghosts_0_data) +
-                                (j + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            const int idx_data_L = (i - 1 + num_subghosts_0_data) +
-                                (j + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            const int idx_data_R = (i + 1 + num_subghosts_0_data) +
-                                (j + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            const int idx_data_RR = (i + 2 + num_subghosts_0_data) +
-                                (j + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            const int idx_data_RRR = (i + 3 + num_subghosts_0_data) +
-                                (j + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            dudx[idx] = (double(3)/double(4)*(u[idx_data_R] - u[idx_data_L]) +
-                                         double(-3)/double(20)*(u[idx_data_RR] - u[idx_data_LL]) +
-                                         double(1)/double(60)*(u[idx_data_RRR] - u[idx_data_LLL]))/
-                                            dx_0;
-                        }
+                            (k + 2 + num_diff_ghosts_2)*diff_ghostcell_dim_0*
+                                diff_ghostcell_dim_1;
+                        
+                        F_face_z[idx_face_z] = dt*(
+                            double(37)/double(60)*(F_node_z[ei][idx_node_B] + F_node_z[ei][idx_node_F]) +
+                            double(-2)/double(15)*(F_node_z[ei][idx_node_BB] + F_node_z[ei][idx_node_FF]) +
+                            double(1)/double(60)*(F_node_z[ei][idx_node_BBB] + F_node_z[ei][idx_node_FFF]));
                     }
-                    
-                    std::pair<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_pair(
-                        u,
-                        derivative);
-                    
-                    derivative_x_computed.insert(derivative_pair);
                 }
-                
-                derivative_x[ei].push_back(
-                    derivative_x_computed.find(data_x[ei][vi]->getPointer(u_idx))->
-                        second);
             }
         }
-    }
-    else if (d_dim == tbox::Dimension(3))
-    {
-        /*
-         * Get the dimensions and number of ghost cells.
-         */
         
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
+        var_data_x.clear();
+        var_data_y.clear();
+        var_data_z.clear();
         
-        const int num_diff_ghosts_0 = d_num_diff_ghosts[0];
-        const int num_diff_ghosts_1 = d_num_diff_ghosts[1];
-        const int num_diff_ghosts_2 = d_num_diff_ghosts[2];
+        diffusivities_data_x.clear();
+        diffusivities_data_y.clear();
+        diffusivities_data_z.clear();
         
-        const int diff_ghostcell_dim_0 = diff_ghostcell_dims[0];
-        const int diff_ghostcell_dim_1 = diff_ghostcell_dims[1];
+        var_component_idx_x.clear();
+        var_component_idx_y.clear();
+        var_component_idx_z.clear();
         
-        for (int ei = 0; ei < d_num_eqn; ei++)
+        diffusivities_component_idx_x.clear();
+        diffusivities_component_idx_y.clear();
+        diffusivities_component_idx_z.clear();
+        
+        /*
+         * Unregister the patch and data of all registered derived cell variables in the flow model.
+         */
+        
+        if (!is_patch_registered)
         {
-            derivative_x[ei].reserve(static_cast<int>(data_x[ei].size()));
-            
-            for (int vi = 0; vi < static_cast<int>(data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int u_idx = data_component_idx_x[ei][vi];
-                
-                if (derivative_x_computed.find(data_x[ei][vi]->getPointer(u_idx))
-                    == derivative_x_computed.end())
-                {
-                    // Get the pointer to variable for derivative.
-                    double* u = data_x[ei][vi]->getPointer(u_idx);
-                    
-                    // Declare container to store the derivative.
-                    boost::shared_ptr<pdat::CellData<double> > derivative(
-                        new pdat::CellData<double>(
-                            interior_box, 1, d_num_diff_ghosts));
-                    
-                    // Get the pointer to the derivative.
-                    double* dudx = derivative->getPointer(0);
-                    
-                    /*
-                     * Get the sub-ghost cell width and ghost box dimensions of the variable.
-                     */
-                    
-                    hier::IntVector num_subghosts_data =
-                        data_x[ei][vi]->getGhostCellWidth();
-                    
-                    hier::IntVector subghostcell_dims_data =
-                        data_x[ei][vi]->getGhostBox().numberCells();
-                    
-                    const int num_subghosts_0_data = num_subghosts_data[0];
-                    const int num_subghosts_1_data = num_subghosts_data[1];
-                    const int num_subghosts_2_data = num_subghosts_data[2];
-                    const int subghostcell_dim_0_data = subghostcell_dims_data[0];
-                    const int subghostcell_dim_1_data = subghostcell_dims_data[1];
-                    
-                    for (int k = -3; k < interior_dim_2 + 3; k++)
-                    {
-                        for (int j = -3; j < interior_dim_1 + 3; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = -3; i < interior_dim_0 + 3; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx = (i + num_diff_ghosts_0) +
-                                    (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                    (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                        diff_ghostcell_dim_1;
-                                
-                                const int idx_data_LLL = (i - 3 + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_LL = (i - 2 + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_L = (i - 1 + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_R = (i + 1 + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_RR = (i + 2 + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_RRR = (i + 3 + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                dudx[idx] = (double(3)/double(4)*(u[idx_data_R] - u[idx_data_L]) +
-                                             double(-3)/double(20)*(u[idx_data_RR] - u[idx_data_LL]) +
-                                             double(1)/double(60)*(u[idx_data_RRR] - u[idx_data_LLL]))/
-                                                dx_0;
-                            }
-                        }
-                    }
-                    
-                    std::pair<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_pair(
-                        u,
-                        derivative);
-                    
-                    derivative_x_computed.insert(derivative_pair);
-                }
-                
-                derivative_x[ei].push_back(
-                    derivative_x_computed.find(data_x[ei][vi]->getPointer(u_idx))->
-                        second);
-            }
+            d_flow_model->unregisterPatch();
         }
-    }
+        
+    } // if (d_dim == tbox::Dimension(3))
 }
 
 
 /*
- * Compute the first derivatives in the y-direction.
+ * Add the products of the diffusivities and the first derivatives in a direction to the diffusive
+ * flux in a direction at the nodes. The sixth-order first derivatives are evaluated from the
+ * variables inside the loop that accumulates the node flux, so that no derivative is stored.
  */
 void
-DiffusiveFluxReconstructorSixthOrder::computeFirstDerivativesInY(
+DiffusiveFluxReconstructorSixthOrder::addDiffusiveFluxAtNodes(
     hier::Patch& patch,
-    std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& derivative_y,
-    std::map<double*, boost::shared_ptr<pdat::CellData<double> > >& derivative_y_computed,
-    const std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& data_y,
-    const std::vector<std::vector<int> >& data_component_idx_y)
+    std::vector<double*>& F_node,
+    const DIRECTION::TYPE& flux_direction,
+    const DIRECTION::TYPE& derivative_direction,
+    const std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& data,
+    const std::vector<std::vector<int> >& data_component_idx,
+    const std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& diffusivities_data,
+    const std::vector<std::vector<int> >& diffusivities_component_idx)
 {
-#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
-    for (int ei = 0; ei < d_num_eqn; ei++)
-    {
-        TBOX_ASSERT(static_cast<int>(data_y[ei].size()) ==
-                    static_cast<int>(data_component_idx_y[ei].size()));
-    }
-#endif
-    
-    derivative_y.resize(d_num_eqn);
+    TBOX_ASSERT(static_cast<int>(F_node.size()) == d_num_eqn);
+    TBOX_ASSERT(static_cast<int>(data.size()) == d_num_eqn);
+    TBOX_ASSERT(static_cast<int>(data_component_idx.size()) == d_num_eqn);
+    TBOX_ASSERT(static_cast<int>(diffusivities_data.size()) == d_num_eqn);
+    TBOX_ASSERT(static_cast<int>(diffusivities_component_idx.size()) == d_num_eqn);
     
     // Get the dimensions of box that covers the interior of patch.
     hier::Box interior_box = patch.getBox();
@@ -2322,307 +1195,192 @@ DiffusiveFluxReconstructorSixthOrder::computeFirstDerivativesInY(
     
     const double* const dx = patch_geom->getDx();
     
-    const double dx_1 = dx[1];
+    /*
+     * Get the index of the direction of the derivative and the range of the nodes. The nodes extend
+     * three cells outside the interior in the direction of the flux for the midpoint interpolation.
+     */
     
-    if (d_dim == tbox::Dimension(1))
+    int derivative_dir = 0;
+    if (derivative_direction == DIRECTION::Y_DIRECTION)
     {
-        TBOX_ERROR(d_object_name
-            << ": DiffusiveFluxReconstructorSixthOrder::"
-            << "computeFirstDerivativesInY()\n"
-            << "There isn't y-direction for 1D problem."
-            << std::endl);
+        derivative_dir = 1;
     }
-    else if (d_dim == tbox::Dimension(2))
+    else if (derivative_direction == DIRECTION::Z_DIRECTION)
+    {
+        derivative_dir = 2;
+    }
+    
+    int flux_dir = 0;
+    if (flux_direction == DIRECTION::Y_DIRECTION)
+    {
+        flux_dir = 1;
+    }
+    else if (flux_direction == DIRECTION::Z_DIRECTION)
+    {
+        flux_dir = 2;
+    }
+    
+    TBOX_ASSERT(derivative_dir < d_dim.getValue());
+    TBOX_ASSERT(flux_dir < d_dim.getValue());
+    
+    hier::IntVector node_lo = hier::IntVector::getZero(d_dim);
+    hier::IntVector node_hi = interior_dims;
+    node_lo[flux_dir] -= 3;
+    node_hi[flux_dir] += 3;
+    
+    const double dx_inv = double(1)/dx[derivative_dir];
+    
+    if (d_dim == tbox::Dimension(1))
     {
         /*
-         * Get the dimensions and number of ghost cells.
+         * Get the number of ghost cells and the range of the nodes.
          */
         
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
         const int num_diff_ghosts_0 = d_num_diff_ghosts[0];
-        const int num_diff_ghosts_1 = d_num_diff_ghosts[1];
         
-        const int diff_ghostcell_dim_0 = diff_ghostcell_dims[0];
+        const int node_lo_0 = node_lo[0];
+        const int node_hi_0 = node_hi[0];
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            derivative_y[ei].reserve(static_cast<int>(data_y[ei].size()));
+            TBOX_ASSERT(static_cast<int>(data[ei].size()) ==
+                        static_cast<int>(diffusivities_data[ei].size()));
+            
+            TBOX_ASSERT(static_cast<int>(diffusivities_data[ei].size()) ==
+                        static_cast<int>(diffusivities_component_idx[ei].size()));
+            
+            double* F = F_node[ei];
             
-            for (int vi = 0; vi < static_cast<int>(data_y[ei].size()); vi++)
+            for (int vi = 0; vi < static_cast<int>(data[ei].size()); vi++)
             {
-                // Get the index of variable for derivative.
-                const int u_idx = data_component_idx_y[ei][vi];
+                // Get the indices of variable for derivative and diffusivity.
+                const int u_idx = data_component_idx[ei][vi];
+                const int mu_idx = diffusivities_component_idx[ei][vi];
+                
+                // Get the pointers to variable for derivative and diffusivity.
+                const double* const u = data[ei][vi]->getPointer(u_idx);
+                const double* const mu = diffusivities_data[ei][vi]->getPointer(mu_idx);
+                
+                /*
+                 * Get the sub-ghost cell widths of the variable and the diffusivity.
+                 */
+                
+                const int num_subghosts_0_data = data[ei][vi]->getGhostCellWidth()[0];
+                
+                const int num_subghosts_0_diffusivity =
+                    diffusivities_data[ei][vi]->getGhostCellWidth()[0];
                 
-                if (derivative_y_computed.find(data_y[ei][vi]->getPointer(u_idx))
-                    == derivative_y_computed.end())
-                {
-                    // Get the pointer to variable for derivative.
-                    double* u = data_y[ei][vi]->getPointer(u_idx);
-                    
-                    // Declare container to store the derivative.
-                    boost::shared_ptr<pdat::CellData<double> > derivative(
-                        new pdat::CellData<double>(
-                            interior_box, 1, d_num_diff_ghosts));
-                    
-                    // Get the pointer to the derivative.
-                    double* dudy = derivative->getPointer(0);
-                    
-                    /*
-                     * Get the sub-ghost cell width and ghost box dimensions of the variable.
-                     */
-                    
-                    hier::IntVector num_subghosts_data =
-                        data_y[ei][vi]->getGhostCellWidth();
-                    
-                    hier::IntVector subghostcell_dims_data =
-                        data_y[ei][vi]->getGhostBox().numberCells();
-                    
-                    const int num_subghosts_0_data = num_subghosts_data[0];
-                    const int num_subghosts_1_data = num_subghosts_data[1];
-                    const int subghostcell_dim_0_data = subghostcell_dims_data[0];
-                    
-                    for (int j = -3; j < interior_dim_1 + 3; j++)
-                    {
 #ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
+                #pragma omp simd
 #endif
-                        for (int i = -3; i < interior_dim_0 + 3; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0;
-                            
-                            const int idx_data_BBB = (i + num_subghosts_0_data) +
-                                (j - 3 + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            const int idx_data_BB = (i + num_subghosts_0_data) +
-                                (j - 2 + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            const int idx_data_B = (i + num_subghosts_0_data) +
-                                (j - 1 + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            const int idx_data_T = (i + num_subghosts_0_data) +
-                                (j + 1 + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            const int idx_data_TT = (i + num_subghosts_0_data) +
-                                (j + 2 + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            const int idx_data_TTT = (i + num_subghosts_0_data) +
-                                (j + 3 + num_subghosts_1_data)*subghostcell_dim_0_data;
-                            
-                            dudy[idx] = (double(3)/double(4)*(u[idx_data_T] - u[idx_data_B]) +
-                                         double(-3)/double(20)*(u[idx_data_TT] - u[idx_data_BB]) +
-                                         double(1)/double(60)*(u[idx_data_TTT] - u[idx_data_BBB]))/
-                                            dx_1;
-                        }
-                    }
-                    
-                    std::pair<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_pair(
-                        u,
-                        derivative);
+                for (int i = node_lo_0; i < node_hi_0; i++)
+                {
+                    // Compute the linear indices.
+                    const int idx_node = i + num_diff_ghosts_0;
+                    const int idx_data = i + num_subghosts_0_data;
+                    const int idx_diffusivity = i + num_subghosts_0_diffusivity;
                     
-                    derivative_y_computed.insert(derivative_pair);
+                    F[idx_node] += mu[idx_diffusivity]*dx_inv*(
+                        double(3)/double(4)*(u[idx_data + 1] - u[idx_data - 1]) +
+                        double(-3)/double(20)*(u[idx_data + 2] - u[idx_data - 2]) +
+                        double(1)/double(60)*(u[idx_data + 3] - u[idx_data - 3]));
                 }
-                
-                derivative_y[ei].push_back(
-                    derivative_y_computed.find(data_y[ei][vi]->getPointer(u_idx))->
-                        second);
             }
         }
     }
-    else if (d_dim == tbox::Dimension(3))
+    else if (d_dim == tbox::Dimension(2))
     {
         /*
-         * Get the dimensions and number of ghost cells.
+         * Get the numbers of ghost cells, the dimensions of the ghost box and the range of the nodes.
          */
         
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
         const int num_diff_ghosts_0 = d_num_diff_ghosts[0];
         const int num_diff_ghosts_1 = d_num_diff_ghosts[1];
-        const int num_diff_ghosts_2 = d_num_diff_ghosts[2];
         
         const int diff_ghostcell_dim_0 = diff_ghostcell_dims[0];
-        const int diff_ghostcell_dim_1 = diff_ghostcell_dims[1];
+        
+        const int node_lo_0 = node_lo[0];
+        const int node_lo_1 = node_lo[1];
+        const int node_hi_0 = node_hi[0];
+        const int node_hi_1 = node_hi[1];
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            derivative_y[ei].reserve(static_cast<int>(data_y[ei].size()));
+            TBOX_ASSERT(static_cast<int>(data[ei].size()) ==
+                        static_cast<int>(diffusivities_data[ei].size()));
+            
+            TBOX_ASSERT(static_cast<int>(diffusivities_data[ei].size()) ==
+                        static_cast<int>(diffusivities_component_idx[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(data_y[ei].size()); vi++)
+            double* F = F_node[ei];
+            
+            for (int vi = 0; vi < static_cast<int>(data[ei].size()); vi++)
             {
-                // Get the index of variable for derivative.
-                const int u_idx = data_component_idx_y[ei][vi];
+                // Get the indices of variable for derivative and diffusivity.
+                const int u_idx = data_component_idx[ei][vi];
+                const int mu_idx = diffusivities_component_idx[ei][vi];
+                
+                // Get the pointers to variable for derivative and diffusivity.
+                const double* const u = data[ei][vi]->getPointer(u_idx);
+                const double* const mu = diffusivities_data[ei][vi]->getPointer(mu_idx);
+                
+                /*
+                 * Get the sub-ghost cell widths and ghost box dimensions of the variable and the
+                 * diffusivity.
+                 */
+                
+                const hier::IntVector num_subghosts_data = data[ei][vi]->getGhostCellWidth();
+                const hier::IntVector subghostcell_dims_data = data[ei][vi]->getGhostBox().numberCells();
+                
+                const hier::IntVector num_subghosts_diffusivity =
+                    diffusivities_data[ei][vi]->getGhostCellWidth();
+                
+                const hier::IntVector subghostcell_dims_diffusivity =
+                    diffusivities_data[ei][vi]->getGhostBox().numberCells();
                 
-                if (derivative_y_computed.find(data_y[ei][vi]->getPointer(u_idx))
-                    == derivative_y_computed.end())
+                const int num_subghosts_0_data = num_subghosts_data[0];
+                const int num_subghosts_1_data = num_subghosts_data[1];
+                const int subghostcell_dim_0_data = subghostcell_dims_data[0];
+                
+                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
+                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
+                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
+                
+                // Get the stride of the stencil of the derivative in the data.
+                const int stride = derivative_dir == 0 ? 1 : subghostcell_dim_0_data;
+                
+                for (int j = node_lo_1; j < node_hi_1; j++)
                 {
-                    // Get the pointer to variable for derivative.
-                    double* u = data_y[ei][vi]->getPointer(u_idx);
-                    
-                    // Declare container to store the derivative.
-                    boost::shared_ptr<pdat::CellData<double> > derivative(
-                        new pdat::CellData<double>(
-                            interior_box, 1, d_num_diff_ghosts));
-                    
-                    // Get the pointer to the derivative.
-                    double* dudy = derivative->getPointer(0);
-                    
-                    /*
-                     * Get the sub-ghost cell width and ghost box dimensions of the variable.
-                     */
-                    
-                    hier::IntVector num_subghosts_data =
-                        data_y[ei][vi]->getGhostCellWidth();
-                    
-                    hier::IntVector subghostcell_dims_data =
-                        data_y[ei][vi]->getGhostBox().numberCells();
-                    
-                    const int num_subghosts_0_data = num_subghosts_data[0];
-                    const int num_subghosts_1_data = num_subghosts_data[1];
-                    const int num_subghosts_2_data = num_subghosts_data[2];
-                    const int subghostcell_dim_0_data = subghostcell_dims_data[0];
-                    const int subghostcell_dim_1_data = subghostcell_dims_data[1];
-                    
-                    for (int k = -3; k < interior_dim_2 + 3; k++)
-                    {
-                        for (int j = -3; j < interior_dim_1 + 3; j++)
-                        {
 #ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
+                    #pragma omp simd
 #endif
-                            for (int i = -3; i < interior_dim_0 + 3; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx = (i + num_diff_ghosts_0) +
-                                    (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                    (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                        diff_ghostcell_dim_1;
-                                
-                                const int idx_data_BBB = (i + num_subghosts_0_data) +
-                                    (j - 3 + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_BB = (i + num_subghosts_0_data) +
-                                    (j - 2 + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_B = (i + num_subghosts_0_data) +
-                                    (j - 1 + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_T = (i + num_subghosts_0_data) +
-                                    (j + 1 + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_TT = (i + num_subghosts_0_data) +
-                                    (j + 2 + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_TTT = (i + num_subghosts_0_data) +
-                                    (j + 3 + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                dudy[idx] = (double(3)/double(4)*(u[idx_data_T] - u[idx_data_B]) +
-                                             double(-3)/double(20)*(u[idx_data_TT] - u[idx_data_BB]) +
-                                             double(1)/double(60)*(u[idx_data_TTT] - u[idx_data_BBB]))/
-                                                dx_1;
-                            }
-                        }
+                    for (int i = node_lo_0; i < node_hi_0; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_node = (i + num_diff_ghosts_0) +
+                            (j + num_diff_ghosts_1)*diff_ghostcell_dim_0;
+                        
+                        const int idx_data = (i + num_subghosts_0_data) +
+                            (j + num_subghosts_1_data)*subghostcell_dim_0_data;
+                        
+                        const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
+                            (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity;
+                        
+                        F[idx_node] += mu[idx_diffusivity]*dx_inv*(
+                            double(3)/double(4)*(u[idx_data + stride] - u[idx_data - stride]) +
+                            double(-3)/double(20)*(u[idx_data + 2*stride] - u[idx_data - 2*stride]) +
+                            double(1)/double(60)*(u[idx_data + 3*stride] - u[idx_data - 3*stride]));
                     }
-                    
-                    std::pair<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_pair(
-                        u,
-                        derivative);
-                    
-                    derivative_y_computed.insert(derivative_pair);
                 }
-                
-                derivative_y[ei].push_back(
-                    derivative_y_computed.find(data_y[ei][vi]->getPointer(u_idx))->
-                        second);
             }
         }
     }
-}
-
-
-/*
- * Compute the first derivatives in the z-direction.
- */
-void
-DiffusiveFluxReconstructorSixthOrder::computeFirstDerivativesInZ(
-    hier::Patch& patch,
-    std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& derivative_z,
-    std::map<double*, boost::shared_ptr<pdat::CellData<double> > >& derivative_z_computed,
-    const std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > >& data_z,
-    const std::vector<std::vector<int> >& data_component_idx_z)
-{
-#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
-    for (int ei = 0; ei < d_num_eqn; ei++)
-    {
-        TBOX_ASSERT(static_cast<int>(data_z[ei].size()) ==
-                    static_cast<int>(data_component_idx_z[ei].size()));
-    }
-#endif
-    
-    derivative_z.resize(d_num_eqn);
-    
-    // Get the dimensions of box that covers the interior of patch.
-    hier::Box interior_box = patch.getBox();
-    const hier::IntVector interior_dims = interior_box.numberCells();
-    
-    // Get the dimensions of box that covers interior of patch plus
-    // diffusive ghost cells.
-    hier::Box diff_ghost_box = interior_box;
-    diff_ghost_box.grow(d_num_diff_ghosts);
-    const hier::IntVector diff_ghostcell_dims = diff_ghost_box.numberCells();
-    
-    // Get the grid spacing.
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    
-    const double* const dx = patch_geom->getDx();
-    
-    const double dx_2 = dx[2];
-    
-    if (d_dim == tbox::Dimension(1))
-    {
-        TBOX_ERROR(d_object_name
-            << ": DiffusiveFluxReconstructorSixthOrder::"
-            << "computeFirstDerivativesInZ()\n"
-            << "There isn't z-direction for 1D problem."
-            << std::endl);
-    }
-    else if (d_dim == tbox::Dimension(2))
-    {
-        TBOX_ERROR(d_object_name
-            << ": DiffusiveFluxReconstructorSixthOrder::"
-            << "computeFirstDerivativesInZ()\n"
-            << "There isn't z-direction for 2D problem."
-            << std::endl);
-    }
     else if (d_dim == tbox::Dimension(3))
     {
         /*
-         * Get the dimensions and number of ghost cells.
+         * Get the numbers of ghost cells, the dimensions of the ghost box and the range of the nodes.
          */
         
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
         const int num_diff_ghosts_0 = d_num_diff_ghosts[0];
         const int num_diff_ghosts_1 = d_num_diff_ghosts[1];
         const int num_diff_ghosts_2 = d_num_diff_ghosts[2];
@@ -2630,108 +1388,96 @@ DiffusiveFluxReconstructorSixthOrder::computeFirstDerivativesInZ(
         const int diff_ghostcell_dim_0 = diff_ghostcell_dims[0];
         const int diff_ghostcell_dim_1 = diff_ghostcell_dims[1];
         
+        const int node_lo_0 = node_lo[0];
+        const int node_lo_1 = node_lo[1];
+        const int node_lo_2 = node_lo[2];
+        const int node_hi_0 = node_hi[0];
+        const int node_hi_1 = node_hi[1];
+        const int node_hi_2 = node_hi[2];
+        
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            derivative_z[ei].reserve(static_cast<int>(data_z[ei].size()));
+            TBOX_ASSERT(static_cast<int>(data[ei].size()) ==
+                        static_cast<int>(diffusivities_data[ei].size()));
+            
+            TBOX_ASSERT(static_cast<int>(diffusivities_data[ei].size()) ==
+                        static_cast<int>(diffusivities_component_idx[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(data_z[ei].size()); vi++)
+            double* F = F_node[ei];
+            
+            for (int vi = 0; vi < static_cast<int>(data[ei].size()); vi++)
             {
-                // Get the index of variable for derivative.
-                const int u_idx = data_component_idx_z[ei][vi];
+                // Get the indices of variable for derivative and diffusivity.
+                const int u_idx = data_component_idx[ei][vi];
+                const int mu_idx = diffusivities_component_idx[ei][vi];
+                
+                // Get the pointers to variable for derivative and diffusivity.
+                const double* const u = data[ei][vi]->getPointer(u_idx);
+                const double* const mu = diffusivities_data[ei][vi]->getPointer(mu_idx);
+                
+                /*
+                 * Get the sub-ghost cell widths and ghost box dimensions of the variable and the
+                 * diffusivity.
+                 */
+                
+                const hier::IntVector num_subghosts_data = data[ei][vi]->getGhostCellWidth();
+                const hier::IntVector subghostcell_dims_data = data[ei][vi]->getGhostBox().numberCells();
+                
+                const hier::IntVector num_subghosts_diffusivity =
+                    diffusivities_data[ei][vi]->getGhostCellWidth();
+                
+                const hier::IntVector subghostcell_dims_diffusivity =
+                    diffusivities_data[ei][vi]->getGhostBox().numberCells();
                 
-                if (derivative_z_computed.find(data_z[ei][vi]->getPointer(u_idx))
-                    == derivative_z_computed.end())
+                const int num_subghosts_0_data = num_subghosts_data[0];
+                const int num_subghosts_1_data = num_subghosts_data[1];
+                const int num_subghosts_2_data = num_subghosts_data[2];
+                const int subghostcell_dim_0_data = subghostcell_dims_data[0];
+                const int subghostcell_dim_1_data = subghostcell_dims_data[1];
+                
+                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
+                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
+                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
+                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
+                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
+                
+                // Get the stride of the stencil of the derivative in the data.
+                const int stride = derivative_dir == 0 ? 1 :
+                    (derivative_dir == 1 ? subghostcell_dim_0_data :
+                        subghostcell_dim_0_data*subghostcell_dim_1_data);
+                
+                for (int k = node_lo_2; k < node_hi_2; k++)
                 {
-                    // Get the pointer to variable for derivative.
-                    double* u = data_z[ei][vi]->getPointer(u_idx);
-                    
-                    // Declare container to store the derivative.
-                    boost::shared_ptr<pdat::CellData<double> > derivative(
-                        new pdat::CellData<double>(
-                            interior_box, 1, d_num_diff_ghosts));
-                    
-                    // Get the pointer to the derivative.
-                    double* dudz = derivative->getPointer(0);
-                    
-                    /*
-                     * Get the sub-ghost cell width and ghost box dimensions of the variable.
-                     */
-                    
-                    hier::IntVector num_subghosts_data =
-                        data_z[ei][vi]->getGhostCellWidth();
-                    
-                    hier::IntVector subghostcell_dims_data =
-                        data_z[ei][vi]->getGhostBox().numberCells();
-                    
-                    const int num_subghosts_0_data = num_subghosts_data[0];
-                    const int num_subghosts_1_data = num_subghosts_data[1];
-                    const int num_subghosts_2_data = num_subghosts_data[2];
-                    const int subghostcell_dim_0_data = subghostcell_dims_data[0];
-                    const int subghostcell_dim_1_data = subghostcell_dims_data[1];
-                    
-                    for (int k = -3; k < interior_dim_2 + 3; k++)
+                    for (int j = node_lo_1; j < node_hi_1; j++)
                     {
-                        for (int j = -3; j < interior_dim_1 + 3; j++)
-                        {
 #ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
+                        #pragma omp simd
 #endif
-                            for (int i = -3; i < interior_dim_0 + 3; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx = (i + num_diff_ghosts_0) +
-                                    (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                    (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                        diff_ghostcell_dim_1;
-                                
-                                const int idx_data_BBB = (i + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k - 3 + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_BB = (i + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k - 2 + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_B = (i + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k - 1 + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_F = (i + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + 1 + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_FF = (i + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + 2 + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                const int idx_data_FFF = (i + num_subghosts_0_data) +
-                                    (j + num_subghosts_1_data)*subghostcell_dim_0_data +
-                                    (k + 3 + num_subghosts_2_data)*subghostcell_dim_0_data*
-                                        subghostcell_dim_1_data;
-                                
-                                dudz[idx] = (double(3)/double(4)*(u[idx_data_F] - u[idx_data_B]) +
-                                             double(-3)/double(20)*(u[idx_data_FF] - u[idx_data_BB]) +
-                                             double(1)/double(60)*(u[idx_data_FFF] - u[idx_data_BBB]))/
-                                                dx_2;
-                            }
+                        for (int i = node_lo_0; i < node_hi_0; i++)
+                        {
+                            // Compute the linear indices.
+                            const int idx_node = (i + num_diff_ghosts_0) +
+                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
+                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
+                                    diff_ghostcell_dim_1;
+                            
+                            const int idx_data = (i + num_subghosts_0_data) +
+                                (j + num_subghosts_1_data)*subghostcell_dim_0_data +
+                                (k + num_subghosts_2_data)*subghostcell_dim_0_data*
+                                    subghostcell_dim_1_data;
+                            
+                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
+                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
+                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
+                                    subghostcell_dim_1_diffusivity;
+                            
+                            F[idx_node] += mu[idx_diffusivity]*dx_inv*(
+                                double(3)/double(4)*(u[idx_data + stride] - u[idx_data - stride]) +
+                                double(-3)/double(20)*(u[idx_data + 2*stride] - u[idx_data - 2*stride]) +
+                                double(1)/double(60)*(u[idx_data + 3*stride] - u[idx_data - 3*stride]));
                         }
                     }
-                    
-                    std::pair<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_pair(
-                        u,
-                        derivative);
-                    
-                    derivative_z_computed.insert(derivative_pair);
                 }
-                
-                derivative_z[ei].push_back(
-                    derivative_z_computed.find(data_z[ei][vi]->getPointer(u_idx))->
-                        second);
             }
         }
     }
@@ -158,7 +158,8 @@ FlowModelBoundaryUtilitiesFiveEqnAllaire::fill1dNodeBoundaryData(
     std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<std::vector<double> >& bdry_node_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
 
 }
@@ -175,7 +176,8 @@ FlowModelBoundaryUtilitiesFiveEqnAllaire::fill2dEdgeBoundaryData(
     std::vector<int>& bdry_edge_locs,
     const std::vector<int>& bdry_edge_conds,
     const std::vector<std::vector<double> >& bdry_edge_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     
 }
@@ -192,7 +194,8 @@ FlowModelBoundaryUtilitiesFiveEqnAllaire::fill2dNodeBoundaryData(
     std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<std::vector<double> >& bdry_edge_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     
 }
@@ -209,7 +212,8 @@ FlowModelBoundaryUtilitiesFiveEqnAllaire::fill3dFaceBoundaryData(
     std::vector<int>& bdry_face_locs,
     const std::vector<int>& bdry_face_conds,
     const std::vector<std::vector<double> >& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     
 }
@@ -226,7 +230,8 @@ FlowModelBoundaryUtilitiesFiveEqnAllaire::fill3dEdgeBoundaryData(
     std::vector<int>& bdry_edge_locs,
     const std::vector<int>& bdry_edge_conds,
     const std::vector<std::vector<double> >& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     
 }
@@ -243,7 +248,8 @@ FlowModelBoundaryUtilitiesFiveEqnAllaire::fill3dNodeBoundaryData(
     std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<std::vector<double> >& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     
 }
@@ -961,6 +961,25 @@ void FlowModelFiveEqnAllaire::unregisterPatch()
     d_subghostcell_dims_max_diffusivity      = hier::IntVector::getZero(d_dim);
     d_subghostcell_dims_diffusivities        = hier::IntVector::getZero(d_dim);
     
+    // Record the memory of the derived cell data of the patch before it is dumped.
+    MemoryUsage::recordTemporaryData(
+        "FlowModel derived cell data",
+        MemoryUsage::getPatchDataSize(d_data_density) +
+        MemoryUsage::getPatchDataSize(d_data_mass_fractions) +
+        MemoryUsage::getPatchDataSize(d_data_velocity) +
+        MemoryUsage::getPatchDataSize(d_data_internal_energy) +
+        MemoryUsage::getPatchDataSize(d_data_pressure) +
+        MemoryUsage::getPatchDataSize(d_data_sound_speed) +
+        MemoryUsage::getPatchDataSize(d_data_species_temperatures) +
+        MemoryUsage::getPatchDataSize(d_data_convective_flux_x) +
+        MemoryUsage::getPatchDataSize(d_data_convective_flux_y) +
+        MemoryUsage::getPatchDataSize(d_data_convective_flux_z) +
+        MemoryUsage::getPatchDataSize(d_data_max_wave_speed_x) +
+        MemoryUsage::getPatchDataSize(d_data_max_wave_speed_y) +
+        MemoryUsage::getPatchDataSize(d_data_max_wave_speed_z) +
+        MemoryUsage::getPatchDataSize(d_data_max_diffusivity) +
+        MemoryUsage::getPatchDataSize(d_data_diffusivities));
+    
     d_data_density.reset();
     d_data_mass_fractions.reset();
     d_data_velocity.reset();
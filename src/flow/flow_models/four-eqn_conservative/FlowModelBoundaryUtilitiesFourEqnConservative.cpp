@@ -202,7 +202,8 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
     std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<std::vector<double> >& bdry_node_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -227,11 +228,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -270,8 +266,18 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& node_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::NODE1D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE1D);
+    const std::vector<hier::Box>& node_fill_boxes = fill_plan->getFillBoxes(BDRY::NODE1D, gcw_to_fill);
     
     for (int ni = 0; ni < static_cast<int>(node_bdry.size()); ni++)
     {
@@ -282,10 +288,7 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
         if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
             bdry_node_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                node_bdry[ni],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(node_fill_boxes[ni]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -341,6 +344,24 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
                 
                 if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         const int idx_cell_rho_Y = i + num_subghosts_conservative_var[0][0];
@@ -386,27 +407,72 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
                         }
                         
                         /*
-                         * Compute the mass fractions of the pivot.
+                         * Store the indices and the state of the pivot.
                          */
                         
-                        std::vector<double> Y_pivot;
-                        Y_pivot.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                        }
+                        idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                        idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                        idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                        idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                        idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                         
-                        /*
-                         * Get the pointers to the mass fractions of the pivot.
-                         */
+                        rho_pivot_bdry[count_bdry] = rho_pivot;
                         
-                        std::vector<const double*> Y_pivot_ptr;
-                        Y_pivot_ptr.reserve(d_num_species);
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            Y_pivot_ptr.push_back(&Y_pivot[si]);
+                            Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                         }
                         
+                        epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 1][idx_cell_pivot_E] -
+                            0.5*Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom]/
+                                rho_pivot)/rho_pivot;
+                        
+                        count_bdry++;
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
                         /*
                          * Set the values for partial densities and momentum.
                          */
@@ -422,29 +488,7 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
                          * Set the values for total internal energy.
                          */
                         
-                        double epsilon_pivot = (Q[d_num_species + 1][idx_cell_pivot_E] -
-                            0.5*Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom]/
-                                rho_pivot)/rho_pivot;
-                        
-                        double p_pivot = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_pivot,
-                                &epsilon_pivot,
-                                Y_pivot_ptr);
-                        
-                        double T_pivot = d_equation_of_state_mixing_rules->
-                            getTemperature(
-                                &rho_pivot,
-                                &p_pivot,
-                                Y_pivot_ptr);
-                        
-                        double T = T_pivot;
-                        
-                        double epsilon = d_equation_of_state_mixing_rules->
-                            getInternalEnergyFromTemperature(
-                                &rho_pivot,
-                                &T,
-                                Y_pivot_ptr);
+                        const double epsilon = epsilon_bdry[n];
                         
                         double E = rho_pivot*epsilon +
                             0.5*Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom]/rho_pivot;
@@ -458,6 +502,23 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         const int idx_cell_rho_Y = i + num_subghosts_conservative_var[0][0];
@@ -502,71 +563,101 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
                         }
                         
                         /*
-                         * Compute the mass fractions of the pivot.
+                         * Store the indices and the state of the pivot.
                          */
                         
-                        std::vector<double> Y_pivot;
-                        Y_pivot.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                        }
+                        idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                        idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                        idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                        idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                         
-                        /*
-                         * Get the pointers to the mass fractions of the pivot.
-                         */
+                        rho_pivot_bdry[count_bdry] = rho_pivot;
                         
-                        std::vector<const double*> Y_pivot_ptr;
-                        Y_pivot_ptr.reserve(d_num_species);
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            Y_pivot_ptr.push_back(&Y_pivot[si]);
+                            Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                         }
                         
-                        /*
-                         * Set the values for partial densities, momentum and total internal energy.
-                         */
-                        
-                        double epsilon_pivot = (Q[d_num_species + 1][idx_cell_pivot_E] -
+                        epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 1][idx_cell_pivot_E] -
                             0.5*Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom]/
                                 rho_pivot)/rho_pivot;
                         
-                        double p_pivot = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_pivot,
-                                &epsilon_pivot,
-                                Y_pivot_ptr);
-                        
-                        double p = p_pivot;
+                        count_bdry++;
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_node_isothermal_no_slip_T[node_loc];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
                         
-                        double T_pivot = d_equation_of_state_mixing_rules->
-                            getTemperature(
-                                &rho_pivot,
-                                &p_pivot,
-                                Y_pivot_ptr);
+                        const double rho_pivot = rho_pivot_bdry[n];
                         
-                        double T = -T_pivot + 2.0*d_bdry_node_isothermal_no_slip_T[node_loc];
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
                         
-                        double rho = d_equation_of_state_mixing_rules->
-                            getMixtureDensity(
-                                &p,
-                                &T,
-                                Y_pivot_ptr);
+                        const double rho = rho_bdry[n];
                         
                         double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
                             2.0*d_bdry_node_isothermal_no_slip_vel[node_loc];
                         
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
                         }
                         Q[d_num_species][idx_cell_mom] = rho*u;
                         
-                        double epsilon = d_equation_of_state_mixing_rules->
-                            getInternalEnergyFromTemperature(
-                                &rho,
-                                &T,
-                                Y_pivot_ptr);
+                        const double epsilon = epsilon_bdry[n];
                         
                         double E = rho*epsilon + 0.5*Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom]/rho;
                         
@@ -594,7 +685,8 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
     std::vector<int>& bdry_edge_locs,
     const std::vector<int>& bdry_edge_conds,
     const std::vector<std::vector<double> >& bdry_edge_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -619,11 +711,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -662,8 +749,18 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& edge_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::EDGE2D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& edge_bdry = fill_plan->getBoundaryBoxes(BDRY::EDGE2D);
+    const std::vector<hier::Box>& edge_fill_boxes = fill_plan->getFillBoxes(BDRY::EDGE2D, gcw_to_fill);
     
     for (int ei = 0; ei < static_cast<int>(edge_bdry.size()); ei++)
     {
@@ -674,10 +771,7 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
         if (std::find(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc) !=
             bdry_edge_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                edge_bdry[ei],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(edge_fill_boxes[ei]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -733,6 +827,24 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                 
                 if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -833,75 +945,98 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             }
                             
                             /*
-                             * Compute the mass fractions of the pivot.
-                             */
-                            
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
+                             * Store the indices and the state of the pivot.
                              */
                             
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
-                            }
+                            idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                            idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                            idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                            idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                            idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                             
-                            /*
-                             * Set the values for partial densities and momentum.
-                             */
+                            rho_pivot_bdry[count_bdry] = rho_pivot;
                             
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                                Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
-                            Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
-                                2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc*2];
-                            Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc*2 + 1];
-                            
-                            /*
-                             * Set the values for total internal energy.
-                             */
                             
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T = T_pivot;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho_pivot,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho_pivot*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_bdry++;
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities and momentum.
+                         */
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
                         }
+                        Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc*2];
+                        Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc*2 + 1];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
                     }
                     
                     // Remove edge locations that have boundary conditions identified.
@@ -910,6 +1045,23 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -1010,82 +1162,112 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             }
                             
                             /*
-                             * Compute the mass fractions of the pivot.
+                             * Store the indices and the state of the pivot.
                              */
                             
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
+                            idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                            idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                            idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                            idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                             
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
-                             */
+                            rho_pivot_bdry[count_bdry] = rho_pivot;
                             
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
                             
-                            /*
-                             * Set the values for partial densities, momentum and total internal energy.
-                             */
-                            
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double p = p_pivot;
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T = -T_pivot + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc];
-                            
-                            double rho = d_equation_of_state_mixing_rules->
-                                getMixtureDensity(
-                                    &p,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2];
-                            double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2 + 1];
-                            
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                            }
-                            Q[d_num_species][idx_cell_mom] = rho*u;
-                            Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_bdry++;
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        const double rho = rho_bdry[n];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2 + 1];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
                         }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
                     }
                     
                     // Remove edge locations that have boundary conditions identified.
@@ -1109,7 +1291,8 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
     std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<std::vector<double> >& bdry_edge_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -1134,11 +1317,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -1177,8 +1355,18 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& node_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::NODE2D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE2D);
+    const std::vector<hier::Box>& node_fill_boxes = fill_plan->getFillBoxes(BDRY::NODE2D, gcw_to_fill);
     
     for (int ni = 0; ni < static_cast<int>(node_bdry.size()); ni++)
     {
@@ -1189,10 +1377,7 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
         if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
             bdry_node_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                node_bdry[ni],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(node_fill_boxes[ni]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -1285,6 +1470,24 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                 
                 if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -1351,75 +1554,98 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                             }
                             
                             /*
-                             * Compute the mass fractions of the pivot.
-                             */
-                            
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
+                             * Store the indices and the state of the pivot.
                              */
                             
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
-                            }
+                            idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                            idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                            idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                            idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                            idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                             
-                            /*
-                             * Set the values for partial densities and momentum.
-                             */
+                            rho_pivot_bdry[count_bdry] = rho_pivot;
                             
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                                Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
-                            Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
-                                2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_0*2];
-                            Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_0*2 + 1];
-                            
-                            /*
-                             * Set the values for total internal energy.
-                             */
                             
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T = T_pivot;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho_pivot,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho_pivot*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_bdry++;
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities and momentum.
+                         */
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
                         }
+                        Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_0*2];
+                        Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_0*2 + 1];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
                     }
                     
                     // Remove node locations that have boundary conditions identified.
@@ -1428,6 +1654,24 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -1494,83 +1738,123 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                             }
                             
                             /*
-                             * Compute the mass fractions of the pivot.
-                             */
-                            
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
+                             * Store the indices and the state of the pivot.
                              */
                             
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
-                            }
+                            idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                            idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                            idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                            idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                            idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                             
-                            /*
-                             * Set the values for partial densities and momentum.
-                             */
+                            rho_pivot_bdry[count_bdry] = rho_pivot;
                             
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                                Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
-                            Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
-                                2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_1*2];
-                            Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_1*2 + 1];
                             
-                            /*
-                             * Set the values for total internal energy.
-                             */
-                            
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T = T_pivot;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho_pivot,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho_pivot*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_bdry++;
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities and momentum.
+                         */
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                        }
+                        Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_1*2];
+                        Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_1*2 + 1];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -1637,82 +1921,112 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                             }
                             
                             /*
-                             * Compute the mass fractions of the pivot.
+                             * Store the indices and the state of the pivot.
                              */
                             
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
+                            idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                            idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                            idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                            idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                             
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
-                             */
+                            rho_pivot_bdry[count_bdry] = rho_pivot;
                             
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
                             
-                            /*
-                             * Set the values for partial densities, momentum and total internal energy.
-                             */
-                            
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double p = p_pivot;
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T = -T_pivot + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc_0];
-                            
-                            double rho = d_equation_of_state_mixing_rules->
-                                getMixtureDensity(
-                                    &p,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2];
-                            double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2 + 1];
-                            
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                            }
-                            Q[d_num_species][idx_cell_mom] = rho*u;
-                            Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_bdry++;
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc_0];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        const double rho = rho_bdry[n];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2 + 1];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
                         }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
                     }
                     
                     // Remove node locations that have boundary conditions identified.
@@ -1721,6 +2035,23 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -1787,82 +2118,112 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                             }
                             
                             /*
-                             * Compute the mass fractions of the pivot.
+                             * Store the indices and the state of the pivot.
                              */
                             
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
+                            idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                            idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                            idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                            idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                             
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
-                             */
+                            rho_pivot_bdry[count_bdry] = rho_pivot;
                             
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
                             
-                            /*
-                             * Set the values for partial densities, momentum and total internal energy.
-                             */
-                            
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double p = p_pivot;
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T = -T_pivot + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc_1];
-                            
-                            double rho = d_equation_of_state_mixing_rules->
-                                getMixtureDensity(
-                                    &p,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2];
-                            double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2 + 1];
-                            
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                            }
-                            Q[d_num_species][idx_cell_mom] = rho*u;
-                            Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_bdry++;
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc_1];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        const double rho = rho_bdry[n];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2 + 1];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
                         }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
                     }
                     
                     // Remove node locations that have boundary conditions identified.
@@ -1886,7 +2247,8 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
     std::vector<int>& bdry_face_locs,
     const std::vector<int>& bdry_face_conds,
     const std::vector<std::vector<double> >& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -1911,11 +2273,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -1954,8 +2311,18 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& face_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::FACE3D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& face_bdry = fill_plan->getBoundaryBoxes(BDRY::FACE3D);
+    const std::vector<hier::Box>& face_fill_boxes = fill_plan->getFillBoxes(BDRY::FACE3D, gcw_to_fill);
     
     for (int fi = 0; fi < static_cast<int>(face_bdry.size()); fi++)
     {
@@ -1966,10 +2333,7 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
         if (std::find(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc) !=
             bdry_face_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                face_bdry[fi],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(face_fill_boxes[fi]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -2025,6 +2389,24 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                 
                 if (bdry_face_conds[face_loc] == BDRY_COND::FLOW_MODEL::ADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -2224,89 +2606,129 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Set the values for partial densities and momentum.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
-                                Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc*3];
-                                Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc*3 + 1];
-                                Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc*3 + 2];
-                                
-                                /*
-                                 * Set the values for total internal energy.
-                                 */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities and momentum.
+                         */
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                        }
+                        Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc*3];
+                        Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc*3 + 1];
+                        Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc*3 + 2];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove face locations that have boundary conditions identified.
                     bdry_face_locs.erase(std::remove(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc),
                         bdry_face_locs.end());
                 }
                 else if (bdry_face_conds[face_loc] == BDRY_COND::FLOW_MODEL::ISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -2506,90 +2928,120 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities, momentum and total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        const double rho = rho_bdry[n];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove face locations that have boundary conditions identified.
                     bdry_face_locs.erase(std::remove(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc),
                         bdry_face_locs.end());
@@ -2612,7 +3064,8 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
     std::vector<int>& bdry_edge_locs,
     const std::vector<int>& bdry_edge_conds,
     const std::vector<std::vector<double> >& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -2637,11 +3090,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -2680,8 +3128,18 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& edge_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::EDGE3D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& edge_bdry = fill_plan->getBoundaryBoxes(BDRY::EDGE3D);
+    const std::vector<hier::Box>& edge_fill_boxes = fill_plan->getFillBoxes(BDRY::EDGE3D, gcw_to_fill);
     
     for (int ei = 0; ei < static_cast<int>(edge_bdry.size()); ei++)
     {
@@ -2692,10 +3150,7 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
         if (std::find(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc) !=
             bdry_edge_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                edge_bdry[ei],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(edge_fill_boxes[ei]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -2847,6 +3302,24 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                 
                 if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::XADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -2942,89 +3415,130 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities and momentum.
-                                 */
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                    0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
+                                         Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
+                                         Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
+                                    rho_pivot)/rho_pivot;
                                 
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
-                                }
-                                Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3];
-                                Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 1];
-                                Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 2];
-                                
-                                /*
-                                 * Set the values for total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
-                                    0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
-                                         Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                         Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
-                                    rho_pivot)/rho_pivot;
-                                
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities and momentum.
+                         */
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                        }
+                        Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3];
+                        Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 1];
+                        Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 2];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::YADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -3120,89 +3634,130 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Set the values for partial densities and momentum.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
-                                Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3];
-                                Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 1];
-                                Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 2];
-                                
-                                /*
-                                 * Set the values for total internal energy.
-                                 */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities and momentum.
+                         */
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                        }
+                        Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3];
+                        Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 1];
+                        Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 2];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ZADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -3298,89 +3853,129 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Set the values for partial densities and momentum.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
-                                Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3];
-                                Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 1];
-                                Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 2];
                                 
-                                /*
-                                 * Set the values for total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities and momentum.
+                         */
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                        }
+                        Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3];
+                        Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 1];
+                        Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 2];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::XISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -3476,96 +4071,143 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities, momentum and total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_0];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_0];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        const double rho = rho_bdry[n];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::YISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -3661,96 +4303,143 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities, momentum and total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_1];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_1];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        const double rho = rho_bdry[n];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ZISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -3846,97 +4535,127 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities, momentum and total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_2];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
-                    // Remove edge locations that have boundary conditions identified.
-                    bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
-                        bdry_edge_locs.end());
-                }
-            }
-        }
-    }
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_2];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        const double rho = rho_bdry[n];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
+                    // Remove edge locations that have boundary conditions identified.
+                    bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
+                        bdry_edge_locs.end());
+                }
+            }
+        }
+    }
 }
 
 
@@ -3951,7 +4670,8 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
     std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<std::vector<double> >& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -3976,11 +4696,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -4019,8 +4734,18 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& node_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::NODE3D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE3D);
+    const std::vector<hier::Box>& node_fill_boxes = fill_plan->getFillBoxes(BDRY::NODE3D, gcw_to_fill);
     
     for (int ni = 0; ni < static_cast<int>(node_bdry.size()); ni++)
     {
@@ -4031,10 +4756,7 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
         if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
             bdry_node_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                node_bdry[ni],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(node_fill_boxes[ni]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -4166,6 +4888,24 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                 
                 if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4261,89 +5001,130 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities and momentum.
-                                 */
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
-                                }
-                                Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3];
-                                Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 1];
-                                Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 2];
-                                
-                                /*
-                                 * Set the values for total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities and momentum.
+                         */
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                        }
+                        Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3];
+                        Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 1];
+                        Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 2];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4439,89 +5220,130 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities and momentum.
-                                 */
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
-                                }
-                                Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3];
-                                Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 1];
-                                Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 2];
-                                
-                                /*
-                                 * Set the values for total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities and momentum.
+                         */
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                        }
+                        Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3];
+                        Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 1];
+                        Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 2];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ZADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4617,89 +5439,129 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_rho_Y_bdry[count_bdry] = idx_cell_pivot_rho_Y;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities and momentum.
-                                 */
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
-                                }
-                                Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3];
-                                Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 1];
-                                Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
-                                    2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 2];
-                                
-                                /*
-                                 * Set the values for total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy of
+                     * the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_rho_Y = idx_cell_pivot_rho_Y_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities and momentum.
+                         */
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = Q[si][idx_cell_pivot_rho_Y];
+                        }
+                        Q[d_num_species][idx_cell_mom] = -Q[d_num_species][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3];
+                        Q[d_num_species + 1][idx_cell_mom] = -Q[d_num_species + 1][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 1];
+                        Q[d_num_species + 2][idx_cell_mom] = -Q[d_num_species + 2][idx_cell_pivot_mom] +
+                            2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 2];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4795,96 +5657,143 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities, momentum and total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_0];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_0];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        const double rho = rho_bdry[n];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4980,96 +5889,143 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities, momentum and total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_1];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_1];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        const double rho = rho_bdry[n];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ZISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the indices of the ghost cells and the pivots and the states of the pivots so
+                     * that the equation of state is evaluated on the whole fill box at once.
+                     */
+                    
+                    const int num_bdry_cells = static_cast<int>(fill_box.size());
+                    
+                    std::vector<int> idx_cell_rho_Y_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_mom_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_E_bdry(num_bdry_cells);
+                    std::vector<int> idx_cell_pivot_mom_bdry(num_bdry_cells);
+                    std::vector<double> rho_pivot_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_pivot_bdry(num_bdry_cells);
+                    std::vector<double> Y_pivot_bdry(d_num_species*num_bdry_cells);
+                    
+                    int count_bdry = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -5165,90 +6121,120 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Compute the mass fractions of the pivot.
+                                 * Store the indices and the state of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
+                                idx_cell_rho_Y_bdry[count_bdry] = idx_cell_rho_Y;
+                                idx_cell_mom_bdry[count_bdry] = idx_cell_mom;
+                                idx_cell_E_bdry[count_bdry] = idx_cell_E;
+                                idx_cell_pivot_mom_bdry[count_bdry] = idx_cell_pivot_mom;
                                 
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
+                                rho_pivot_bdry[count_bdry] = rho_pivot;
                                 
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_bdry[si*num_bdry_cells + count_bdry] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
-                                /*
-                                 * Set the values for partial densities, momentum and total internal energy.
-                                 */
-                                
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_bdry[count_bdry] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_2];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_bdry++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the density and specific internal
+                     * energy of the ghost cells.
+                     */
+                    
+                    std::vector<double> p_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_pivot_bdry(num_bdry_cells);
+                    std::vector<double> T_bdry(num_bdry_cells);
+                    std::vector<double> rho_bdry(num_bdry_cells);
+                    std::vector<double> epsilon_bdry(num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            epsilon_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_bdry.data(),
+                            rho_pivot_bdry.data(),
+                            p_pivot_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        T_bdry[n] = -T_pivot_bdry[n] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_2];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_bdry.data(),
+                            p_pivot_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_bdry.data(),
+                            rho_bdry.data(),
+                            T_bdry.data(),
+                            Y_pivot_bdry.data(),
+                            num_bdry_cells);
+                    
+                    for (int n = 0; n < num_bdry_cells; n++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_bdry[n];
+                        const int idx_cell_mom = idx_cell_mom_bdry[n];
+                        const int idx_cell_E = idx_cell_E_bdry[n];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_bdry[n];
+                        
+                        const double rho_pivot = rho_pivot_bdry[n];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        const double rho = rho_bdry[n];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_bdry[si*num_bdry_cells + n];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        const double epsilon = epsilon_bdry[n];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
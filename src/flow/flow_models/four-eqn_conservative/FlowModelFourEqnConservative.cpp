@@ -1043,6 +1043,9 @@ FlowModelFourEqnConservative::unregisterPatch()
             << std::endl);
     }
     
+    // Release the cached mixture thermodynamic properties of the patch.
+    d_equation_of_state_mixing_rules->stopCachingMixtureThermodynamicProperties();
+    
     d_patch = nullptr;
     
     d_num_ghosts                      = -hier::IntVector::getOne(d_dim);
@@ -1101,6 +1104,26 @@ FlowModelFourEqnConservative::unregisterPatch()
     d_subghostcell_dims_max_diffusivity   = hier::IntVector::getZero(d_dim);
     d_subghostcell_dims_diffusivities     = hier::IntVector::getZero(d_dim);
     
+    // Record the memory of the derived cell data of the patch before it is dumped.
+    MemoryUsage::recordTemporaryData(
+        "FlowModel derived cell data",
+        MemoryUsage::getPatchDataSize(d_data_density) +
+        MemoryUsage::getPatchDataSize(d_data_mass_fractions) +
+        MemoryUsage::getPatchDataSize(d_data_mole_fractions) +
+        MemoryUsage::getPatchDataSize(d_data_velocity) +
+        MemoryUsage::getPatchDataSize(d_data_internal_energy) +
+        MemoryUsage::getPatchDataSize(d_data_pressure) +
+        MemoryUsage::getPatchDataSize(d_data_sound_speed) +
+        MemoryUsage::getPatchDataSize(d_data_temperature) +
+        MemoryUsage::getPatchDataSize(d_data_convective_flux_x) +
+        MemoryUsage::getPatchDataSize(d_data_convective_flux_y) +
+        MemoryUsage::getPatchDataSize(d_data_convective_flux_z) +
+        MemoryUsage::getPatchDataSize(d_data_max_wave_speed_x) +
+        MemoryUsage::getPatchDataSize(d_data_max_wave_speed_y) +
+        MemoryUsage::getPatchDataSize(d_data_max_wave_speed_z) +
+        MemoryUsage::getPatchDataSize(d_data_max_diffusivity) +
+        MemoryUsage::getPatchDataSize(d_data_diffusivities));
+    
     d_data_density.reset();
     d_data_mass_fractions.reset();
     d_data_mole_fractions.reset();
@@ -10182,6 +10205,18 @@ FlowModelFourEqnConservative::computeGlobalCellDataMassFractionsWithDensity(
                 }
             }
         }
+        
+        /*
+         * Cache the mixture thermodynamic properties computed from the mass fractions when the mass
+         * fractions are computed in all cells since they are not changed until the patch is
+         * unregistered.
+         */
+        
+        if (domain.empty())
+        {
+            d_equation_of_state_mixing_rules->startCachingMixtureThermodynamicProperties(
+                d_data_mass_fractions);
+        }
     }
     else
     {
@@ -220,7 +220,8 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill1dNodeBoundaryData(
     std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<std::vector<double> >& bdry_node_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -245,11 +246,6 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill1dNodeBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -288,8 +284,18 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill1dNodeBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& node_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::NODE1D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE1D);
+    const std::vector<hier::Box>& node_fill_boxes = fill_plan->getFillBoxes(BDRY::NODE1D, gcw_to_fill);
     
     for (int ni = 0; ni < static_cast<int>(node_bdry.size()); ni++)
     {
@@ -300,10 +306,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill1dNodeBoundaryData(
         if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
             bdry_node_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                node_bdry[ni],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(node_fill_boxes[ni]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -550,7 +553,8 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
     std::vector<int>& bdry_edge_locs,
     const std::vector<int>& bdry_edge_conds,
     const std::vector<std::vector<double> >& bdry_edge_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -575,11 +579,6 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -618,8 +617,18 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& edge_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::EDGE2D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& edge_bdry = fill_plan->getBoundaryBoxes(BDRY::EDGE2D);
+    const std::vector<hier::Box>& edge_fill_boxes = fill_plan->getFillBoxes(BDRY::EDGE2D, gcw_to_fill);
     
     for (int ei = 0; ei < static_cast<int>(edge_bdry.size()); ei++)
     {
@@ -630,10 +639,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
         if (std::find(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc) !=
             bdry_edge_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                edge_bdry[ei],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(edge_fill_boxes[ei]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -1003,7 +1009,8 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dNodeBoundaryData(
     std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<std::vector<double> >& bdry_edge_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -1028,11 +1035,6 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dNodeBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -1071,8 +1073,18 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dNodeBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& node_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::NODE2D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE2D);
+    const std::vector<hier::Box>& node_fill_boxes = fill_plan->getFillBoxes(BDRY::NODE2D, gcw_to_fill);
     
     for (int ni = 0; ni < static_cast<int>(node_bdry.size()); ni++)
     {
@@ -1083,10 +1095,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dNodeBoundaryData(
         if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
             bdry_node_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                node_bdry[ni],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(node_fill_boxes[ni]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -1648,7 +1657,8 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
     std::vector<int>& bdry_face_locs,
     const std::vector<int>& bdry_face_conds,
     const std::vector<std::vector<double> >& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -1673,11 +1683,6 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -1716,8 +1721,18 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& face_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::FACE3D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& face_bdry = fill_plan->getBoundaryBoxes(BDRY::FACE3D);
+    const std::vector<hier::Box>& face_fill_boxes = fill_plan->getFillBoxes(BDRY::FACE3D, gcw_to_fill);
     
     for (int fi = 0; fi < static_cast<int>(face_bdry.size()); fi++)
     {
@@ -1728,10 +1743,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
         if (std::find(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc) !=
             bdry_face_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                face_bdry[fi],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(face_fill_boxes[fi]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -2309,7 +2321,8 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
     std::vector<int>& bdry_edge_locs,
     const std::vector<int>& bdry_edge_conds,
     const std::vector<std::vector<double> >& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -2334,11 +2347,6 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -2377,8 +2385,18 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& edge_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::EDGE3D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& edge_bdry = fill_plan->getBoundaryBoxes(BDRY::EDGE3D);
+    const std::vector<hier::Box>& edge_fill_boxes = fill_plan->getFillBoxes(BDRY::EDGE3D, gcw_to_fill);
     
     for (int ei = 0; ei < static_cast<int>(edge_bdry.size()); ei++)
     {
@@ -2389,10 +2407,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
         if (std::find(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc) !=
             bdry_edge_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                edge_bdry[ei],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(edge_fill_boxes[ei]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -3440,7 +3455,8 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
     std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<std::vector<double> >& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(static_cast<int>(conservative_var_data.size()) == 3);
     for (int vi = 0; vi < static_cast<int>(conservative_var_data.size()); vi++)
@@ -3465,11 +3481,6 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
         TBOX_ASSERT_OBJDIM_EQUALITY3(*conservative_var_data[vi], patch, ghost_width_to_fill);
     }
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     hier::IntVector num_ghosts(conservative_var_data[0]->getGhostCellWidth());
     for (int vi = 1; vi < static_cast<int>(conservative_var_data.size()); vi++)
     {
@@ -3508,8 +3519,18 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
     interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
     interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    const std::vector<hier::BoundaryBox>& node_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::NODE3D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE3D);
+    const std::vector<hier::Box>& node_fill_boxes = fill_plan->getFillBoxes(BDRY::NODE3D, gcw_to_fill);
     
     for (int ni = 0; ni < static_cast<int>(node_bdry.size()); ni++)
     {
@@ -3520,10 +3541,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
         if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
             bdry_node_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                node_bdry[ni],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(node_fill_boxes[ni]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -1024,6 +1024,23 @@ FlowModelSingleSpecies::unregisterPatch()
     d_subghostcell_dims_max_diffusivity   = hier::IntVector::getZero(d_dim);
     d_subghostcell_dims_diffusivities     = hier::IntVector::getZero(d_dim);
     
+    // Record the memory of the derived cell data of the patch before it is dumped.
+    MemoryUsage::recordTemporaryData(
+        "FlowModel derived cell data",
+        MemoryUsage::getPatchDataSize(d_data_velocity) +
+        MemoryUsage::getPatchDataSize(d_data_internal_energy) +
+        MemoryUsage::getPatchDataSize(d_data_pressure) +
+        MemoryUsage::getPatchDataSize(d_data_sound_speed) +
+        MemoryUsage::getPatchDataSize(d_data_temperature) +
+        MemoryUsage::getPatchDataSize(d_data_convective_flux_x) +
+        MemoryUsage::getPatchDataSize(d_data_convective_flux_y) +
+        MemoryUsage::getPatchDataSize(d_data_convective_flux_z) +
+        MemoryUsage::getPatchDataSize(d_data_max_wave_speed_x) +
+        MemoryUsage::getPatchDataSize(d_data_max_wave_speed_y) +
+        MemoryUsage::getPatchDataSize(d_data_max_wave_speed_z) +
+        MemoryUsage::getPatchDataSize(d_data_max_diffusivity) +
+        MemoryUsage::getPatchDataSize(d_data_diffusivities));
+    
     d_data_velocity.reset();
     d_data_internal_energy.reset();
     d_data_pressure.reset();
@@ -7278,6 +7295,159 @@ FlowModelSingleSpecies::computeGlobalCellDataInternalEnergyWithVelocity(
 }
 
 
+/*
+ * Evaluate an equation of state function of density and another variable given at compile time
+ * in the cells of the domain so that the function is inlined into the loops.
+ */
+template<double (*EquationOfStateFunction)(const double, const double, const double* const)>
+static void
+computeCellDataWithEquationOfStatePolicy(
+    double* const f,
+    const double* const rho,
+    const double* const q,
+    const double* const thermo_properties,
+    const hier::IntVector& num_subghosts_f,
+    const hier::IntVector& subghostcell_dims_f,
+    const hier::IntVector& num_ghosts_rho,
+    const hier::IntVector& ghostcell_dims_rho,
+    const hier::IntVector& num_subghosts_q,
+    const hier::IntVector& subghostcell_dims_q,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    const tbox::Dimension& dim = domain_lo.getDim();
+    
+    if (dim == tbox::Dimension(1))
+    {
+        /*
+         * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
+         */
+        
+        const int domain_lo_0 = domain_lo[0];
+        const int domain_dim_0 = domain_dims[0];
+        
+        const int num_subghosts_0_f = num_subghosts_f[0];
+        const int num_ghosts_0_rho = num_ghosts_rho[0];
+        const int num_subghosts_0_q = num_subghosts_q[0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+        {
+            // Compute the linear indices.
+            const int idx_f = i + num_subghosts_0_f;
+            const int idx_rho = i + num_ghosts_0_rho;
+            const int idx_q = i + num_subghosts_0_q;
+            
+            f[idx_f] = EquationOfStateFunction(rho[idx_rho], q[idx_q], thermo_properties);
+        }
+    }
+    else if (dim == tbox::Dimension(2))
+    {
+        /*
+         * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
+         */
+        
+        const int domain_lo_0 = domain_lo[0];
+        const int domain_lo_1 = domain_lo[1];
+        const int domain_dim_0 = domain_dims[0];
+        const int domain_dim_1 = domain_dims[1];
+        
+        const int num_subghosts_0_f = num_subghosts_f[0];
+        const int num_subghosts_1_f = num_subghosts_f[1];
+        const int subghostcell_dim_0_f = subghostcell_dims_f[0];
+        
+        const int num_ghosts_0_rho = num_ghosts_rho[0];
+        const int num_ghosts_1_rho = num_ghosts_rho[1];
+        const int ghostcell_dim_0_rho = ghostcell_dims_rho[0];
+        
+        const int num_subghosts_0_q = num_subghosts_q[0];
+        const int num_subghosts_1_q = num_subghosts_q[1];
+        const int subghostcell_dim_0_q = subghostcell_dims_q[0];
+        
+        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
+        {
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+            {
+                // Compute the linear indices.
+                const int idx_f = (i + num_subghosts_0_f) +
+                    (j + num_subghosts_1_f)*subghostcell_dim_0_f;
+                
+                const int idx_rho = (i + num_ghosts_0_rho) +
+                    (j + num_ghosts_1_rho)*ghostcell_dim_0_rho;
+                
+                const int idx_q = (i + num_subghosts_0_q) +
+                    (j + num_subghosts_1_q)*subghostcell_dim_0_q;
+                
+                f[idx_f] = EquationOfStateFunction(rho[idx_rho], q[idx_q], thermo_properties);
+            }
+        }
+    }
+    else if (dim == tbox::Dimension(3))
+    {
+        /*
+         * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
+         */
+        
+        const int domain_lo_0 = domain_lo[0];
+        const int domain_lo_1 = domain_lo[1];
+        const int domain_lo_2 = domain_lo[2];
+        const int domain_dim_0 = domain_dims[0];
+        const int domain_dim_1 = domain_dims[1];
+        const int domain_dim_2 = domain_dims[2];
+        
+        const int num_subghosts_0_f = num_subghosts_f[0];
+        const int num_subghosts_1_f = num_subghosts_f[1];
+        const int num_subghosts_2_f = num_subghosts_f[2];
+        const int subghostcell_dim_0_f = subghostcell_dims_f[0];
+        const int subghostcell_dim_1_f = subghostcell_dims_f[1];
+        
+        const int num_ghosts_0_rho = num_ghosts_rho[0];
+        const int num_ghosts_1_rho = num_ghosts_rho[1];
+        const int num_ghosts_2_rho = num_ghosts_rho[2];
+        const int ghostcell_dim_0_rho = ghostcell_dims_rho[0];
+        const int ghostcell_dim_1_rho = ghostcell_dims_rho[1];
+        
+        const int num_subghosts_0_q = num_subghosts_q[0];
+        const int num_subghosts_1_q = num_subghosts_q[1];
+        const int num_subghosts_2_q = num_subghosts_q[2];
+        const int subghostcell_dim_0_q = subghostcell_dims_q[0];
+        const int subghostcell_dim_1_q = subghostcell_dims_q[1];
+        
+        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
+        {
+            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
+            {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+                {
+                    // Compute the linear indices.
+                    const int idx_f = (i + num_subghosts_0_f) +
+                        (j + num_subghosts_1_f)*subghostcell_dim_0_f +
+                        (k + num_subghosts_2_f)*subghostcell_dim_0_f*subghostcell_dim_1_f;
+                    
+                    const int idx_rho = (i + num_ghosts_0_rho) +
+                        (j + num_ghosts_1_rho)*ghostcell_dim_0_rho +
+                        (k + num_ghosts_2_rho)*ghostcell_dim_0_rho*ghostcell_dim_1_rho;
+                    
+                    const int idx_q = (i + num_subghosts_0_q) +
+                        (j + num_subghosts_1_q)*subghostcell_dim_0_q +
+                        (k + num_subghosts_2_q)*subghostcell_dim_0_q*subghostcell_dim_1_q;
+                    
+                    f[idx_f] = EquationOfStateFunction(rho[idx_rho], q[idx_q], thermo_properties);
+                }
+            }
+        }
+    }
+}
+
+
 /*
  * Compute the global cell data of pressure with internal energy in the registered patch.
  */
@@ -7308,13 +7478,57 @@ FlowModelSingleSpecies::computeGlobalCellDataPressureWithInternalEnergy(
             thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
         }
         
-        // Compute the pressure field.
-        d_equation_of_state_mixing_rules->getEquationOfState()->computePressure(
-            d_data_pressure,
-            data_density,
-            d_data_internal_energy,
-            thermo_properties_ptr,
-            domain);
+        /*
+         * Compute the pressure field. The ideal gas equation of state is inlined into the loops.
+         */
+        
+        if (d_equation_of_state_mixing_rules_manager->getEquationOfStateType() == EQN_STATE::IDEAL_GAS)
+        {
+            /*
+             * Get the local lower indices and number of cells in each direction of the domain.
+             */
+            
+            hier::IntVector domain_lo(d_dim);
+            hier::IntVector domain_dims(d_dim);
+            
+            if (domain.empty())
+            {
+                domain_lo = -d_num_subghosts_pressure;
+                domain_dims = d_subghostcell_dims_pressure;
+            }
+            else
+            {
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+                TBOX_ASSERT(d_subghost_box_pressure.contains(domain));
+#endif
+                
+                domain_lo = domain.lower() - d_interior_box.lower();
+                domain_dims = domain.numberCells();
+            }
+            
+            computeCellDataWithEquationOfStatePolicy<&EquationOfStateIdealGasPolicy::getPressure>(
+                d_data_pressure->getPointer(0),
+                data_density->getPointer(0),
+                d_data_internal_energy->getPointer(0),
+                d_thermo_properties.data(),
+                d_num_subghosts_pressure,
+                d_subghostcell_dims_pressure,
+                d_num_ghosts,
+                d_ghostcell_dims,
+                d_num_subghosts_internal_energy,
+                d_subghostcell_dims_internal_energy,
+                domain_lo,
+                domain_dims);
+        }
+        else
+        {
+            d_equation_of_state_mixing_rules->getEquationOfState()->computePressure(
+                d_data_pressure,
+                data_density,
+                d_data_internal_energy,
+                thermo_properties_ptr,
+                domain);
+        }
     }
     else
     {
@@ -7356,13 +7570,57 @@ FlowModelSingleSpecies::computeGlobalCellDataSoundSpeedWithPressure(
             thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
         }
         
-        // Compute the sound speed field.
-        d_equation_of_state_mixing_rules->getEquationOfState()->computeSoundSpeed(
-            d_data_sound_speed,
-            data_density,
-            d_data_pressure,
-            thermo_properties_ptr,
-            domain);
+        /*
+         * Compute the sound speed field. The ideal gas equation of state is inlined into the loops.
+         */
+        
+        if (d_equation_of_state_mixing_rules_manager->getEquationOfStateType() == EQN_STATE::IDEAL_GAS)
+        {
+            /*
+             * Get the local lower indices and number of cells in each direction of the domain.
+             */
+            
+            hier::IntVector domain_lo(d_dim);
+            hier::IntVector domain_dims(d_dim);
+            
+            if (domain.empty())
+            {
+                domain_lo = -d_num_subghosts_sound_speed;
+                domain_dims = d_subghostcell_dims_sound_speed;
+            }
+            else
+            {
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+                TBOX_ASSERT(d_subghost_box_sound_speed.contains(domain));
+#endif
+                
+                domain_lo = domain.lower() - d_interior_box.lower();
+                domain_dims = domain.numberCells();
+            }
+            
+            computeCellDataWithEquationOfStatePolicy<&EquationOfStateIdealGasPolicy::getSoundSpeed>(
+                d_data_sound_speed->getPointer(0),
+                data_density->getPointer(0),
+                d_data_pressure->getPointer(0),
+                d_thermo_properties.data(),
+                d_num_subghosts_sound_speed,
+                d_subghostcell_dims_sound_speed,
+                d_num_ghosts,
+                d_ghostcell_dims,
+                d_num_subghosts_pressure,
+                d_subghostcell_dims_pressure,
+                domain_lo,
+                domain_dims);
+        }
+        else
+        {
+            d_equation_of_state_mixing_rules->getEquationOfState()->computeSoundSpeed(
+                d_data_sound_speed,
+                data_density,
+                d_data_pressure,
+                thermo_properties_ptr,
+                domain);
+        }
     }
     else
     {
@@ -7404,13 +7662,57 @@ FlowModelSingleSpecies::computeGlobalCellDataTemperatureWithPressure(
             thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
         }
         
-        // Compute the temperature field.
-        d_equation_of_state_mixing_rules->getEquationOfState()->computeTemperature(
-            d_data_temperature,
-            data_density,
-            d_data_pressure,
-            thermo_properties_ptr,
-            domain);
+        /*
+         * Compute the temperature field. The ideal gas equation of state is inlined into the loops.
+         */
+        
+        if (d_equation_of_state_mixing_rules_manager->getEquationOfStateType() == EQN_STATE::IDEAL_GAS)
+        {
+            /*
+             * Get the local lower indices and number of cells in each direction of the domain.
+             */
+            
+            hier::IntVector domain_lo(d_dim);
+            hier::IntVector domain_dims(d_dim);
+            
+            if (domain.empty())
+            {
+                domain_lo = -d_num_subghosts_temperature;
+                domain_dims = d_subghostcell_dims_temperature;
+            }
+            else
+            {
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+                TBOX_ASSERT(d_subghost_box_temperature.contains(domain));
+#endif
+                
+                domain_lo = domain.lower() - d_interior_box.lower();
+                domain_dims = domain.numberCells();
+            }
+            
+            computeCellDataWithEquationOfStatePolicy<&EquationOfStateIdealGasPolicy::getTemperature>(
+                d_data_temperature->getPointer(0),
+                data_density->getPointer(0),
+                d_data_pressure->getPointer(0),
+                d_thermo_properties.data(),
+                d_num_subghosts_temperature,
+                d_subghostcell_dims_temperature,
+                d_num_ghosts,
+                d_ghostcell_dims,
+                d_num_subghosts_pressure,
+                d_subghostcell_dims_pressure,
+                domain_lo,
+                domain_dims);
+        }
+        else
+        {
+            d_equation_of_state_mixing_rules->getEquationOfState()->computeTemperature(
+                d_data_temperature,
+                data_density,
+                d_data_pressure,
+                thermo_properties_ptr,
+                domain);
+        }
     }
     else
     {
@@ -56,6 +56,19 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::putToRestart(
 }
 
 
+/*
+ * Register the derived cell variables required by the diffusive flux divergence in the flow model.
+ */
+void
+NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::registerDerivedVariablesForDiffusiveFluxDivergence(
+    const hier::Patch& patch)
+{
+    NULL_USE(patch);
+    
+    d_flow_model->registerDiffusiveFlux(d_num_diff_ghosts);
+}
+
+
 /*
  * Compute the non-conservative diffusive flux divergence on a patch.
  */
@@ -98,17 +111,27 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
     // Initialize the data of diffusive flux to zero.
     diffusive_flux_divergence->fillAll(double(0));
     
+    /*
+     * Check whether the patch and the derived cell variables are already registered in the flow
+     * model by the caller, which then also unregisters the patch.
+     */
+    
+    const bool is_patch_registered = d_flow_model->hasRegisteredPatch();
+    
     if (d_dim == tbox::Dimension(1))
     {
         /*
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        d_flow_model->registerDiffusiveFlux(d_num_diff_ghosts);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForDiffusiveFluxDivergence(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Delcare containers for computing flux derivatives in different directions.
@@ -128,9 +151,8 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         
         std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > diffusivities_derivative_x;
         
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_x_computed;
-        
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_xx_computed;
+        // Plan of the first and second derivatives computed on the patch.
+        DerivativePlan derivative_plan;
         
         /*
          * Compute the derivatives for diffusive flux in x-direction.
@@ -159,7 +181,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             var_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             var_data_x,
             var_component_idx_x);
         
@@ -167,7 +189,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             diffusivities_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             diffusivities_data_x,
             diffusivities_component_idx_x);
         
@@ -175,7 +197,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeSecondDerivativesInX(
             patch,
             var_derivative_xx,
-            derivative_xx_computed,
+            derivative_plan.derivative_xx_computed,
             var_data_x,
             var_component_idx_x);
         
@@ -204,11 +226,20 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         diffusivities_derivative_x.clear();
         var_derivative_xx.clear();
         
+        /*
+         * Free the buffers of all derivatives of the plan together.
+         */
+        
+        derivative_plan.clear();
+        
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
     }
     else if (d_dim == tbox::Dimension(2))
     {
@@ -216,11 +247,14 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        d_flow_model->registerDiffusiveFlux(d_num_diff_ghosts);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForDiffusiveFluxDivergence(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Delcare containers for computing flux derivatives in different directions.
@@ -239,7 +273,6 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         std::vector<std::vector<int> > diffusivities_component_idx_y;
         
         std::vector<std::vector<int> > var_derivative_component_idx_x;
-        std::vector<std::vector<int> > var_derivative_component_idx_y;
         
         std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > var_derivative_x;
         std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > var_derivative_y;
@@ -252,13 +285,8 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > diffusivities_derivative_x;
         std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > diffusivities_derivative_y;
         
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_x_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_y_computed;
-        
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_xx_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_xy_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_yx_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_yy_computed;
+        // Plan of the first and second derivatives computed on the patch.
+        DerivativePlan derivative_plan;
         
         /*
          * (1) Compute the derivatives for diffusive flux in x-direction.
@@ -287,7 +315,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             var_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             var_data_x,
             var_component_idx_x);
         
@@ -295,7 +323,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             diffusivities_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             diffusivities_data_x,
             diffusivities_component_idx_x);
         
@@ -303,7 +331,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeSecondDerivativesInX(
             patch,
             var_derivative_xx,
-            derivative_xx_computed,
+            derivative_plan.derivative_xx_computed,
             var_data_x,
             var_component_idx_x);
         
@@ -355,7 +383,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             var_derivative_y,
-            derivative_y_computed,
+            derivative_plan.derivative_y_computed,
             var_data_y,
             var_component_idx_y);
         
@@ -363,27 +391,35 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             diffusivities_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             diffusivities_data_y,
             diffusivities_component_idx_y);
         
-        // Compute the mixed derivatives of variables.
-        var_derivative_component_idx_y.resize(d_num_eqn);
+        // Compute the mixed derivatives of variables. They are taken in y-direction of the first
+        // derivatives in x-direction so that they are shared with the diffusive flux in y-direction.
+        computeFirstDerivativesInX(
+            patch,
+            var_derivative_x,
+            derivative_plan.derivative_x_computed,
+            var_data_y,
+            var_component_idx_y);
+        
+        var_derivative_component_idx_x.resize(d_num_eqn);
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            var_derivative_component_idx_y[ei].resize(var_derivative_y[ei].size());
-            for (int vi = 0; vi < static_cast<int>(var_derivative_component_idx_y[ei].size()); vi++)
+            var_derivative_component_idx_x[ei].resize(var_derivative_x[ei].size());
+            for (int vi = 0; vi < static_cast<int>(var_derivative_component_idx_x[ei].size()); vi++)
             {
-                var_derivative_component_idx_y[ei][vi] = 0;
+                var_derivative_component_idx_x[ei][vi] = 0;
             }
         }
         
-        computeFirstDerivativesInX(
+        computeFirstDerivativesInY(
             patch,
             var_derivative_xy,
-            derivative_xy_computed,
-            var_derivative_y,
-            var_derivative_component_idx_y);
+            derivative_plan.derivative_xy_computed,
+            var_derivative_x,
+            var_derivative_component_idx_x);
         
         // Add the derivatives to the divergence of diffusive flux.
         
@@ -406,8 +442,9 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         
         diffusivities_component_idx_y.clear();
         
-        var_derivative_component_idx_y.clear();
+        var_derivative_component_idx_x.clear();
         
+        var_derivative_x.clear();
         var_derivative_y.clear();
         diffusivities_derivative_x.clear();
         var_derivative_xy.clear();
@@ -439,7 +476,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             var_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             var_data_x,
             var_component_idx_x);
         
@@ -447,7 +484,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             diffusivities_derivative_y,
-            derivative_y_computed,
+            derivative_plan.derivative_y_computed,
             diffusivities_data_x,
             diffusivities_component_idx_x);
         
@@ -465,7 +502,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             var_derivative_yx,
-            derivative_yx_computed,
+            derivative_plan.derivative_xy_computed,
             var_derivative_x,
             var_derivative_component_idx_x);
         
@@ -519,7 +556,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             var_derivative_y,
-            derivative_y_computed,
+            derivative_plan.derivative_y_computed,
             var_data_y,
             var_component_idx_y);
         
@@ -527,7 +564,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             diffusivities_derivative_y,
-            derivative_y_computed,
+            derivative_plan.derivative_y_computed,
             diffusivities_data_y,
             diffusivities_component_idx_y);
         
@@ -535,7 +572,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeSecondDerivativesInY(
             patch,
             var_derivative_yy,
-            derivative_yy_computed,
+            derivative_plan.derivative_yy_computed,
             var_data_y,
             var_component_idx_y);
         
@@ -564,11 +601,20 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         diffusivities_derivative_y.clear();
         var_derivative_yy.clear();
         
+        /*
+         * Free the buffers of all derivatives of the plan together.
+         */
+        
+        derivative_plan.clear();
+        
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
     }
     else if (d_dim == tbox::Dimension(3))
     {
@@ -576,11 +622,14 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, data_context);
-        
-        d_flow_model->registerDiffusiveFlux(d_num_diff_ghosts);
-        
-        d_flow_model->computeGlobalDerivedCellData();
+        if (!is_patch_registered)
+        {
+            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            
+            registerDerivedVariablesForDiffusiveFluxDivergence(patch);
+            
+            d_flow_model->computeGlobalDerivedCellData();
+        }
         
         /*
          * Delcare containers for computing flux derivatives in different directions.
@@ -604,7 +653,6 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         
         std::vector<std::vector<int> > var_derivative_component_idx_x;
         std::vector<std::vector<int> > var_derivative_component_idx_y;
-        std::vector<std::vector<int> > var_derivative_component_idx_z;
         
         std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > var_derivative_x;
         std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > var_derivative_y;
@@ -624,19 +672,8 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > diffusivities_derivative_y;
         std::vector<std::vector<boost::shared_ptr<pdat::CellData<double> > > > diffusivities_derivative_z;
         
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_x_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_y_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_z_computed;
-        
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_xx_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_xy_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_xz_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_yx_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_yy_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_yz_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_zx_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_zy_computed;
-        std::map<double*, boost::shared_ptr<pdat::CellData<double> > > derivative_zz_computed;
+        // Plan of the first and second derivatives computed on the patch.
+        DerivativePlan derivative_plan;
         
         /*
          * (1) Compute the derivatives for diffusive flux in x-direction.
@@ -665,7 +702,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             var_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             var_data_x,
             var_component_idx_x);
         
@@ -673,7 +710,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             diffusivities_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             diffusivities_data_x,
             diffusivities_component_idx_x);
         
@@ -681,7 +718,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeSecondDerivativesInX(
             patch,
             var_derivative_xx,
-            derivative_xx_computed,
+            derivative_plan.derivative_xx_computed,
             var_data_x,
             var_component_idx_x);
         
@@ -733,7 +770,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             var_derivative_y,
-            derivative_y_computed,
+            derivative_plan.derivative_y_computed,
             var_data_y,
             var_component_idx_y);
         
@@ -741,27 +778,35 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             diffusivities_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             diffusivities_data_y,
             diffusivities_component_idx_y);
         
-        // Compute the mixed derivatives of variables.
-        var_derivative_component_idx_y.resize(d_num_eqn);
+        // Compute the mixed derivatives of variables. They are taken in y-direction of the first
+        // derivatives in x-direction so that they are shared with the diffusive flux in y-direction.
+        computeFirstDerivativesInX(
+            patch,
+            var_derivative_x,
+            derivative_plan.derivative_x_computed,
+            var_data_y,
+            var_component_idx_y);
+        
+        var_derivative_component_idx_x.resize(d_num_eqn);
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            var_derivative_component_idx_y[ei].resize(var_derivative_y[ei].size());
-            for (int vi = 0; vi < static_cast<int>(var_derivative_component_idx_y[ei].size()); vi++)
+            var_derivative_component_idx_x[ei].resize(var_derivative_x[ei].size());
+            for (int vi = 0; vi < static_cast<int>(var_derivative_component_idx_x[ei].size()); vi++)
             {
-                var_derivative_component_idx_y[ei][vi] = 0;
+                var_derivative_component_idx_x[ei][vi] = 0;
             }
         }
         
-        computeFirstDerivativesInX(
+        computeFirstDerivativesInY(
             patch,
             var_derivative_xy,
-            derivative_xy_computed,
-            var_derivative_y,
-            var_derivative_component_idx_y);
+            derivative_plan.derivative_xy_computed,
+            var_derivative_x,
+            var_derivative_component_idx_x);
         
         // Add the derivatives to the divergence of diffusive flux.
         
@@ -784,8 +829,9 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         
         diffusivities_component_idx_y.clear();
         
-        var_derivative_component_idx_y.clear();
+        var_derivative_component_idx_x.clear();
         
+        var_derivative_x.clear();
         var_derivative_y.clear();
         diffusivities_derivative_x.clear();
         var_derivative_xy.clear();
@@ -813,7 +859,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInZ(
             patch,
             var_derivative_z,
-            derivative_z_computed,
+            derivative_plan.derivative_z_computed,
             var_data_z,
             var_component_idx_z);
         
@@ -821,27 +867,35 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             diffusivities_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             diffusivities_data_z,
             diffusivities_component_idx_z);
         
-        // Compute the mixed derivatives of variables.
-        var_derivative_component_idx_z.resize(d_num_eqn);
+        // Compute the mixed derivatives of variables. They are taken in z-direction of the first
+        // derivatives in x-direction so that they are shared with the diffusive flux in z-direction.
+        computeFirstDerivativesInX(
+            patch,
+            var_derivative_x,
+            derivative_plan.derivative_x_computed,
+            var_data_z,
+            var_component_idx_z);
+        
+        var_derivative_component_idx_x.resize(d_num_eqn);
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            var_derivative_component_idx_z[ei].resize(var_derivative_z[ei].size());
-            for (int vi = 0; vi < static_cast<int>(var_derivative_component_idx_z[ei].size()); vi++)
+            var_derivative_component_idx_x[ei].resize(var_derivative_x[ei].size());
+            for (int vi = 0; vi < static_cast<int>(var_derivative_component_idx_x[ei].size()); vi++)
             {
-                var_derivative_component_idx_z[ei][vi] = 0;
+                var_derivative_component_idx_x[ei][vi] = 0;
             }
         }
         
-        computeFirstDerivativesInX(
+        computeFirstDerivativesInZ(
             patch,
             var_derivative_xz,
-            derivative_xz_computed,
-            var_derivative_z,
-            var_derivative_component_idx_z);
+            derivative_plan.derivative_xz_computed,
+            var_derivative_x,
+            var_derivative_component_idx_x);
         
         // Add the derivatives to the divergence of diffusive flux.
         
@@ -864,8 +918,9 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         
         diffusivities_component_idx_z.clear();
         
-        var_derivative_component_idx_z.clear();
+        var_derivative_component_idx_x.clear();
         
+        var_derivative_x.clear();
         var_derivative_z.clear();
         diffusivities_derivative_x.clear();
         var_derivative_xz.clear();
@@ -897,7 +952,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             var_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             var_data_x,
             var_component_idx_x);
         
@@ -905,7 +960,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             diffusivities_derivative_y,
-            derivative_y_computed,
+            derivative_plan.derivative_y_computed,
             diffusivities_data_x,
             diffusivities_component_idx_x);
         
@@ -923,7 +978,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             var_derivative_yx,
-            derivative_yx_computed,
+            derivative_plan.derivative_xy_computed,
             var_derivative_x,
             var_derivative_component_idx_x);
         
@@ -977,7 +1032,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             var_derivative_y,
-            derivative_y_computed,
+            derivative_plan.derivative_y_computed,
             var_data_y,
             var_component_idx_y);
         
@@ -985,7 +1040,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             diffusivities_derivative_y,
-            derivative_y_computed,
+            derivative_plan.derivative_y_computed,
             diffusivities_data_y,
             diffusivities_component_idx_y);
         
@@ -993,7 +1048,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeSecondDerivativesInY(
             patch,
             var_derivative_yy,
-            derivative_yy_computed,
+            derivative_plan.derivative_yy_computed,
             var_data_y,
             var_component_idx_y);
         
@@ -1045,7 +1100,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInZ(
             patch,
             var_derivative_z,
-            derivative_z_computed,
+            derivative_plan.derivative_z_computed,
             var_data_z,
             var_component_idx_z);
         
@@ -1053,27 +1108,35 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             diffusivities_derivative_y,
-            derivative_y_computed,
+            derivative_plan.derivative_y_computed,
             diffusivities_data_z,
             diffusivities_component_idx_z);
         
-        // Compute the mixed derivatives of variables.
-        var_derivative_component_idx_z.resize(d_num_eqn);
+        // Compute the mixed derivatives of variables. They are taken in z-direction of the first
+        // derivatives in y-direction so that they are shared with the diffusive flux in z-direction.
+        computeFirstDerivativesInY(
+            patch,
+            var_derivative_y,
+            derivative_plan.derivative_y_computed,
+            var_data_z,
+            var_component_idx_z);
+        
+        var_derivative_component_idx_y.resize(d_num_eqn);
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            var_derivative_component_idx_z[ei].resize(var_derivative_z[ei].size());
-            for (int vi = 0; vi < static_cast<int>(var_derivative_component_idx_z[ei].size()); vi++)
+            var_derivative_component_idx_y[ei].resize(var_derivative_y[ei].size());
+            for (int vi = 0; vi < static_cast<int>(var_derivative_component_idx_y[ei].size()); vi++)
             {
-                var_derivative_component_idx_z[ei][vi] = 0;
+                var_derivative_component_idx_y[ei][vi] = 0;
             }
         }
         
-        computeFirstDerivativesInY(
+        computeFirstDerivativesInZ(
             patch,
             var_derivative_yz,
-            derivative_yz_computed,
-            var_derivative_z,
-            var_derivative_component_idx_z);
+            derivative_plan.derivative_yz_computed,
+            var_derivative_y,
+            var_derivative_component_idx_y);
         
         // Add the derivatives to the divergence of diffusive flux.
         
@@ -1096,8 +1159,9 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         
         diffusivities_component_idx_z.clear();
         
-        var_derivative_component_idx_z.clear();
+        var_derivative_component_idx_y.clear();
         
+        var_derivative_y.clear();
         var_derivative_z.clear();
         diffusivities_derivative_y.clear();
         var_derivative_yz.clear();
@@ -1129,7 +1193,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInX(
             patch,
             var_derivative_x,
-            derivative_x_computed,
+            derivative_plan.derivative_x_computed,
             var_data_x,
             var_component_idx_x);
         
@@ -1137,7 +1201,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInZ(
             patch,
             diffusivities_derivative_z,
-            derivative_z_computed,
+            derivative_plan.derivative_z_computed,
             diffusivities_data_x,
             diffusivities_component_idx_x);
         
@@ -1155,7 +1219,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInZ(
             patch,
             var_derivative_zx,
-            derivative_zx_computed,
+            derivative_plan.derivative_xz_computed,
             var_derivative_x,
             var_derivative_component_idx_x);
         
@@ -1209,7 +1273,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInY(
             patch,
             var_derivative_y,
-            derivative_y_computed,
+            derivative_plan.derivative_y_computed,
             var_data_y,
             var_component_idx_y);
         
@@ -1217,7 +1281,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInZ(
             patch,
             diffusivities_derivative_z,
-            derivative_z_computed,
+            derivative_plan.derivative_z_computed,
             diffusivities_data_y,
             diffusivities_component_idx_y);
         
@@ -1235,7 +1299,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInZ(
             patch,
             var_derivative_zy,
-            derivative_zy_computed,
+            derivative_plan.derivative_yz_computed,
             var_derivative_y,
             var_derivative_component_idx_y);
         
@@ -1289,7 +1353,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInZ(
             patch,
             var_derivative_z,
-            derivative_z_computed,
+            derivative_plan.derivative_z_computed,
             var_data_z,
             var_component_idx_z);
         
@@ -1297,7 +1361,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeFirstDerivativesInZ(
             patch,
             diffusivities_derivative_z,
-            derivative_z_computed,
+            derivative_plan.derivative_z_computed,
             diffusivities_data_z,
             diffusivities_component_idx_z);
         
@@ -1305,7 +1369,7 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         computeSecondDerivativesInZ(
             patch,
             var_derivative_zz,
-            derivative_zz_computed,
+            derivative_plan.derivative_zz_computed,
             var_data_z,
             var_component_idx_z);
         
@@ -1334,11 +1398,20 @@ NonconservativeDiffusiveFluxDivergenceOperatorSixthOrder::computeNonconservative
         diffusivities_derivative_z.clear();
         var_derivative_zz.clear();
         
+        /*
+         * Free the buffers of all derivatives of the plan together.
+         */
+        
+        derivative_plan.clear();
+        
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        if (!is_patch_registered)
+        {
+            d_flow_model->unregisterPatch();
+        }
     }
 }
 
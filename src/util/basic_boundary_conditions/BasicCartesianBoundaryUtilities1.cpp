@@ -81,6 +81,8 @@ BasicCartesianBoundaryUtilities1::getFromInput(
  *                           (this must be consistent with boundary
  *                           condition types)
  *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
  */
 void
 BasicCartesianBoundaryUtilities1::fillNodeBoundaryData(
@@ -90,7 +92,8 @@ BasicCartesianBoundaryUtilities1::fillNodeBoundaryData(
     const std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<double>& bdry_node_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(!var_name.empty());
     TBOX_ASSERT(var_data);
@@ -105,11 +108,6 @@ BasicCartesianBoundaryUtilities1::fillNodeBoundaryData(
     
     NULL_USE(var_name);
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     const hier::IntVector& num_ghosts(var_data->getGhostCellWidth());
     
     /*
@@ -144,8 +142,18 @@ BasicCartesianBoundaryUtilities1::fillNodeBoundaryData(
     // ghost cells.
     const hier::IntVector ghostcell_dims = var_data->getGhostBox().numberCells();
     
-    const std::vector<hier::BoundaryBox>& node_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::NODE1D);
+    /*
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE1D);
+    const std::vector<hier::Box>& node_fill_boxes = fill_plan->getFillBoxes(BDRY::NODE1D, gcw_to_fill);
     
     const int var_depth = var_data->getDepth();
     
@@ -158,10 +166,7 @@ BasicCartesianBoundaryUtilities1::fillNodeBoundaryData(
         if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
             bdry_node_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                node_bdry[ni],
-                interior_box,
-                gcw_to_fill));
+            const hier::Box& fill_box(node_fill_boxes[ni]);
             
             hier::Index fill_box_lo_idx(fill_box.lower());
             hier::Index fill_box_hi_idx(fill_box.upper());
@@ -21,6 +21,7 @@
 #include "SAMRAI/tbox/MathUtilities.h"
 
 #include <algorithm>
+#include <cstring>
 
 /*
  * This function reads 2D boundary data from given input database.
@@ -111,6 +112,8 @@ BasicCartesianBoundaryUtilities2::getFromInput(
  *                           (this must be consistent with boundary
  *                           condition types)
  *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
  */
 void
 BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
@@ -120,7 +123,8 @@ BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
     const std::vector<int>& bdry_edge_locs,
     const std::vector<int>& bdry_edge_conds,
     const std::vector<double>& bdry_edge_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(!var_name.empty());
     TBOX_ASSERT(var_data);
@@ -135,11 +139,6 @@ BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
     
     NULL_USE(var_name);
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     const hier::IntVector& num_ghosts(var_data->getGhostCellWidth());
     
     /*
@@ -159,25 +158,21 @@ BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
             ghost_width_to_fill);
     }
     
-    // Get the dimensions of box that covers the interior of patch.
+    // Get the box that covers the interior of patch.
     const hier::Box& interior_box(patch.getBox());
-    hier::Index interior_box_lo_idx(interior_box.lower());
-    hier::Index interior_box_hi_idx(interior_box.upper());
     
     /*
-     * Offset the indices.
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
      */
-    interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
-    interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    // Get the dimensions of box that covers interior of patch plus
-    // ghost cells.
-    const hier::IntVector ghostcell_dims = var_data->getGhostBox().numberCells();
-    
-    const std::vector<hier::BoundaryBox>& edge_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::EDGE2D);
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
     
-    const int var_depth = var_data->getDepth();
+    const std::vector<hier::BoundaryBox>& edge_bdry = fill_plan->getBoundaryBoxes(BDRY::EDGE2D);
+    const std::vector<hier::Box>& edge_fill_boxes = fill_plan->getFillBoxes(BDRY::EDGE2D, gcw_to_fill);
     
     for (int ei = 0; ei < static_cast<int>(edge_bdry.size()); ei++)
     {
@@ -188,165 +183,22 @@ BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
         if (std::find(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc) !=
             bdry_edge_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                edge_bdry[ei],
-                interior_box,
-                gcw_to_fill));
-            
-            hier::Index fill_box_lo_idx(fill_box.lower());
-            hier::Index fill_box_hi_idx(fill_box.upper());
-            
-            /*
-             * Offset the indices.
-             */
-            fill_box_lo_idx = fill_box_lo_idx - interior_box.lower();
-            fill_box_hi_idx = fill_box_hi_idx - interior_box.lower();
-            
-            if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::DIRICHLET)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = bdry_edge_values[edge_loc*var_depth + di];
-                        }
-                    }
-                }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::NEUMANN)
+            if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::NEUMANN)
             {
                 // NOT YET IMPLEMENTED
             }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::FLOW)
+            else if ((bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::DIRICHLET) ||
+                     (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::FLOW) ||
+                     (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::REFLECT) ||
+                     (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::SYMMETRY))
             {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        int idx_cell_pivot = idx_cell;
-                        
-                        if (edge_loc == BDRY_LOC::XLO)
-                        {
-                            idx_cell_pivot = (interior_box_lo_idx[0] + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc == BDRY_LOC::XHI)
-                        {
-                            idx_cell_pivot = (interior_box_hi_idx[0] + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc == BDRY_LOC::YLO)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_lo_idx[1] + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc == BDRY_LOC::YHI)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_hi_idx[1] + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                        }
-                    }
-                }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::REFLECT)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        int idx_cell_pivot = idx_cell;
-                        
-                        if (edge_loc == BDRY_LOC::XLO)
-                        {
-                            idx_cell_pivot = (interior_box_lo_idx[0] + (fill_box_hi_idx[0] - i) + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc == BDRY_LOC::XHI)
-                        {
-                            idx_cell_pivot = (interior_box_hi_idx[0] - (i - fill_box_lo_idx[0]) + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc == BDRY_LOC::YLO)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_lo_idx[1] + (fill_box_hi_idx[1] - j) + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc == BDRY_LOC::YHI)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_hi_idx[1] - (j - fill_box_lo_idx[1]) + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                        }
-                        
-                        if (edge_loc == BDRY_LOC::XLO || edge_loc == BDRY_LOC::XHI)
-                        {
-                            var_data->getPointer(0)[idx_cell] = -var_data->getPointer(0)[idx_cell_pivot];
-                        }
-                        else if (edge_loc == BDRY_LOC::YLO || edge_loc == BDRY_LOC::YHI)
-                        {
-                            var_data->getPointer(1)[idx_cell] = -var_data->getPointer(1)[idx_cell_pivot];
-                        }
-                    }
-                }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::SYMMETRY)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        int idx_cell_pivot = idx_cell;
-                        
-                        if (edge_loc == BDRY_LOC::XLO)
-                        {
-                            idx_cell_pivot = (interior_box_lo_idx[0] + (fill_box_hi_idx[0] - i) + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc == BDRY_LOC::XHI)
-                        {
-                            idx_cell_pivot = (interior_box_hi_idx[0] - (i - fill_box_lo_idx[0]) + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc == BDRY_LOC::YLO)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_lo_idx[1] + (fill_box_hi_idx[1] - j) + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc == BDRY_LOC::YHI)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_hi_idx[1] - (j - fill_box_lo_idx[1]) + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                        }
-                    }
-                }
+                fillBoxWithEdgeBoundaryCondition(
+                    var_data,
+                    edge_fill_boxes[ei],
+                    interior_box,
+                    edge_loc,
+                    bdry_edge_conds[edge_loc],
+                    bdry_edge_values);
             }
             else
             {
@@ -361,6 +213,133 @@ BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
 }
 
 
+/*
+ * Function to fill edge boundary values of several variables. The edge boundary boxes are
+ * traversed once and all the variables are filled for each of them.
+ *
+ * Arguments are:
+ *    var_names ............ names of variables (for error reporting)
+ *    var_data ............. cell-centered patch data objects to fill
+ *    patch ................ patch on which data objects live
+ *    bdry_edge_locs ....... array of locations of edges for applying
+ *                           boundary conditions.
+ *    bdry_edge_conds ...... arrays of boundary conditions for patch edges,
+ *                           one for each variable
+ *    bdry_edge_values ..... arrays of boundary values for edges, one for
+ *                           each variable
+ *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
+ */
+void
+BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
+    const std::vector<std::string>& var_names,
+    const std::vector<boost::shared_ptr<pdat::CellData<double> > >& var_data,
+    const hier::Patch& patch,
+    const std::vector<int>& bdry_edge_locs,
+    const std::vector<std::vector<int> >& bdry_edge_conds,
+    const std::vector<std::vector<double> >& bdry_edge_values,
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
+{
+    TBOX_ASSERT(var_names.size() == var_data.size());
+    TBOX_ASSERT(bdry_edge_conds.size() == var_data.size());
+    TBOX_ASSERT(bdry_edge_values.size() == var_data.size());
+    TBOX_ASSERT(static_cast<int>(bdry_edge_locs.size()) <= NUM_2D_EDGES);
+    
+    TBOX_DIM_ASSERT(ghost_width_to_fill.getDim() == tbox::Dimension(2));
+    
+    const int num_vars = static_cast<int>(var_data.size());
+    
+    /*
+     * Determine the ghost cell widths to fill of the variables.
+     */
+    
+    std::vector<hier::IntVector> gcw_to_fill;
+    gcw_to_fill.reserve(num_vars);
+    
+    for (int vi = 0; vi < num_vars; vi++)
+    {
+        TBOX_ASSERT(var_data[vi]);
+        TBOX_ASSERT(static_cast<int>(bdry_edge_conds[vi].size()) == NUM_2D_EDGES);
+        TBOX_ASSERT(static_cast<int>(bdry_edge_values[vi].size()) == NUM_2D_EDGES*(var_data[vi]->getDepth()));
+        TBOX_ASSERT_OBJDIM_EQUALITY3(*var_data[vi], patch, ghost_width_to_fill);
+        
+        // If the ghost fill width is not used, it is set to the ghost cell width of the data.
+        if (ghost_width_to_fill == -hier::IntVector::getOne(tbox::Dimension(2)))
+        {
+            gcw_to_fill.push_back(var_data[vi]->getGhostCellWidth());
+        }
+        else
+        {
+            gcw_to_fill.push_back(hier::IntVector::min(
+                var_data[vi]->getGhostCellWidth(),
+                ghost_width_to_fill));
+        }
+    }
+    
+    // Get the box that covers the interior of patch.
+    const hier::Box& interior_box(patch.getBox());
+    
+    /*
+     * Get the boundary boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& edge_bdry = fill_plan->getBoundaryBoxes(BDRY::EDGE2D);
+    
+    for (int ei = 0; ei < static_cast<int>(edge_bdry.size()); ei++)
+    {
+        TBOX_ASSERT(edge_bdry[ei].getBoundaryType() == BDRY::EDGE2D);
+        
+        int edge_loc = edge_bdry[ei].getLocationIndex();
+        
+        if (std::find(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc) !=
+            bdry_edge_locs.end())
+        {
+            for (int vi = 0; vi < num_vars; vi++)
+            {
+                const hier::Box& fill_box(fill_plan->getFillBoxes(BDRY::EDGE2D, gcw_to_fill[vi])[ei]);
+                
+                const int bdry_edge_cond = bdry_edge_conds[vi][edge_loc];
+                
+                if (bdry_edge_cond == BDRY_COND::BASIC::NEUMANN)
+                {
+                    // NOT YET IMPLEMENTED
+                }
+                else if ((bdry_edge_cond == BDRY_COND::BASIC::DIRICHLET) ||
+                         (bdry_edge_cond == BDRY_COND::BASIC::FLOW) ||
+                         (bdry_edge_cond == BDRY_COND::BASIC::REFLECT) ||
+                         (bdry_edge_cond == BDRY_COND::BASIC::SYMMETRY))
+                {
+                    fillBoxWithEdgeBoundaryCondition(
+                        var_data[vi],
+                        fill_box,
+                        interior_box,
+                        edge_loc,
+                        bdry_edge_cond,
+                        bdry_edge_values[vi]);
+                }
+                else
+                {
+                    TBOX_ERROR("BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData()\n"
+                        << "Invalid edge boundary condition!\n"
+                        << "var_name = '" << var_names[vi] << "'." << std::endl
+                        << "edge_loc = '" << edge_loc << "'." << std::endl
+                        << "bdry_edge_conds[edge_loc] = '" << bdry_edge_conds[vi][edge_loc] << "'."
+                        << std::endl);
+                }
+            }
+        }
+    }
+}
+
+
 /*
  * Function to fill node boundary values.
  *
@@ -375,6 +354,8 @@ BasicCartesianBoundaryUtilities2::fillEdgeBoundaryData(
  *                           (this must be consistent with boundary
  *                           condition types)
  *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
  */
 void
 BasicCartesianBoundaryUtilities2::fillNodeBoundaryData(
@@ -384,7 +365,8 @@ BasicCartesianBoundaryUtilities2::fillNodeBoundaryData(
     const std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<double>& bdry_edge_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(!var_name.empty());
     TBOX_ASSERT(var_data);
@@ -399,11 +381,6 @@ BasicCartesianBoundaryUtilities2::fillNodeBoundaryData(
     
     NULL_USE(var_name);
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     const hier::IntVector& num_ghosts(var_data->getGhostCellWidth());
     
     /*
@@ -423,25 +400,21 @@ BasicCartesianBoundaryUtilities2::fillNodeBoundaryData(
             ghost_width_to_fill);
     }
     
-    // Get the dimensions of box that covers the interior of patch.
+    // Get the box that covers the interior of patch.
     const hier::Box& interior_box(patch.getBox());
-    hier::Index interior_box_lo_idx(interior_box.lower());
-    hier::Index interior_box_hi_idx(interior_box.upper());
     
     /*
-     * Offset the indices.
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
      */
-    interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
-    interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
     
-    // Get the dimensions of box that covers interior of patch plus
-    // ghost cells.
-    const hier::IntVector ghostcell_dims = var_data->getGhostBox().numberCells();
-    
-    const std::vector<hier::BoundaryBox>& node_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::NODE2D);
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
     
-    const int var_depth = var_data->getDepth();
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE2D);
+    const std::vector<hier::Box>& node_fill_boxes = fill_plan->getFillBoxes(BDRY::NODE2D, gcw_to_fill);
     
     for (int ni = 0; ni < static_cast<int>(node_bdry.size()); ni++)
     {
@@ -452,283 +425,163 @@ BasicCartesianBoundaryUtilities2::fillNodeBoundaryData(
         if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
             bdry_node_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                node_bdry[ni],
-                interior_box,
-                gcw_to_fill));
-            
-            hier::Index fill_box_lo_idx(fill_box.lower());
-            hier::Index fill_box_hi_idx(fill_box.upper());
-            
             /*
-             * Offset the indices.
+             * The node boundary condition is the boundary condition of one of the edges touching
+             * the node, applied to the fill box of the node.
              */
-            fill_box_lo_idx = fill_box_lo_idx - interior_box.lower();
-            fill_box_hi_idx = fill_box_hi_idx - interior_box.lower();
-            
-            int edge_loc_0 = -1;
-            int edge_loc_1 = -1;
             
-            switch (node_loc)
-            {
-                case NODE_BDRY_LOC_2D::XLO_YLO:
-                {
-                    edge_loc_0 = BDRY_LOC::XLO;
-                    edge_loc_1 = BDRY_LOC::YLO;
-                    
-                    break;
-                }
-                case NODE_BDRY_LOC_2D::XHI_YLO:
-                {
-                    edge_loc_0 = BDRY_LOC::XHI;
-                    edge_loc_1 = BDRY_LOC::YLO;
-                    
-                    break;
-                }
-                case NODE_BDRY_LOC_2D::XLO_YHI:
-                {
-                    edge_loc_0 = BDRY_LOC::XLO;
-                    edge_loc_1 = BDRY_LOC::YHI;
-                    
-                    break;
-                }
-                case NODE_BDRY_LOC_2D::XHI_YHI:
-                {
-                    edge_loc_0 = BDRY_LOC::XHI;
-                    edge_loc_1 = BDRY_LOC::YHI;
-                    
-                    break;
-                }
-            }
+            const int edge_bdry_cond = getEdgeBoundaryConditionType(bdry_node_conds[node_loc]);
             
-            if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::XDIRICHLET)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = bdry_edge_values[edge_loc_0*var_depth + di];
-                        }
-                        
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::YDIRICHLET)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = bdry_edge_values[edge_loc_1*var_depth + di];
-                        }
-                        
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::XNEUMANN)
+            if (edge_bdry_cond == BDRY_COND::BASIC::NEUMANN)
             {
                 // NOT YET IMPLEMENTED
             }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::YNEUMANN)
+            else if (edge_bdry_cond != -1)
             {
-                // NOT YET IMPLEMENTED
+                const int edge_loc = getEdgeLocationForNodeBdry(node_loc, bdry_node_conds[node_loc]);
+                
+                fillBoxWithEdgeBoundaryCondition(
+                    var_data,
+                    node_fill_boxes[ni],
+                    interior_box,
+                    edge_loc,
+                    edge_bdry_cond,
+                    bdry_edge_values);
             }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::XFLOW)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        int idx_cell_pivot = idx_cell;
-                        
-                        if (edge_loc_0 == BDRY_LOC::XLO)
-                        {
-                            idx_cell_pivot = (interior_box_lo_idx[0] + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc_0 == BDRY_LOC::XHI)
-                        {
-                            idx_cell_pivot = (interior_box_hi_idx[0] + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                        }
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::YFLOW)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        int idx_cell_pivot = idx_cell;
-                        
-                        if (edge_loc_1 == BDRY_LOC::YLO)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_lo_idx[1] + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc_1 == BDRY_LOC::YHI)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_hi_idx[1] + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                        }
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::XREFLECT)
+            else
             {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        int idx_cell_pivot = idx_cell;
-                        
-                        if (edge_loc_0 == BDRY_LOC::XLO)
-                        {
-                            idx_cell_pivot = (interior_box_lo_idx[0] + (fill_box_hi_idx[0] - i) + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc_0 == BDRY_LOC::XHI)
-                        {
-                            idx_cell_pivot = (interior_box_hi_idx[0] - (i - fill_box_lo_idx[0]) + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                        }
-                        
-                        var_data->getPointer(0)[idx_cell] = -var_data->getPointer(0)[idx_cell_pivot];
-                    }
-                }
+                TBOX_ERROR("BasicCartesianBoundaryUtilities2::fillNodeBoundaryData()\n"
+                    << "Invalid node boundary condition!\n"
+                    << "node_loc = '" << node_loc << "'." << std::endl
+                    << "bdry_node_conds[node_loc] = '" << bdry_node_conds[node_loc] << "'."
+                    << std::endl);
             }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::YREFLECT)
+        }
+    }
+}
+
+
+/*
+ * Function to fill node boundary values of several variables. The node boundary boxes are
+ * traversed once and all the variables are filled for each of them.
+ *
+ * Arguments are:
+ *    var_names ............ names of variables (for error reporting)
+ *    var_data ............. cell-centered patch data objects to fill
+ *    patch ................ patch on which data objects live
+ *    bdry_node_locs ....... array of locations of nodes for applying
+ *                           boundary conditions.
+ *    bdry_node_conds ...... arrays of boundary conditions for patch nodes,
+ *                           one for each variable
+ *    bdry_edge_values ..... arrays of boundary values for edges, one for
+ *                           each variable
+ *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
+ */
+void
+BasicCartesianBoundaryUtilities2::fillNodeBoundaryData(
+    const std::vector<std::string>& var_names,
+    const std::vector<boost::shared_ptr<pdat::CellData<double> > >& var_data,
+    const hier::Patch& patch,
+    const std::vector<int>& bdry_node_locs,
+    const std::vector<std::vector<int> >& bdry_node_conds,
+    const std::vector<std::vector<double> >& bdry_edge_values,
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
+{
+    TBOX_ASSERT(var_names.size() == var_data.size());
+    TBOX_ASSERT(bdry_node_conds.size() == var_data.size());
+    TBOX_ASSERT(bdry_edge_values.size() == var_data.size());
+    TBOX_ASSERT(static_cast<int>(bdry_node_locs.size()) <= NUM_2D_NODES);
+    
+    TBOX_DIM_ASSERT(ghost_width_to_fill.getDim() == tbox::Dimension(2));
+    
+    const int num_vars = static_cast<int>(var_data.size());
+    
+    /*
+     * Determine the ghost cell widths to fill of the variables.
+     */
+    
+    std::vector<hier::IntVector> gcw_to_fill;
+    gcw_to_fill.reserve(num_vars);
+    
+    for (int vi = 0; vi < num_vars; vi++)
+    {
+        TBOX_ASSERT(var_data[vi]);
+        TBOX_ASSERT(static_cast<int>(bdry_node_conds[vi].size()) == NUM_2D_NODES);
+        TBOX_ASSERT(static_cast<int>(bdry_edge_values[vi].size()) == NUM_2D_EDGES*(var_data[vi]->getDepth()));
+        TBOX_ASSERT_OBJDIM_EQUALITY3(*var_data[vi], patch, ghost_width_to_fill);
+        
+        // If the ghost fill width is not used, it is set to the ghost cell width of the data.
+        if (ghost_width_to_fill == -hier::IntVector::getOne(tbox::Dimension(2)))
+        {
+            gcw_to_fill.push_back(var_data[vi]->getGhostCellWidth());
+        }
+        else
+        {
+            gcw_to_fill.push_back(hier::IntVector::min(
+                var_data[vi]->getGhostCellWidth(),
+                ghost_width_to_fill));
+        }
+    }
+    
+    // Get the box that covers the interior of patch.
+    const hier::Box& interior_box(patch.getBox());
+    
+    /*
+     * Get the boundary boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE2D);
+    
+    for (int ni = 0; ni < static_cast<int>(node_bdry.size()); ni++)
+    {
+        TBOX_ASSERT(node_bdry[ni].getBoundaryType() == BDRY::NODE2D);
+        
+        int node_loc = node_bdry[ni].getLocationIndex();
+        
+        if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
+            bdry_node_locs.end())
+        {
+            for (int vi = 0; vi < num_vars; vi++)
             {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                const hier::Box& fill_box(fill_plan->getFillBoxes(BDRY::NODE2D, gcw_to_fill[vi])[ni]);
+                
+                const int edge_bdry_cond = getEdgeBoundaryConditionType(bdry_node_conds[vi][node_loc]);
+                
+                if (edge_bdry_cond == BDRY_COND::BASIC::NEUMANN)
                 {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        int idx_cell_pivot = idx_cell;
-                        
-                        if (edge_loc_1 == BDRY_LOC::YLO)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_lo_idx[1] + (fill_box_hi_idx[1] - j) + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc_1 == BDRY_LOC::YHI)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_hi_idx[1] - (j - fill_box_lo_idx[1]) + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                        }
-                        
-                        var_data->getPointer(1)[idx_cell] = -var_data->getPointer(1)[idx_cell_pivot];
-                    }
+                    // NOT YET IMPLEMENTED
                 }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::XSYMMETRY)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                else if (edge_bdry_cond != -1)
                 {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        int idx_cell_pivot = idx_cell;
-                        
-                        if (edge_loc_0 == BDRY_LOC::XLO)
-                        {
-                            idx_cell_pivot = (interior_box_lo_idx[0] + (fill_box_hi_idx[0] - i) + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc_0 == BDRY_LOC::XHI)
-                        {
-                            idx_cell_pivot = (interior_box_hi_idx[0] - (i - fill_box_lo_idx[0]) + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                        }
-                    }
+                    const int edge_loc = getEdgeLocationForNodeBdry(node_loc, bdry_node_conds[vi][node_loc]);
+                    
+                    fillBoxWithEdgeBoundaryCondition(
+                        var_data[vi],
+                        fill_box,
+                        interior_box,
+                        edge_loc,
+                        edge_bdry_cond,
+                        bdry_edge_values[vi]);
                 }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::YSYMMETRY)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                else
                 {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        const int idx_cell = (i + num_ghosts[0]) +
-                            (j + num_ghosts[1])*ghostcell_dims[0];
-                        
-                        int idx_cell_pivot = idx_cell;
-                        
-                        if (edge_loc_1 == BDRY_LOC::YLO)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_lo_idx[1] + (fill_box_hi_idx[1] - j) + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        else if (edge_loc_1 == BDRY_LOC::YHI)
-                        {
-                            idx_cell_pivot = (i + num_ghosts[0]) +
-                                (interior_box_hi_idx[1] - (j - fill_box_lo_idx[1]) + num_ghosts[1])*ghostcell_dims[0];
-                        }
-                        
-                        for (int di = 0; di < var_depth; di++)
-                        {
-                            var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                        }
-                    }
+                    TBOX_ERROR("BasicCartesianBoundaryUtilities2::fillNodeBoundaryData()\n"
+                        << "Invalid node boundary condition!\n"
+                        << "var_name = '" << var_names[vi] << "'." << std::endl
+                        << "node_loc = '" << node_loc << "'." << std::endl
+                        << "bdry_node_conds[node_loc] = '" << bdry_node_conds[vi][node_loc] << "'."
+                        << std::endl);
                 }
             }
-            else
-            {
-                TBOX_ERROR("BasicCartesianBoundaryUtilities2::fillNodeBoundaryData()\n"
-                    << "Invalid node boundary condition!\n"
-                    << "node_loc = '" << node_loc << "'." << std::endl
-                    << "bdry_node_conds[node_loc] = '" << bdry_node_conds[node_loc] << "'."
-                    << std::endl);
-            }
         }
     }
 }
@@ -1218,3 +1071,190 @@ BasicCartesianBoundaryUtilities2::read2dBdryNodes(
         } // for (int ni = 0 ...
     } // if (num_per_dirs < 1)
 }
+
+
+/*
+ * Function that returns the edge boundary condition type (FLOW, REFLECT, SYMMETRY, DIRICHLET or
+ * NEUMANN) of a node boundary condition type. -1 is returned if the node boundary condition type
+ * is unknown.
+ */
+int
+BasicCartesianBoundaryUtilities2::getEdgeBoundaryConditionType(
+    const int bdry_cond)
+{
+    switch (bdry_cond)
+    {
+        case BDRY_COND::BASIC::XFLOW:
+        case BDRY_COND::BASIC::YFLOW:
+        {
+            return BDRY_COND::BASIC::FLOW;
+        }
+        case BDRY_COND::BASIC::XREFLECT:
+        case BDRY_COND::BASIC::YREFLECT:
+        {
+            return BDRY_COND::BASIC::REFLECT;
+        }
+        case BDRY_COND::BASIC::XSYMMETRY:
+        case BDRY_COND::BASIC::YSYMMETRY:
+        {
+            return BDRY_COND::BASIC::SYMMETRY;
+        }
+        case BDRY_COND::BASIC::XDIRICHLET:
+        case BDRY_COND::BASIC::YDIRICHLET:
+        {
+            return BDRY_COND::BASIC::DIRICHLET;
+        }
+        case BDRY_COND::BASIC::XNEUMANN:
+        case BDRY_COND::BASIC::YNEUMANN:
+        {
+            return BDRY_COND::BASIC::NEUMANN;
+        }
+        default:
+        {
+            return -1;
+        }
+    }
+}
+
+
+/*
+ * Function to fill the cells of a fill box with the FLOW, REFLECT, SYMMETRY or DIRICHLET boundary
+ * condition of an edge. The fill box is filled row by row along the x-direction, which is
+ * contiguous in memory. For the edges normal to the y-direction, each row is a copy of a row in the
+ * interior of the patch. For the edges normal to the x-direction, each row is a broadcast of the
+ * pivot (FLOW) or a mirror of the interior row (REFLECT and SYMMETRY).
+ */
+void
+BasicCartesianBoundaryUtilities2::fillBoxWithEdgeBoundaryCondition(
+    const boost::shared_ptr<pdat::CellData<double> >& var_data,
+    const hier::Box& fill_box,
+    const hier::Box& interior_box,
+    const int edge_loc,
+    const int bdry_edge_cond,
+    const std::vector<double>& bdry_edge_values)
+{
+    TBOX_ASSERT(edge_loc >= 0 && edge_loc < NUM_2D_EDGES);
+    
+    const int var_depth = var_data->getDepth();
+    
+    const hier::IntVector& num_ghosts(var_data->getGhostCellWidth());
+    
+    // Get the dimensions of box that covers interior of patch plus
+    // ghost cells.
+    const hier::IntVector ghostcell_dims = var_data->getGhostBox().numberCells();
+    
+    hier::Index interior_box_hi_idx(interior_box.upper());
+    hier::Index fill_box_lo_idx(fill_box.lower());
+    hier::Index fill_box_hi_idx(fill_box.upper());
+    
+    /*
+     * Offset the indices.
+     */
+    interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
+    fill_box_lo_idx = fill_box_lo_idx - interior_box.lower();
+    fill_box_hi_idx = fill_box_hi_idx - interior_box.lower();
+    
+    /*
+     * Get the direction normal to the edge, the index of the pivot in the interior next to the edge
+     * and the sum of the indices of the mirrored cells in that direction.
+     */
+    
+    const int dir = edge_loc/2;
+    const bool is_lo_edge = (edge_loc%2 == 0);
+    
+    const int idx_pivot = is_lo_edge ? 0 : interior_box_hi_idx[dir];
+    const int idx_mirror_sum = is_lo_edge ? fill_box_hi_idx[dir] : interior_box_hi_idx[dir] + fill_box_lo_idx[dir];
+    
+    const int num_cells_row = fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1;
+    
+    for (int di = 0; di < var_depth; di++)
+    {
+        double* Q = var_data->getPointer(di);
+        
+        if (bdry_edge_cond == BDRY_COND::BASIC::DIRICHLET)
+        {
+            const double Q_bdry = bdry_edge_values[edge_loc*var_depth + di];
+            
+            for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+            {
+                const int idx_row = (fill_box_lo_idx[0] + num_ghosts[0]) +
+                    (j + num_ghosts[1])*ghostcell_dims[0];
+                
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = 0; i < num_cells_row; i++)
+                {
+                    Q[idx_row + i] = Q_bdry;
+                }
+            }
+            
+            continue;
+        }
+        
+        // The normal component of a vector is flipped at a REFLECT boundary.
+        const double sign = ((bdry_edge_cond == BDRY_COND::BASIC::REFLECT) && (di == dir)) ?
+            double(-1) : double(1);
+        
+        for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+        {
+            const int idx_row = (fill_box_lo_idx[0] + num_ghosts[0]) +
+                (j + num_ghosts[1])*ghostcell_dims[0];
+            
+            if (dir == 0)
+            {
+                if (bdry_edge_cond == BDRY_COND::BASIC::FLOW)
+                {
+                    const int idx_cell_pivot = (idx_pivot + num_ghosts[0]) +
+                        (j + num_ghosts[1])*ghostcell_dims[0];
+                    
+                    const double Q_pivot = Q[idx_cell_pivot];
+                    
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < num_cells_row; i++)
+                    {
+                        Q[idx_row + i] = Q_pivot;
+                    }
+                }
+                else
+                {
+                    // Index of the cell mirrored with the first cell of the row.
+                    const int idx_row_mirror = (idx_mirror_sum - fill_box_lo_idx[0] + num_ghosts[0]) +
+                        (j + num_ghosts[1])*ghostcell_dims[0];
+                    
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < num_cells_row; i++)
+                    {
+                        Q[idx_row + i] = sign*Q[idx_row_mirror - i];
+                    }
+                }
+            }
+            else
+            {
+                const int j_src = (bdry_edge_cond == BDRY_COND::BASIC::FLOW) ? idx_pivot : idx_mirror_sum - j;
+                
+                const int idx_row_src = (fill_box_lo_idx[0] + num_ghosts[0]) +
+                    (j_src + num_ghosts[1])*ghostcell_dims[0];
+                
+                if (sign > double(0))
+                {
+                    std::memcpy(&Q[idx_row], &Q[idx_row_src], num_cells_row*sizeof(double));
+                }
+                else
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < num_cells_row; i++)
+                    {
+                        Q[idx_row + i] = -Q[idx_row_src + i];
+                    }
+                }
+            }
+        }
+    }
+}
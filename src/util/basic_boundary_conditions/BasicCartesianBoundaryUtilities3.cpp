@@ -20,6 +20,8 @@
 #include "SAMRAI/tbox/Utilities.h"
 #include "SAMRAI/tbox/MathUtilities.h"
 
+#include <cstring>
+
 /*
  * This function reads 3D boundary data from given input database.
  * The integer boundary condition types are placed in the integer
@@ -127,6 +129,8 @@ BasicCartesianBoundaryUtilities3::getFromInput(
  *                           (this must be consistent with boundary
  *                           condition types)
  *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
  */
 void
 BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
@@ -136,7 +140,8 @@ BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
     const std::vector<int>& bdry_face_locs,
     const std::vector<int>& bdry_face_conds,
     const std::vector<double>& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(!var_name.empty());
     TBOX_ASSERT(var_data);
@@ -151,11 +156,6 @@ BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
     
     NULL_USE(var_name);
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     const hier::IntVector& num_ghosts(var_data->getGhostCellWidth());
     
     /*
@@ -175,25 +175,21 @@ BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
             ghost_width_to_fill);
     }
     
-    // Get the dimensions of box that covers the interior of patch.
+    // Get the box that covers the interior of patch.
     const hier::Box& interior_box(patch.getBox());
-    hier::Index interior_box_lo_idx(interior_box.lower());
-    hier::Index interior_box_hi_idx(interior_box.upper());
     
     /*
-     * Offset the indices.
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
      */
-    interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
-    interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
-    
-    // Get the dimensions of box that covers interior of patch plus
-    // ghost cells.
-    const hier::IntVector ghostcell_dims = var_data->getGhostBox().numberCells();
     
-    const std::vector<hier::BoundaryBox>& face_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::FACE3D);
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
     
-    const int var_depth = var_data->getDepth();
+    const std::vector<hier::BoundaryBox>& face_bdry = fill_plan->getBoundaryBoxes(BDRY::FACE3D);
+    const std::vector<hier::Box>& face_fill_boxes = fill_plan->getFillBoxes(BDRY::FACE3D, gcw_to_fill);
     
     for (int fi = 0; fi < static_cast<int>(face_bdry.size()); fi++)
     {
@@ -204,237 +200,22 @@ BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
         if (std::find(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc) !=
             bdry_face_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                face_bdry[fi],
-                interior_box,
-                gcw_to_fill));
-            
-            hier::Index fill_box_lo_idx(fill_box.lower());
-            hier::Index fill_box_hi_idx(fill_box.upper());
-            
-            /*
-             * Offset the indices.
-             */
-            fill_box_lo_idx = fill_box_lo_idx - interior_box.lower();
-            fill_box_hi_idx = fill_box_hi_idx - interior_box.lower();
-            
-            if (bdry_face_conds[face_loc] == BDRY_COND::BASIC::DIRICHLET)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = bdry_face_values[face_loc*var_depth + di];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_face_conds[face_loc] == BDRY_COND::BASIC::NEUMANN)
+            if (bdry_face_conds[face_loc] == BDRY_COND::BASIC::NEUMANN)
             {
                 // NOT YET IMPLEMENTED
             }
-            else if (bdry_face_conds[face_loc] == BDRY_COND::BASIC::FLOW)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc == BDRY_LOC::XLO)
-                            {
-                                idx_cell_pivot = (interior_box_lo_idx[0] + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::XHI)
-                            {
-                                idx_cell_pivot = (interior_box_hi_idx[0] + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::YLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_lo_idx[1] + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::YHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_hi_idx[1] + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::ZLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_lo_idx[2] + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::ZHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_hi_idx[2] + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_face_conds[face_loc] == BDRY_COND::BASIC::REFLECT)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc == BDRY_LOC::XLO)
-                            {
-                                idx_cell_pivot = (interior_box_lo_idx[0] + (fill_box_hi_idx[0] - i) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::XHI)
-                            {
-                                idx_cell_pivot = (interior_box_hi_idx[0] - (i - fill_box_lo_idx[0]) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::YLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_lo_idx[1] + (fill_box_hi_idx[1] - j) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::YHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_hi_idx[1] - (j - fill_box_lo_idx[1]) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::ZLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_lo_idx[2] + (fill_box_hi_idx[2] - k) + num_ghosts[2])*ghostcell_dims[0]*
-                                        ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::ZHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_hi_idx[2] - (k - fill_box_lo_idx[2]) + num_ghosts[2])*ghostcell_dims[0]*
-                                        ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                            
-                            if (face_loc == BDRY_LOC::XLO || face_loc == BDRY_LOC::XHI)
-                            {
-                                var_data->getPointer(0)[idx_cell] = -var_data->getPointer(0)[idx_cell_pivot];
-                            }
-                            else if (face_loc == BDRY_LOC::YLO || face_loc == BDRY_LOC::YHI)
-                            {
-                                var_data->getPointer(1)[idx_cell] = -var_data->getPointer(1)[idx_cell_pivot];
-                            }
-                            else if (face_loc == BDRY_LOC::ZLO || face_loc == BDRY_LOC::ZHI)
-                            {
-                                var_data->getPointer(2)[idx_cell] = -var_data->getPointer(2)[idx_cell_pivot];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_face_conds[face_loc] == BDRY_COND::BASIC::SYMMETRY)
+            else if ((bdry_face_conds[face_loc] == BDRY_COND::BASIC::DIRICHLET) ||
+                     (bdry_face_conds[face_loc] == BDRY_COND::BASIC::FLOW) ||
+                     (bdry_face_conds[face_loc] == BDRY_COND::BASIC::REFLECT) ||
+                     (bdry_face_conds[face_loc] == BDRY_COND::BASIC::SYMMETRY))
             {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc == BDRY_LOC::XLO)
-                            {
-                                idx_cell_pivot = (interior_box_lo_idx[0] + (fill_box_hi_idx[0] - i) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::XHI)
-                            {
-                                idx_cell_pivot = (interior_box_hi_idx[0] - (i - fill_box_lo_idx[0]) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::YLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_lo_idx[1] + (fill_box_hi_idx[1] - j) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::YHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_hi_idx[1] - (j - fill_box_lo_idx[1]) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::ZLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_lo_idx[2] + (fill_box_hi_idx[2] - k) + num_ghosts[2])*ghostcell_dims[0]*
-                                        ghostcell_dims[1];
-                            }
-                            else if (face_loc == BDRY_LOC::ZHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_hi_idx[2] - (k - fill_box_lo_idx[2]) + num_ghosts[2])*ghostcell_dims[0]*
-                                        ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
-                }
+                fillBoxWithFaceBoundaryCondition(
+                    var_data,
+                    face_fill_boxes[fi],
+                    interior_box,
+                    face_loc,
+                    bdry_face_conds[face_loc],
+                    bdry_face_values);
             }
             else
             {
@@ -449,6 +230,133 @@ BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
 }
 
 
+/*
+ * Function to fill face boundary values of several variables. The face boundary boxes are
+ * traversed once and all the variables are filled for each of them.
+ *
+ * Arguments are:
+ *    var_names ............ names of variables (for error reporting)
+ *    var_data ............. cell-centered patch data objects to fill
+ *    patch ................ patch on which data objects live
+ *    bdry_face_locs ....... array of locations of faces for applying
+ *                           boundary conditions.
+ *    bdry_face_conds ...... arrays of boundary conditions for patch faces,
+ *                           one for each variable
+ *    bdry_face_values ..... arrays of boundary values for faces, one for
+ *                           each variable
+ *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
+ */
+void
+BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
+    const std::vector<std::string>& var_names,
+    const std::vector<boost::shared_ptr<pdat::CellData<double> > >& var_data,
+    const hier::Patch& patch,
+    const std::vector<int>& bdry_face_locs,
+    const std::vector<std::vector<int> >& bdry_face_conds,
+    const std::vector<std::vector<double> >& bdry_face_values,
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
+{
+    TBOX_ASSERT(var_names.size() == var_data.size());
+    TBOX_ASSERT(bdry_face_conds.size() == var_data.size());
+    TBOX_ASSERT(bdry_face_values.size() == var_data.size());
+    TBOX_ASSERT(static_cast<int>(bdry_face_locs.size()) <= NUM_3D_FACES);
+    
+    TBOX_DIM_ASSERT(ghost_width_to_fill.getDim() == tbox::Dimension(3));
+    
+    const int num_vars = static_cast<int>(var_data.size());
+    
+    /*
+     * Determine the ghost cell widths to fill of the variables.
+     */
+    
+    std::vector<hier::IntVector> gcw_to_fill;
+    gcw_to_fill.reserve(num_vars);
+    
+    for (int vi = 0; vi < num_vars; vi++)
+    {
+        TBOX_ASSERT(var_data[vi]);
+        TBOX_ASSERT(static_cast<int>(bdry_face_conds[vi].size()) == NUM_3D_FACES);
+        TBOX_ASSERT(static_cast<int>(bdry_face_values[vi].size()) == NUM_3D_FACES*(var_data[vi]->getDepth()));
+        TBOX_ASSERT_OBJDIM_EQUALITY3(*var_data[vi], patch, ghost_width_to_fill);
+        
+        // If the ghost fill width is not used, it is set to the ghost cell width of the data.
+        if (ghost_width_to_fill == -hier::IntVector::getOne(tbox::Dimension(3)))
+        {
+            gcw_to_fill.push_back(var_data[vi]->getGhostCellWidth());
+        }
+        else
+        {
+            gcw_to_fill.push_back(hier::IntVector::min(
+                var_data[vi]->getGhostCellWidth(),
+                ghost_width_to_fill));
+        }
+    }
+    
+    // Get the box that covers the interior of patch.
+    const hier::Box& interior_box(patch.getBox());
+    
+    /*
+     * Get the boundary boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& face_bdry = fill_plan->getBoundaryBoxes(BDRY::FACE3D);
+    
+    for (int fi = 0; fi < static_cast<int>(face_bdry.size()); fi++)
+    {
+        TBOX_ASSERT(face_bdry[fi].getBoundaryType() == BDRY::FACE3D);
+        
+        int face_loc = face_bdry[fi].getLocationIndex();
+        
+        if (std::find(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc) !=
+            bdry_face_locs.end())
+        {
+            for (int vi = 0; vi < num_vars; vi++)
+            {
+                const hier::Box& fill_box(fill_plan->getFillBoxes(BDRY::FACE3D, gcw_to_fill[vi])[fi]);
+                
+                const int bdry_face_cond = bdry_face_conds[vi][face_loc];
+                
+                if (bdry_face_cond == BDRY_COND::BASIC::NEUMANN)
+                {
+                    // NOT YET IMPLEMENTED
+                }
+                else if ((bdry_face_cond == BDRY_COND::BASIC::DIRICHLET) ||
+                         (bdry_face_cond == BDRY_COND::BASIC::FLOW) ||
+                         (bdry_face_cond == BDRY_COND::BASIC::REFLECT) ||
+                         (bdry_face_cond == BDRY_COND::BASIC::SYMMETRY))
+                {
+                    fillBoxWithFaceBoundaryCondition(
+                        var_data[vi],
+                        fill_box,
+                        interior_box,
+                        face_loc,
+                        bdry_face_cond,
+                        bdry_face_values[vi]);
+                }
+                else
+                {
+                    TBOX_ERROR("BasicCartesianBoundaryUtilities3::fillFaceBoundaryData()\n"
+                        << "Invalid face boundary condition!\n"
+                        << "var_name = '" << var_names[vi] << "'." << std::endl
+                        << "face_loc = '" << face_loc << "'." << std::endl
+                        << "bdry_face_conds[face_loc] = '" << bdry_face_conds[vi][face_loc] << "'."
+                        << std::endl);
+                }
+            }
+        }
+    }
+}
+
+
 /*
  * Function to fill edge boundary values.
  *
@@ -463,6 +371,8 @@ BasicCartesianBoundaryUtilities3::fillFaceBoundaryData(
  *                           (this must be consistent with boundary
  *                           condition types)
  *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
  */
 void
 BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData(
@@ -472,7 +382,8 @@ BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData(
     const std::vector<int>& bdry_edge_locs,
     const std::vector<int>& bdry_edge_conds,
     const std::vector<double>& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(!var_name.empty());
     TBOX_ASSERT(var_data);
@@ -487,11 +398,6 @@ BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData(
     
     NULL_USE(var_name);
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     const hier::IntVector& num_ghosts(var_data->getGhostCellWidth());
     
     /*
@@ -511,25 +417,21 @@ BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData(
             ghost_width_to_fill);
     }
     
-    // Get the dimensions of box that covers the interior of patch.
+    // Get the box that covers the interior of patch.
     const hier::Box& interior_box(patch.getBox());
-    hier::Index interior_box_lo_idx(interior_box.lower());
-    hier::Index interior_box_hi_idx(interior_box.upper());
     
     /*
-     * Offset the indices.
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
      */
-    interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
-    interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
-    
-    // Get the dimensions of box that covers interior of patch plus
-    // ghost cells.
-    const hier::IntVector ghostcell_dims = var_data->getGhostBox().numberCells();
     
-    const std::vector<hier::BoundaryBox>& edge_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::EDGE3D);
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
     
-    const int var_depth = var_data->getDepth();
+    const std::vector<hier::BoundaryBox>& edge_bdry = fill_plan->getBoundaryBoxes(BDRY::EDGE3D);
+    const std::vector<hier::Box>& edge_fill_boxes = fill_plan->getFillBoxes(BDRY::EDGE3D, gcw_to_fill);
     
     for (int ei = 0; ei < static_cast<int>(edge_bdry.size()); ei++)
     {
@@ -540,517 +442,163 @@ BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData(
         if (std::find(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc) !=
             bdry_edge_locs.end())
         {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                edge_bdry[ei],
-                interior_box,
-                gcw_to_fill));
-            
-            hier::Index fill_box_lo_idx(fill_box.lower());
-            hier::Index fill_box_hi_idx(fill_box.upper());
-            
             /*
-             * Offset the indices.
+             * The edge boundary condition is the boundary condition of one of the faces touching
+             * the edge, applied to the fill box of the edge.
              */
-            fill_box_lo_idx = fill_box_lo_idx - interior_box.lower();
-            fill_box_hi_idx = fill_box_hi_idx - interior_box.lower();
             
-            int face_loc_0 = -1;
-            int face_loc_1 = -1;
-            int face_loc_2 = -1;
+            const int face_bdry_cond = getFaceBoundaryConditionType(bdry_edge_conds[edge_loc]);
             
-            switch (edge_loc)
-            {
-                case EDGE_BDRY_LOC_3D::XLO_YLO:
-                {
-                    face_loc_0 = BDRY_LOC::XLO;
-                    face_loc_1 = BDRY_LOC::YLO;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::XHI_YLO:
-                {
-                    face_loc_0 = BDRY_LOC::XHI;
-                    face_loc_1 = BDRY_LOC::YLO;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::XLO_YHI:
-                {
-                    face_loc_0 = BDRY_LOC::XLO;
-                    face_loc_1 = BDRY_LOC::YHI;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::XHI_YHI:
-                {
-                    face_loc_0 = BDRY_LOC::XHI;
-                    face_loc_1 = BDRY_LOC::YHI;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::XLO_ZLO:
-                {
-                    face_loc_0 = BDRY_LOC::XLO;
-                    face_loc_2 = BDRY_LOC::ZLO;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::XHI_ZLO:
-                {
-                    face_loc_0 = BDRY_LOC::XHI;
-                    face_loc_2 = BDRY_LOC::ZLO;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::XLO_ZHI:
-                {
-                    face_loc_0 = BDRY_LOC::XLO;
-                    face_loc_2 = BDRY_LOC::ZHI;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::XHI_ZHI:
-                {
-                    face_loc_0 = BDRY_LOC::XHI;
-                    face_loc_2 = BDRY_LOC::ZHI;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::YLO_ZLO:
-                {
-                    face_loc_1 = BDRY_LOC::YLO;
-                    face_loc_2 = BDRY_LOC::ZLO;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::YHI_ZLO:
-                {
-                    face_loc_1 = BDRY_LOC::YHI;
-                    face_loc_2 = BDRY_LOC::ZLO;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::YLO_ZHI:
-                {
-                    face_loc_1 = BDRY_LOC::YLO;
-                    face_loc_2 = BDRY_LOC::ZHI;
-                    
-                    break;
-                }
-                case EDGE_BDRY_LOC_3D::YHI_ZHI:
-                {
-                    face_loc_1 = BDRY_LOC::YHI;
-                    face_loc_2 = BDRY_LOC::ZHI;
-                    
-                    break;
-                }
-            }
-            
-            if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::XDIRICHLET)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                                
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = bdry_face_values[face_loc_0*var_depth + di];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::YDIRICHLET)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                                
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = bdry_face_values[face_loc_1*var_depth + di];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::ZDIRICHLET)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                                
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = bdry_face_values[face_loc_2*var_depth + di];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::XNEUMANN)
+            if (face_bdry_cond == BDRY_COND::BASIC::NEUMANN)
             {
                 // NOT YET IMPLEMENTED
             }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::YNEUMANN)
-            {
-                // NOT YET IMPLEMENTED
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::ZNEUMANN)
-            {
-                // NOT YET IMPLEMENTED
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::XFLOW)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_0 == BDRY_LOC::XLO)
-                            {
-                                idx_cell_pivot = (interior_box_lo_idx[0] + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_0 == BDRY_LOC::XHI)
-                            {
-                                idx_cell_pivot = (interior_box_hi_idx[0] + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::YFLOW)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_1 == BDRY_LOC::YLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_lo_idx[1] + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_1 == BDRY_LOC::YHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_hi_idx[1] + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::ZFLOW)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_2 == BDRY_LOC::ZLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_lo_idx[2] + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_2 == BDRY_LOC::ZHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_hi_idx[2] + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::XREFLECT)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_0 == BDRY_LOC::XLO)
-                            {
-                                idx_cell_pivot = (interior_box_lo_idx[0] + (fill_box_hi_idx[0] - i) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_0 == BDRY_LOC::XHI)
-                            {
-                                idx_cell_pivot = (interior_box_hi_idx[0] - (i - fill_box_lo_idx[0]) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                            
-                            var_data->getPointer(0)[idx_cell] = -var_data->getPointer(0)[idx_cell_pivot];
-                        }
-                    }
-                }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::YREFLECT)
+            else if (face_bdry_cond != -1)
             {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_1 == BDRY_LOC::YLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_lo_idx[1] + (fill_box_hi_idx[1] - j) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_1 == BDRY_LOC::YHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_hi_idx[1] - (j - fill_box_lo_idx[1]) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                            
-                            var_data->getPointer(1)[idx_cell] = -var_data->getPointer(1)[idx_cell_pivot];
-                        }
-                    }
-                }
+                const int face_loc = getFaceLocationForEdgeBdry(edge_loc, bdry_edge_conds[edge_loc]);
+                
+                fillBoxWithFaceBoundaryCondition(
+                    var_data,
+                    edge_fill_boxes[ei],
+                    interior_box,
+                    face_loc,
+                    face_bdry_cond,
+                    bdry_face_values);
             }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::ZREFLECT)
+            else
             {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_2 == BDRY_LOC::ZLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_lo_idx[2] + (fill_box_hi_idx[2] - k) + num_ghosts[2])
-                                        *ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_2 == BDRY_LOC::ZHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_hi_idx[2] - (k - fill_box_lo_idx[2]) + num_ghosts[2])
-                                        *ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                            
-                            var_data->getPointer(2)[idx_cell] = -var_data->getPointer(2)[idx_cell_pivot];
-                        }
-                    }
-                }
+                TBOX_ERROR("BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData()\n"
+                    << "Invalid edge boundary condition!\n"
+                    << "edge_loc = '" << edge_loc << "'." << std::endl
+                    << "bdry_edge_conds[edge_loc] = '" << bdry_edge_conds[edge_loc] << "'."
+                    << std::endl);
             }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::XSYMMETRY)
+        }
+    }
+}
+
+
+/*
+ * Function to fill edge boundary values of several variables. The edge boundary boxes are
+ * traversed once and all the variables are filled for each of them.
+ *
+ * Arguments are:
+ *    var_names ............ names of variables (for error reporting)
+ *    var_data ............. cell-centered patch data objects to fill
+ *    patch ................ patch on which data objects live
+ *    bdry_edge_locs ....... array of locations of edges for applying
+ *                           boundary conditions.
+ *    bdry_edge_conds ...... arrays of boundary conditions for patch edges,
+ *                           one for each variable
+ *    bdry_face_values ..... arrays of boundary values for faces, one for
+ *                           each variable
+ *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
+ */
+void
+BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData(
+    const std::vector<std::string>& var_names,
+    const std::vector<boost::shared_ptr<pdat::CellData<double> > >& var_data,
+    const hier::Patch& patch,
+    const std::vector<int>& bdry_edge_locs,
+    const std::vector<std::vector<int> >& bdry_edge_conds,
+    const std::vector<std::vector<double> >& bdry_face_values,
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
+{
+    TBOX_ASSERT(var_names.size() == var_data.size());
+    TBOX_ASSERT(bdry_edge_conds.size() == var_data.size());
+    TBOX_ASSERT(bdry_face_values.size() == var_data.size());
+    TBOX_ASSERT(static_cast<int>(bdry_edge_locs.size()) <= NUM_3D_EDGES);
+    
+    TBOX_DIM_ASSERT(ghost_width_to_fill.getDim() == tbox::Dimension(3));
+    
+    const int num_vars = static_cast<int>(var_data.size());
+    
+    /*
+     * Determine the ghost cell widths to fill of the variables.
+     */
+    
+    std::vector<hier::IntVector> gcw_to_fill;
+    gcw_to_fill.reserve(num_vars);
+    
+    for (int vi = 0; vi < num_vars; vi++)
+    {
+        TBOX_ASSERT(var_data[vi]);
+        TBOX_ASSERT(static_cast<int>(bdry_edge_conds[vi].size()) == NUM_3D_EDGES);
+        TBOX_ASSERT(static_cast<int>(bdry_face_values[vi].size()) == NUM_3D_FACES*(var_data[vi]->getDepth()));
+        TBOX_ASSERT_OBJDIM_EQUALITY3(*var_data[vi], patch, ghost_width_to_fill);
+        
+        // If the ghost fill width is not used, it is set to the ghost cell width of the data.
+        if (ghost_width_to_fill == -hier::IntVector::getOne(tbox::Dimension(3)))
+        {
+            gcw_to_fill.push_back(var_data[vi]->getGhostCellWidth());
+        }
+        else
+        {
+            gcw_to_fill.push_back(hier::IntVector::min(
+                var_data[vi]->getGhostCellWidth(),
+                ghost_width_to_fill));
+        }
+    }
+    
+    // Get the box that covers the interior of patch.
+    const hier::Box& interior_box(patch.getBox());
+    
+    /*
+     * Get the boundary boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& edge_bdry = fill_plan->getBoundaryBoxes(BDRY::EDGE3D);
+    
+    for (int ei = 0; ei < static_cast<int>(edge_bdry.size()); ei++)
+    {
+        TBOX_ASSERT(edge_bdry[ei].getBoundaryType() == BDRY::EDGE3D);
+        
+        int edge_loc = edge_bdry[ei].getLocationIndex();
+        
+        if (std::find(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc) !=
+            bdry_edge_locs.end())
+        {
+            for (int vi = 0; vi < num_vars; vi++)
             {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                const hier::Box& fill_box(fill_plan->getFillBoxes(BDRY::EDGE3D, gcw_to_fill[vi])[ei]);
+                
+                const int face_bdry_cond = getFaceBoundaryConditionType(bdry_edge_conds[vi][edge_loc]);
+                
+                if (face_bdry_cond == BDRY_COND::BASIC::NEUMANN)
                 {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_0 == BDRY_LOC::XLO)
-                            {
-                                idx_cell_pivot = (interior_box_lo_idx[0] + (fill_box_hi_idx[0] - i) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_0 == BDRY_LOC::XHI)
-                            {
-                                idx_cell_pivot = (interior_box_hi_idx[0] - (i - fill_box_lo_idx[0]) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
+                    // NOT YET IMPLEMENTED
                 }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::YSYMMETRY)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                else if (face_bdry_cond != -1)
                 {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_1 == BDRY_LOC::YLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_lo_idx[1] + (fill_box_hi_idx[1] - j) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_1 == BDRY_LOC::YHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_hi_idx[1] - (j - fill_box_lo_idx[1]) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
+                    const int face_loc = getFaceLocationForEdgeBdry(edge_loc, bdry_edge_conds[vi][edge_loc]);
+                    
+                    fillBoxWithFaceBoundaryCondition(
+                        var_data[vi],
+                        fill_box,
+                        interior_box,
+                        face_loc,
+                        face_bdry_cond,
+                        bdry_face_values[vi]);
                 }
-            }
-            else if (bdry_edge_conds[edge_loc] == BDRY_COND::BASIC::ZSYMMETRY)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                else
                 {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_2 == BDRY_LOC::ZLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_lo_idx[2] + (fill_box_hi_idx[2] - k) + num_ghosts[2])
-                                        *ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_2 == BDRY_LOC::ZHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_hi_idx[2] - (k - fill_box_lo_idx[2]) + num_ghosts[2])
-                                        *ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
+                    TBOX_ERROR("BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData()\n"
+                        << "Invalid edge boundary condition!\n"
+                        << "var_name = '" << var_names[vi] << "'." << std::endl
+                        << "edge_loc = '" << edge_loc << "'." << std::endl
+                        << "bdry_edge_conds[edge_loc] = '" << bdry_edge_conds[vi][edge_loc] << "'."
+                        << std::endl);
                 }
             }
-            else
-            {
-                TBOX_ERROR("BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData()\n"
-                    << "Invalid edge boundary condition!\n"
-                    << "edge_loc = '" << edge_loc << "'." << std::endl
-                    << "bdry_edge_conds[edge_loc] = '" << bdry_edge_conds[edge_loc] << "'."
-                    << std::endl);
-            }
         }
     }
 }
@@ -1070,6 +618,8 @@ BasicCartesianBoundaryUtilities3::fillEdgeBoundaryData(
  *                           (this must be consistent with boundary
  *                           condition types)
  *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
  */
 void
 BasicCartesianBoundaryUtilities3::fillNodeBoundaryData(
@@ -1079,7 +629,8 @@ BasicCartesianBoundaryUtilities3::fillNodeBoundaryData(
     const std::vector<int>& bdry_node_locs,
     const std::vector<int>& bdry_node_conds,
     const std::vector<double>& bdry_face_values,
-    const hier::IntVector& ghost_width_to_fill)
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
 {
     TBOX_ASSERT(!var_name.empty());
     TBOX_ASSERT(var_data);
@@ -1094,11 +645,6 @@ BasicCartesianBoundaryUtilities3::fillNodeBoundaryData(
     
     NULL_USE(var_name);
     
-    const boost::shared_ptr<geom::CartesianPatchGeometry> patch_geom(
-        BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
-            patch.getPatchGeometry()));
-    TBOX_ASSERT(patch_geom);
-    
     const hier::IntVector& num_ghosts(var_data->getGhostCellWidth());
     
     /*
@@ -1118,526 +664,188 @@ BasicCartesianBoundaryUtilities3::fillNodeBoundaryData(
             ghost_width_to_fill);
     }
     
-    // Get the dimensions of box that covers the interior of patch.
+    // Get the box that covers the interior of patch.
     const hier::Box& interior_box(patch.getBox());
-    hier::Index interior_box_lo_idx(interior_box.lower());
-    hier::Index interior_box_hi_idx(interior_box.upper());
     
     /*
-     * Offset the indices.
+     * Get the boundary boxes and their fill boxes from the boundary fill plan of the patch.
      */
-    interior_box_lo_idx = interior_box_lo_idx - interior_box.lower();
-    interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
-    
-    // Get the dimensions of box that covers interior of patch plus
-    // ghost cells.
-    const hier::IntVector ghostcell_dims = var_data->getGhostBox().numberCells();
     
-    const std::vector<hier::BoundaryBox>& node_bdry =
-        patch_geom->getCodimensionBoundaries(BDRY::NODE3D);
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
     
-    const int var_depth = var_data->getDepth();
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE3D);
+    const std::vector<hier::Box>& node_fill_boxes = fill_plan->getFillBoxes(BDRY::NODE3D, gcw_to_fill);
     
     for (int ni = 0; ni < static_cast<int>(node_bdry.size()); ni++)
     {
         TBOX_ASSERT(node_bdry[ni].getBoundaryType() == BDRY::NODE3D);
-        
-        int node_loc(node_bdry[ni].getLocationIndex());
-        
-        if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
-            bdry_node_locs.end())
-        {
-            hier::Box fill_box(patch_geom->getBoundaryFillBox(
-                node_bdry[ni],
-                interior_box,
-                gcw_to_fill));
-            
-            hier::Index fill_box_lo_idx(fill_box.lower());
-            hier::Index fill_box_hi_idx(fill_box.upper());
-            
-            /*
-             * Offset the indices.
-             */
-            fill_box_lo_idx = fill_box_lo_idx - interior_box.lower();
-            fill_box_hi_idx = fill_box_hi_idx - interior_box.lower();
-            
-            int face_loc_0 = -1;
-            int face_loc_1 = -1;
-            int face_loc_2 = -1;
-            
-            switch (node_loc)
-            {
-                case NODE_BDRY_LOC_3D::XLO_YLO_ZLO:
-                {
-                    face_loc_0 = BDRY_LOC::XLO;
-                    face_loc_1 = BDRY_LOC::YLO;
-                    face_loc_2 = BDRY_LOC::ZLO;
-                    
-                    break;
-                }
-                case NODE_BDRY_LOC_3D::XHI_YLO_ZLO:
-                {
-                    face_loc_0 = BDRY_LOC::XHI;
-                    face_loc_1 = BDRY_LOC::YLO;
-                    face_loc_2 = BDRY_LOC::ZLO;
-                    
-                    break;
-                }
-                case NODE_BDRY_LOC_3D::XLO_YHI_ZLO:
-                {
-                    face_loc_0 = BDRY_LOC::XLO;
-                    face_loc_1 = BDRY_LOC::YHI;
-                    face_loc_2 = BDRY_LOC::ZLO;
-                    
-                    break;
-                }
-                case NODE_BDRY_LOC_3D::XHI_YHI_ZLO:
-                {
-                    face_loc_0 = BDRY_LOC::XHI;
-                    face_loc_1 = BDRY_LOC::YHI;
-                    face_loc_2 = BDRY_LOC::ZLO;
-                    
-                    break;
-                }
-                case NODE_BDRY_LOC_3D::XLO_YLO_ZHI:
-                {
-                    face_loc_0 = BDRY_LOC::XLO;
-                    face_loc_1 = BDRY_LOC::YLO;
-                    face_loc_2 = BDRY_LOC::ZHI;
-                    
-                    break;
-                }
-                case NODE_BDRY_LOC_3D::XHI_YLO_ZHI:
-                {
-                    face_loc_0 = BDRY_LOC::XHI;
-                    face_loc_1 = BDRY_LOC::YLO;
-                    face_loc_2 = BDRY_LOC::ZHI;
-                    
-                    break;
-                }
-                case NODE_BDRY_LOC_3D::XLO_YHI_ZHI:
-                {
-                    face_loc_0 = BDRY_LOC::XLO;
-                    face_loc_1 = BDRY_LOC::YHI;
-                    face_loc_2 = BDRY_LOC::ZHI;
-                    
-                    break;
-                }
-                case NODE_BDRY_LOC_3D::XHI_YHI_ZHI:
-                {
-                    face_loc_0 = BDRY_LOC::XHI;
-                    face_loc_1 = BDRY_LOC::YHI;
-                    face_loc_2 = BDRY_LOC::ZHI;
-                    
-                    break;
-                }
-            }
-            
-            if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::XDIRICHLET)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                                
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = bdry_face_values[face_loc_0*var_depth + di];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::YDIRICHLET)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                                
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = bdry_face_values[face_loc_1*var_depth + di];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::ZDIRICHLET)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                                
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = bdry_face_values[face_loc_2*var_depth + di];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::XNEUMANN)
-            {
-                // NOT YET IMPLEMENTED
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::YNEUMANN)
-            {
-                // NOT YET IMPLEMENTED
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::ZNEUMANN)
+        
+        int node_loc(node_bdry[ni].getLocationIndex());
+        
+        if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
+            bdry_node_locs.end())
+        {
+            /*
+             * The node boundary condition is the boundary condition of one of the faces touching
+             * the node, applied to the fill box of the node.
+             */
+            
+            const int face_bdry_cond = getFaceBoundaryConditionType(bdry_node_conds[node_loc]);
+            
+            if (face_bdry_cond == BDRY_COND::BASIC::NEUMANN)
             {
                 // NOT YET IMPLEMENTED
             }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::XFLOW)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_0 == BDRY_LOC::XLO)
-                            {
-                                idx_cell_pivot = (interior_box_lo_idx[0] + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_0 == BDRY_LOC::XHI)
-                            {
-                                idx_cell_pivot = (interior_box_hi_idx[0] + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::YFLOW)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_1 == BDRY_LOC::YLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_lo_idx[1] + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_1 == BDRY_LOC::YHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_hi_idx[1] + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::ZFLOW)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_2 == BDRY_LOC::ZLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_lo_idx[2] + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_2 == BDRY_LOC::ZHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_hi_idx[2] + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::XREFLECT)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_0 == BDRY_LOC::XLO)
-                            {
-                                idx_cell_pivot = (interior_box_lo_idx[0] + (fill_box_hi_idx[0] - i) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_0 == BDRY_LOC::XHI)
-                            {
-                                idx_cell_pivot = (interior_box_hi_idx[0] - (i - fill_box_lo_idx[0]) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                            
-                            var_data->getPointer(0)[idx_cell] = -var_data->getPointer(0)[idx_cell_pivot];
-                        }
-                    }
-                }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::YREFLECT)
+            else if (face_bdry_cond != -1)
             {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_1 == BDRY_LOC::YLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_lo_idx[1] + (fill_box_hi_idx[1] - j) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_1 == BDRY_LOC::YHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_hi_idx[1] - (j - fill_box_lo_idx[1]) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                            
-                            var_data->getPointer(1)[idx_cell] = -var_data->getPointer(1)[idx_cell_pivot];
-                        }
-                    }
-                }
+                const int face_loc = getFaceLocationForNodeBdry(node_loc, bdry_node_conds[node_loc]);
+                
+                fillBoxWithFaceBoundaryCondition(
+                    var_data,
+                    node_fill_boxes[ni],
+                    interior_box,
+                    face_loc,
+                    face_bdry_cond,
+                    bdry_face_values);
             }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::ZREFLECT)
+            else
             {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
-                {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_2 == BDRY_LOC::ZLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_lo_idx[2] + (fill_box_hi_idx[2] - k) + num_ghosts[2])
-                                        *ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_2 == BDRY_LOC::ZHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_hi_idx[2] - (k - fill_box_lo_idx[2]) + num_ghosts[2])
-                                        *ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                            
-                            var_data->getPointer(2)[idx_cell] = -var_data->getPointer(2)[idx_cell_pivot];
-                        }
-                    }
-                }
+                TBOX_ERROR("BasicCartesianBoundaryUtilities3::fillNodeBoundaryData()\n"
+                    << "Invalid node boundary condition!\n"
+                    << "node_loc = '" << node_loc << "'." << std::endl
+                    << "bdry_node_conds[node_loc] = '" << bdry_node_conds[node_loc] << "'."
+                    << std::endl);
             }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::XSYMMETRY)
+        }
+    }
+}
+
+
+/*
+ * Function to fill node boundary values of several variables. The node boundary boxes are
+ * traversed once and all the variables are filled for each of them.
+ *
+ * Arguments are:
+ *    var_names ............ names of variables (for error reporting)
+ *    var_data ............. cell-centered patch data objects to fill
+ *    patch ................ patch on which data objects live
+ *    bdry_node_locs ....... array of locations of nodes for applying
+ *                           boundary conditions.
+ *    bdry_node_conds ...... arrays of boundary conditions for patch nodes,
+ *                           one for each variable
+ *    bdry_face_values ..... arrays of boundary values for faces, one for
+ *                           each variable
+ *    ghost_width_to_fill .. width of ghost region to fill
+ *    bdry_fill_plan ....... boundary fill plan of the patch (built on the fly if
+ *                           it is not given)
+ */
+void
+BasicCartesianBoundaryUtilities3::fillNodeBoundaryData(
+    const std::vector<std::string>& var_names,
+    const std::vector<boost::shared_ptr<pdat::CellData<double> > >& var_data,
+    const hier::Patch& patch,
+    const std::vector<int>& bdry_node_locs,
+    const std::vector<std::vector<int> >& bdry_node_conds,
+    const std::vector<std::vector<double> >& bdry_face_values,
+    const hier::IntVector& ghost_width_to_fill,
+    const boost::shared_ptr<BoundaryFillPlan>& bdry_fill_plan)
+{
+    TBOX_ASSERT(var_names.size() == var_data.size());
+    TBOX_ASSERT(bdry_node_conds.size() == var_data.size());
+    TBOX_ASSERT(bdry_face_values.size() == var_data.size());
+    TBOX_ASSERT(static_cast<int>(bdry_node_locs.size()) <= NUM_3D_NODES);
+    
+    TBOX_DIM_ASSERT(ghost_width_to_fill.getDim() == tbox::Dimension(3));
+    
+    const int num_vars = static_cast<int>(var_data.size());
+    
+    /*
+     * Determine the ghost cell widths to fill of the variables.
+     */
+    
+    std::vector<hier::IntVector> gcw_to_fill;
+    gcw_to_fill.reserve(num_vars);
+    
+    for (int vi = 0; vi < num_vars; vi++)
+    {
+        TBOX_ASSERT(var_data[vi]);
+        TBOX_ASSERT(static_cast<int>(bdry_node_conds[vi].size()) == NUM_3D_NODES);
+        TBOX_ASSERT(static_cast<int>(bdry_face_values[vi].size()) == NUM_3D_FACES*(var_data[vi]->getDepth()));
+        TBOX_ASSERT_OBJDIM_EQUALITY3(*var_data[vi], patch, ghost_width_to_fill);
+        
+        // If the ghost fill width is not used, it is set to the ghost cell width of the data.
+        if (ghost_width_to_fill == -hier::IntVector::getOne(tbox::Dimension(3)))
+        {
+            gcw_to_fill.push_back(var_data[vi]->getGhostCellWidth());
+        }
+        else
+        {
+            gcw_to_fill.push_back(hier::IntVector::min(
+                var_data[vi]->getGhostCellWidth(),
+                ghost_width_to_fill));
+        }
+    }
+    
+    // Get the box that covers the interior of patch.
+    const hier::Box& interior_box(patch.getBox());
+    
+    /*
+     * Get the boundary boxes from the boundary fill plan of the patch.
+     */
+    
+    boost::shared_ptr<BoundaryFillPlan> fill_plan(bdry_fill_plan);
+    if (!fill_plan)
+    {
+        fill_plan.reset(new BoundaryFillPlan(patch));
+    }
+    
+    const std::vector<hier::BoundaryBox>& node_bdry = fill_plan->getBoundaryBoxes(BDRY::NODE3D);
+    
+    for (int ni = 0; ni < static_cast<int>(node_bdry.size()); ni++)
+    {
+        TBOX_ASSERT(node_bdry[ni].getBoundaryType() == BDRY::NODE3D);
+        
+        int node_loc = node_bdry[ni].getLocationIndex();
+        
+        if (std::find(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc) !=
+            bdry_node_locs.end())
+        {
+            for (int vi = 0; vi < num_vars; vi++)
             {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                const hier::Box& fill_box(fill_plan->getFillBoxes(BDRY::NODE3D, gcw_to_fill[vi])[ni]);
+                
+                const int face_bdry_cond = getFaceBoundaryConditionType(bdry_node_conds[vi][node_loc]);
+                
+                if (face_bdry_cond == BDRY_COND::BASIC::NEUMANN)
                 {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_0 == BDRY_LOC::XLO)
-                            {
-                                idx_cell_pivot = (interior_box_lo_idx[0] + (fill_box_hi_idx[0] - i) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_0 == BDRY_LOC::XHI)
-                            {
-                                idx_cell_pivot = (interior_box_hi_idx[0] - (i - fill_box_lo_idx[0]) + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
+                    // NOT YET IMPLEMENTED
                 }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::YSYMMETRY)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                else if (face_bdry_cond != -1)
                 {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_1 == BDRY_LOC::YLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_lo_idx[1] + (fill_box_hi_idx[1] - j) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_1 == BDRY_LOC::YHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (interior_box_hi_idx[1] - (j - fill_box_lo_idx[1]) + num_ghosts[1])*ghostcell_dims[0] +
-                                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
+                    const int face_loc = getFaceLocationForNodeBdry(node_loc, bdry_node_conds[vi][node_loc]);
+                    
+                    fillBoxWithFaceBoundaryCondition(
+                        var_data[vi],
+                        fill_box,
+                        interior_box,
+                        face_loc,
+                        face_bdry_cond,
+                        bdry_face_values[vi]);
                 }
-            }
-            else if (bdry_node_conds[node_loc] == BDRY_COND::BASIC::ZSYMMETRY)
-            {
-                for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                else
                 {
-                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
-                    {
-                        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
-                        {
-                            const int idx_cell = (i + num_ghosts[0]) +
-                                (j + num_ghosts[1])*ghostcell_dims[0] +
-                                (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
-                            
-                            int idx_cell_pivot = idx_cell;
-                            
-                            if (face_loc_2 == BDRY_LOC::ZLO)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_lo_idx[2] + (fill_box_hi_idx[2] - k) + num_ghosts[2])
-                                        *ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            else if (face_loc_2 == BDRY_LOC::ZHI)
-                            {
-                                idx_cell_pivot = (i + num_ghosts[0]) +
-                                    (j + num_ghosts[1])*ghostcell_dims[0] +
-                                    (interior_box_hi_idx[2] - (k - fill_box_lo_idx[2]) + num_ghosts[2])
-                                        *ghostcell_dims[0]*ghostcell_dims[1];
-                            }
-                            
-                            for (int di = 0; di < var_depth; di++)
-                            {
-                                var_data->getPointer(di)[idx_cell] = var_data->getPointer(di)[idx_cell_pivot];
-                            }
-                        }
-                    }
+                    TBOX_ERROR("BasicCartesianBoundaryUtilities3::fillNodeBoundaryData()\n"
+                        << "Invalid node boundary condition!\n"
+                        << "var_name = '" << var_names[vi] << "'." << std::endl
+                        << "node_loc = '" << node_loc << "'." << std::endl
+                        << "bdry_node_conds[node_loc] = '" << bdry_node_conds[vi][node_loc] << "'."
+                        << std::endl);
                 }
             }
-            else
-            {
-                TBOX_ERROR("BasicCartesianBoundaryUtilities3::fillNodeBoundaryData()\n"
-                    << "Invalid node boundary condition!\n"
-                    << "node_loc = '" << node_loc << "'." << std::endl
-                    << "bdry_node_conds[node_loc] = '" << bdry_node_conds[node_loc] << "'."
-                    << std::endl);
-            }
         }
     }
 }
@@ -2915,3 +2123,216 @@ BasicCartesianBoundaryUtilities3::read3dBdryNodes(
         } // for (int ni = 0 ...
     } // if (num_per_dirs < 1)
 }
+
+
+/*
+ * Function that returns the face boundary condition type (FLOW, REFLECT, SYMMETRY, DIRICHLET or
+ * NEUMANN) of an edge or node boundary condition type. -1 is returned if the edge or node boundary
+ * condition type is unknown.
+ */
+int
+BasicCartesianBoundaryUtilities3::getFaceBoundaryConditionType(
+    const int bdry_cond)
+{
+    switch (bdry_cond)
+    {
+        case BDRY_COND::BASIC::XFLOW:
+        case BDRY_COND::BASIC::YFLOW:
+        case BDRY_COND::BASIC::ZFLOW:
+        {
+            return BDRY_COND::BASIC::FLOW;
+        }
+        case BDRY_COND::BASIC::XREFLECT:
+        case BDRY_COND::BASIC::YREFLECT:
+        case BDRY_COND::BASIC::ZREFLECT:
+        {
+            return BDRY_COND::BASIC::REFLECT;
+        }
+        case BDRY_COND::BASIC::XSYMMETRY:
+        case BDRY_COND::BASIC::YSYMMETRY:
+        case BDRY_COND::BASIC::ZSYMMETRY:
+        {
+            return BDRY_COND::BASIC::SYMMETRY;
+        }
+        case BDRY_COND::BASIC::XDIRICHLET:
+        case BDRY_COND::BASIC::YDIRICHLET:
+        case BDRY_COND::BASIC::ZDIRICHLET:
+        {
+            return BDRY_COND::BASIC::DIRICHLET;
+        }
+        case BDRY_COND::BASIC::XNEUMANN:
+        case BDRY_COND::BASIC::YNEUMANN:
+        case BDRY_COND::BASIC::ZNEUMANN:
+        {
+            return BDRY_COND::BASIC::NEUMANN;
+        }
+        default:
+        {
+            return -1;
+        }
+    }
+}
+
+
+/*
+ * Function to fill the cells of a fill box with the FLOW, REFLECT, SYMMETRY or DIRICHLET boundary
+ * condition of a face. The fill box is filled row by row along the x-direction, which is contiguous
+ * in memory. For the faces normal to the y- and z-directions, each row is a copy of a row in the
+ * interior of the patch. For the faces normal to the x-direction, each row is a broadcast of the
+ * pivot (FLOW) or a mirror of the interior row (REFLECT and SYMMETRY).
+ */
+void
+BasicCartesianBoundaryUtilities3::fillBoxWithFaceBoundaryCondition(
+    const boost::shared_ptr<pdat::CellData<double> >& var_data,
+    const hier::Box& fill_box,
+    const hier::Box& interior_box,
+    const int face_loc,
+    const int bdry_face_cond,
+    const std::vector<double>& bdry_face_values)
+{
+    TBOX_ASSERT(face_loc >= 0 && face_loc < NUM_3D_FACES);
+    
+    const int var_depth = var_data->getDepth();
+    
+    const hier::IntVector& num_ghosts(var_data->getGhostCellWidth());
+    
+    // Get the dimensions of box that covers interior of patch plus
+    // ghost cells.
+    const hier::IntVector ghostcell_dims = var_data->getGhostBox().numberCells();
+    
+    hier::Index interior_box_hi_idx(interior_box.upper());
+    hier::Index fill_box_lo_idx(fill_box.lower());
+    hier::Index fill_box_hi_idx(fill_box.upper());
+    
+    /*
+     * Offset the indices.
+     */
+    interior_box_hi_idx = interior_box_hi_idx - interior_box.lower();
+    fill_box_lo_idx = fill_box_lo_idx - interior_box.lower();
+    fill_box_hi_idx = fill_box_hi_idx - interior_box.lower();
+    
+    /*
+     * Get the direction normal to the face, the index of the pivot in the interior next to the face
+     * and the sum of the indices of the mirrored cells in that direction.
+     */
+    
+    const int dir = face_loc/2;
+    const bool is_lo_face = (face_loc%2 == 0);
+    
+    const int idx_pivot = is_lo_face ? 0 : interior_box_hi_idx[dir];
+    const int idx_mirror_sum = is_lo_face ? fill_box_hi_idx[dir] : interior_box_hi_idx[dir] + fill_box_lo_idx[dir];
+    
+    const int num_cells_row = fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1;
+    
+    for (int di = 0; di < var_depth; di++)
+    {
+        double* Q = var_data->getPointer(di);
+        
+        if (bdry_face_cond == BDRY_COND::BASIC::DIRICHLET)
+        {
+            const double Q_bdry = bdry_face_values[face_loc*var_depth + di];
+            
+            for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
+            {
+                for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                {
+                    const int idx_row = (fill_box_lo_idx[0] + num_ghosts[0]) +
+                        (j + num_ghosts[1])*ghostcell_dims[0] +
+                        (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
+                    
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = 0; i < num_cells_row; i++)
+                    {
+                        Q[idx_row + i] = Q_bdry;
+                    }
+                }
+            }
+            
+            continue;
+        }
+        
+        // The normal component of a vector is flipped at a REFLECT boundary.
+        const double sign = ((bdry_face_cond == BDRY_COND::BASIC::REFLECT) && (di == dir)) ?
+            double(-1) : double(1);
+        
+        for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
+        {
+            for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+            {
+                const int idx_row = (fill_box_lo_idx[0] + num_ghosts[0]) +
+                    (j + num_ghosts[1])*ghostcell_dims[0] +
+                    (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
+                
+                if (dir == 0)
+                {
+                    if (bdry_face_cond == BDRY_COND::BASIC::FLOW)
+                    {
+                        const int idx_cell_pivot = (idx_pivot + num_ghosts[0]) +
+                            (j + num_ghosts[1])*ghostcell_dims[0] +
+                            (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
+                        
+                        const double Q_pivot = Q[idx_cell_pivot];
+                        
+#ifdef HAMERS_ENABLE_SIMD
+                        #pragma omp simd
+#endif
+                        for (int i = 0; i < num_cells_row; i++)
+                        {
+                            Q[idx_row + i] = Q_pivot;
+                        }
+                    }
+                    else
+                    {
+                        // Index of the cell mirrored with the first cell of the row.
+                        const int idx_row_mirror = (idx_mirror_sum - fill_box_lo_idx[0] + num_ghosts[0]) +
+                            (j + num_ghosts[1])*ghostcell_dims[0] +
+                            (k + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
+                        
+#ifdef HAMERS_ENABLE_SIMD
+                        #pragma omp simd
+#endif
+                        for (int i = 0; i < num_cells_row; i++)
+                        {
+                            Q[idx_row + i] = sign*Q[idx_row_mirror - i];
+                        }
+                    }
+                }
+                else
+                {
+                    int j_src = j;
+                    int k_src = k;
+                    
+                    if (dir == 1)
+                    {
+                        j_src = (bdry_face_cond == BDRY_COND::BASIC::FLOW) ? idx_pivot : idx_mirror_sum - j;
+                    }
+                    else
+                    {
+                        k_src = (bdry_face_cond == BDRY_COND::BASIC::FLOW) ? idx_pivot : idx_mirror_sum - k;
+                    }
+                    
+                    const int idx_row_src = (fill_box_lo_idx[0] + num_ghosts[0]) +
+                        (j_src + num_ghosts[1])*ghostcell_dims[0] +
+                        (k_src + num_ghosts[2])*ghostcell_dims[0]*ghostcell_dims[1];
+                    
+                    if (sign > double(0))
+                    {
+                        std::memcpy(&Q[idx_row], &Q[idx_row_src], num_cells_row*sizeof(double));
+                    }
+                    else
+                    {
+#ifdef HAMERS_ENABLE_SIMD
+                        #pragma omp simd
+#endif
+                        for (int i = 0; i < num_cells_row; i++)
+                        {
+                            Q[idx_row + i] = -Q[idx_row_src + i];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
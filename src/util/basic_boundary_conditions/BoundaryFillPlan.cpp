@@ -0,0 +1,79 @@
+#include "util/basic_boundary_conditions/BoundaryFillPlan.hpp"
+
+BoundaryFillPlan::BoundaryFillPlan(
+    const hier::Patch& patch):
+        d_dim(patch.getDim()),
+        d_patch_box(patch.getBox()),
+        d_ratio_to_level_zero(patch.getPatchGeometry()->getRatio()),
+        d_patch_geom(
+            BOOST_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
+                patch.getPatchGeometry()))
+{
+    TBOX_ASSERT(d_patch_geom);
+    
+    d_bdry_boxes.reserve(d_dim.getValue());
+    
+    for (int codim = 1; codim <= d_dim.getValue(); codim++)
+    {
+        d_bdry_boxes.push_back(d_patch_geom->getCodimensionBoundaries(codim));
+    }
+}
+
+
+/*
+ * Whether the plan was built for a patch with the same box and the same refinement ratio as the
+ * given patch.
+ */
+bool
+BoundaryFillPlan::isValidFor(
+    const hier::Patch& patch) const
+{
+    return patch.getBox().isSpatiallyEqual(d_patch_box) &&
+        patch.getBox().getBlockId() == d_patch_box.getBlockId() &&
+        patch.getPatchGeometry()->getRatio() == d_ratio_to_level_zero;
+}
+
+
+/*
+ * Get the fill boxes of the boundary boxes of a codimension for a ghost cell width to fill.
+ */
+const std::vector<hier::Box>&
+BoundaryFillPlan::getFillBoxes(
+    const int codim,
+    const hier::IntVector& ghost_width_to_fill)
+{
+    TBOX_ASSERT(codim >= 1 && codim <= d_dim.getValue());
+    TBOX_ASSERT(ghost_width_to_fill.getDim() == d_dim);
+    
+    for (int wi = 0; wi < static_cast<int>(d_ghost_widths_to_fill.size()); wi++)
+    {
+        if (d_ghost_widths_to_fill[wi] == ghost_width_to_fill)
+        {
+            return d_fill_boxes[wi][codim - 1];
+        }
+    }
+    
+    /*
+     * Compute the fill boxes for the new ghost cell width.
+     */
+    
+    d_ghost_widths_to_fill.push_back(ghost_width_to_fill);
+    d_fill_boxes.push_back(std::vector<std::vector<hier::Box> >(d_dim.getValue()));
+    
+    std::vector<std::vector<hier::Box> >& fill_boxes = d_fill_boxes.back();
+    
+    for (int ci = 0; ci < d_dim.getValue(); ci++)
+    {
+        fill_boxes[ci].reserve(d_bdry_boxes[ci].size());
+        
+        for (int bi = 0; bi < static_cast<int>(d_bdry_boxes[ci].size()); bi++)
+        {
+            fill_boxes[ci].push_back(d_patch_geom->getBoundaryFillBox(
+                d_bdry_boxes[ci][bi],
+                d_patch_box,
+                ghost_width_to_fill));
+        }
+    }
+    
+    return fill_boxes[codim - 1];
+}
@@ -0,0 +1,105 @@
+#include "util/basic_boundary_conditions/SpecialBoundaryConditionsCache.hpp"
+
+SpecialBoundaryConditionsPatchData::SpecialBoundaryConditionsPatchData(
+    const hier::Patch& patch,
+    const hier::IntVector& ghost_width_to_fill,
+    const hier::IntVector& num_ghosts):
+        d_patch_box(patch.getBox()),
+        d_ratio_to_level_zero(patch.getPatchGeometry()->getRatio()),
+        d_ghost_width_to_fill(ghost_width_to_fill),
+        d_num_ghosts(num_ghosts)
+{
+}
+
+
+/*
+ * Whether the data was set up for a patch with the same box and the same refinement ratio as the
+ * given patch and for the same ghost cell widths.
+ */
+bool
+SpecialBoundaryConditionsPatchData::isValidFor(
+    const hier::Patch& patch,
+    const hier::IntVector& ghost_width_to_fill,
+    const hier::IntVector& num_ghosts) const
+{
+    return patch.getBox().isSpatiallyEqual(d_patch_box) &&
+        patch.getBox().getBlockId() == d_patch_box.getBlockId() &&
+        patch.getPatchGeometry()->getRatio() == d_ratio_to_level_zero &&
+        ghost_width_to_fill == d_ghost_width_to_fill &&
+        num_ghosts == d_num_ghosts;
+}
+
+
+/*
+ * Get the cached data of a patch. A null pointer is returned if no data is cached for the patch or
+ * if the cached data is stale.
+ */
+boost::shared_ptr<SpecialBoundaryConditionsPatchData>
+SpecialBoundaryConditionsCache::getPatchData(
+    const hier::Patch& patch,
+    const hier::IntVector& ghost_width_to_fill,
+    const hier::IntVector& num_ghosts) const
+{
+    const int level_number = patch.getPatchLevelNumber();
+    
+    if (level_number >= 0 && level_number < static_cast<int>(d_patch_data.size()))
+    {
+        std::map<hier::BoxId, boost::shared_ptr<SpecialBoundaryConditionsPatchData> >::const_iterator it =
+            d_patch_data[level_number].find(patch.getBox().getBoxId());
+        
+        if (it != d_patch_data[level_number].end() &&
+            it->second->isValidFor(patch, ghost_width_to_fill, num_ghosts))
+        {
+            return it->second;
+        }
+    }
+    
+    return boost::shared_ptr<SpecialBoundaryConditionsPatchData>();
+}
+
+
+/*
+ * Create empty data for a patch, replacing any data cached for the patch.
+ */
+boost::shared_ptr<SpecialBoundaryConditionsPatchData>
+SpecialBoundaryConditionsCache::createPatchData(
+    const hier::Patch& patch,
+    const hier::IntVector& ghost_width_to_fill,
+    const hier::IntVector& num_ghosts)
+{
+    boost::shared_ptr<SpecialBoundaryConditionsPatchData> patch_data(
+        new SpecialBoundaryConditionsPatchData(patch, ghost_width_to_fill, num_ghosts));
+    
+    const int level_number = patch.getPatchLevelNumber();
+    
+    if (level_number >= 0)
+    {
+        if (level_number >= static_cast<int>(d_patch_data.size()))
+        {
+            d_patch_data.resize(level_number + 1);
+        }
+        
+        d_patch_data[level_number][patch.getBox().getBoxId()] = patch_data;
+    }
+    
+    return patch_data;
+}
+
+
+/*
+ * Drop the cached data of the patches on the levels in the range of levels.
+ */
+void
+SpecialBoundaryConditionsCache::resetLevels(
+    const int coarsest_level,
+    const int finest_level)
+{
+    TBOX_ASSERT((coarsest_level >= 0) && (coarsest_level <= finest_level));
+    
+    for (int ln = coarsest_level;
+         ln <= finest_level && ln < static_cast<int>(d_patch_data.size());
+         ln++)
+    {
+        d_patch_data[ln].clear();
+    }
+}
@@ -0,0 +1,318 @@
+#include "util/memory_usage/MemoryUsage.hpp"
+
+#include "SAMRAI/hier/PatchDescriptor.h"
+#include "SAMRAI/hier/VariableDatabase.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+std::map<std::string, size_t> MemoryUsage::s_temporary_data_peak;
+
+/*
+ * Convert a number of bytes to megabytes.
+ */
+static double
+bytesToMegabytes(const double num_bytes)
+{
+    return num_bytes/(1024.0*1024.0);
+}
+
+
+/*
+ * Record the size of the temporary data of a component. Only the peak size of the temporary data
+ * of each component is kept.
+ */
+void
+MemoryUsage::recordTemporaryData(
+    const std::string& component_name,
+    const size_t num_bytes)
+{
+    size_t& peak = s_temporary_data_peak[component_name];
+    
+    if (num_bytes > peak)
+    {
+        peak = num_bytes;
+    }
+}
+
+
+/*
+ * Get the size of the array of the cell data including the ghost cells.
+ */
+size_t
+MemoryUsage::getPatchDataSize(
+    const boost::shared_ptr<pdat::CellData<double> >& data)
+{
+    if (!data)
+    {
+        return 0;
+    }
+    
+    return static_cast<size_t>(data->getGhostBox().size())*
+        static_cast<size_t>(data->getDepth())*sizeof(double);
+}
+
+
+/*
+ * Get the size of the arrays of the side data including the ghost cells.
+ */
+size_t
+MemoryUsage::getPatchDataSize(
+    const boost::shared_ptr<pdat::SideData<double> >& data)
+{
+    if (!data)
+    {
+        return 0;
+    }
+    
+    size_t num_bytes = 0;
+    
+    for (int di = 0; di < data->getDim().getValue(); di++)
+    {
+        if (data->getDirectionVector()[di])
+        {
+            num_bytes += static_cast<size_t>(data->getArrayData(di).getBox().size())*
+                static_cast<size_t>(data->getDepth())*sizeof(double);
+        }
+    }
+    
+    return num_bytes;
+}
+
+
+/*
+ * Get the current resident memory of the process in bytes.
+ */
+size_t
+MemoryUsage::getCurrentProcessMemory()
+{
+    return readProcessStatusField("VmRSS:");
+}
+
+
+/*
+ * Get the peak resident memory of the process in bytes.
+ */
+size_t
+MemoryUsage::getPeakProcessMemory()
+{
+    return readProcessStatusField("VmHWM:");
+}
+
+
+/*
+ * Print the current and peak memory of the process on each rank, the memory of the patch data on
+ * the patch hierarchy on this rank grouped by variable context and the peak memory of the
+ * temporary data of the components on this rank.
+ */
+void
+MemoryUsage::printMemoryUsage(
+    std::ostream& os,
+    const boost::shared_ptr<hier::PatchHierarchy>& patch_hierarchy)
+{
+    TBOX_ASSERT(patch_hierarchy);
+    
+    const tbox::SAMRAI_MPI& mpi(tbox::SAMRAI_MPI::getSAMRAIWorld());
+    
+    /*
+     * Get the statistics of the current and peak memory of the process over the ranks.
+     */
+    
+    double process_memory_local[2];
+    process_memory_local[0] = double(getCurrentProcessMemory());
+    process_memory_local[1] = double(getPeakProcessMemory());
+    
+    double process_memory_min[2];
+    double process_memory_max[2];
+    double process_memory_sum[2];
+    
+    mpi.Allreduce(
+        process_memory_local,
+        process_memory_min,
+        2,
+        MPI_DOUBLE,
+        MPI_MIN);
+    
+    mpi.Allreduce(
+        process_memory_local,
+        process_memory_max,
+        2,
+        MPI_DOUBLE,
+        MPI_MAX);
+    
+    mpi.Allreduce(
+        process_memory_local,
+        process_memory_sum,
+        2,
+        MPI_DOUBLE,
+        MPI_SUM);
+    
+    /*
+     * Sum the memory of the allocated patch data of each component over the patches on all
+     * levels.
+     */
+    
+    const boost::shared_ptr<hier::PatchDescriptor> patch_descriptor(
+        patch_hierarchy->getPatchDescriptor());
+    
+    const int num_components = patch_descriptor->getMaxNumberRegisteredComponents();
+    
+    std::vector<double> patch_data_memory_local(num_components, 0.0);
+    std::vector<double> patch_data_memory_sum(num_components, 0.0);
+    
+    for (int li = 0; li < patch_hierarchy->getNumberOfLevels(); li++)
+    {
+        boost::shared_ptr<hier::PatchLevel> level(patch_hierarchy->getPatchLevel(li));
+        
+        for (hier::PatchLevel::iterator ip(level->begin());
+             ip != level->end();
+             ip++)
+        {
+            const boost::shared_ptr<hier::Patch> patch = *ip;
+            
+            for (int pi = 0; pi < num_components; pi++)
+            {
+                const boost::shared_ptr<hier::PatchDataFactory> factory(
+                    patch_descriptor->getPatchDataFactory(pi));
+                
+                if (factory && patch->checkAllocated(pi))
+                {
+                    patch_data_memory_local[pi] += double(factory->getSizeOfMemory(patch->getBox()));
+                }
+            }
+        }
+    }
+    
+    if (num_components > 0)
+    {
+        mpi.Allreduce(
+            &patch_data_memory_local[0],
+            &patch_data_memory_sum[0],
+            num_components,
+            MPI_DOUBLE,
+            MPI_SUM);
+    }
+    
+    /*
+     * Group the memory of the patch data by variable context.
+     */
+    
+    hier::VariableDatabase* variable_db = hier::VariableDatabase::getDatabase();
+    
+    std::map<std::string, std::pair<double, double> > patch_data_memory_context;
+    double patch_data_memory_local_total = 0.0;
+    double patch_data_memory_sum_total = 0.0;
+    
+    for (int pi = 0; pi < num_components; pi++)
+    {
+        if (patch_data_memory_sum[pi] > 0.0)
+        {
+            boost::shared_ptr<hier::Variable> variable;
+            boost::shared_ptr<hier::VariableContext> context;
+            
+            std::string context_name("no context");
+            
+            if (variable_db->mapIndexToVariableAndContext(pi, variable, context) && context)
+            {
+                context_name = context->getName();
+            }
+            
+            patch_data_memory_context[context_name].first += patch_data_memory_local[pi];
+            patch_data_memory_context[context_name].second += patch_data_memory_sum[pi];
+            
+            patch_data_memory_local_total += patch_data_memory_local[pi];
+            patch_data_memory_sum_total += patch_data_memory_sum[pi];
+        }
+    }
+    
+    /*
+     * Print the memory usage.
+     */
+    
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    
+    os << std::fixed << std::setprecision(2);
+    
+    os << "Memory usage (MB):" << std::endl;
+    os << "  Process memory (this rank / min / max / total over ranks):" << std::endl;
+    os << "    current: "
+       << bytesToMegabytes(process_memory_local[0]) << " / "
+       << bytesToMegabytes(process_memory_min[0]) << " / "
+       << bytesToMegabytes(process_memory_max[0]) << " / "
+       << bytesToMegabytes(process_memory_sum[0]) << std::endl;
+    os << "    peak:    "
+       << bytesToMegabytes(process_memory_local[1]) << " / "
+       << bytesToMegabytes(process_memory_min[1]) << " / "
+       << bytesToMegabytes(process_memory_max[1]) << " / "
+       << bytesToMegabytes(process_memory_sum[1]) << std::endl;
+    
+    os << "  Patch data on hierarchy by context (this rank / total over ranks):" << std::endl;
+    for (std::map<std::string, std::pair<double, double> >::const_iterator it =
+             patch_data_memory_context.begin();
+         it != patch_data_memory_context.end();
+         it++)
+    {
+        os << "    " << it->first << ": "
+           << bytesToMegabytes(it->second.first) << " / "
+           << bytesToMegabytes(it->second.second) << std::endl;
+    }
+    os << "    all contexts: "
+       << bytesToMegabytes(patch_data_memory_local_total) << " / "
+       << bytesToMegabytes(patch_data_memory_sum_total) << std::endl;
+    
+    os << "  Peak temporary data by component (this rank):" << std::endl;
+    for (std::map<std::string, size_t>::const_iterator it = s_temporary_data_peak.begin();
+         it != s_temporary_data_peak.end();
+         it++)
+    {
+        os << "    " << it->first << ": " << bytesToMegabytes(double(it->second)) << std::endl;
+    }
+    
+    /*
+     * The temporary data is freed between the steps. The rest of the current memory of the process
+     * is taken up by the metadata of the patch hierarchy (boxes, connectors and schedules), the
+     * communication buffers and the code.
+     */
+    
+    if (process_memory_local[0] > 0.0)
+    {
+        os << "  Other memory of process on this rank (metadata, buffers, code): "
+           << bytesToMegabytes(
+                  process_memory_local[0] - patch_data_memory_local_total)
+           << std::endl;
+    }
+    
+    os.flags(flags);
+    os.precision(precision);
+}
+
+
+/*
+ * Read the value of a field of /proc/self/status in bytes. The values of the memory fields are
+ * given in kB.
+ */
+size_t
+MemoryUsage::readProcessStatusField(const std::string& field_name)
+{
+    std::ifstream status_file("/proc/self/status");
+    
+    std::string line;
+    while (std::getline(status_file, line))
+    {
+        if (line.compare(0, field_name.size(), field_name) == 0)
+        {
+            std::istringstream line_stream(line.substr(field_name.size()));
+            
+            size_t value_kB = 0;
+            line_stream >> value_kB;
+            
+            return value_kB*1024;
+        }
+    }
+    
+    return 0;
+}
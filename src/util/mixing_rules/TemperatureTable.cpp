@@ -0,0 +1,572 @@
+#include "util/mixing_rules/TemperatureTable.hpp"
+
+TemperatureTableSettings::TemperatureTableSettings(
+    const std::string& object_name,
+    const boost::shared_ptr<tbox::Database>& mixing_rules_db):
+        d_use_temperature_tables(false),
+        d_temperature_table_T_min(double(0)),
+        d_temperature_table_T_max(double(0)),
+        d_temperature_table_num_points(64),
+        d_temperature_table_max_num_points(65537),
+        d_temperature_table_use_log_spacing(true),
+        d_temperature_table_tolerance(double(1.0e-6)),
+        d_object_name(object_name)
+{
+    d_use_temperature_tables = mixing_rules_db->getBoolWithDefault("use_temperature_tables", false);
+    d_use_temperature_tables = mixing_rules_db->getBoolWithDefault("d_use_temperature_tables",
+        d_use_temperature_tables);
+    
+    if (!d_use_temperature_tables)
+    {
+        return;
+    }
+    
+    /*
+     * Get the range of temperature covered by the tables from the database.
+     */
+    
+    if (mixing_rules_db->keyExists("temperature_table_T_min"))
+    {
+        d_temperature_table_T_min = mixing_rules_db->getDouble("temperature_table_T_min");
+    }
+    else if (mixing_rules_db->keyExists("d_temperature_table_T_min"))
+    {
+        d_temperature_table_T_min = mixing_rules_db->getDouble("d_temperature_table_T_min");
+    }
+    else
+    {
+        TBOX_ERROR(d_object_name
+            << ": "
+            << "Key data 'temperature_table_T_min'/'d_temperature_table_T_min'"
+            << " not found in data for temperature tables."
+            << std::endl);
+    }
+    
+    if (mixing_rules_db->keyExists("temperature_table_T_max"))
+    {
+        d_temperature_table_T_max = mixing_rules_db->getDouble("temperature_table_T_max");
+    }
+    else if (mixing_rules_db->keyExists("d_temperature_table_T_max"))
+    {
+        d_temperature_table_T_max = mixing_rules_db->getDouble("d_temperature_table_T_max");
+    }
+    else
+    {
+        TBOX_ERROR(d_object_name
+            << ": "
+            << "Key data 'temperature_table_T_max'/'d_temperature_table_T_max'"
+            << " not found in data for temperature tables."
+            << std::endl);
+    }
+    
+    if (d_temperature_table_T_min <= double(0) || d_temperature_table_T_max <= d_temperature_table_T_min)
+    {
+        TBOX_ERROR(d_object_name
+            << ": "
+            << "The range of temperature of the tables is invalid."
+            << std::endl);
+    }
+    
+    /*
+     * Get the numbers of nodes, the spacing of the nodes and the tolerance of the tables from the
+     * database.
+     */
+    
+    d_temperature_table_num_points = mixing_rules_db->
+        getIntegerWithDefault("temperature_table_num_points", d_temperature_table_num_points);
+    d_temperature_table_num_points = mixing_rules_db->
+        getIntegerWithDefault("d_temperature_table_num_points", d_temperature_table_num_points);
+    
+    d_temperature_table_max_num_points = mixing_rules_db->
+        getIntegerWithDefault("temperature_table_max_num_points", d_temperature_table_max_num_points);
+    d_temperature_table_max_num_points = mixing_rules_db->
+        getIntegerWithDefault("d_temperature_table_max_num_points", d_temperature_table_max_num_points);
+    
+    d_temperature_table_use_log_spacing = mixing_rules_db->
+        getBoolWithDefault("temperature_table_use_log_spacing", d_temperature_table_use_log_spacing);
+    d_temperature_table_use_log_spacing = mixing_rules_db->
+        getBoolWithDefault("d_temperature_table_use_log_spacing", d_temperature_table_use_log_spacing);
+    
+    d_temperature_table_tolerance = mixing_rules_db->
+        getDoubleWithDefault("temperature_table_tolerance", d_temperature_table_tolerance);
+    d_temperature_table_tolerance = mixing_rules_db->
+        getDoubleWithDefault("d_temperature_table_tolerance", d_temperature_table_tolerance);
+    
+    if (d_temperature_table_num_points < 4 ||
+        d_temperature_table_max_num_points < d_temperature_table_num_points)
+    {
+        TBOX_ERROR(d_object_name
+            << ": "
+            << "The tables need at least four nodes and 'temperature_table_max_num_points' cannot be"
+            << " smaller than 'temperature_table_num_points'."
+            << std::endl);
+    }
+    
+    if (d_temperature_table_tolerance <= double(0))
+    {
+        TBOX_ERROR(d_object_name
+            << ": "
+            << "'temperature_table_tolerance' must be positive."
+            << std::endl);
+    }
+}
+
+
+/*
+ * Print all characteristics of the temperature table settings.
+ */
+void
+TemperatureTableSettings::printClassData(std::ostream& os) const
+{
+    os << "d_use_temperature_tables = "
+       << d_use_temperature_tables
+       << std::endl;
+    
+    if (d_use_temperature_tables)
+    {
+        os << "d_temperature_table_T_min = "
+           << d_temperature_table_T_min
+           << std::endl;
+        
+        os << "d_temperature_table_T_max = "
+           << d_temperature_table_T_max
+           << std::endl;
+        
+        os << "d_temperature_table_num_points = "
+           << d_temperature_table_num_points
+           << std::endl;
+        
+        os << "d_temperature_table_max_num_points = "
+           << d_temperature_table_max_num_points
+           << std::endl;
+        
+        os << "d_temperature_table_use_log_spacing = "
+           << d_temperature_table_use_log_spacing
+           << std::endl;
+        
+        os << "d_temperature_table_tolerance = "
+           << d_temperature_table_tolerance
+           << std::endl;
+    }
+}
+
+
+/*
+ * Put the characteristics of the temperature table settings into the restart database. The
+ * settings may be shared by several mixing rules objects writing to the same database.
+ */
+void
+TemperatureTableSettings::putToRestart(
+    const boost::shared_ptr<tbox::Database>& restart_db) const
+{
+    if (restart_db->keyExists("d_use_temperature_tables"))
+    {
+        return;
+    }
+    
+    restart_db->putBool("d_use_temperature_tables", d_use_temperature_tables);
+    
+    if (d_use_temperature_tables)
+    {
+        restart_db->putDouble("d_temperature_table_T_min", d_temperature_table_T_min);
+        restart_db->putDouble("d_temperature_table_T_max", d_temperature_table_T_max);
+        restart_db->putInteger("d_temperature_table_num_points", d_temperature_table_num_points);
+        restart_db->putInteger("d_temperature_table_max_num_points", d_temperature_table_max_num_points);
+        restart_db->putBool("d_temperature_table_use_log_spacing", d_temperature_table_use_log_spacing);
+        restart_db->putDouble("d_temperature_table_tolerance", d_temperature_table_tolerance);
+    }
+}
+
+
+TemperatureTable::TemperatureTable(
+    const std::string& object_name,
+    const tbox::Dimension& dim,
+    const TemperatureTableSettings& settings,
+    const std::function<double(const double)>& function):
+        d_object_name(object_name),
+        d_dim(dim),
+        d_function(function),
+        d_T_min(settings.d_temperature_table_T_min),
+        d_T_max(settings.d_temperature_table_T_max),
+        d_use_log_spacing(settings.d_temperature_table_use_log_spacing),
+        d_num_points(settings.d_temperature_table_num_points),
+        d_inv_dx(double(0)),
+        d_max_relative_error(double(0))
+{
+    if (d_use_log_spacing)
+    {
+        d_x_min = log(d_T_min);
+        d_x_max = log(d_T_max);
+    }
+    else
+    {
+        d_x_min = d_T_min;
+        d_x_max = d_T_max;
+    }
+    
+    /*
+     * Refine the table by inserting a node between every two nodes until the interpolation error is
+     * within the tolerance.
+     */
+    
+    sampleFunction();
+    d_max_relative_error = computeMaximumRelativeError();
+    
+    while (d_max_relative_error > settings.d_temperature_table_tolerance &&
+           2*d_num_points - 1 <= settings.d_temperature_table_max_num_points)
+    {
+        d_num_points = 2*d_num_points - 1;
+        
+        sampleFunction();
+        d_max_relative_error = computeMaximumRelativeError();
+    }
+    
+    if (d_max_relative_error > settings.d_temperature_table_tolerance)
+    {
+        TBOX_ERROR(d_object_name
+            << ": "
+            << "The relative error of the table "
+            << d_max_relative_error
+            << " with "
+            << d_num_points
+            << " nodes is larger than the tolerance."
+            << std::endl);
+    }
+}
+
+
+/*
+ * Compute the cell data of the function at a depth from the cell data of temperature.
+ */
+void
+TemperatureTable::computeCellData(
+    boost::shared_ptr<pdat::CellData<double> >& data_function,
+    const boost::shared_ptr<pdat::CellData<double> >& data_temperature,
+    const hier::Box& domain,
+    const int depth_function) const
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(data_function);
+    TBOX_ASSERT(data_temperature);
+    TBOX_ASSERT(depth_function >= 0 && depth_function < data_function->getDepth());
+#endif
+    
+    // Get the dimensions of box that covers the interior of patch.
+    const hier::Box interior_box = data_function->getBox();
+    const hier::IntVector interior_dims = interior_box.numberCells();
+    
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(data_temperature->getBox().numberCells() == interior_dims);
+#endif
+    
+    /*
+     * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
+     */
+    
+    const hier::IntVector num_ghosts_function = data_function->getGhostCellWidth();
+    const hier::IntVector ghostcell_dims_function = data_function->getGhostBox().numberCells();
+    
+    const hier::IntVector num_ghosts_temperature = data_temperature->getGhostCellWidth();
+    const hier::IntVector ghostcell_dims_temperature = data_temperature->getGhostBox().numberCells();
+    
+    /*
+     * Get the local lower indices and number of cells in each direction of the domain.
+     */
+    
+    hier::IntVector domain_lo(d_dim);
+    hier::IntVector domain_dims(d_dim);
+    
+    if (domain.empty())
+    {
+        hier::IntVector num_ghosts_min(d_dim);
+        
+        num_ghosts_min = num_ghosts_function;
+        num_ghosts_min = hier::IntVector::min(num_ghosts_temperature, num_ghosts_min);
+        
+        hier::Box ghost_box = interior_box;
+        ghost_box.grow(num_ghosts_min);
+        
+        domain_lo = -num_ghosts_min;
+        domain_dims = ghost_box.numberCells();
+    }
+    else
+    {
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+        TBOX_ASSERT(data_function->getGhostBox().contains(domain));
+        TBOX_ASSERT(data_temperature->getGhostBox().contains(domain));
+#endif
+        
+        domain_lo = domain.lower() - interior_box.lower();
+        domain_dims = domain.numberCells();
+    }
+    
+    /*
+     * Get the pointers to the cell data.
+     */
+    
+    double* f = data_function->getPointer(depth_function);
+    const double* const T = data_temperature->getPointer(0);
+    
+    const double T_min = d_T_min;
+    const double T_max = d_T_max;
+    const bool use_log_spacing = d_use_log_spacing;
+    
+    /*
+     * The cells are interpolated from the table in a vectorizable loop. The function itself is
+     * evaluated afterwards in the few cells outside the range of the table.
+     */
+    
+    int num_cells_out_of_range = 0;
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        /*
+         * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
+         */
+        
+        const int domain_lo_0 = domain_lo[0];
+        const int domain_dim_0 = domain_dims[0];
+        
+        const int num_ghosts_0_function = num_ghosts_function[0];
+        const int num_ghosts_0_temperature = num_ghosts_temperature[0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd reduction(+:num_cells_out_of_range)
+#endif
+        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+        {
+            // Compute the linear indices.
+            const int idx_function = i + num_ghosts_0_function;
+            const int idx_temperature = i + num_ghosts_0_temperature;
+            
+            const double x = use_log_spacing ? log(T[idx_temperature]) : T[idx_temperature];
+            
+            f[idx_function] = interpolate(x);
+            
+            num_cells_out_of_range +=
+                (T[idx_temperature] < T_min || T[idx_temperature] > T_max) ? 1 : 0;
+        }
+        
+        if (num_cells_out_of_range > 0)
+        {
+            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+            {
+                // Compute the linear indices.
+                const int idx_function = i + num_ghosts_0_function;
+                const int idx_temperature = i + num_ghosts_0_temperature;
+                
+                if (T[idx_temperature] < T_min || T[idx_temperature] > T_max)
+                {
+                    f[idx_function] = d_function(T[idx_temperature]);
+                }
+            }
+        }
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        /*
+         * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
+         */
+        
+        const int domain_lo_0 = domain_lo[0];
+        const int domain_lo_1 = domain_lo[1];
+        const int domain_dim_0 = domain_dims[0];
+        const int domain_dim_1 = domain_dims[1];
+        
+        const int num_ghosts_0_function = num_ghosts_function[0];
+        const int num_ghosts_1_function = num_ghosts_function[1];
+        const int ghostcell_dim_0_function = ghostcell_dims_function[0];
+        
+        const int num_ghosts_0_temperature = num_ghosts_temperature[0];
+        const int num_ghosts_1_temperature = num_ghosts_temperature[1];
+        const int ghostcell_dim_0_temperature = ghostcell_dims_temperature[0];
+        
+        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
+        {
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd reduction(+:num_cells_out_of_range)
+#endif
+            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+            {
+                // Compute the linear indices.
+                const int idx_function = (i + num_ghosts_0_function) +
+                    (j + num_ghosts_1_function)*ghostcell_dim_0_function;
+                
+                const int idx_temperature = (i + num_ghosts_0_temperature) +
+                    (j + num_ghosts_1_temperature)*ghostcell_dim_0_temperature;
+                
+                const double x = use_log_spacing ? log(T[idx_temperature]) : T[idx_temperature];
+                
+                f[idx_function] = interpolate(x);
+                
+                num_cells_out_of_range +=
+                    (T[idx_temperature] < T_min || T[idx_temperature] > T_max) ? 1 : 0;
+            }
+        }
+        
+        if (num_cells_out_of_range > 0)
+        {
+            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
+            {
+                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+                {
+                    // Compute the linear indices.
+                    const int idx_function = (i + num_ghosts_0_function) +
+                        (j + num_ghosts_1_function)*ghostcell_dim_0_function;
+                    
+                    const int idx_temperature = (i + num_ghosts_0_temperature) +
+                        (j + num_ghosts_1_temperature)*ghostcell_dim_0_temperature;
+                    
+                    if (T[idx_temperature] < T_min || T[idx_temperature] > T_max)
+                    {
+                        f[idx_function] = d_function(T[idx_temperature]);
+                    }
+                }
+            }
+        }
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        /*
+         * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
+         */
+        
+        const int domain_lo_0 = domain_lo[0];
+        const int domain_lo_1 = domain_lo[1];
+        const int domain_lo_2 = domain_lo[2];
+        const int domain_dim_0 = domain_dims[0];
+        const int domain_dim_1 = domain_dims[1];
+        const int domain_dim_2 = domain_dims[2];
+        
+        const int num_ghosts_0_function = num_ghosts_function[0];
+        const int num_ghosts_1_function = num_ghosts_function[1];
+        const int num_ghosts_2_function = num_ghosts_function[2];
+        const int ghostcell_dim_0_function = ghostcell_dims_function[0];
+        const int ghostcell_dim_1_function = ghostcell_dims_function[1];
+        
+        const int num_ghosts_0_temperature = num_ghosts_temperature[0];
+        const int num_ghosts_1_temperature = num_ghosts_temperature[1];
+        const int num_ghosts_2_temperature = num_ghosts_temperature[2];
+        const int ghostcell_dim_0_temperature = ghostcell_dims_temperature[0];
+        const int ghostcell_dim_1_temperature = ghostcell_dims_temperature[1];
+        
+        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
+        {
+            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
+            {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd reduction(+:num_cells_out_of_range)
+#endif
+                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+                {
+                    // Compute the linear indices.
+                    const int idx_function = (i + num_ghosts_0_function) +
+                        (j + num_ghosts_1_function)*ghostcell_dim_0_function +
+                        (k + num_ghosts_2_function)*ghostcell_dim_0_function*
+                            ghostcell_dim_1_function;
+                    
+                    const int idx_temperature = (i + num_ghosts_0_temperature) +
+                        (j + num_ghosts_1_temperature)*ghostcell_dim_0_temperature +
+                        (k + num_ghosts_2_temperature)*ghostcell_dim_0_temperature*
+                            ghostcell_dim_1_temperature;
+                    
+                    const double x = use_log_spacing ? log(T[idx_temperature]) : T[idx_temperature];
+                    
+                    f[idx_function] = interpolate(x);
+                    
+                    num_cells_out_of_range +=
+                        (T[idx_temperature] < T_min || T[idx_temperature] > T_max) ? 1 : 0;
+                }
+            }
+        }
+        
+        if (num_cells_out_of_range > 0)
+        {
+            for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
+            {
+                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
+                {
+                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_function = (i + num_ghosts_0_function) +
+                            (j + num_ghosts_1_function)*ghostcell_dim_0_function +
+                            (k + num_ghosts_2_function)*ghostcell_dim_0_function*
+                                ghostcell_dim_1_function;
+                        
+                        const int idx_temperature = (i + num_ghosts_0_temperature) +
+                            (j + num_ghosts_1_temperature)*ghostcell_dim_0_temperature +
+                            (k + num_ghosts_2_temperature)*ghostcell_dim_0_temperature*
+                                ghostcell_dim_1_temperature;
+                        
+                        if (T[idx_temperature] < T_min || T[idx_temperature] > T_max)
+                        {
+                            f[idx_function] = d_function(T[idx_temperature]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * Sample the function on the nodes of the table.
+ */
+void
+TemperatureTable::sampleFunction()
+{
+    const double dx = (d_x_max - d_x_min)/double(d_num_points - 1);
+    d_inv_dx = double(1)/dx;
+    
+    d_values.resize(d_num_points);
+    
+    for (int n = 0; n < d_num_points; n++)
+    {
+        double T_n = d_T_min;
+        
+        if (n == d_num_points - 1)
+        {
+            T_n = d_T_max;
+        }
+        else if (n > 0)
+        {
+            const double x_n = d_x_min + double(n)*dx;
+            T_n = d_use_log_spacing ? exp(x_n) : x_n;
+        }
+        
+        d_values[n] = d_function(T_n);
+    }
+}
+
+
+/*
+ * Compute the maximum relative error of the interpolation between the nodes.
+ */
+double
+TemperatureTable::computeMaximumRelativeError() const
+{
+    const double dx = double(1)/d_inv_dx;
+    
+    double max_relative_error = double(0);
+    
+    for (int n = 0; n < d_num_points - 1; n++)
+    {
+        for (int q = 1; q < 4; q++)
+        {
+            const double x = d_x_min + (double(n) + double(q)/double(4))*dx;
+            const double T_q = d_use_log_spacing ? exp(x) : x;
+            
+            const double f_exact = d_function(T_q);
+            const double f_table = interpolate(x);
+            
+            const double relative_error = fabs(f_table - f_exact)/
+                fmax(fabs(f_exact), HAMERS_EPSILON);
+            
+            max_relative_error = fmax(max_relative_error, relative_error);
+        }
+    }
+    
+    return max_relative_error;
+}
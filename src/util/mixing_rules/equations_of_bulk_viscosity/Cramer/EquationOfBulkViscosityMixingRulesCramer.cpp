@@ -11,6 +11,9 @@ EquationOfBulkViscosityMixingRulesCramer::EquationOfBulkViscosityMixingRulesCram
             dim,
             num_species,
             mixing_closure_model,
+            equation_of_bulk_viscosity_mixing_rules_db),
+        d_temperature_table_settings(
+            object_name,
             equation_of_bulk_viscosity_mixing_rules_db)
 {
     d_equation_of_bulk_viscosity.reset(new EquationOfBulkViscosityCramer(
@@ -376,6 +379,51 @@ EquationOfBulkViscosityMixingRulesCramer::EquationOfBulkViscosityMixingRulesCram
             << "not found in data for equation of bulk viscosity mixing rules."
             << std::endl);
     }
+    
+    /*
+     * Tabulate the bulk viscosity of each species in temperature if required.
+     */
+    
+    if (d_temperature_table_settings.d_use_temperature_tables)
+    {
+        const boost::shared_ptr<EquationOfBulkViscosity> equation_of_bulk_viscosity =
+            d_equation_of_bulk_viscosity;
+        
+        d_species_bulk_viscosity_tables.reserve(d_num_species);
+        
+        for (int si = 0; si < d_num_species; si++)
+        {
+            std::vector<double> species_molecular_properties(getNumberOfSpeciesMolecularProperties(si));
+            std::vector<double*> species_molecular_properties_ptr;
+            for (int mi = 0; mi < static_cast<int>(species_molecular_properties.size()); mi++)
+            {
+                species_molecular_properties_ptr.push_back(&species_molecular_properties[mi]);
+            }
+            
+            getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
+            
+            d_species_bulk_viscosity_tables.push_back(boost::make_shared<TemperatureTable>(
+                d_object_name + "::d_species_bulk_viscosity_tables",
+                d_dim,
+                d_temperature_table_settings,
+                [equation_of_bulk_viscosity, species_molecular_properties](const double T) -> double
+                {
+                    std::vector<const double*> molecular_properties_const_ptr;
+                    for (int mi = 0; mi < static_cast<int>(species_molecular_properties.size()); mi++)
+                    {
+                        molecular_properties_const_ptr.push_back(&species_molecular_properties[mi]);
+                    }
+                    
+                    // The Cramer bulk viscosity is independent of pressure.
+                    const double p = double(0);
+                    
+                    return equation_of_bulk_viscosity->getBulkViscosity(
+                        &p,
+                        &T,
+                        molecular_properties_const_ptr);
+                }));
+        }
+    }
 }
 
 
@@ -481,6 +529,12 @@ EquationOfBulkViscosityMixingRulesCramer::printClassData(
     }
     os << d_species_M[d_num_species - 1];
     os << std::endl;
+    
+    /*
+     * Print the settings of the temperature tables.
+     */
+    
+    d_temperature_table_settings.printClassData(os);
 }
 
 
@@ -503,6 +557,8 @@ EquationOfBulkViscosityMixingRulesCramer::putToRestart(
     restart_db->putDoubleVector("d_species_C_v", d_species_C_v);
     
     restart_db->putDoubleVector("d_species_M", d_species_M);
+    
+    d_temperature_table_settings.putToRestart(restart_db);
 }
 
 
@@ -554,11 +610,11 @@ EquationOfBulkViscosityMixingRulesCramer::getBulkViscosity(
         {
             getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
             
-            const double mu_v_i = d_equation_of_bulk_viscosity->
-                getBulkViscosity(
-                    pressure,
-                    temperature,
-                    species_molecular_properties_const_ptr);
+            const double mu_v_i = getBulkViscosityOfSpecies(
+                pressure,
+                temperature,
+                species_molecular_properties_const_ptr,
+                si);
             
             const double weight = *(mass_fractions[si])/(sqrt(species_molecular_properties[7]));
             
@@ -574,11 +630,11 @@ EquationOfBulkViscosityMixingRulesCramer::getBulkViscosity(
         {
             getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
             
-            const double mu_v_i = d_equation_of_bulk_viscosity->
-                getBulkViscosity(
-                    pressure,
-                    temperature,
-                    species_molecular_properties_const_ptr);
+            const double mu_v_i = getBulkViscosityOfSpecies(
+                pressure,
+                temperature,
+                species_molecular_properties_const_ptr,
+                si);
             
             const double weight = *(mass_fractions[si])/(sqrt(species_molecular_properties[7]));
             
@@ -595,11 +651,11 @@ EquationOfBulkViscosityMixingRulesCramer::getBulkViscosity(
         
         getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-        const double mu_v_last = d_equation_of_bulk_viscosity->
-            getBulkViscosity(
-                pressure,
-                temperature,
-                species_molecular_properties_const_ptr);
+        const double mu_v_last = getBulkViscosityOfSpecies(
+            pressure,
+            temperature,
+            species_molecular_properties_const_ptr,
+            d_num_species - 1);
         
         const double weight = Y_last/(sqrt(species_molecular_properties[7]));
         
@@ -798,13 +854,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[7]));
                 
@@ -864,13 +920,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[7]));
                 
@@ -950,13 +1006,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[7]));
                 
@@ -1060,13 +1116,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[7]));
                 
@@ -1091,13 +1147,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_bulk_viscosity->
-                computeBulkViscosity(
-                    data_bulk_viscosity_species,
-                    data_pressure,
-                    data_temperature,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeBulkViscosityOfSpecies(
+                data_bulk_viscosity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             const double factor = double(1)/(sqrt(species_molecular_properties[7]));
             
@@ -1147,13 +1203,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[7]));
                 
@@ -1184,13 +1240,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_bulk_viscosity->
-                computeBulkViscosity(
-                    data_bulk_viscosity_species,
-                    data_pressure,
-                    data_temperature,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeBulkViscosityOfSpecies(
+                data_bulk_viscosity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             const double factor = double(1)/(sqrt(species_molecular_properties[7]));
             
@@ -1256,13 +1312,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[7]));
                 
@@ -1300,13 +1356,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_bulk_viscosity->
-                computeBulkViscosity(
-                    data_bulk_viscosity_species,
-                    data_pressure,
-                    data_temperature,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeBulkViscosityOfSpecies(
+                data_bulk_viscosity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             const double factor = double(1)/(sqrt(species_molecular_properties[7]));
             
@@ -1405,11 +1461,11 @@ EquationOfBulkViscosityMixingRulesCramer::getBulkViscosity(
         {
             getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
             
-            const double mu_v_i = d_equation_of_bulk_viscosity->
-                getBulkViscosity(
-                    pressure,
-                    species_temperatures[si],
-                    species_molecular_properties_const_ptr);
+            const double mu_v_i = getBulkViscosityOfSpecies(
+                pressure,
+                species_temperatures[si],
+                species_molecular_properties_const_ptr,
+                si);
             
             mu_v += *(volume_fractions[si])*mu_v_i;
         }
@@ -1422,11 +1478,11 @@ EquationOfBulkViscosityMixingRulesCramer::getBulkViscosity(
         {
             getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
             
-            const double mu_v_i = d_equation_of_bulk_viscosity->
-                getBulkViscosity(
-                    pressure,
-                    species_temperatures[si],
-                    species_molecular_properties_const_ptr);
+            const double mu_v_i = getBulkViscosityOfSpecies(
+                pressure,
+                species_temperatures[si],
+                species_molecular_properties_const_ptr,
+                si);
             
             mu_v += *(volume_fractions[si])*mu_v_i;
             
@@ -1440,11 +1496,11 @@ EquationOfBulkViscosityMixingRulesCramer::getBulkViscosity(
         
         getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-        const double mu_v_last = d_equation_of_bulk_viscosity->
-            getBulkViscosity(
-                pressure,
-                species_temperatures[d_num_species - 1],
-                species_molecular_properties_const_ptr);
+        const double mu_v_last = getBulkViscosityOfSpecies(
+            pressure,
+            species_temperatures[d_num_species - 1],
+            species_molecular_properties_const_ptr,
+            d_num_species - 1);
         
         mu_v += Z_last*mu_v_last;
     }
@@ -1635,13 +1691,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
@@ -1686,13 +1742,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
                 {
@@ -1753,13 +1809,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
                 {
@@ -1839,13 +1895,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
@@ -1868,13 +1924,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_bulk_viscosity->
-                computeBulkViscosity(
-                    data_bulk_viscosity_species,
-                    data_pressure,
-                    data_temperature_species,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeBulkViscosityOfSpecies(
+                data_bulk_viscosity_species,
+                data_pressure,
+                data_temperature_species,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
 #ifdef HAMERS_ENABLE_SIMD
             #pragma omp simd
@@ -1918,13 +1974,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
                 {
@@ -1955,13 +2011,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_bulk_viscosity->
-                computeBulkViscosity(
-                    data_bulk_viscosity_species,
-                    data_pressure,
-                    data_temperature_species,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeBulkViscosityOfSpecies(
+                data_bulk_viscosity_species,
+                data_pressure,
+                data_temperature_species,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
             {
@@ -2021,13 +2077,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_bulk_viscosity->
-                    computeBulkViscosity(
-                        data_bulk_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeBulkViscosityOfSpecies(
+                    data_bulk_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
                 {
@@ -2067,13 +2123,13 @@ EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_bulk_viscosity->
-                computeBulkViscosity(
-                    data_bulk_viscosity_species,
-                    data_pressure,
-                    data_temperature_species,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeBulkViscosityOfSpecies(
+                data_bulk_viscosity_species,
+                data_pressure,
+                data_temperature_species,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
             {
@@ -2143,3 +2199,59 @@ EquationOfBulkViscosityMixingRulesCramer::getSpeciesMolecularProperties(
     
     *(species_molecular_properties[7]) = d_species_M[species_index];
 }
+
+
+/*
+ * Compute the bulk viscosity of a species from its table or from the equation of bulk viscosity.
+ */
+double
+EquationOfBulkViscosityMixingRulesCramer::getBulkViscosityOfSpecies(
+    const double* const pressure,
+    const double* const temperature,
+    const std::vector<const double*>& species_molecular_properties,
+    const int species_index) const
+{
+    if (d_temperature_table_settings.d_use_temperature_tables)
+    {
+        return d_species_bulk_viscosity_tables[species_index]->getValue(*temperature);
+    }
+    
+    return d_equation_of_bulk_viscosity->
+        getBulkViscosity(
+            pressure,
+            temperature,
+            species_molecular_properties);
+}
+
+
+/*
+ * Compute the bulk viscosity of a species from its table or from the equation of bulk viscosity.
+ */
+void
+EquationOfBulkViscosityMixingRulesCramer::computeBulkViscosityOfSpecies(
+    boost::shared_ptr<pdat::CellData<double> >& data_bulk_viscosity_species,
+    const boost::shared_ptr<pdat::CellData<double> >& data_pressure,
+    const boost::shared_ptr<pdat::CellData<double> >& data_temperature,
+    const std::vector<const double*>& species_molecular_properties,
+    const int species_index,
+    const hier::Box& domain) const
+{
+    if (d_temperature_table_settings.d_use_temperature_tables)
+    {
+        d_species_bulk_viscosity_tables[species_index]->
+            computeCellData(
+                data_bulk_viscosity_species,
+                data_temperature,
+                domain);
+    }
+    else
+    {
+        d_equation_of_bulk_viscosity->
+            computeBulkViscosity(
+                data_bulk_viscosity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties,
+                domain);
+    }
+}
@@ -15,6 +15,9 @@ EquationOfMassDiffusivityMixingRulesReid::EquationOfMassDiffusivityMixingRulesRe
             dim,
             num_species,
             mixing_closure_model,
+            equation_of_mass_diffusivity_mixing_rules_db),
+        d_temperature_table_settings(
+            object_name,
             equation_of_mass_diffusivity_mixing_rules_db)
 {
     /*
@@ -157,6 +160,68 @@ EquationOfMassDiffusivityMixingRulesReid::EquationOfMassDiffusivityMixingRulesRe
             << "not found in data for equation of mass diffusivity mixing rules."
             << std::endl);
     }
+    
+    /*
+     * Pack the constants of the binary mass diffusivity of each pair of species into a table. The
+     * constants of pair ij are 1/T_epsilon_ij, T_epsilon_ij^(-B) and 0.0266/(sqrt(M_ij)*sigma_ij^2),
+     * where B is the exponent of the power of the reduced temperature in the collision integral.
+     */
+    
+    const double B = double(-0.1561);
+    
+    d_species_pair_indices.resize(d_num_species*d_num_species, -1);
+    d_species_pair_constants.reserve(3*(d_num_species - 1)*d_num_species/2);
+    
+    for (int si = 0; si < d_num_species; si++)
+    {
+        for (int sj = si + 1; sj < d_num_species; sj++)
+        {
+            const int idx_ij = (d_num_species - 1)*d_num_species/2 -
+                (d_num_species - 1 - si)*(d_num_species - si)/2 +
+                (sj - (si + 1));
+            
+            d_species_pair_indices[si*d_num_species + sj] = idx_ij;
+            d_species_pair_indices[sj*d_num_species + si] = idx_ij;
+            
+            const double T_epsilon_ij = sqrt(d_species_epsilon_by_k[si]*d_species_epsilon_by_k[sj]);
+            const double sigma_ij = double(1)/double(2)*(d_species_sigma[si] + d_species_sigma[sj]);
+            const double M_ij = double(2)/(double(1)/d_species_M[si] + double(1)/d_species_M[sj]);
+            
+            d_species_pair_constants.push_back(double(1)/T_epsilon_ij);
+            d_species_pair_constants.push_back(pow(T_epsilon_ij, -B));
+            d_species_pair_constants.push_back(double(0.0266)/(sqrt(M_ij)*sigma_ij*sigma_ij));
+        }
+    }
+    
+    /*
+     * Tabulate the product of pressure and binary mass diffusivity of each pair of species in
+     * temperature if required.
+     */
+    
+    if (d_temperature_table_settings.d_use_temperature_tables && d_num_species > 1)
+    {
+        d_binary_mass_diffusivity_tables.reserve((d_num_species - 1)*d_num_species/2);
+        
+        for (int si = 0; si < d_num_species; si++)
+        {
+            for (int sj = si + 1; sj < d_num_species; sj++)
+            {
+                const int species_index_i = si;
+                const int species_index_j = sj;
+                
+                d_binary_mass_diffusivity_tables.push_back(boost::make_shared<TemperatureTable>(
+                    d_object_name + "::d_binary_mass_diffusivity_tables",
+                    d_dim,
+                    d_temperature_table_settings,
+                    [this, species_index_i, species_index_j](const double T) -> double
+                    {
+                        const double p = double(1);
+                        
+                        return getMassDiffusivity(&p, &T, species_index_i, species_index_j);
+                    }));
+            }
+        }
+    }
 }
 
 
@@ -218,6 +283,12 @@ EquationOfMassDiffusivityMixingRulesReid::printClassData(
     }
     os << d_species_M[d_num_species - 1];
     os << std::endl;
+    
+    /*
+     * Print the settings of the temperature tables.
+     */
+    
+    d_temperature_table_settings.printClassData(os);
 }
 
 
@@ -232,6 +303,8 @@ EquationOfMassDiffusivityMixingRulesReid::putToRestart(
     restart_db->putDoubleVector("d_species_epsilon_by_k", d_species_epsilon_by_k);
     restart_db->putDoubleVector("d_species_sigma", d_species_sigma);
     restart_db->putDoubleVector("d_species_M", d_species_M);
+    
+    d_temperature_table_settings.putToRestart(restart_db);
 }
 
 
@@ -257,32 +330,21 @@ EquationOfMassDiffusivityMixingRulesReid::getMassDiffusivities(
     if (d_num_species > 1)
     {
         /*
-         * Initialize the containers and pointers to the containers for the molecular properties
-         * of species i and j.
+         * Initialize the container and pointers to the container for the molecular properties
+         * of a species.
          */
         
         std::vector<double> species_molecular_properties_i;
-        std::vector<double> species_molecular_properties_j;
         std::vector<double*> species_molecular_properties_ptr_i;
-        std::vector<double*> species_molecular_properties_ptr_j;
-        std::vector<const double*> species_molecular_properties_const_ptr_i;
-        std::vector<const double*> species_molecular_properties_const_ptr_j;
         
         const int num_molecular_properties = getNumberOfSpeciesMolecularProperties();
         
         species_molecular_properties_i.resize(num_molecular_properties);
-        species_molecular_properties_j.resize(num_molecular_properties);
         species_molecular_properties_ptr_i.reserve(num_molecular_properties);
-        species_molecular_properties_ptr_j.reserve(num_molecular_properties);
-        species_molecular_properties_const_ptr_i.reserve(num_molecular_properties);
-        species_molecular_properties_const_ptr_j.reserve(num_molecular_properties);
         
         for (int mi = 0; mi < num_molecular_properties; mi++)
         {
             species_molecular_properties_ptr_i.push_back(&species_molecular_properties_i[mi]);
-            species_molecular_properties_ptr_j.push_back(&species_molecular_properties_j[mi]);
-            species_molecular_properties_const_ptr_i.push_back(&species_molecular_properties_i[mi]);
-            species_molecular_properties_const_ptr_j.push_back(&species_molecular_properties_j[mi]);
         }
         
         /*
@@ -293,21 +355,23 @@ EquationOfMassDiffusivityMixingRulesReid::getMassDiffusivities(
         
         for (int i = 0; i < d_num_species; i++)
         {
-            getSpeciesMolecularProperties(species_molecular_properties_ptr_i, i);
-            
             for (int j = i + 1; j < d_num_species; j++)
             {
-                const int idx_ij = (d_num_species - 1)*d_num_species/2 -
-                    (d_num_species - 1 - i)*(d_num_species - i)/2 +
-                    (j - (i + 1));
+                const int idx_ij = d_species_pair_indices[i*d_num_species + j];
                 
-                getSpeciesMolecularProperties(species_molecular_properties_ptr_j, j);
-                
-                D_ij[idx_ij] = getMassDiffusivity(
-                    pressure,
-                    temperature,
-                    species_molecular_properties_const_ptr_i,
-                    species_molecular_properties_const_ptr_j);
+                if (d_temperature_table_settings.d_use_temperature_tables)
+                {
+                    D_ij[idx_ij] = d_binary_mass_diffusivity_tables[idx_ij]->getValue(*temperature)/
+                        (*pressure);
+                }
+                else
+                {
+                    D_ij[idx_ij] = getMassDiffusivity(
+                        pressure,
+                        temperature,
+                        i,
+                        j);
+                }
             }
         }
         
@@ -377,19 +441,7 @@ EquationOfMassDiffusivityMixingRulesReid::getMassDiffusivities(
             {
                 if (si != sj)
                 {
-                    int idx = 0;
-                    if (sj > si)
-                    {
-                        idx = (d_num_species - 1)*d_num_species/2 -
-                            (d_num_species - 1 - si)*(d_num_species - si)/2 +
-                            (sj - (si + 1));
-                    }
-                    else
-                    {
-                        idx = (d_num_species - 1)*d_num_species/2 -
-                            (d_num_species - 1 - sj)*(d_num_species - sj)/2 +
-                            (si - (sj + 1));
-                    }
+                    const int idx = d_species_pair_indices[si*d_num_species + sj];
                     
                     D += (X[sj] + double(EPSILON))/(D_ij[idx] + double(EPSILON));
                 }
@@ -516,10 +568,11 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
     }
     
     /*
-     * Delcare data containers for binary mass diffusivities and mole fractions.
+     * Delcare data containers for inverses of binary mass diffusivities, mole fractions and the
+     * factors of the binary mass diffusivities that are independent of the pairs of species.
      */
     
-    boost::shared_ptr<pdat::CellData<double> > data_binary_mass_diffusivities(
+    boost::shared_ptr<pdat::CellData<double> > data_binary_mass_diffusivities_inv(
         new pdat::CellData<double>(interior_box, (d_num_species - 1)*d_num_species/2, num_ghosts_min));
     
     boost::shared_ptr<pdat::CellData<double> > data_mole_fractions(
@@ -528,6 +581,9 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
     boost::shared_ptr<pdat::CellData<double> > data_sum(
         new pdat::CellData<double>(interior_box, 1, num_ghosts_min));
     
+    boost::shared_ptr<pdat::CellData<double> > data_pair_independent_factors(
+        new pdat::CellData<double>(interior_box, 2, num_ghosts_min));
+    
     if (domain.empty())
     {
         data_sum->fillAll(double(0));
@@ -549,11 +605,11 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
     }
     double* p = data_pressure->getPointer(0);
     double* T = data_temperature->getPointer(0);
-    std::vector<double*> D_ij;
-    D_ij.reserve((d_num_species - 1)*d_num_species/2);
+    std::vector<double*> D_ij_inv;
+    D_ij_inv.reserve((d_num_species - 1)*d_num_species/2);
     for (int si = 0; si < (d_num_species - 1)*d_num_species/2; si++)
     {
-        D_ij.push_back(data_binary_mass_diffusivities->getPointer(si));
+        D_ij_inv.push_back(data_binary_mass_diffusivities_inv->getPointer(si));
     }
     std::vector<double*> X;
     X.reserve(d_num_species);
@@ -562,124 +618,128 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
         X.push_back(data_mole_fractions->getPointer(si));
     }
     double* sum = data_sum->getPointer(0);
+    double* T_pow_B = data_pair_independent_factors->getPointer(0);
+    double* p_by_T_pow_3_by_2 = data_pair_independent_factors->getPointer(1);
     
     /*
-     * Compute the binary mass diffusivities.
+     * Compute the inverses of the binary mass diffusivities.
      */
     
+    if (d_temperature_table_settings.d_use_temperature_tables)
     {
-        const double A = double(1.06036);
-        const double B = double(-0.1561);
-        const double C = double(0.19300);
-        const double D = double(-0.47635);
-        const double E = double(1.03587);
-        const double F = double(-1.52996);
-        const double G = double(1.76474);
-        const double H = double(-3.89411);
-        
         /*
-         * Initialize the containers and pointers to the containers for the molecular properties of
-         * species i and j.
+         * Interpolate the products of pressure and binary mass diffusivities from the tables and
+         * invert them.
          */
         
-        std::vector<double> species_molecular_properties_i;
-        std::vector<double> species_molecular_properties_j;
-        std::vector<double*> species_molecular_properties_ptr_i;
-        std::vector<double*> species_molecular_properties_ptr_j;
-        
-        const int num_molecular_properties = getNumberOfSpeciesMolecularProperties();
-        
-        species_molecular_properties_i.resize(num_molecular_properties);
-        species_molecular_properties_j.resize(num_molecular_properties);
-        species_molecular_properties_ptr_i.reserve(num_molecular_properties);
-        species_molecular_properties_ptr_j.reserve(num_molecular_properties);
-        
-        for (int mi = 0; mi < num_molecular_properties; mi++)
+        for (int idx_ij = 0; idx_ij < (d_num_species - 1)*d_num_species/2; idx_ij++)
         {
-            species_molecular_properties_ptr_i.push_back(&species_molecular_properties_i[mi]);
-            species_molecular_properties_ptr_j.push_back(&species_molecular_properties_j[mi]);
+            d_binary_mass_diffusivity_tables[idx_ij]->
+                computeCellData(
+                    data_binary_mass_diffusivities_inv,
+                    data_temperature,
+                    domain,
+                    idx_ij);
         }
-                
-        for (int si = 0; si < d_num_species; si++)
+        
+        if (d_dim == tbox::Dimension(1))
         {
-            getSpeciesMolecularProperties(species_molecular_properties_ptr_i, si);
+            /*
+             * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
+             */
             
-            const double& epsilon_by_k_i = species_molecular_properties_i[0];
-            const double& sigma_i = species_molecular_properties_i[1];
-            const double& M_i = species_molecular_properties_i[2];
+            const int domain_lo_0 = domain_lo[0];
+            const int domain_dim_0 = domain_dims[0];
             
-            for (int sj = si + 1; sj < d_num_species; sj++)
+            const int num_ghosts_0_min = num_ghosts_min[0];
+            const int num_ghosts_0_pressure = num_ghosts_pressure[0];
+            
+            for (int idx_ij = 0; idx_ij < (d_num_species - 1)*d_num_species/2; idx_ij++)
             {
-                getSpeciesMolecularProperties(species_molecular_properties_ptr_j, sj);
-                
-                const double& epsilon_by_k_j = species_molecular_properties_j[0];
-                const double& sigma_j = species_molecular_properties_j[1];
-                const double& M_j = species_molecular_properties_j[2];
-                
-                const double T_epsilon_ij = sqrt(epsilon_by_k_i*epsilon_by_k_j);
-                const double sigma_ij = double(1)/double(2)*(sigma_i + sigma_j);
-                const double sigma_ij_sq = sigma_ij*sigma_ij;
-                const double M_ij = double(2)/(double(1)/M_i + double(1)/M_j);
-                const double M_ij_sqrt = sqrt(M_ij);
-                
-                const int idx_ij = (d_num_species - 1)*d_num_species/2 -
-                    (d_num_species - 1 - si)*(d_num_species - si)/2 +
-                    (sj - (si + 1));
-                
-                if (d_dim == tbox::Dimension(1))
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
                 {
-                    /*
-                     * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_dim_0 = domain_dims[0];
-                    
-                    const int num_ghosts_0_min = num_ghosts_min[0];
-                    const int num_ghosts_0_pressure = num_ghosts_pressure[0];
-                    const int num_ghosts_0_temperature = num_ghosts_temperature[0];
+                    // Compute the linear indices.
+                    const int idx_min = i + num_ghosts_0_min;
+                    const int idx_pressure = i + num_ghosts_0_pressure;
                     
+                    D_ij_inv[idx_ij][idx_min] = p[idx_pressure]/
+                        (D_ij_inv[idx_ij][idx_min] + double(EPSILON)*p[idx_pressure]);
+                }
+            }
+        }
+        else if (d_dim == tbox::Dimension(2))
+        {
+            /*
+             * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
+             */
+            
+            const int domain_lo_0 = domain_lo[0];
+            const int domain_lo_1 = domain_lo[1];
+            const int domain_dim_0 = domain_dims[0];
+            const int domain_dim_1 = domain_dims[1];
+            
+            const int num_ghosts_0_min = num_ghosts_min[0];
+            const int num_ghosts_1_min = num_ghosts_min[1];
+            const int ghostcell_dim_0_min = ghostcell_dims_min[0];
+            
+            const int num_ghosts_0_pressure = num_ghosts_pressure[0];
+            const int num_ghosts_1_pressure = num_ghosts_pressure[1];
+            const int ghostcell_dim_0_pressure = ghostcell_dims_pressure[0];
+            
+            for (int idx_ij = 0; idx_ij < (d_num_species - 1)*d_num_species/2; idx_ij++)
+            {
+                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
+                {
 #ifdef HAMERS_ENABLE_SIMD
                     #pragma omp simd
 #endif
                     for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
                     {
                         // Compute the linear indices.
-                        const int idx_min = i + num_ghosts_0_min;
-                        const int idx_pressure = i + num_ghosts_0_pressure;
-                        const int idx_temperature = i + num_ghosts_0_temperature;
+                        const int idx_min = (i + num_ghosts_0_min) +
+                            (j + num_ghosts_1_min)*ghostcell_dim_0_min;
                         
-                        const double T_star_ij = T[idx_temperature]/T_epsilon_ij;
-                        const double Omega_D_ij = A*pow(T_star_ij, B) + C*exp(D*T_star_ij) + E*exp(F*T_star_ij) +
-                            G*exp(H*T_star_ij);
+                        const int idx_pressure = (i + num_ghosts_0_pressure) +
+                            (j + num_ghosts_1_pressure)*ghostcell_dim_0_pressure;
                         
-                        D_ij[idx_ij][idx_min] = double(0.0266)*pow(T[idx_temperature], double(3)/double(2))/
-                            (Omega_D_ij*p[idx_pressure]*M_ij_sqrt*sigma_ij_sq);
+                        D_ij_inv[idx_ij][idx_min] = p[idx_pressure]/
+                            (D_ij_inv[idx_ij][idx_min] + double(EPSILON)*p[idx_pressure]);
                     }
                 }
-                else if (d_dim == tbox::Dimension(2))
+            }
+        }
+        else if (d_dim == tbox::Dimension(3))
+        {
+            /*
+             * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
+             */
+            
+            const int domain_lo_0 = domain_lo[0];
+            const int domain_lo_1 = domain_lo[1];
+            const int domain_lo_2 = domain_lo[2];
+            const int domain_dim_0 = domain_dims[0];
+            const int domain_dim_1 = domain_dims[1];
+            const int domain_dim_2 = domain_dims[2];
+            
+            const int num_ghosts_0_min = num_ghosts_min[0];
+            const int num_ghosts_1_min = num_ghosts_min[1];
+            const int num_ghosts_2_min = num_ghosts_min[2];
+            const int ghostcell_dim_0_min = ghostcell_dims_min[0];
+            const int ghostcell_dim_1_min = ghostcell_dims_min[1];
+            
+            const int num_ghosts_0_pressure = num_ghosts_pressure[0];
+            const int num_ghosts_1_pressure = num_ghosts_pressure[1];
+            const int num_ghosts_2_pressure = num_ghosts_pressure[2];
+            const int ghostcell_dim_0_pressure = ghostcell_dims_pressure[0];
+            const int ghostcell_dim_1_pressure = ghostcell_dims_pressure[1];
+            
+            for (int idx_ij = 0; idx_ij < (d_num_species - 1)*d_num_species/2; idx_ij++)
+            {
+                for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
                 {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    
-                    const int num_ghosts_0_min = num_ghosts_min[0];
-                    const int num_ghosts_1_min = num_ghosts_min[1];
-                    const int ghostcell_dim_0_min = ghostcell_dims_min[0];
-                    
-                    const int num_ghosts_0_pressure = num_ghosts_pressure[0];
-                    const int num_ghosts_1_pressure = num_ghosts_pressure[1];
-                    const int ghostcell_dim_0_pressure = ghostcell_dims_pressure[0];
-                    
-                    const int num_ghosts_0_temperature = num_ghosts_temperature[0];
-                    const int num_ghosts_1_temperature = num_ghosts_temperature[1];
-                    const int ghostcell_dim_0_temperature = ghostcell_dims_temperature[0];
-                    
                     for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
                     {
 #ifdef HAMERS_ENABLE_SIMD
@@ -689,86 +749,271 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
                         {
                             // Compute the linear indices.
                             const int idx_min = (i + num_ghosts_0_min) +
-                                (j + num_ghosts_1_min)*ghostcell_dim_0_min;
+                                (j + num_ghosts_1_min)*ghostcell_dim_0_min +
+                                (k + num_ghosts_2_min)*ghostcell_dim_0_min*
+                                    ghostcell_dim_1_min;
                             
                             const int idx_pressure = (i + num_ghosts_0_pressure) +
-                                (j + num_ghosts_1_pressure)*ghostcell_dim_0_pressure;
-                            
-                            const int idx_temperature = (i + num_ghosts_0_temperature) +
-                                (j + num_ghosts_1_temperature)*ghostcell_dim_0_temperature;
-                            
-                            const double T_star_ij = T[idx_temperature]/T_epsilon_ij;
-                            const double Omega_D_ij = A*pow(T_star_ij, B) + C*exp(D*T_star_ij) + E*exp(F*T_star_ij) +
-                                G*exp(H*T_star_ij);
+                                (j + num_ghosts_1_pressure)*ghostcell_dim_0_pressure +
+                                (k + num_ghosts_2_pressure)*ghostcell_dim_0_pressure*
+                                    ghostcell_dim_1_pressure;
                             
-                            D_ij[idx_ij][idx_min] = double(0.0266)*pow(T[idx_temperature], double(3)/double(2))/
-                                (Omega_D_ij*p[idx_pressure]*M_ij_sqrt*sigma_ij_sq);
+                            D_ij_inv[idx_ij][idx_min] = p[idx_pressure]/
+                                (D_ij_inv[idx_ij][idx_min] + double(EPSILON)*p[idx_pressure]);
                         }
                     }
                 }
-                else if (d_dim == tbox::Dimension(3))
+            }
+        }
+    }
+    else
+    {
+        const double A = double(1.06036);
+        const double B = double(-0.1561);
+        const double C = double(0.19300);
+        const double D = double(-0.47635);
+        const double E = double(1.03587);
+        const double F = double(-1.52996);
+        const double G = double(1.76474);
+        const double H = double(-3.89411);
+        
+        /*
+         * The factors of the binary mass diffusivities that are independent of the pairs of species
+         * are computed once per cell. The power of temperature in the collision integral is split into
+         * the factor T^B of the cell and the constant T_epsilon_ij^(-B) of the pair of species, which is
+         * read from the packed table of the constants of the pairs of species together with 1/T_epsilon_ij and
+         * 0.0266/(sqrt(M_ij)*sigma_ij^2).
+         */
+        
+        if (d_dim == tbox::Dimension(1))
+        {
+            /*
+             * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
+             */
+            
+            const int domain_lo_0 = domain_lo[0];
+            const int domain_dim_0 = domain_dims[0];
+            
+            const int num_ghosts_0_min = num_ghosts_min[0];
+            const int num_ghosts_0_pressure = num_ghosts_pressure[0];
+            const int num_ghosts_0_temperature = num_ghosts_temperature[0];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+            {
+                // Compute the linear indices.
+                const int idx_min = i + num_ghosts_0_min;
+                const int idx_pressure = i + num_ghosts_0_pressure;
+                const int idx_temperature = i + num_ghosts_0_temperature;
+                
+                T_pow_B[idx_min] = pow(T[idx_temperature], B);
+                p_by_T_pow_3_by_2[idx_min] = p[idx_pressure]/(T[idx_temperature]*sqrt(T[idx_temperature]));
+            }
+            
+            for (int idx_ij = 0; idx_ij < (d_num_species - 1)*d_num_species/2; idx_ij++)
+            {
+                const double T_epsilon_inv_ij = d_species_pair_constants[3*idx_ij];
+                const double T_epsilon_pow_minus_B_ij = d_species_pair_constants[3*idx_ij + 1];
+                const double factor_ij = d_species_pair_constants[3*idx_ij + 2];
+                
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
                 {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
+                    // Compute the linear indices.
+                    const int idx_min = i + num_ghosts_0_min;
+                    const int idx_temperature = i + num_ghosts_0_temperature;
                     
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_lo_2 = domain_lo[2];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    const int domain_dim_2 = domain_dims[2];
+                    const double T_star_ij = T[idx_temperature]*T_epsilon_inv_ij;
+                    const double Omega_D_ij = A*T_pow_B[idx_min]*T_epsilon_pow_minus_B_ij + C*exp(D*T_star_ij) +
+                        E*exp(F*T_star_ij) + G*exp(H*T_star_ij);
                     
-                    const int num_ghosts_0_min = num_ghosts_min[0];
-                    const int num_ghosts_1_min = num_ghosts_min[1];
-                    const int num_ghosts_2_min = num_ghosts_min[2];
-                    const int ghostcell_dim_0_min = ghostcell_dims_min[0];
-                    const int ghostcell_dim_1_min = ghostcell_dims_min[1];
+                    const double Omega_D_p_by_T_pow_3_by_2 = Omega_D_ij*p_by_T_pow_3_by_2[idx_min];
                     
-                    const int num_ghosts_0_pressure = num_ghosts_pressure[0];
-                    const int num_ghosts_1_pressure = num_ghosts_pressure[1];
-                    const int num_ghosts_2_pressure = num_ghosts_pressure[2];
-                    const int ghostcell_dim_0_pressure = ghostcell_dims_pressure[0];
-                    const int ghostcell_dim_1_pressure = ghostcell_dims_pressure[1];
+                    // Equivalent to 1/(D_ij + EPSILON) with one division.
+                    D_ij_inv[idx_ij][idx_min] = Omega_D_p_by_T_pow_3_by_2/
+                        (factor_ij + double(EPSILON)*Omega_D_p_by_T_pow_3_by_2);
+                }
+            }
+        }
+        else if (d_dim == tbox::Dimension(2))
+        {
+            /*
+             * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
+             */
+            
+            const int domain_lo_0 = domain_lo[0];
+            const int domain_lo_1 = domain_lo[1];
+            const int domain_dim_0 = domain_dims[0];
+            const int domain_dim_1 = domain_dims[1];
+            
+            const int num_ghosts_0_min = num_ghosts_min[0];
+            const int num_ghosts_1_min = num_ghosts_min[1];
+            const int ghostcell_dim_0_min = ghostcell_dims_min[0];
+            
+            const int num_ghosts_0_pressure = num_ghosts_pressure[0];
+            const int num_ghosts_1_pressure = num_ghosts_pressure[1];
+            const int ghostcell_dim_0_pressure = ghostcell_dims_pressure[0];
+            
+            const int num_ghosts_0_temperature = num_ghosts_temperature[0];
+            const int num_ghosts_1_temperature = num_ghosts_temperature[1];
+            const int ghostcell_dim_0_temperature = ghostcell_dims_temperature[0];
+            
+            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
+            {
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+                {
+                    // Compute the linear indices.
+                    const int idx_min = (i + num_ghosts_0_min) +
+                        (j + num_ghosts_1_min)*ghostcell_dim_0_min;
+                    
+                    const int idx_pressure = (i + num_ghosts_0_pressure) +
+                        (j + num_ghosts_1_pressure)*ghostcell_dim_0_pressure;
                     
-                    const int num_ghosts_0_temperature = num_ghosts_temperature[0];
-                    const int num_ghosts_1_temperature = num_ghosts_temperature[1];
-                    const int num_ghosts_2_temperature = num_ghosts_temperature[2];
-                    const int ghostcell_dim_0_temperature = ghostcell_dims_temperature[0];
-                    const int ghostcell_dim_1_temperature = ghostcell_dims_temperature[1];
+                    const int idx_temperature = (i + num_ghosts_0_temperature) +
+                        (j + num_ghosts_1_temperature)*ghostcell_dim_0_temperature;
                     
-                    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
+                    T_pow_B[idx_min] = pow(T[idx_temperature], B);
+                    p_by_T_pow_3_by_2[idx_min] = p[idx_pressure]/(T[idx_temperature]*sqrt(T[idx_temperature]));
+                }
+            }
+            
+            for (int idx_ij = 0; idx_ij < (d_num_species - 1)*d_num_species/2; idx_ij++)
+            {
+                const double T_epsilon_inv_ij = d_species_pair_constants[3*idx_ij];
+                const double T_epsilon_pow_minus_B_ij = d_species_pair_constants[3*idx_ij + 1];
+                const double factor_ij = d_species_pair_constants[3*idx_ij + 2];
+                
+                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_min = (i + num_ghosts_0_min) +
+                            (j + num_ghosts_1_min)*ghostcell_dim_0_min;
+                        
+                        const int idx_temperature = (i + num_ghosts_0_temperature) +
+                            (j + num_ghosts_1_temperature)*ghostcell_dim_0_temperature;
+                        
+                        const double T_star_ij = T[idx_temperature]*T_epsilon_inv_ij;
+                        const double Omega_D_ij = A*T_pow_B[idx_min]*T_epsilon_pow_minus_B_ij + C*exp(D*T_star_ij) +
+                            E*exp(F*T_star_ij) + G*exp(H*T_star_ij);
+                        
+                        const double Omega_D_p_by_T_pow_3_by_2 = Omega_D_ij*p_by_T_pow_3_by_2[idx_min];
+                        
+                        // Equivalent to 1/(D_ij + EPSILON) with one division.
+                        D_ij_inv[idx_ij][idx_min] = Omega_D_p_by_T_pow_3_by_2/
+                            (factor_ij + double(EPSILON)*Omega_D_p_by_T_pow_3_by_2);
+                    }
+                }
+            }
+        }
+        else if (d_dim == tbox::Dimension(3))
+        {
+            /*
+             * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
+             */
+            
+            const int domain_lo_0 = domain_lo[0];
+            const int domain_lo_1 = domain_lo[1];
+            const int domain_lo_2 = domain_lo[2];
+            const int domain_dim_0 = domain_dims[0];
+            const int domain_dim_1 = domain_dims[1];
+            const int domain_dim_2 = domain_dims[2];
+            
+            const int num_ghosts_0_min = num_ghosts_min[0];
+            const int num_ghosts_1_min = num_ghosts_min[1];
+            const int num_ghosts_2_min = num_ghosts_min[2];
+            const int ghostcell_dim_0_min = ghostcell_dims_min[0];
+            const int ghostcell_dim_1_min = ghostcell_dims_min[1];
+            
+            const int num_ghosts_0_pressure = num_ghosts_pressure[0];
+            const int num_ghosts_1_pressure = num_ghosts_pressure[1];
+            const int num_ghosts_2_pressure = num_ghosts_pressure[2];
+            const int ghostcell_dim_0_pressure = ghostcell_dims_pressure[0];
+            const int ghostcell_dim_1_pressure = ghostcell_dims_pressure[1];
+            
+            const int num_ghosts_0_temperature = num_ghosts_temperature[0];
+            const int num_ghosts_1_temperature = num_ghosts_temperature[1];
+            const int num_ghosts_2_temperature = num_ghosts_temperature[2];
+            const int ghostcell_dim_0_temperature = ghostcell_dims_temperature[0];
+            const int ghostcell_dim_1_temperature = ghostcell_dims_temperature[1];
+            
+            for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
+            {
+                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
+                {
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+                    {
+                        // Compute the linear indices.
+                        const int idx_min = (i + num_ghosts_0_min) +
+                            (j + num_ghosts_1_min)*ghostcell_dim_0_min +
+                            (k + num_ghosts_2_min)*ghostcell_dim_0_min*
+                                ghostcell_dim_1_min;
+                        
+                        const int idx_pressure = (i + num_ghosts_0_pressure) +
+                            (j + num_ghosts_1_pressure)*ghostcell_dim_0_pressure +
+                            (k + num_ghosts_2_pressure)*ghostcell_dim_0_pressure*
+                                ghostcell_dim_1_pressure;
+                        
+                        const int idx_temperature = (i + num_ghosts_0_temperature) +
+                            (j + num_ghosts_1_temperature)*ghostcell_dim_0_temperature +
+                            (k + num_ghosts_2_temperature)*ghostcell_dim_0_temperature*
+                                ghostcell_dim_1_temperature;
+                        
+                        T_pow_B[idx_min] = pow(T[idx_temperature], B);
+                        p_by_T_pow_3_by_2[idx_min] = p[idx_pressure]/(T[idx_temperature]*sqrt(T[idx_temperature]));
+                    }
+                }
+            }
+            
+            for (int idx_ij = 0; idx_ij < (d_num_species - 1)*d_num_species/2; idx_ij++)
+            {
+                const double T_epsilon_inv_ij = d_species_pair_constants[3*idx_ij];
+                const double T_epsilon_pow_minus_B_ij = d_species_pair_constants[3*idx_ij + 1];
+                const double factor_ij = d_species_pair_constants[3*idx_ij + 2];
+                
+                for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
+                {
+                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
                     {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
 #ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
+                        #pragma omp simd
 #endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx_min = (i + num_ghosts_0_min) +
-                                    (j + num_ghosts_1_min)*ghostcell_dim_0_min +
-                                    (k + num_ghosts_2_min)*ghostcell_dim_0_min*
-                                        ghostcell_dim_1_min;
-                                
-                                const int idx_pressure = (i + num_ghosts_0_pressure) +
-                                    (j + num_ghosts_1_pressure)*ghostcell_dim_0_pressure +
-                                    (k + num_ghosts_2_pressure)*ghostcell_dim_0_pressure*
-                                        ghostcell_dim_1_pressure;
-                                
-                                const int idx_temperature = (i + num_ghosts_0_temperature) +
-                                    (j + num_ghosts_1_temperature)*ghostcell_dim_0_temperature +
-                                    (k + num_ghosts_2_temperature)*ghostcell_dim_0_temperature*
-                                        ghostcell_dim_1_temperature;
-                                
-                                const double T_star_ij = T[idx_temperature]/T_epsilon_ij;
-                                const double Omega_D_ij = A*pow(T_star_ij, B) + C*exp(D*T_star_ij) +
-                                    E*exp(F*T_star_ij) + G*exp(H*T_star_ij);
-                                
-                                D_ij[idx_ij][idx_min] = double(0.0266)*pow(T[idx_temperature], double(3)/double(2))/
-                                    (Omega_D_ij*p[idx_pressure]*M_ij_sqrt*sigma_ij_sq);
-                            }
+                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
+                        {
+                            // Compute the linear indices.
+                            const int idx_min = (i + num_ghosts_0_min) +
+                                (j + num_ghosts_1_min)*ghostcell_dim_0_min +
+                                (k + num_ghosts_2_min)*ghostcell_dim_0_min*
+                                    ghostcell_dim_1_min;
+                            
+                            const int idx_temperature = (i + num_ghosts_0_temperature) +
+                                (j + num_ghosts_1_temperature)*ghostcell_dim_0_temperature +
+                                (k + num_ghosts_2_temperature)*ghostcell_dim_0_temperature*
+                                    ghostcell_dim_1_temperature;
+                            
+                            const double T_star_ij = T[idx_temperature]*T_epsilon_inv_ij;
+                            const double Omega_D_ij = A*T_pow_B[idx_min]*T_epsilon_pow_minus_B_ij + C*exp(D*T_star_ij) +
+                                E*exp(F*T_star_ij) + G*exp(H*T_star_ij);
+                            
+                            const double Omega_D_p_by_T_pow_3_by_2 = Omega_D_ij*p_by_T_pow_3_by_2[idx_min];
+                            
+                            // Equivalent to 1/(D_ij + EPSILON) with one division.
+                            D_ij_inv[idx_ij][idx_min] = Omega_D_p_by_T_pow_3_by_2/
+                                (factor_ij + double(EPSILON)*Omega_D_p_by_T_pow_3_by_2);
                         }
                     }
                 }
@@ -1307,17 +1552,12 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
     }
     
     /*
-     * Compute the effective binary diffusivity for each species.
+     * Compute the effective binary diffusivity for each species. The sum over the other species is
+     * accumulated in the cell loop so that the mass diffusivity of each species is only written once.
      */
     
-    if (domain.empty())
-    {
-        data_mass_diffusivities->fillAll(double(0));
-    }
-    else
-    {
-        data_mass_diffusivities->fillAll(double(0), domain);
-    }
+    std::vector<const double*> X_other(d_num_species - 1);
+    std::vector<const double*> D_ij_inv_other(d_num_species - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -1333,39 +1573,21 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
         
         for (int si = 0; si < d_num_species; si++)
         {
-            for (int sj = 0; sj < d_num_species; sj++)
+            /*
+             * Gather the pointers to the mole fractions of the other species and the inverses of the
+             * binary mass diffusivities of the pairs with the other species.
+             */
+            
+            for (int sj = 0; sj < d_num_species - 1; sj++)
             {
-                if (si != sj)
-                {
-                    int idx_ij = 0;
-                    if (sj > si)
-                    {
-                        idx_ij = (d_num_species - 1)*d_num_species/2 -
-                            (d_num_species - 1 - si)*(d_num_species - si)/2 +
-                            (sj - (si + 1));
-                    }
-                    else
-                    {
-                        idx_ij = (d_num_species - 1)*d_num_species/2 -
-                            (d_num_species - 1 - sj)*(d_num_species - sj)/2 +
-                            (si - (sj + 1));
-                    }
-                    
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_mass_diffusivities = i + num_ghosts_0_mass_diffusivities;
-                        const int idx_min = i + num_ghosts_0_min;
-                        
-                        D[si][idx_mass_diffusivities] += (X[sj][idx_min] + double(EPSILON))/
-                            (D_ij[idx_ij][idx_min] + double(EPSILON));
-                    }
-                }
+                const int sk = sj < si ? sj : sj + 1;
+                X_other[sj] = X[sk];
+                D_ij_inv_other[sj] = D_ij_inv[d_species_pair_indices[si*d_num_species + sk]];
             }
             
+            const double* const* X_sj = X_other.data();
+            const double* const* D_ij_inv_sj = D_ij_inv_other.data();
+            
 #ifdef HAMERS_ENABLE_SIMD
             #pragma omp simd
 #endif
@@ -1375,8 +1597,13 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
                 const int idx_mass_diffusivities = i + num_ghosts_0_mass_diffusivities;
                 const int idx_min = i + num_ghosts_0_min;
                 
-                D[si][idx_mass_diffusivities] = (double(1) - X[si][idx_min] + double(EPSILON))/
-                    D[si][idx_mass_diffusivities];
+                double X_by_D_sum = double(0);
+                for (int sj = 0; sj < d_num_species - 1; sj++)
+                {
+                    X_by_D_sum += (X_sj[sj][idx_min] + double(EPSILON))*D_ij_inv_sj[sj][idx_min];
+                }
+                
+                D[si][idx_mass_diffusivities] = (double(1) - X[si][idx_min] + double(EPSILON))/X_by_D_sum;
             }
         }
     }
@@ -1401,45 +1628,21 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
         
         for (int si = 0; si < d_num_species; si++)
         {
-            for (int sj = 0; sj < d_num_species; sj++)
+            /*
+             * Gather the pointers to the mole fractions of the other species and the inverses of the
+             * binary mass diffusivities of the pairs with the other species.
+             */
+            
+            for (int sj = 0; sj < d_num_species - 1; sj++)
             {
-                if (si != sj)
-                {
-                    int idx_ij = 0;
-                    if (sj > si)
-                    {
-                        idx_ij = (d_num_species - 1)*d_num_species/2 -
-                            (d_num_species - 1 - si)*(d_num_species - si)/2 +
-                            (sj - (si + 1));
-                    }
-                    else
-                    {
-                        idx_ij = (d_num_species - 1)*d_num_species/2 -
-                            (d_num_species - 1 - sj)*(d_num_species - sj)/2 +
-                            (si - (sj + 1));
-                    }
-                    
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx_mass_diffusivities = (i + num_ghosts_0_mass_diffusivities) +
-                                (j + num_ghosts_1_mass_diffusivities)*ghostcell_dim_0_mass_diffusivities;
-                            
-                            const int idx_min = (i + num_ghosts_0_min) +
-                                (j + num_ghosts_1_min)*ghostcell_dim_0_min;
-                            
-                            D[si][idx_mass_diffusivities] += (X[sj][idx_min] + double(EPSILON))/
-                                (D_ij[idx_ij][idx_min] + double(EPSILON));
-                        }
-                    }
-                }
+                const int sk = sj < si ? sj : sj + 1;
+                X_other[sj] = X[sk];
+                D_ij_inv_other[sj] = D_ij_inv[d_species_pair_indices[si*d_num_species + sk]];
             }
             
+            const double* const* X_sj = X_other.data();
+            const double* const* D_ij_inv_sj = D_ij_inv_other.data();
+            
             for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
             {
 #ifdef HAMERS_ENABLE_SIMD
@@ -1454,8 +1657,13 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
                     const int idx_min = (i + num_ghosts_0_min) +
                         (j + num_ghosts_1_min)*ghostcell_dim_0_min;
                     
-                    D[si][idx_mass_diffusivities] = (double(1) - X[si][idx_min] + double(EPSILON))/
-                        D[si][idx_mass_diffusivities];
+                    double X_by_D_sum = double(0);
+                    for (int sj = 0; sj < d_num_species - 1; sj++)
+                    {
+                        X_by_D_sum += (X_sj[sj][idx_min] + double(EPSILON))*D_ij_inv_sj[sj][idx_min];
+                    }
+                    
+                    D[si][idx_mass_diffusivities] = (double(1) - X[si][idx_min] + double(EPSILON))/X_by_D_sum;
                 }
             }
         }
@@ -1487,52 +1695,21 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
         
         for (int si = 0; si < d_num_species; si++)
         {
-            for (int sj = 0; sj < d_num_species; sj++)
+            /*
+             * Gather the pointers to the mole fractions of the other species and the inverses of the
+             * binary mass diffusivities of the pairs with the other species.
+             */
+            
+            for (int sj = 0; sj < d_num_species - 1; sj++)
             {
-                if (si != sj)
-                {
-                    int idx_ij = 0;
-                    if (sj > si)
-                    {
-                        idx_ij = (d_num_species - 1)*d_num_species/2 -
-                            (d_num_species - 1 - si)*(d_num_species - si)/2 +
-                            (sj - (si + 1));
-                    }
-                    else
-                    {
-                        idx_ij = (d_num_species - 1)*d_num_species/2 -
-                            (d_num_species - 1 - sj)*(d_num_species - sj)/2 +
-                            (si - (sj + 1));
-                    }
-                    
-                    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx_mass_diffusivities = (i + num_ghosts_0_mass_diffusivities) +
-                                    (j + num_ghosts_1_mass_diffusivities)*ghostcell_dim_0_mass_diffusivities +
-                                    (k + num_ghosts_2_mass_diffusivities)*ghostcell_dim_0_mass_diffusivities*
-                                        ghostcell_dim_1_mass_diffusivities;
-                                
-                                const int idx_min = (i + num_ghosts_0_min) +
-                                    (j + num_ghosts_1_min)*ghostcell_dim_0_min +
-                                    (k + num_ghosts_2_min)*ghostcell_dim_0_min*
-                                        ghostcell_dim_1_min;
-                                
-                                D[si][idx_mass_diffusivities] += (X[sj][idx_min] + double(EPSILON))/
-                                    (D_ij[idx_ij][idx_min] + double(EPSILON));
-                            }
-                        }
-                    }
-                }
+                const int sk = sj < si ? sj : sj + 1;
+                X_other[sj] = X[sk];
+                D_ij_inv_other[sj] = D_ij_inv[d_species_pair_indices[si*d_num_species + sk]];
             }
             
+            const double* const* X_sj = X_other.data();
+            const double* const* D_ij_inv_sj = D_ij_inv_other.data();
+            
             for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
             {
                 for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
@@ -1553,8 +1730,13 @@ EquationOfMassDiffusivityMixingRulesReid::computeMassDiffusivities(
                             (k + num_ghosts_2_min)*ghostcell_dim_0_min*
                                 ghostcell_dim_1_min;
                         
-                        D[si][idx_mass_diffusivities] = (double(1) - X[si][idx_min] + double(EPSILON))/
-                            D[si][idx_mass_diffusivities];
+                        double X_by_D_sum = double(0);
+                        for (int sj = 0; sj < d_num_species - 1; sj++)
+                        {
+                            X_by_D_sum += (X_sj[sj][idx_min] + double(EPSILON))*D_ij_inv_sj[sj][idx_min];
+                        }
+                        
+                        D[si][idx_mass_diffusivities] = (double(1) - X[si][idx_min] + double(EPSILON))/X_by_D_sum;
                     }
                 }
             }
@@ -1584,18 +1766,19 @@ EquationOfMassDiffusivityMixingRulesReid::getSpeciesMolecularProperties(
 
 
 /*
- * Compute the mass diffusivity of a binary mixture.
+ * Compute the mass diffusivity of a binary mixture of two species.
  */
 double
 EquationOfMassDiffusivityMixingRulesReid::getMassDiffusivity(
     const double* const pressure,
     const double* const temperature,
-    const std::vector<const double*>& molecular_properties_1,
-    const std::vector<const double*>& molecular_properties_2) const
+    const int species_index_1,
+    const int species_index_2) const
 {
 #ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
-    TBOX_ASSERT(static_cast<int>(molecular_properties_1.size()) >= 3);
-    TBOX_ASSERT(static_cast<int>(molecular_properties_2.size()) >= 3);
+    TBOX_ASSERT(species_index_1 >= 0 && species_index_1 < d_num_species);
+    TBOX_ASSERT(species_index_2 >= 0 && species_index_2 < d_num_species);
+    TBOX_ASSERT(species_index_1 != species_index_2);
 #endif
     
     const double A = double(1.06036);
@@ -1607,25 +1790,20 @@ EquationOfMassDiffusivityMixingRulesReid::getMassDiffusivity(
     const double G = double(1.76474);
     const double H = double(-3.89411);
     
-    const double& epsilon_by_k_1 = *(molecular_properties_1[0]);
-    const double& sigma_1 = *(molecular_properties_1[1]);
-    const double& M_1 = *(molecular_properties_1[2]);
-    
-    const double& epsilon_by_k_2 = *(molecular_properties_2[0]);
-    const double& sigma_2 = *(molecular_properties_2[1]);
-    const double& M_2 = *(molecular_properties_2[2]);
+    const int idx_12 = d_species_pair_indices[species_index_1*d_num_species + species_index_2];
     
-    const double T_epsilon_12 = sqrt(epsilon_by_k_1*epsilon_by_k_2);
-    const double sigma_12 = double(1)/double(2)*(sigma_1 + sigma_2);
-    const double M_12 = double(2)/(double(1)/M_1 + double(1)/M_2);
+    const double T_epsilon_inv_12 = d_species_pair_constants[3*idx_12];
+    const double T_epsilon_pow_minus_B_12 = d_species_pair_constants[3*idx_12 + 1];
+    const double factor_12 = d_species_pair_constants[3*idx_12 + 2];
     
     const double& p = *pressure;
     const double& T = *temperature;
     
-    const double T_star_12 = T/T_epsilon_12;
-    const double Omega_D_12 = A*pow(T_star_12, B) + C*exp(D*T_star_12) + E*exp(F*T_star_12) + G*exp(H*T_star_12);
+    const double T_star_12 = T*T_epsilon_inv_12;
+    const double Omega_D_12 = A*pow(T, B)*T_epsilon_pow_minus_B_12 + C*exp(D*T_star_12) + E*exp(F*T_star_12) +
+        G*exp(H*T_star_12);
     
-    double D_12 = double(0.0266)*pow(T, double(3)/double(2))/(Omega_D_12*p*sqrt(M_12)*sigma_12*sigma_12);
+    double D_12 = factor_12*T*sqrt(T)/(Omega_D_12*p);
     
     return D_12;
 }
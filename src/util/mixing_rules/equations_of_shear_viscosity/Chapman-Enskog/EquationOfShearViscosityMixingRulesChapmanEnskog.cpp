@@ -11,6 +11,9 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::EquationOfShearViscosityMixing
             dim,
             num_species,
             mixing_closure_model,
+            equation_of_shear_viscosity_mixing_rules_db),
+        d_temperature_table_settings(
+            object_name,
             equation_of_shear_viscosity_mixing_rules_db)
 {
     d_equation_of_shear_viscosity.reset(new EquationOfShearViscosityChapmanEnskog(
@@ -157,6 +160,51 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::EquationOfShearViscosityMixing
             << "not found in data for equation of shear viscosity mixing rules."
             << std::endl);
     }
+    
+    /*
+     * Tabulate the shear viscosity of each species in temperature if required.
+     */
+    
+    if (d_temperature_table_settings.d_use_temperature_tables)
+    {
+        const boost::shared_ptr<EquationOfShearViscosity> equation_of_shear_viscosity =
+            d_equation_of_shear_viscosity;
+        
+        d_species_shear_viscosity_tables.reserve(d_num_species);
+        
+        for (int si = 0; si < d_num_species; si++)
+        {
+            std::vector<double> species_molecular_properties(getNumberOfSpeciesMolecularProperties(si));
+            std::vector<double*> species_molecular_properties_ptr;
+            for (int mi = 0; mi < static_cast<int>(species_molecular_properties.size()); mi++)
+            {
+                species_molecular_properties_ptr.push_back(&species_molecular_properties[mi]);
+            }
+            
+            getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
+            
+            d_species_shear_viscosity_tables.push_back(boost::make_shared<TemperatureTable>(
+                d_object_name + "::d_species_shear_viscosity_tables",
+                d_dim,
+                d_temperature_table_settings,
+                [equation_of_shear_viscosity, species_molecular_properties](const double T) -> double
+                {
+                    std::vector<const double*> molecular_properties_const_ptr;
+                    for (int mi = 0; mi < static_cast<int>(species_molecular_properties.size()); mi++)
+                    {
+                        molecular_properties_const_ptr.push_back(&species_molecular_properties[mi]);
+                    }
+                    
+                    // The Chapman-Enskog shear viscosity is independent of pressure.
+                    const double p = double(0);
+                    
+                    return equation_of_shear_viscosity->getShearViscosity(
+                        &p,
+                        &T,
+                        molecular_properties_const_ptr);
+                }));
+        }
+    }
 }
 
 
@@ -218,6 +266,12 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::printClassData(
     }
     os << d_species_M[d_num_species - 1];
     os << std::endl;
+    
+    /*
+     * Print the settings of the temperature tables.
+     */
+    
+    d_temperature_table_settings.printClassData(os);
 }
 
 
@@ -232,6 +286,8 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::putToRestart(
     restart_db->putDoubleVector("d_species_epsilon_by_k", d_species_epsilon_by_k);
     restart_db->putDoubleVector("d_species_sigma", d_species_sigma);
     restart_db->putDoubleVector("d_species_M", d_species_M);
+    
+    d_temperature_table_settings.putToRestart(restart_db);
 }
 
 
@@ -283,11 +339,11 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::getShearViscosity(
         {
             getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
             
-            const double mu_i = d_equation_of_shear_viscosity->
-                getShearViscosity(
-                    pressure,
-                    temperature,
-                    species_molecular_properties_const_ptr);
+            const double mu_i = getShearViscosityOfSpecies(
+                pressure,
+                temperature,
+                species_molecular_properties_const_ptr,
+                si);
             
             const double weight = *(mass_fractions[si])/(sqrt(species_molecular_properties[2]));
             
@@ -303,11 +359,11 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::getShearViscosity(
         {
             getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
             
-            const double mu_i = d_equation_of_shear_viscosity->
-                getShearViscosity(
-                    pressure,
-                    temperature,
-                    species_molecular_properties_const_ptr);
+            const double mu_i = getShearViscosityOfSpecies(
+                pressure,
+                temperature,
+                species_molecular_properties_const_ptr,
+                si);
             
             const double weight = *(mass_fractions[si])/(sqrt(species_molecular_properties[2]));
             
@@ -324,11 +380,11 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::getShearViscosity(
         
         getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-        const double mu_last = d_equation_of_shear_viscosity->
-            getShearViscosity(
-                pressure,
-                temperature,
-                species_molecular_properties_const_ptr);
+        const double mu_last = getShearViscosityOfSpecies(
+            pressure,
+            temperature,
+            species_molecular_properties_const_ptr,
+            d_num_species - 1);
         
         const double weight = Y_last/(sqrt(species_molecular_properties[2]));
         
@@ -527,13 +583,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -593,13 +649,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -679,13 +735,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -789,13 +845,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -820,13 +876,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_shear_viscosity->
-                computeShearViscosity(
-                    data_shear_viscosity_species,
-                    data_pressure,
-                    data_temperature,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeShearViscosityOfSpecies(
+                data_shear_viscosity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             const double factor = double(1)/(sqrt(species_molecular_properties[2]));
             
@@ -876,13 +932,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -913,13 +969,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_shear_viscosity->
-                computeShearViscosity(
-                    data_shear_viscosity_species,
-                    data_pressure,
-                    data_temperature,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeShearViscosityOfSpecies(
+                data_shear_viscosity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             const double factor = double(1)/(sqrt(species_molecular_properties[2]));
             
@@ -985,13 +1041,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -1029,13 +1085,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_shear_viscosity->
-                computeShearViscosity(
-                    data_shear_viscosity_species,
-                    data_pressure,
-                    data_temperature,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeShearViscosityOfSpecies(
+                data_shear_viscosity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             const double factor = double(1)/(sqrt(species_molecular_properties[2]));
             
@@ -1134,11 +1190,11 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::getShearViscosity(
         {
             getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
             
-            const double mu_i = d_equation_of_shear_viscosity->
-                getShearViscosity(
-                    pressure,
-                    species_temperatures[si],
-                    species_molecular_properties_const_ptr);
+            const double mu_i = getShearViscosityOfSpecies(
+                pressure,
+                species_temperatures[si],
+                species_molecular_properties_const_ptr,
+                si);
             
             mu += *(volume_fractions[si])*mu_i;
         }
@@ -1151,11 +1207,11 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::getShearViscosity(
         {
             getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
             
-            const double mu_i = d_equation_of_shear_viscosity->
-                getShearViscosity(
-                    pressure,
-                    species_temperatures[si],
-                    species_molecular_properties_const_ptr);
+            const double mu_i = getShearViscosityOfSpecies(
+                pressure,
+                species_temperatures[si],
+                species_molecular_properties_const_ptr,
+                si);
             
             mu += *(volume_fractions[si])*mu_i;
             
@@ -1169,11 +1225,11 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::getShearViscosity(
         
         getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-        const double mu_last = d_equation_of_shear_viscosity->
-            getShearViscosity(
-                pressure,
-                species_temperatures[d_num_species - 1],
-                species_molecular_properties_const_ptr);
+        const double mu_last = getShearViscosityOfSpecies(
+            pressure,
+            species_temperatures[d_num_species - 1],
+            species_molecular_properties_const_ptr,
+            d_num_species - 1);
         
         mu += Z_last*mu_last;
     }
@@ -1364,13 +1420,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
@@ -1415,13 +1471,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
                 {
@@ -1482,13 +1538,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
                 {
@@ -1568,13 +1624,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
 #ifdef HAMERS_ENABLE_SIMD
                 #pragma omp simd
@@ -1597,13 +1653,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_shear_viscosity->
-                computeShearViscosity(
-                    data_shear_viscosity_species,
-                    data_pressure,
-                    data_temperature_species,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeShearViscosityOfSpecies(
+                data_shear_viscosity_species,
+                data_pressure,
+                data_temperature_species,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
 #ifdef HAMERS_ENABLE_SIMD
             #pragma omp simd
@@ -1647,13 +1703,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
                 {
@@ -1684,13 +1740,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_shear_viscosity->
-                computeShearViscosity(
-                    data_shear_viscosity_species,
-                    data_pressure,
-                    data_temperature_species,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeShearViscosityOfSpecies(
+                data_shear_viscosity_species,
+                data_pressure,
+                data_temperature_species,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
             {
@@ -1750,13 +1806,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
                 
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_shear_viscosity->
-                    computeShearViscosity(
-                        data_shear_viscosity_species,
-                        data_pressure,
-                        data_temperature_species,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeShearViscosityOfSpecies(
+                    data_shear_viscosity_species,
+                    data_pressure,
+                    data_temperature_species,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
                 {
@@ -1796,13 +1852,13 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_shear_viscosity->
-                computeShearViscosity(
-                    data_shear_viscosity_species,
-                    data_pressure,
-                    data_temperature_species,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeShearViscosityOfSpecies(
+                data_shear_viscosity_species,
+                data_pressure,
+                data_temperature_species,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
             {
@@ -1864,3 +1920,59 @@ EquationOfShearViscosityMixingRulesChapmanEnskog::getSpeciesMolecularProperties(
     *(species_molecular_properties[1]) = d_species_sigma[species_index];
     *(species_molecular_properties[2]) = d_species_M[species_index];
 }
+
+
+/*
+ * Compute the shear viscosity of a species from its table or from the equation of shear viscosity.
+ */
+double
+EquationOfShearViscosityMixingRulesChapmanEnskog::getShearViscosityOfSpecies(
+    const double* const pressure,
+    const double* const temperature,
+    const std::vector<const double*>& species_molecular_properties,
+    const int species_index) const
+{
+    if (d_temperature_table_settings.d_use_temperature_tables)
+    {
+        return d_species_shear_viscosity_tables[species_index]->getValue(*temperature);
+    }
+    
+    return d_equation_of_shear_viscosity->
+        getShearViscosity(
+            pressure,
+            temperature,
+            species_molecular_properties);
+}
+
+
+/*
+ * Compute the shear viscosity of a species from its table or from the equation of shear viscosity.
+ */
+void
+EquationOfShearViscosityMixingRulesChapmanEnskog::computeShearViscosityOfSpecies(
+    boost::shared_ptr<pdat::CellData<double> >& data_shear_viscosity_species,
+    const boost::shared_ptr<pdat::CellData<double> >& data_pressure,
+    const boost::shared_ptr<pdat::CellData<double> >& data_temperature,
+    const std::vector<const double*>& species_molecular_properties,
+    const int species_index,
+    const hier::Box& domain) const
+{
+    if (d_temperature_table_settings.d_use_temperature_tables)
+    {
+        d_species_shear_viscosity_tables[species_index]->
+            computeCellData(
+                data_shear_viscosity_species,
+                data_temperature,
+                domain);
+    }
+    else
+    {
+        d_equation_of_shear_viscosity->
+            computeShearViscosity(
+                data_shear_viscosity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties,
+                domain);
+    }
+}
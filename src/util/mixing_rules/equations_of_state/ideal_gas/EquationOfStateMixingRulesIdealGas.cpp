@@ -193,6 +193,34 @@ EquationOfStateMixingRulesIdealGas::putToRestart(
 }
 
 
+/*
+ * Start caching the thermodynamic properties of the mixture computed from the given cell data of
+ * species fractions.
+ */
+void
+EquationOfStateMixingRulesIdealGas::startCachingMixtureThermodynamicProperties(
+    const boost::shared_ptr<pdat::CellData<double> >& data_species_fractions) const
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(data_species_fractions);
+#endif
+    
+    d_data_species_fractions_cached = data_species_fractions;
+    d_data_mixture_thermo_properties_cached.reset();
+}
+
+
+/*
+ * Stop caching the thermodynamic properties of the mixture and release the cached data.
+ */
+void
+EquationOfStateMixingRulesIdealGas::stopCachingMixtureThermodynamicProperties() const
+{
+    d_data_species_fractions_cached.reset();
+    d_data_mixture_thermo_properties_cached.reset();
+}
+
+
 /*
  * Compute the pressure of the mixture with isothermal and isobaric equilibria assumptions.
  */
@@ -295,15 +323,12 @@ EquationOfStateMixingRulesIdealGas::computePressure(
      * Get the mixture thermodyanmic properties.
      */
     
-    const int num_thermo_properties = getNumberOfMixtureThermodynamicProperties();
-    
-    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties(
-        new pdat::CellData<double>(interior_box, num_thermo_properties, num_ghosts_min));
-    
-    computeMixtureThermodynamicProperties(
-        data_mixture_thermo_properties,
-        data_mass_fractions,
-        domain);
+    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties =
+        getCellDataMixtureThermodynamicProperties(
+            data_mass_fractions,
+            interior_box,
+            num_ghosts_min,
+            domain);
     
     d_equation_of_state->computePressure(
         data_pressure,
@@ -513,15 +538,12 @@ EquationOfStateMixingRulesIdealGas::computePressure(
      * Get the mixture thermodyanmic properties.
      */
     
-    const int num_thermo_properties = getNumberOfMixtureThermodynamicProperties();
-    
-    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties(
-        new pdat::CellData<double>(interior_box, num_thermo_properties, num_ghosts_min));
-    
-    computeMixtureThermodynamicProperties(
-        data_mixture_thermo_properties,
-        data_volume_fractions,
-        domain);
+    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties =
+        getCellDataMixtureThermodynamicProperties(
+            data_volume_fractions,
+            interior_box,
+            num_ghosts_min,
+            domain);
     
     d_equation_of_state->computePressure(
         data_pressure,
@@ -729,15 +751,12 @@ EquationOfStateMixingRulesIdealGas::computeSoundSpeed(
      * Get the mixture thermodyanmic properties.
      */
     
-    const int num_thermo_properties = getNumberOfMixtureThermodynamicProperties();
-    
-    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties(
-        new pdat::CellData<double>(interior_box, num_thermo_properties, num_ghosts_min));
-    
-    computeMixtureThermodynamicProperties(
-        data_mixture_thermo_properties,
-        data_mass_fractions,
-        domain);
+    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties =
+        getCellDataMixtureThermodynamicProperties(
+            data_mass_fractions,
+            interior_box,
+            num_ghosts_min,
+            domain);
     
     d_equation_of_state->computeSoundSpeed(
         data_sound_speed,
@@ -947,15 +966,12 @@ EquationOfStateMixingRulesIdealGas::computeSoundSpeed(
      * Get the mixture thermodyanmic properties.
      */
     
-    const int num_thermo_properties = getNumberOfMixtureThermodynamicProperties();
-    
-    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties(
-        new pdat::CellData<double>(interior_box, num_thermo_properties, num_ghosts_min));
-    
-    computeMixtureThermodynamicProperties(
-        data_mixture_thermo_properties,
-        data_volume_fractions,
-        domain);
+    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties =
+        getCellDataMixtureThermodynamicProperties(
+            data_volume_fractions,
+            interior_box,
+            num_ghosts_min,
+            domain);
     
     d_equation_of_state->computeSoundSpeed(
         data_sound_speed,
@@ -1163,15 +1179,12 @@ EquationOfStateMixingRulesIdealGas::computeInternalEnergy(
      * Get the mixture thermodyanmic properties.
      */
     
-    const int num_thermo_properties = getNumberOfMixtureThermodynamicProperties();
-    
-    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties(
-        new pdat::CellData<double>(interior_box, num_thermo_properties, num_ghosts_min));
-    
-    computeMixtureThermodynamicProperties(
-        data_mixture_thermo_properties,
-        data_mass_fractions,
-        domain);
+    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties =
+        getCellDataMixtureThermodynamicProperties(
+            data_mass_fractions,
+            interior_box,
+            num_ghosts_min,
+            domain);
     
     d_equation_of_state->computeInternalEnergy(
         data_internal_energy,
@@ -1381,15 +1394,12 @@ EquationOfStateMixingRulesIdealGas::computeInternalEnergy(
      * Get the mixture thermodyanmic properties.
      */
     
-    const int num_thermo_properties = getNumberOfMixtureThermodynamicProperties();
-    
-    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties(
-        new pdat::CellData<double>(interior_box, num_thermo_properties, num_ghosts_min));
-    
-    computeMixtureThermodynamicProperties(
-        data_mixture_thermo_properties,
-        data_volume_fractions,
-        domain);
+    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties =
+        getCellDataMixtureThermodynamicProperties(
+            data_volume_fractions,
+            interior_box,
+            num_ghosts_min,
+            domain);
     
     d_equation_of_state->computeInternalEnergy(
         data_internal_energy,
@@ -1597,15 +1607,12 @@ EquationOfStateMixingRulesIdealGas::computeTemperature(
      * Get the mixture thermodyanmic properties.
      */
     
-    const int num_thermo_properties = getNumberOfMixtureThermodynamicProperties();
-    
-    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties(
-        new pdat::CellData<double>(interior_box, num_thermo_properties, num_ghosts_min));
-    
-    computeMixtureThermodynamicProperties(
-        data_mixture_thermo_properties,
-        data_mass_fractions,
-        domain);
+    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties =
+        getCellDataMixtureThermodynamicProperties(
+            data_mass_fractions,
+            interior_box,
+            num_ghosts_min,
+            domain);
     
     d_equation_of_state->computeTemperature(
         data_temperature,
@@ -1813,15 +1820,12 @@ EquationOfStateMixingRulesIdealGas::computeInternalEnergyFromTemperature(
      * Get the mixture thermodyanmic properties.
      */
     
-    const int num_thermo_properties = getNumberOfMixtureThermodynamicProperties();
-    
-    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties(
-        new pdat::CellData<double>(interior_box, num_thermo_properties, num_ghosts_min));
-    
-    computeMixtureThermodynamicProperties(
-        data_mixture_thermo_properties,
-        data_mass_fractions,
-        domain);
+    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties =
+        getCellDataMixtureThermodynamicProperties(
+            data_mass_fractions,
+            interior_box,
+            num_ghosts_min,
+            domain);
     
     d_equation_of_state->computeInternalEnergyFromTemperature(
         data_internal_energy,
@@ -2847,15 +2851,12 @@ EquationOfStateMixingRulesIdealGas::computeMixtureDensity(
      * Get the mixture thermodyanmic properties.
      */
     
-    const int num_thermo_properties = getNumberOfMixtureThermodynamicProperties();
-    
-    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties(
-        new pdat::CellData<double>(interior_box, num_thermo_properties, num_ghosts_min));
-    
-    computeMixtureThermodynamicProperties(
-        data_mixture_thermo_properties,
-        data_mass_fractions,
-        domain);
+    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties =
+        getCellDataMixtureThermodynamicProperties(
+            data_mass_fractions,
+            interior_box,
+            num_ghosts_min,
+            domain);
     
     d_equation_of_state->computeDensity(
         data_mixture_density,
@@ -2959,6 +2960,170 @@ EquationOfStateMixingRulesIdealGas::computeMixtureDensity(
 }
 
 
+/*
+ * Compute the pressure of the mixture with isothermal and isobaric equilibria assumptions for a
+ * batch of values stored in contiguous arrays.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computePressure(
+    double* const pressure,
+    const double* const density,
+    const double* const internal_energy,
+    const double* const mass_fractions,
+    const int num_values) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT(num_values >= 0);
+#endif
+    
+    std::vector<double> c_p(num_values);
+    std::vector<double> c_v(num_values);
+    
+    computeMixtureSpecificHeatCapacities(
+        c_p.data(),
+        c_v.data(),
+        mass_fractions,
+        num_values);
+    
+    const double* const c_p_mix = c_p.data();
+    const double* const c_v_mix = c_v.data();
+    
+#ifdef HAMERS_ENABLE_SIMD
+    #pragma omp simd
+#endif
+    for (int n = 0; n < num_values; n++)
+    {
+        const double gamma = c_p_mix[n]/c_v_mix[n];
+        pressure[n] = (gamma - double(1))*density[n]*internal_energy[n];
+    }
+}
+
+
+/*
+ * Compute the temperature of the mixture with isothermal and isobaric equilibria assumptions for
+ * a batch of values stored in contiguous arrays.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computeTemperature(
+    double* const temperature,
+    const double* const density,
+    const double* const pressure,
+    const double* const mass_fractions,
+    const int num_values) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT(num_values >= 0);
+#endif
+    
+    std::vector<double> c_p(num_values);
+    std::vector<double> c_v(num_values);
+    
+    computeMixtureSpecificHeatCapacities(
+        c_p.data(),
+        c_v.data(),
+        mass_fractions,
+        num_values);
+    
+    const double* const c_p_mix = c_p.data();
+    const double* const c_v_mix = c_v.data();
+    
+#ifdef HAMERS_ENABLE_SIMD
+    #pragma omp simd
+#endif
+    for (int n = 0; n < num_values; n++)
+    {
+        const double R = c_p_mix[n] - c_v_mix[n];
+        temperature[n] = pressure[n]/(R*density[n]);
+    }
+}
+
+
+/*
+ * Compute the specific internal energy of the mixture from temperature with isothermal and
+ * isobaric equilibria assumptions for a batch of values stored in contiguous arrays.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computeInternalEnergyFromTemperature(
+    double* const internal_energy,
+    const double* const density,
+    const double* const temperature,
+    const double* const mass_fractions,
+    const int num_values) const
+{
+    NULL_USE(density);
+    
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT(num_values >= 0);
+#endif
+    
+    std::vector<double> c_p(num_values);
+    std::vector<double> c_v(num_values);
+    
+    computeMixtureSpecificHeatCapacities(
+        c_p.data(),
+        c_v.data(),
+        mass_fractions,
+        num_values);
+    
+    const double* const c_v_mix = c_v.data();
+    
+#ifdef HAMERS_ENABLE_SIMD
+    #pragma omp simd
+#endif
+    for (int n = 0; n < num_values; n++)
+    {
+        internal_energy[n] = c_v_mix[n]*temperature[n];
+    }
+}
+
+
+/*
+ * Compute the density of mixture with isothermal and isobaric equilibria assumptions for a batch
+ * of values stored in contiguous arrays.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computeMixtureDensity(
+    double* const mixture_density,
+    const double* const pressure,
+    const double* const temperature,
+    const double* const mass_fractions,
+    const int num_values) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT(num_values >= 0);
+#endif
+    
+    std::vector<double> c_p(num_values);
+    std::vector<double> c_v(num_values);
+    
+    computeMixtureSpecificHeatCapacities(
+        c_p.data(),
+        c_v.data(),
+        mass_fractions,
+        num_values);
+    
+    const double* const c_p_mix = c_p.data();
+    const double* const c_v_mix = c_v.data();
+    
+#ifdef HAMERS_ENABLE_SIMD
+    #pragma omp simd
+#endif
+    for (int n = 0; n < num_values; n++)
+    {
+        const double R = c_p_mix[n] - c_v_mix[n];
+        mixture_density[n] = pressure[n]/(R*temperature[n]);
+    }
+}
+
+
 /*
  * Get the thermodynamic properties of a species.
  */
@@ -3155,6 +3320,99 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicProperties(
 }
 
 
+/*
+ * Get the cell data of the thermodynamic properties of the mixture. The cached data is returned
+ * if the species fractions are the ones being cached. Otherwise, the data is computed with the
+ * given number of ghost cells.
+ */
+boost::shared_ptr<pdat::CellData<double> >
+EquationOfStateMixingRulesIdealGas::getCellDataMixtureThermodynamicProperties(
+    const boost::shared_ptr<pdat::CellData<double> >& data_species_fraction,
+    const hier::Box& interior_box,
+    const hier::IntVector& num_ghosts_min,
+    const hier::Box& domain) const
+{
+    const int num_thermo_properties = getNumberOfMixtureThermodynamicProperties();
+    
+    if (d_data_species_fractions_cached &&
+        (data_species_fraction == d_data_species_fractions_cached) &&
+        interior_box.isSpatiallyEqual(data_species_fraction->getBox()))
+    {
+        /*
+         * Compute the mixture thermodynamic properties in all cells of the species fractions once
+         * and reuse them until the caching is stopped.
+         */
+        
+        if (!d_data_mixture_thermo_properties_cached)
+        {
+            d_data_mixture_thermo_properties_cached.reset(
+                new pdat::CellData<double>(
+                    interior_box,
+                    num_thermo_properties,
+                    data_species_fraction->getGhostCellWidth()));
+            
+            const hier::Box empty_box(d_dim);
+            
+            computeMixtureThermodynamicProperties(
+                d_data_mixture_thermo_properties_cached,
+                data_species_fraction,
+                empty_box);
+        }
+        
+        return d_data_mixture_thermo_properties_cached;
+    }
+    
+    boost::shared_ptr<pdat::CellData<double> > data_mixture_thermo_properties(
+        new pdat::CellData<double>(interior_box, num_thermo_properties, num_ghosts_min));
+    
+    computeMixtureThermodynamicProperties(
+        data_mixture_thermo_properties,
+        data_species_fraction,
+        domain);
+    
+    return data_mixture_thermo_properties;
+}
+
+
+/*
+ * Compute the isobaric and isochoric specific heat capacities of the mixture with mass fractions
+ * for a batch of values stored in contiguous arrays.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computeMixtureSpecificHeatCapacities(
+    double* const c_p,
+    double* const c_v,
+    const double* const mass_fractions,
+    const int num_values) const
+{
+#ifdef HAMERS_ENABLE_SIMD
+    #pragma omp simd
+#endif
+    for (int n = 0; n < num_values; n++)
+    {
+        c_p[n] = double(0);
+        c_v[n] = double(0);
+    }
+    
+    for (int si = 0; si < d_num_species; si++)
+    {
+        const double c_p_species = d_species_c_p[si];
+        const double c_v_species = d_species_c_v[si];
+        
+        const double* const Y = mass_fractions + si*num_values;
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int n = 0; n < num_values; n++)
+        {
+            c_p[n] += Y[n]*c_p_species;
+            c_v[n] += Y[n]*c_v_species;
+        }
+    }
+}
+
+
 /*
  * Compute the thermodynamic properties of the mixture with mass fractions.
  */
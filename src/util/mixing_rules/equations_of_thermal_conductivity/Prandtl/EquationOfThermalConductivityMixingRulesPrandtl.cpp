@@ -11,6 +11,9 @@ EquationOfThermalConductivityMixingRulesPrandtl::EquationOfThermalConductivityMi
             dim,
             num_species,
             mixing_closure_model,
+            equation_of_thermal_conductivity_mixing_rules_db),
+        d_temperature_table_settings(
+            object_name,
             equation_of_thermal_conductivity_mixing_rules_db)
 {
     /*
@@ -194,6 +197,51 @@ EquationOfThermalConductivityMixingRulesPrandtl::EquationOfThermalConductivityMi
         dim,
         d_equation_of_shear_viscosity_mixing_rules->
             getEquationOfShearViscosity()));
+    
+    /*
+     * Tabulate the thermal conductivity of each species in temperature if required.
+     */
+    
+    if (d_temperature_table_settings.d_use_temperature_tables)
+    {
+        const boost::shared_ptr<EquationOfThermalConductivity> equation_of_thermal_conductivity =
+            d_equation_of_thermal_conductivity;
+        
+        d_species_thermal_conductivity_tables.reserve(d_num_species);
+        
+        for (int si = 0; si < d_num_species; si++)
+        {
+            std::vector<double> species_molecular_properties(getNumberOfSpeciesMolecularProperties(si));
+            std::vector<double*> species_molecular_properties_ptr;
+            for (int mi = 0; mi < static_cast<int>(species_molecular_properties.size()); mi++)
+            {
+                species_molecular_properties_ptr.push_back(&species_molecular_properties[mi]);
+            }
+            
+            getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
+            
+            d_species_thermal_conductivity_tables.push_back(boost::make_shared<TemperatureTable>(
+                d_object_name + "::d_species_thermal_conductivity_tables",
+                d_dim,
+                d_temperature_table_settings,
+                [equation_of_thermal_conductivity, species_molecular_properties](const double T) -> double
+                {
+                    std::vector<const double*> molecular_properties_const_ptr;
+                    for (int mi = 0; mi < static_cast<int>(species_molecular_properties.size()); mi++)
+                    {
+                        molecular_properties_const_ptr.push_back(&species_molecular_properties[mi]);
+                    }
+                    
+                    // The shear viscosities of the species are independent of pressure.
+                    const double p = double(0);
+                    
+                    return equation_of_thermal_conductivity->getThermalConductivity(
+                        &p,
+                        &T,
+                        molecular_properties_const_ptr);
+                }));
+        }
+    }
 }
 
 
@@ -340,11 +388,11 @@ EquationOfThermalConductivityMixingRulesPrandtl::getThermalConductivity(
         {
             getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
             
-            const double kappa_i = d_equation_of_thermal_conductivity->
-                getThermalConductivity(
-                    pressure,
-                    temperature,
-                    species_molecular_properties_const_ptr);
+            const double kappa_i = getThermalConductivityOfSpecies(
+                pressure,
+                temperature,
+                species_molecular_properties_const_ptr,
+                si);
             
             const double weight = *(mass_fractions[si])/(sqrt(species_molecular_properties[2]));
             
@@ -360,11 +408,11 @@ EquationOfThermalConductivityMixingRulesPrandtl::getThermalConductivity(
         {
             getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
             
-            const double kappa_i = d_equation_of_thermal_conductivity->
-                getThermalConductivity(
-                    pressure,
-                    temperature,
-                    species_molecular_properties_const_ptr);
+            const double kappa_i = getThermalConductivityOfSpecies(
+                pressure,
+                temperature,
+                species_molecular_properties_const_ptr,
+                si);
             
             const double weight = *(mass_fractions[si])/(sqrt(species_molecular_properties[2]));
             
@@ -380,11 +428,11 @@ EquationOfThermalConductivityMixingRulesPrandtl::getThermalConductivity(
          */
         getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
         
-        const double kappa_last = d_equation_of_thermal_conductivity->
-            getThermalConductivity(
-                pressure,
-                temperature,
-                species_molecular_properties_const_ptr);
+        const double kappa_last = getThermalConductivityOfSpecies(
+            pressure,
+            temperature,
+            species_molecular_properties_const_ptr,
+            d_num_species - 1);
         
         const double weight = Y_last/(sqrt(species_molecular_properties[2]));
         
@@ -583,13 +631,13 @@ EquationOfThermalConductivityMixingRulesPrandtl::computeThermalConductivity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_thermal_conductivity->
-                    computeThermalConductivity(
-                        data_thermal_conductivity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeThermalConductivityOfSpecies(
+                    data_thermal_conductivity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -649,13 +697,13 @@ EquationOfThermalConductivityMixingRulesPrandtl::computeThermalConductivity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_thermal_conductivity->
-                    computeThermalConductivity(
-                        data_thermal_conductivity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeThermalConductivityOfSpecies(
+                    data_thermal_conductivity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -735,13 +783,13 @@ EquationOfThermalConductivityMixingRulesPrandtl::computeThermalConductivity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_thermal_conductivity->
-                    computeThermalConductivity(
-                        data_thermal_conductivity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeThermalConductivityOfSpecies(
+                    data_thermal_conductivity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -845,13 +893,13 @@ EquationOfThermalConductivityMixingRulesPrandtl::computeThermalConductivity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_thermal_conductivity->
-                    computeThermalConductivity(
-                        data_thermal_conductivity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeThermalConductivityOfSpecies(
+                    data_thermal_conductivity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -876,13 +924,13 @@ EquationOfThermalConductivityMixingRulesPrandtl::computeThermalConductivity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_thermal_conductivity->
-                computeThermalConductivity(
-                    data_thermal_conductivity_species,
-                    data_pressure,
-                    data_temperature,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeThermalConductivityOfSpecies(
+                data_thermal_conductivity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             const double factor = double(1)/(sqrt(species_molecular_properties[2]));
             
@@ -932,13 +980,13 @@ EquationOfThermalConductivityMixingRulesPrandtl::computeThermalConductivity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_thermal_conductivity->
-                    computeThermalConductivity(
-                        data_thermal_conductivity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeThermalConductivityOfSpecies(
+                    data_thermal_conductivity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -969,13 +1017,13 @@ EquationOfThermalConductivityMixingRulesPrandtl::computeThermalConductivity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_thermal_conductivity->
-                computeThermalConductivity(
-                    data_thermal_conductivity_species,
-                    data_pressure,
-                    data_temperature,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeThermalConductivityOfSpecies(
+                data_thermal_conductivity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             const double factor = double(1)/(sqrt(species_molecular_properties[2]));
             
@@ -1041,13 +1089,13 @@ EquationOfThermalConductivityMixingRulesPrandtl::computeThermalConductivity(
             {
                 getSpeciesMolecularProperties(species_molecular_properties_ptr, si);
                 
-                d_equation_of_thermal_conductivity->
-                    computeThermalConductivity(
-                        data_thermal_conductivity_species,
-                        data_pressure,
-                        data_temperature,
-                        species_molecular_properties_const_ptr,
-                        domain);
+                computeThermalConductivityOfSpecies(
+                    data_thermal_conductivity_species,
+                    data_pressure,
+                    data_temperature,
+                    species_molecular_properties_const_ptr,
+                    si,
+                    domain);
                 
                 const double factor = double(1)/(sqrt(species_molecular_properties[2]));
                 
@@ -1085,13 +1133,13 @@ EquationOfThermalConductivityMixingRulesPrandtl::computeThermalConductivity(
             
             getSpeciesMolecularProperties(species_molecular_properties_ptr, d_num_species - 1);
             
-            d_equation_of_thermal_conductivity->
-                computeThermalConductivity(
-                    data_thermal_conductivity_species,
-                    data_pressure,
-                    data_temperature,
-                    species_molecular_properties_const_ptr,
-                    domain);
+            computeThermalConductivityOfSpecies(
+                data_thermal_conductivity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties_const_ptr,
+                d_num_species - 1,
+                domain);
             
             const double factor = double(1)/(sqrt(species_molecular_properties[2]));
             
@@ -1190,3 +1238,59 @@ EquationOfThermalConductivityMixingRulesPrandtl::getSpeciesMolecularProperties(
         *(species_molecular_properties[3 + mi]) = mu_molecular_properties[mi];
     }
 }
+
+
+/*
+ * Compute the thermal conductivity of a species from its table or from the equation of thermal conductivity.
+ */
+double
+EquationOfThermalConductivityMixingRulesPrandtl::getThermalConductivityOfSpecies(
+    const double* const pressure,
+    const double* const temperature,
+    const std::vector<const double*>& species_molecular_properties,
+    const int species_index) const
+{
+    if (d_temperature_table_settings.d_use_temperature_tables)
+    {
+        return d_species_thermal_conductivity_tables[species_index]->getValue(*temperature);
+    }
+    
+    return d_equation_of_thermal_conductivity->
+        getThermalConductivity(
+            pressure,
+            temperature,
+            species_molecular_properties);
+}
+
+
+/*
+ * Compute the thermal conductivity of a species from its table or from the equation of thermal conductivity.
+ */
+void
+EquationOfThermalConductivityMixingRulesPrandtl::computeThermalConductivityOfSpecies(
+    boost::shared_ptr<pdat::CellData<double> >& data_thermal_conductivity_species,
+    const boost::shared_ptr<pdat::CellData<double> >& data_pressure,
+    const boost::shared_ptr<pdat::CellData<double> >& data_temperature,
+    const std::vector<const double*>& species_molecular_properties,
+    const int species_index,
+    const hier::Box& domain) const
+{
+    if (d_temperature_table_settings.d_use_temperature_tables)
+    {
+        d_species_thermal_conductivity_tables[species_index]->
+            computeCellData(
+                data_thermal_conductivity_species,
+                data_temperature,
+                domain);
+    }
+    else
+    {
+        d_equation_of_thermal_conductivity->
+            computeThermalConductivity(
+                data_thermal_conductivity_species,
+                data_pressure,
+                data_temperature,
+                species_molecular_properties,
+                domain);
+    }
+}
@@ -0,0 +1,345 @@
+#include "util/patch_tiles/PatchTiles.hpp"
+
+#include "SAMRAI/hier/BoxGeometry.h"
+#include "SAMRAI/hier/BoxOverlap.h"
+#include "SAMRAI/hier/PatchDataFactory.h"
+#include "SAMRAI/hier/PatchDescriptor.h"
+#include "SAMRAI/hier/VariableDatabase.h"
+
+#include "boost/make_shared.hpp"
+#include <algorithm>
+
+const double PatchTiles::s_max_halo_to_tile_volume_ratio = double(1);
+
+
+/*
+ * Get the number of tiles of a patch box.
+ */
+int
+PatchTiles::getNumberOfTiles(
+    const hier::Box& patch_box,
+    const hier::IntVector& tile_size)
+{
+    TBOX_ASSERT(tile_size > hier::IntVector::getZero(tile_size.getDim()));
+    
+    const hier::IntVector patch_dims = patch_box.numberCells();
+    
+    int num_tiles = 1;
+    
+    for (int di = 0; di < patch_box.getDim().getValue(); di++)
+    {
+        num_tiles *= (patch_dims[di] + tile_size[di] - 1)/tile_size[di];
+    }
+    
+    return num_tiles;
+}
+
+
+/*
+ * Get the box of the tile with the given index.
+ */
+hier::Box
+PatchTiles::getTileBox(
+    const hier::Box& patch_box,
+    const hier::IntVector& tile_size,
+    const int tile_index)
+{
+    TBOX_ASSERT(tile_size > hier::IntVector::getZero(tile_size.getDim()));
+    
+    const hier::IntVector patch_dims = patch_box.numberCells();
+    
+    hier::Index tile_lo(patch_box.lower());
+    hier::Index tile_hi(patch_box.upper());
+    
+    int tile_idx = tile_index;
+    
+    for (int di = 0; di < patch_box.getDim().getValue(); di++)
+    {
+        const int num_tiles_di = (patch_dims[di] + tile_size[di] - 1)/tile_size[di];
+        const int tile_idx_di = tile_idx%num_tiles_di;
+        tile_idx /= num_tiles_di;
+        
+        tile_lo[di] = patch_box.lower()[di] + tile_idx_di*tile_size[di];
+        tile_hi[di] = std::min(tile_lo[di] + tile_size[di] - 1, patch_box.upper()[di]);
+    }
+    
+    hier::Box tile_box(patch_box);
+    tile_box.setLower(tile_lo);
+    tile_box.setUpper(tile_hi);
+    
+    return tile_box;
+}
+
+
+/*
+ * Check whether processing a patch box tile by tile is expected to pay off.
+ */
+bool
+PatchTiles::isTilingBeneficial(
+    const hier::Box& patch_box,
+    const hier::IntVector& tile_size,
+    const hier::IntVector& num_ghosts)
+{
+    if (!(tile_size > hier::IntVector::getZero(tile_size.getDim())) ||
+        patch_box.numberCells() <= tile_size)
+    {
+        return false;
+    }
+    
+    const hier::IntVector patch_dims = patch_box.numberCells();
+    
+    double num_cells_tile = double(1);
+    double num_cells_tile_ghost_box = double(1);
+    
+    for (int di = 0; di < patch_box.getDim().getValue(); di++)
+    {
+        const int tile_dim = std::min(tile_size[di], patch_dims[di]);
+        
+        num_cells_tile *= double(tile_dim);
+        num_cells_tile_ghost_box *= double(tile_dim + 2*num_ghosts[di]);
+    }
+    
+    return (num_cells_tile_ghost_box - num_cells_tile) <=
+        s_max_halo_to_tile_volume_ratio*num_cells_tile;
+}
+
+
+/*
+ * Get the cached tile for a tile box of a patch with the patch data of the given indices allocated.
+ */
+hier::Patch&
+PatchTiles::getTile(
+    const hier::Patch& patch,
+    const hier::Box& tile_box,
+    const std::vector<int>& data_ids)
+{
+    hier::VariableDatabase* variable_db = hier::VariableDatabase::getDatabase();
+    
+    const tbox::Dimension& dim = tile_box.getDim();
+    
+    const hier::IntVector tile_dims = tile_box.numberCells();
+    
+    /*
+     * Find the cached tile with the shape of the tile box or create it.
+     */
+    
+    int tile_index = -1;
+    
+    for (int ti = 0; ti < static_cast<int>(d_tiles.size()); ti++)
+    {
+        if (d_tiles[ti]->getBox().numberCells() == tile_dims)
+        {
+            tile_index = ti;
+            break;
+        }
+    }
+    
+    if (tile_index < 0)
+    {
+        hier::Index tile_lo(dim, 0);
+        hier::Index tile_hi(dim, 0);
+        
+        for (int di = 0; di < dim.getValue(); di++)
+        {
+            tile_hi[di] = tile_dims[di] - 1;
+        }
+        
+        hier::Box box(tile_box);
+        box.setLower(tile_lo);
+        box.setUpper(tile_hi);
+        
+        d_tiles.push_back(boost::make_shared<hier::Patch>(
+            box,
+            variable_db->getPatchDescriptor()));
+        
+        d_tile_data_variables.push_back(std::vector<boost::shared_ptr<hier::Variable> >());
+        d_tile_data_ghost_widths.push_back(std::vector<hier::IntVector>());
+        d_tile_data.push_back(std::vector<boost::shared_ptr<hier::PatchData> >());
+        
+        tile_index = static_cast<int>(d_tiles.size()) - 1;
+    }
+    
+    hier::Patch& tile = *d_tiles[tile_index];
+    
+    tile.setPatchGeometry(patch.getPatchGeometry());
+    tile.setPatchLevelNumber(patch.getPatchLevelNumber());
+    
+    /*
+     * Bind the data of the given indices to the data of the tile with the same variable and ghost
+     * cell width. The data are allocated if the tile has no such data yet.
+     */
+    
+    std::vector<boost::shared_ptr<hier::Variable> >& tile_data_variables =
+        d_tile_data_variables[tile_index];
+    
+    std::vector<hier::IntVector>& tile_data_ghost_widths = d_tile_data_ghost_widths[tile_index];
+    
+    std::vector<boost::shared_ptr<hier::PatchData> >& tile_data = d_tile_data[tile_index];
+    
+    for (int i = 0; i < static_cast<int>(data_ids.size()); i++)
+    {
+        boost::shared_ptr<hier::Variable> variable;
+        variable_db->mapIndexToVariable(data_ids[i], variable);
+        
+        TBOX_ASSERT(variable);
+        
+        const boost::shared_ptr<hier::PatchDataFactory> factory(
+            tile.getPatchDescriptor()->getPatchDataFactory(data_ids[i]));
+        
+        const hier::IntVector& ghost_width = factory->getGhostCellWidth();
+        
+        int data_index = -1;
+        
+        for (int ti = 0; ti < static_cast<int>(tile_data.size()); ti++)
+        {
+            if (tile_data_variables[ti] == variable && tile_data_ghost_widths[ti] == ghost_width)
+            {
+                data_index = ti;
+                break;
+            }
+        }
+        
+        if (data_index < 0)
+        {
+            tile_data_variables.push_back(variable);
+            tile_data_ghost_widths.push_back(ghost_width);
+            tile_data.push_back(factory->allocate(tile));
+            
+            data_index = static_cast<int>(tile_data.size()) - 1;
+        }
+        
+        tile.setPatchData(data_ids[i], tile_data[data_index]);
+    }
+    
+    return tile;
+}
+
+
+/*
+ * Copy the data of the patch into the data of the tile for a tile box of the patch. The overlap is
+ * computed by the box geometry of the data so that the ghost cells of the tile data are filled for
+ * any data centering.
+ */
+void
+PatchTiles::copyPatchDataToTile(
+    hier::Patch& tile,
+    const hier::Patch& patch,
+    const hier::Box& tile_box,
+    const std::vector<int>& data_ids)
+{
+    const hier::Transformation transformation(getPatchToTileTransformation(tile, tile_box));
+    
+    for (int i = 0; i < static_cast<int>(data_ids.size()); i++)
+    {
+        const boost::shared_ptr<hier::PatchData> patch_data(patch.getPatchData(data_ids[i]));
+        const boost::shared_ptr<hier::PatchData> tile_data(tile.getPatchData(data_ids[i]));
+        
+        const boost::shared_ptr<hier::PatchDataFactory> factory(
+            tile.getPatchDescriptor()->getPatchDataFactory(data_ids[i]));
+        
+        const boost::shared_ptr<hier::BoxGeometry> patch_geometry(
+            factory->getBoxGeometry(patch.getBox()));
+        
+        const boost::shared_ptr<hier::BoxGeometry> tile_geometry(
+            factory->getBoxGeometry(tile.getBox()));
+        
+        const boost::shared_ptr<hier::BoxOverlap> overlap(
+            tile_geometry->calculateOverlap(
+                *patch_geometry,
+                patch_data->getGhostBox(),
+                tile_data->getGhostBox(),
+                true,
+                transformation));
+        
+        tile_data->copy(*patch_data, *overlap);
+        tile_data->setTime(patch_data->getTime());
+    }
+}
+
+
+/*
+ * Copy the data of the tile covered by the tile box back into the patch. The overlap is computed by
+ * the box geometry of the data so that it is restricted to the tile box for any data centering.
+ */
+void
+PatchTiles::copyTileDataToPatch(
+    hier::Patch& patch,
+    const hier::Patch& tile,
+    const hier::Box& tile_box,
+    const std::vector<int>& data_ids)
+{
+    const hier::Transformation transformation(getTileToPatchTransformation(tile, tile_box));
+    
+    for (int i = 0; i < static_cast<int>(data_ids.size()); i++)
+    {
+        const boost::shared_ptr<hier::PatchDataFactory> factory(
+            tile.getPatchDescriptor()->getPatchDataFactory(data_ids[i]));
+        
+        const boost::shared_ptr<hier::BoxGeometry> patch_geometry(
+            factory->getBoxGeometry(patch.getBox()));
+        
+        const boost::shared_ptr<hier::BoxGeometry> tile_geometry(
+            factory->getBoxGeometry(tile.getBox()));
+        
+        const boost::shared_ptr<hier::BoxOverlap> overlap(
+            patch_geometry->calculateOverlap(
+                *tile_geometry,
+                tile.getBox(),
+                tile_box,
+                true,
+                transformation));
+        
+        patch.getPatchData(data_ids[i])->copy(*tile.getPatchData(data_ids[i]), *overlap);
+    }
+}
+
+
+/*
+ * Get the transformation from the index space of the patch to the index space of the tile.
+ */
+hier::Transformation
+PatchTiles::getPatchToTileTransformation(
+    const hier::Patch& tile,
+    const hier::Box& tile_box)
+{
+    hier::IntVector offset(tile_box.getDim());
+    
+    for (int di = 0; di < tile_box.getDim().getValue(); di++)
+    {
+        offset[di] = tile.getBox().lower()[di] - tile_box.lower()[di];
+    }
+    
+    return hier::Transformation(offset);
+}
+
+
+/*
+ * Get the transformation from the index space of the tile to the index space of the patch.
+ */
+hier::Transformation
+PatchTiles::getTileToPatchTransformation(
+    const hier::Patch& tile,
+    const hier::Box& tile_box)
+{
+    hier::IntVector offset(tile_box.getDim());
+    
+    for (int di = 0; di < tile_box.getDim().getValue(); di++)
+    {
+        offset[di] = tile_box.lower()[di] - tile.getBox().lower()[di];
+    }
+    
+    return hier::Transformation(offset);
+}
+
+
+/*
+ * Release the cached tiles and their data.
+ */
+void
+PatchTiles::clearTiles()
+{
+    d_tiles.clear();
+    d_tile_data_variables.clear();
+    d_tile_data_ghost_widths.clear();
+    d_tile_data.clear();
+}